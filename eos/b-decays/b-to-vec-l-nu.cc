@@ -39,6 +39,7 @@
 #include <functional>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace eos
 {
@@ -203,21 +204,46 @@ namespace eos
         {
             b_to_vec_l_nu::Amplitudes result;
 
-            // NP contributions in EFT including tensor operator cf. [DSD2014], p. 3
+            amplitudes(&q2, 1, &result);
+
+            return result;
+        }
+
+        // compute the amplitudes at several values of q2, sharing the Wilson coefficients and the form factor evaluation
+        void amplitudes(const double * q2, const std::size_t & n, b_to_vec_l_nu::Amplitudes * result) const
+        {
             const WilsonCoefficients<ChargedCurrent> wc = this->wc(opt_l.value(), cp_conjugate);
+
+            // only the form factors that enter the amplitudes
+            FormFactors<PToV>::Values ff(FormFactors<PToV>::ff_v | FormFactors<PToV>::ff_a_0 | FormFactors<PToV>::ff_a_1 | FormFactors<PToV>::ff_a_12
+                    | FormFactors<PToV>::ff_t_1 | FormFactors<PToV>::ff_t_2 | FormFactors<PToV>::ff_t_3);
+            form_factors->evaluate(q2, n, ff);
+
+            for (std::size_t i = 0 ; i < n ; ++i)
+            {
+                result[i] = amplitudes(q2[i], wc, ff, i);
+            }
+        }
+
+        b_to_vec_l_nu::Amplitudes amplitudes(const double & q2, const WilsonCoefficients<ChargedCurrent> & wc,
+                const FormFactors<PToV>::Values & ff, const std::size_t & i) const
+        {
+            b_to_vec_l_nu::Amplitudes result;
+
+            // NP contributions in EFT including tensor operator cf. [DSD2014], p. 3
             const complex<double> gV_pl = wc.cvl() + wc.cvr();  // gV_pl = 1 + gV = 1 + VL + VR = cVL + cVR
             const complex<double> gV_mi = wc.cvl() - wc.cvr();  // gV_mi = 1 - gA = 1 + VL - VR = cVL - cVR
             const complex<double> gP = wc.csr() - wc.csl();
             const complex<double> TL = wc.ct();
 
             // form factors
-            const double aff0  = form_factors->a_0(q2);
-            const double aff1  = form_factors->a_1(q2);
-            const double aff12 = form_factors->a_12(q2);
-            const double vff   = form_factors->v(q2);
-            const double tff1  = form_factors->t_1(q2);
-            const double tff2  = form_factors->t_2(q2);
-            const double tff3  = form_factors->t_3(q2);
+            const double aff0  = ff.a_0[i];
+            const double aff1  = ff.a_1[i];
+            const double aff12 = ff.a_12[i];
+            const double vff   = ff.v[i];
+            const double tff1  = ff.t_1[i];
+            const double tff2  = ff.t_2[i];
+            const double tff3  = ff.t_3[i];
             // meson & lepton masses
             const double m_l = this->m_l();
             const double m_B = this->m_B();
@@ -281,7 +307,16 @@ namespace eos
         // define below integrated observables in generic form
         std::array<double, 12> _integrated_angular_observables(const double & q2_min, const double & q2_max) const
         {
-            std::function<std::array<double, 12> (const double &)> integrand(std::bind(&Implementation::_differential_angular_observables, this, std::placeholders::_1));
+            batch::fadd<12> integrand = [this] (const double * q2, std::array<double, 12> * result, const std::size_t & n)
+            {
+                std::vector<b_to_vec_l_nu::Amplitudes> amplitudes(n);
+                this->amplitudes(q2, n, amplitudes.data());
+
+                for (std::size_t i = 0 ; i < n ; ++i)
+                {
+                    result[i] = b_to_vec_l_nu::AngularObservables(amplitudes[i])._vv;
+                }
+            };
             // second argument of integrate1D is some power of 2
             return integrate1D(integrand, int_points, q2_min, q2_max);
         }
@@ -24,6 +24,9 @@
 #include <eos/utils/exception.hh>
 #include <eos/utils/gsl-interface.hh>
 #include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/mutex.hh>
 #include <eos/utils/observable_set.hh>
 #include <eos/utils/power_of.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
@@ -31,6 +34,7 @@
 #include <eos/utils/stringify.hh>
 #include <eos/utils/destringify.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
+#include <eos/utils/yaml-index.hh>
 
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
@@ -38,6 +42,7 @@
 
 #include <cmath>
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace fs = boost::filesystem;
@@ -2102,13 +2107,9 @@ namespace eos
         return std::bind(&Factory_::make, f, std::placeholders::_1, std::placeholders::_2);
     }
 
-    std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>>
-    load_constraint_entries()
+    fs::path
+    constraints_directory()
     {
-        using ValueType = std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>>::value_type;
-
-        std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>> result;
-
         fs::path base;
         if (std::getenv("EOS_TESTS_CONSTRAINTS"))
         {
@@ -2135,6 +2136,16 @@ namespace eos
             throw InternalError("Expect '" + base.string() + " to be a directory");
         }
 
+        return base;
+    }
+
+    std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>>
+    load_constraint_entries(const fs::path & base)
+    {
+        using ValueType = std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>>::value_type;
+
+        std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>> result;
+
         for (fs::directory_iterator f(base), f_end ; f != f_end ; ++f)
         {
             auto file_path = f->path();
@@ -2175,29 +2186,115 @@ namespace eos
         return result;
     }
 
+    /*
+     * Holds all known constraint entries.
+     *
+     * If the constraints directory holds an up-to-date index, as created by
+     * Constraints::create_index(), the entries are only deserialized on first use.
+     * Otherwise, all constraint files are parsed upon construction.
+     */
     class ConstraintEntries :
         public InstantiationPolicy<ConstraintEntries, Singleton>
     {
         private:
+            std::unique_ptr<YAMLIndex> _index;
+
+            // the deserialized entries, and all inserted entries
             std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>> _entries;
 
+            // true if _entries holds all entries of the constraint files
+            bool _complete;
+
+            Mutex _mutex;
+
             ConstraintEntries() :
-                _entries(load_constraint_entries())
+                _complete(false)
             {
+                const fs::path base = constraints_directory();
+
+                try
+                {
+                    _index.reset(new YAMLIndex(base.string(), (base / Constraints::index_name).string()));
+                }
+                catch (YAMLIndexError & e)
+                {
+                    Log::instance()->message("[ConstraintEntries]", ll_debug)
+                        << "Parsing all constraint files, since no index is available: " << e.what();
+                }
+
+                if (! _index)
+                {
+                    _entries = load_constraint_entries(base);
+                    _complete = true;
+                }
             }
 
             ~ConstraintEntries() = default;
 
+            std::shared_ptr<const ConstraintEntry> load(const unsigned & i) const
+            {
+                try
+                {
+                    YAML::Node node = YAML::Load(_index->entry(i));
+
+                    return std::shared_ptr<const ConstraintEntry>(ConstraintEntry::FromYAML(QualifiedName(_index->name(i)), node.begin()->second));
+                }
+                catch (ConstraintDeserializationError & e)
+                {
+                    throw ConstraintInputFileParseError(_index->file(i), e.what());
+                }
+            }
+
         public:
             friend class InstantiationPolicy<ConstraintEntries, Singleton>;
 
-            const std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>> & entries() const
+            // returns a snapshot, since find() and insert() modify the entries concurrently
+            std::map<QualifiedName, std::shared_ptr<const ConstraintEntry>> entries()
             {
+                Lock l(_mutex);
+
+                if (! _complete)
+                {
+                    for (unsigned i = 0, i_end = _index->size() ; i != i_end ; ++i)
+                    {
+                        QualifiedName name(_index->name(i));
+
+                        // do not replace inserted entries
+                        if (_entries.end() == _entries.find(name))
+                            _entries[name] = load(i);
+                    }
+
+                    _complete = true;
+                }
+
                 return _entries;
             }
 
+            std::shared_ptr<const ConstraintEntry> find(const QualifiedName & name)
+            {
+                Lock l(_mutex);
+
+                auto e = _entries.find(name);
+                if (_entries.end() != e)
+                    return e->second;
+
+                if (_complete)
+                    return {};
+
+                unsigned i = _index->find(name.str());
+                if (_index->size() == i)
+                    return {};
+
+                auto entry = load(i);
+                _entries[name] = entry;
+
+                return entry;
+            }
+
             void insert(const QualifiedName & key, const std::shared_ptr<const ConstraintEntry> & value)
             {
+                Lock l(_mutex);
+
                 _entries[key] = value;
             }
     };
@@ -2205,13 +2302,11 @@ namespace eos
     Constraint
     Constraint::make(const QualifiedName & name, const Options & options)
     {
-        auto & entries = ConstraintEntries::instance()->entries();
-
-        auto e = entries.find(name);
-        if (e == entries.end())
+        auto entry = ConstraintEntries::instance()->find(name);
+        if (! entry)
             throw UnknownConstraintError(name);
 
-        return e->second->make(e->first, name.options() + options); // options supersede name.options
+        return entry->make(entry->name(), name.options() + options); // options supersede name.options
     }
 
     template <>
@@ -2266,6 +2361,14 @@ namespace eos
         return i->second;
     }
 
+    const char * Constraints::index_name = "constraints.index";
+
+    void
+    Constraints::create_index(const std::string & directory)
+    {
+        YAMLIndex::create(directory, (fs::path(directory) / index_name).string());
+    }
+
     std::shared_ptr<const ConstraintEntry>
     Constraints::insert(const QualifiedName & name, const std::string & entry) const
     {
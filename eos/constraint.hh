@@ -172,6 +172,20 @@ namespace eos
          * @param entry A YAML-formatted string representing the new ConstraintEntry.
          */
         std::shared_ptr<const ConstraintEntry> insert(const QualifiedName & name, const std::string & entry) const;
+
+        /// The name of the index file within the directory of constraint files.
+        static const char * index_name;
+
+        /*!
+         * Create the index of a directory of constraint files.
+         *
+         * If an up-to-date index is present, the constraint entries are deserialized on first use only,
+         * rather than parsing all constraint files at once. The index is rejected once any of the
+         * constraint files changes.
+         *
+         * @param directory The directory of the constraint files.
+         */
+        static void create_index(const std::string & directory);
     };
 
     extern template class WrappedForwardIterator<Constraints::ConstraintIteratorTag, const std::pair<const QualifiedName, std::shared_ptr<const ConstraintEntry>>>;
@@ -24,6 +24,8 @@
 
 #include <eos/form-factors/analytic-b-to-p-lcsr.hh>
 #include <eos/form-factors/b-lcdas.hh>
+#include <eos/utils/chebyshev.hh>
+#include <eos/utils/destringify.hh>
 #include <eos/utils/exception.hh>
 #include <eos/utils/integrate.hh>
 #include <eos/utils/kinematic.hh>
@@ -34,9 +36,21 @@
 #include <eos/utils/stringify.hh>
 
 #include <functional>
+#include <memory>
 
 namespace eos
 {
+    namespace lcsr
+    {
+        // the independent B->P form factors, in the order of their q2 interpolants
+        enum class BToPFormFactor : unsigned
+        {
+            f_p = 0,
+            f_pm,
+            f_t
+        };
+    }
+
     template <typename Process_>
     struct Implementation<AnalyticFormFactorBToPLCSR<Process_>>
     {
@@ -81,6 +95,11 @@ namespace eos
         std::function<double (const Implementation *, const double &, const double &)> integrand_fT_2pt;
         bool switch_borel;
 
+        // optional interpolation of the independent form factors on a Chebyshev grid in q2
+        SwitchOption opt_interpolation;
+        ParameterUser interpolation_user;
+        std::unique_ptr<ChebyshevInterpolation> interpolation;
+
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make("SM", p, o)),
@@ -103,7 +122,8 @@ namespace eos
             switch_2pt_g(1.0),
             switch_3pt(1.0),
             opt_method(o, "method", { "borel", "dispersive" }, "borel"),
-            switch_borel(opt_method.value() == "borel")
+            switch_borel(opt_method.value() == "borel"),
+            opt_interpolation(o, "q2-interpolation", { "off", "chebyshev" }, "off")
         {
             u.uses(b_lcdas);
 
@@ -161,6 +181,23 @@ namespace eos
                 integrand_fT_2pt  = &Implementation::integrand_fT_2pt_disp;
             }
 
+            // the interpolants depend on all parameters used so far, and on the quark masses of the model
+            if ("chebyshev" == opt_interpolation.value())
+            {
+                interpolation_user.uses(u);
+                interpolation_user.uses(*model);
+
+                using std::placeholders::_1;
+                interpolation.reset(new ChebyshevInterpolation(p, interpolation_user,
+                        {
+                            std::bind(&Implementation::f_p,  this, _1),
+                            std::bind(&Implementation::f_pm, this, _1),
+                            std::bind(&Implementation::f_t,  this, _1)
+                        },
+                        destringify<double>(o.get("q2-interpolation-min", "-10.0")),
+                        destringify<double>(o.get("q2-interpolation-max", "10.0")),
+                        destringify<double>(o.get("q2-interpolation-tolerance", "1.0e-5"))));
+            }
         }
 
         ~Implementation() = default;
@@ -2711,6 +2748,29 @@ namespace eos
         }
         // }}}
 
+        /* Independent form factors, either interpolated or computed */
+        // {{{
+        double form_factor(const lcsr::BToPFormFactor & ff, const double & q2) const
+        {
+            if (interpolation && interpolation->contains(q2))
+                return interpolation->evaluate(static_cast<unsigned>(ff), q2);
+
+            switch (ff)
+            {
+                case lcsr::BToPFormFactor::f_p:
+                    return f_p(q2);
+
+                case lcsr::BToPFormFactor::f_pm:
+                    return f_pm(q2);
+
+                case lcsr::BToPFormFactor::f_t:
+                    return f_t(q2);
+            }
+
+            throw InternalError("AnalyticFormFactorBToPLCSR: unknown form factor");
+        }
+        // }}}
+
         /* f_+ : form factor and moments */
         // {{{
         double f_p(const double & q2) const
@@ -9504,7 +9564,7 @@ namespace eos
     double
     AnalyticFormFactorBToPLCSR<Process_>::f_p(const double & q2) const
     {
-        return this->_imp->f_p(q2);
+        return this->_imp->form_factor(lcsr::BToPFormFactor::f_p, q2);
     }
 
     template <typename Process_>
@@ -9514,21 +9574,21 @@ namespace eos
         const double m_B = this->_imp->m_B(), m_B2 = pow(m_B, 2);
         const double m_P = this->_imp->m_P(), m_P2 = pow(m_P, 2);
 
-        return (this->_imp->f_pm(q2)-this->_imp->f_p(q2)) * q2 / (m_B2 - m_P2) + this->_imp->f_p(q2);
+        return (this->_imp->form_factor(lcsr::BToPFormFactor::f_pm, q2)-this->_imp->form_factor(lcsr::BToPFormFactor::f_p, q2)) * q2 / (m_B2 - m_P2) + this->_imp->form_factor(lcsr::BToPFormFactor::f_p, q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToPLCSR<Process_>::f_m(const double & q2) const
     {
-        return this->_imp->f_pm(q2)-this->_imp->f_p(q2);
+        return this->_imp->form_factor(lcsr::BToPFormFactor::f_pm, q2)-this->_imp->form_factor(lcsr::BToPFormFactor::f_p, q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToPLCSR<Process_>::f_t(const double & q2) const
     {
-        return this->_imp->f_t(q2);
+        return this->_imp->form_factor(lcsr::BToPFormFactor::f_t, q2);
     }
 
     template <typename Process_>
@@ -9536,7 +9596,7 @@ namespace eos
     AnalyticFormFactorBToPLCSR<Process_>::f_plus_T(const double & q2) const
     {
         // Conventions of GvDV:2020 eq. (A.5)
-        return this->_imp->f_t(q2) * q2 / this->_imp->m_B() / (this->_imp->m_B() + this->_imp->m_P());
+        return this->_imp->form_factor(lcsr::BToPFormFactor::f_t, q2) * q2 / this->_imp->m_B() / (this->_imp->m_B() + this->_imp->m_P());
     }
 
     template <typename Process_>
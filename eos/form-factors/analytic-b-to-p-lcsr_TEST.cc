@@ -22,6 +22,7 @@
 #include <eos/form-factors/analytic-b-to-p-lcsr.hh>
 #include <eos/form-factors/mesonic.hh>
 
+#include <cmath>
 #include <vector>
 #include <utility>
 
@@ -1374,6 +1375,57 @@ class LCSRFormFactorsTest :
                 TEST_CHECK_RELATIVE_ERROR( 0.862329, ff->f_t(+5.0), 5.0 * eps);
 
             }
+
+            /* B_s -> D_s form factor values, interpolated in q2 */
+            {
+                static const double eps = 1.0e-4; // relative error < 0.3%
+
+                Parameters p = Parameters::Defaults();
+                p["B_s::1/lambda_B_p"]            = 1.69348;
+                p["B_s::lambda_E^2"]              = 0.03;
+                p["B_s::lambda_H^2"]              = 0.06;
+                p["mass::B_s"]                    = 5.36677;
+                p["mass::D_s"]                    = 1.96828;
+                p["decay-constant::B_s"]          = 0.2307;
+                p["decay-constant::D_s"]          = 0.2499;
+                p["B_s->D_s::mu@B-LCSR"]          = 2.1213;
+                p["B_s->D_s::s_0^+,0@B-LCSR"]     = 6.0;
+                p["B_s->D_s::s_0^+,1@B-LCSR"]     = 0.0;
+                p["B_s->D_s::s_0^+/-,0@B-LCSR"]   = 6.0;
+                p["B_s->D_s::s_0^+/-,1@B-LCSR"]   = 0.0;
+                p["B_s->D_s::s_0^T,0@B-LCSR"]     = 6.0;
+                p["B_s->D_s::s_0^T,1@B-LCSR"]     = 0.0;
+                p["B_s->D_s::M^2@B-LCSR"]         = 4.5;
+
+                Options o = {
+                    { "2pt",                        "all"       },
+                    { "3pt",                        "all"       },
+                    { "gminus",                     "WW-limit"  },
+                    { "q2-interpolation",           "chebyshev" },
+                    { "q2-interpolation-min",       "-6.0"      },
+                    { "q2-interpolation-max",       "+6.0"      },
+                    { "q2-interpolation-tolerance", "1.0e-6"    }
+                };
+
+                std::shared_ptr<FormFactors<PToP>> ff = FormFactorFactory<PToP>::create("B_s->D_s::B-LCSR", p, o);
+
+                TEST_CHECK_RELATIVE_ERROR( 0.539744, ff->f_p(-5.0),       eps);
+                TEST_CHECK_RELATIVE_ERROR( 0.642184, ff->f_p( 0.0),       eps);
+                TEST_CHECK_RELATIVE_ERROR( 0.787744, ff->f_p(+5.0),       eps);
+
+                TEST_CHECK_RELATIVE_ERROR( 0.600434, ff->f_0(-5.0),       eps);
+                TEST_CHECK_RELATIVE_ERROR( 0.642184, ff->f_0( 0.0),       eps);
+                TEST_CHECK_RELATIVE_ERROR( 0.688616, ff->f_0(+5.0),       eps);
+
+                TEST_CHECK_RELATIVE_ERROR( 0.518002, ff->f_t(-5.0),       eps);
+                TEST_CHECK_RELATIVE_ERROR( 0.643604, ff->f_t( 0.0), 2.0 * eps);
+                TEST_CHECK_RELATIVE_ERROR( 0.862329, ff->f_t(+5.0), 5.0 * eps);
+
+                // the interpolants follow changes of the parameters
+                const double f_p_0 = ff->f_p(0.0);
+                p["B_s->D_s::M^2@B-LCSR"]         = 5.0;
+                TEST_CHECK(std::abs(ff->f_p(0.0) - f_p_0) > 1.0e-4);
+            }
         }
 } kmo2006_form_factors_test;
 
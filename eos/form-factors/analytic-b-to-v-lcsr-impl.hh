@@ -24,6 +24,8 @@
 
 #include <eos/form-factors/analytic-b-to-v-lcsr.hh>
 #include <eos/form-factors/b-lcdas.hh>
+#include <eos/utils/chebyshev.hh>
+#include <eos/utils/destringify.hh>
 #include <eos/utils/exception.hh>
 #include <eos/utils/integrate-impl.hh>
 #include <eos/utils/kinematic.hh>
@@ -34,11 +36,27 @@
 #include <eos/utils/stringify.hh>
 
 #include <functional>
+#include <memory>
 
 #include <iostream>
 
 namespace eos
 {
+    namespace lcsr
+    {
+        // the independent B->V form factors, in the order of their q2 interpolants
+        enum class BToVFormFactor : unsigned
+        {
+            a_1 = 0,
+            a_2,
+            a_30,
+            v,
+            t_1,
+            t_23A,
+            t_23B
+        };
+    }
+
     template <typename Process_>
     struct Implementation<AnalyticFormFactorBToVLCSR<Process_>>
     {
@@ -95,6 +113,11 @@ namespace eos
         std::function<double (const Implementation *, const double &, const double &)> integrand_t23B_2pt;
         bool switch_borel;
 
+        // optional interpolation of the independent form factors on a Chebyshev grid in q2
+        SwitchOption opt_interpolation;
+        ParameterUser interpolation_user;
+        std::unique_ptr<ChebyshevInterpolation> interpolation;
+
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make("SM", p, o)),
             m_B(p[Process_::m_B], u),
@@ -124,7 +147,8 @@ namespace eos
             switch_2pt_g(1.0),
             switch_3pt(1.0),
             opt_method(o, "method", { "borel", "dispersive" }, "borel"),
-            switch_borel(opt_method.value() == "borel")
+            switch_borel(opt_method.value() == "borel"),
+            opt_interpolation(o, "q2-interpolation", { "off", "chebyshev" }, "off")
         {
             u.uses(b_lcdas);
 
@@ -215,6 +239,28 @@ namespace eos
                 std::cout << "   I2d1_g_bar  (sigma = 0.05, q2 = 0) = " << I2d1_A1_2pt_g_bar(sigma, q2) << std::endl;
                 #endif
             }
+
+            // the interpolants depend on all parameters used so far, and on the quark masses of the model
+            if ("chebyshev" == opt_interpolation.value())
+            {
+                interpolation_user.uses(u);
+                interpolation_user.uses(*model);
+
+                using std::placeholders::_1;
+                interpolation.reset(new ChebyshevInterpolation(p, interpolation_user,
+                        {
+                            std::bind(&Implementation::a_1,   this, _1),
+                            std::bind(&Implementation::a_2,   this, _1),
+                            std::bind(&Implementation::a_30,  this, _1),
+                            std::bind(&Implementation::v,     this, _1),
+                            std::bind(&Implementation::t_1,   this, _1),
+                            std::bind(&Implementation::t_23A, this, _1),
+                            std::bind(&Implementation::t_23B, this, _1)
+                        },
+                        destringify<double>(o.get("q2-interpolation-min", "-10.0")),
+                        destringify<double>(o.get("q2-interpolation-max", "10.0")),
+                        destringify<double>(o.get("q2-interpolation-tolerance", "1.0e-5"))));
+            }
         }
 
         ~Implementation() = default;
@@ -3698,6 +3744,41 @@ namespace eos
         }
         // }}}
 
+        /* Independent form factors, either interpolated or computed */
+        // {{{
+        double form_factor(const lcsr::BToVFormFactor & ff, const double & q2) const
+        {
+            if (interpolation && interpolation->contains(q2))
+                return interpolation->evaluate(static_cast<unsigned>(ff), q2);
+
+            switch (ff)
+            {
+                case lcsr::BToVFormFactor::a_1:
+                    return a_1(q2);
+
+                case lcsr::BToVFormFactor::a_2:
+                    return a_2(q2);
+
+                case lcsr::BToVFormFactor::a_30:
+                    return a_30(q2);
+
+                case lcsr::BToVFormFactor::v:
+                    return v(q2);
+
+                case lcsr::BToVFormFactor::t_1:
+                    return t_1(q2);
+
+                case lcsr::BToVFormFactor::t_23A:
+                    return t_23A(q2);
+
+                case lcsr::BToVFormFactor::t_23B:
+                    return t_23B(q2);
+            }
+
+            throw InternalError("AnalyticFormFactorBToVLCSR: unknown form factor");
+        }
+        // }}}
+
         /* A1 : form factor and moments */
         // {{{
         double a_1(const double & q2) const
@@ -23142,21 +23223,21 @@ namespace eos
         const double m_B = this->_imp->m_B();
         const double m_V = this->_imp->m_V();
 
-        return ((m_B + m_V) * this->_imp->a_1(q2) - (m_B - m_V) * this->_imp->a_2(q2) - 2.0 * m_V * this->_imp->a_30(q2)) / (2.0 * m_V);
+        return ((m_B + m_V) * this->_imp->form_factor(lcsr::BToVFormFactor::a_1, q2) - (m_B - m_V) * this->_imp->form_factor(lcsr::BToVFormFactor::a_2, q2) - 2.0 * m_V * this->_imp->form_factor(lcsr::BToVFormFactor::a_30, q2)) / (2.0 * m_V);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::a_1(const double & q2) const
     {
-        return this->_imp->a_1(q2);
+        return this->_imp->form_factor(lcsr::BToVFormFactor::a_1, q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::a_2(const double & q2) const
     {
-        return this->_imp->a_2(q2);
+        return this->_imp->form_factor(lcsr::BToVFormFactor::a_2, q2);
     }
 
     template <typename Process_>
@@ -23169,21 +23250,21 @@ namespace eos
         const double c_1 = (m_B + m_V) * (m_B * m_B - m_V * m_V - q2) / (16.0 * m_B * m_V * m_V);
         const double c_2 = eos::lambda(m_B * m_B, m_V * m_V, q2) / (16.0 * m_B * m_V * m_V * (m_B + m_V));
 
-        return c_1 * this->_imp->a_1(q2) - c_2 * this->_imp->a_2(q2);
+        return c_1 * this->_imp->form_factor(lcsr::BToVFormFactor::a_1, q2) - c_2 * this->_imp->form_factor(lcsr::BToVFormFactor::a_2, q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::v(const double & q2) const
     {
-        return this->_imp->v(q2);
+        return this->_imp->form_factor(lcsr::BToVFormFactor::v, q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::t_1(const double & q2) const
     {
-        return this->_imp->t_1(q2);
+        return this->_imp->form_factor(lcsr::BToVFormFactor::t_1, q2);
     }
 
     template <typename Process_>
@@ -23196,14 +23277,14 @@ namespace eos
         const double c_1 = (pow(m_B, 2) - pow(m_V, 2) - q2) / (pow(m_B, 2) - pow(m_V, 2));
         const double c_2 = 2.0 * q2 / (pow(m_B, 2) - pow(m_V, 2));
 
-        return c_1 * this->_imp->t_23A(q2) + c_2 * this->_imp->t_23B(q2);
+        return c_1 * this->_imp->form_factor(lcsr::BToVFormFactor::t_23A, q2) + c_2 * this->_imp->form_factor(lcsr::BToVFormFactor::t_23B, q2);
     }
 
     template <typename Process_>
     double
     AnalyticFormFactorBToVLCSR<Process_>::t_3(const double & q2) const
     {
-        return 1.0 * this->_imp->t_23A(q2) - 2.0 * this->_imp->t_23B(q2);
+        return 1.0 * this->_imp->form_factor(lcsr::BToVFormFactor::t_23A, q2) - 2.0 * this->_imp->form_factor(lcsr::BToVFormFactor::t_23B, q2);
     }
 
     template <typename Process_>
@@ -23218,8 +23299,8 @@ namespace eos
         const double c_3 = (pow(m_B, 2) - pow(m_V, 2) - q2) / (pow(m_B, 2) - pow(m_V, 2));
         const double c_4 = 2.0 * q2 / (pow(m_B, 2) - pow(m_V, 2));
 
-        return c_1 * (c_3 * this->_imp->t_23A(q2) + c_4 * this->_imp->t_23B(q2))
-             + c_2 * (1.0 * this->_imp->t_23A(q2) - 2.0 * this->_imp->t_23B(q2));
+        return c_1 * (c_3 * this->_imp->form_factor(lcsr::BToVFormFactor::t_23A, q2) + c_4 * this->_imp->form_factor(lcsr::BToVFormFactor::t_23B, q2))
+             + c_2 * (1.0 * this->_imp->form_factor(lcsr::BToVFormFactor::t_23A, q2) - 2.0 * this->_imp->form_factor(lcsr::BToVFormFactor::t_23B, q2));
     }
 
     template <typename Process_>
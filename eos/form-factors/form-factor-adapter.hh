@@ -48,6 +48,8 @@ namespace eos
 
             std::function<double (const FormFactors<Transition_> *, const Args_ & ...)> _form_factor_function;
 
+            std::function<std::vector<std::pair<Parameter::Id, double>> (const FormFactors<Transition_> *, const Args_ & ...)> _derivatives_function;
+
             std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> _kinematics_names;
 
             std::tuple<const FormFactors<Transition_> *, typename impl::ConvertTo<Args_, KinematicVariable>::Type ...> _argument_tuple;
@@ -59,6 +61,7 @@ namespace eos
                     const Kinematics & kinematics,
                     const Options & options,
                     const std::function<double (const FormFactors<Transition_> *, const Args_ & ...)> & form_factor_function,
+                    const std::function<std::vector<std::pair<Parameter::Id, double>> (const FormFactors<Transition_> *, const Args_ & ...)> & derivatives_function,
                     const std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> & kinematics_names) :
                 _name(name),
                 _process(process),
@@ -67,6 +70,7 @@ namespace eos
                 _options(options),
                 _form_factors(FormFactorFactory<Transition_>::create(process.str() + "::" + options["form-factors"], _parameters, _options)),
                 _form_factor_function(form_factor_function),
+                _derivatives_function(derivatives_function),
                 _kinematics_names(kinematics_names),
                 _argument_tuple(impl::TupleMaker<sizeof...(Args_)>::make(_kinematics, _kinematics_names, _form_factors.get()))
             {
@@ -91,6 +95,24 @@ namespace eos
                 return apply(_form_factor_function, values);
             };
 
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives() const
+            {
+                if (! _derivatives_function)
+                    return {};
+
+                std::tuple<const FormFactors<Transition_> *, typename impl::ConvertTo<Args_, double>::Type ...> values = _argument_tuple;
+
+                // not all parametrisations provide exact derivatives
+                try
+                {
+                    return apply(_derivatives_function, values);
+                }
+                catch (InternalError &)
+                {
+                    return {};
+                }
+            }
+
             virtual Parameters parameters()
             {
                 return _parameters;
@@ -108,12 +130,12 @@ namespace eos
 
             virtual ObservablePtr clone() const
             {
-                return ObservablePtr(new FormFactorAdapter(_name, _process, _parameters.clone(), _kinematics.clone(), _options, _form_factor_function, _kinematics_names));
+                return ObservablePtr(new FormFactorAdapter(_name, _process, _parameters.clone(), _kinematics.clone(), _options, _form_factor_function, _derivatives_function, _kinematics_names));
             }
 
             virtual ObservablePtr clone(const Parameters & parameters) const
             {
-                return ObservablePtr(new FormFactorAdapter(_name, _process, parameters, _kinematics.clone(), _options, _form_factor_function, _kinematics_names));
+                return ObservablePtr(new FormFactorAdapter(_name, _process, parameters, _kinematics.clone(), _options, _form_factor_function, _derivatives_function, _kinematics_names));
             }
     };
 
@@ -132,6 +154,8 @@ namespace eos
 
             std::function<double (const FormFactors<Transition_> *, const Args_ & ...)> _form_factor_function;
 
+            std::function<std::vector<std::pair<Parameter::Id, double>> (const FormFactors<Transition_> *, const Args_ & ...)> _derivatives_function;
+
             std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> _kinematics_names;
 
             std::array<const std::string, sizeof...(Args_)> _kinematics_names_array;
@@ -142,12 +166,14 @@ namespace eos
                     const Unit & unit,
                     const qnp::Prefix & process,
                     const std::function<double (const FormFactors<Transition_> *, const Args_ & ...)> & form_factor_function,
+                    const std::function<std::vector<std::pair<Parameter::Id, double>> (const FormFactors<Transition_> *, const Args_ & ...)> & derivatives_function,
                     const std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> & kinematics_names) :
                 _name(name),
                 _latex(latex),
                 _unit(unit),
                 _process(process),
                 _form_factor_function(form_factor_function),
+                _derivatives_function(derivatives_function),
                 _kinematics_names(kinematics_names),
                 _kinematics_names_array(impl::make_array<const std::string>(kinematics_names))
             {
@@ -184,7 +210,7 @@ namespace eos
 
             virtual ObservablePtr make(const Parameters & parameters, const Kinematics & kinematics, const Options & options) const
             {
-                return ObservablePtr(new FormFactorAdapter<Transition_, Args_ ...>(_name, _process, parameters, kinematics, options, _form_factor_function, _kinematics_names));
+                return ObservablePtr(new FormFactorAdapter<Transition_, Args_ ...>(_name, _process, parameters, kinematics, options, _form_factor_function, _derivatives_function, _kinematics_names));
             }
 
             virtual std::ostream & insert(std::ostream & os) const
@@ -22,6 +22,7 @@
 
 #include <eos/form-factors/mesonic.hh>
 #include <eos/utils/derivative.hh>
+#include <eos/utils/dual.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/model.hh>
 #include <eos/utils/options.hh>
@@ -29,8 +30,10 @@
 #include <eos/utils/polylog.hh>
 #include <eos/utils/power_of.hh>
 
+#include <array>
 #include <cmath>
 #include <limits>
+#include <map>
 
 #include <iostream>
 
@@ -55,7 +58,7 @@ namespace eos
 
             // option to determine the model for the leading-power IW function
             SwitchOption _opt_lp_model;
-            std::function<double (const double &)> _xi;
+            bool _use_lp_exponential;
 
             // option to determine if we use z^3 terms in the leading-power IW function
             SwitchOption _opt_lp_zorder;
@@ -116,6 +119,7 @@ namespace eos
                 _mBar(p[prefix + "::mBar@HQET"], *this),
                 _a(p[prefix + "::a@HQET"], *this),
                 _opt_lp_model(o, "model-lp", { "power-series", "exponential" }, "power-series"),
+                _use_lp_exponential(_opt_lp_model.value() == "exponential"),
                 _opt_lp_zorder(o, "z-order-lp", { "2", "3", "4", "5" }, "3"),
                 _enable_lp_z3(1.0 ? _opt_lp_zorder.value() >= "3" : 0.0),
                 _enable_lp_z4(1.0 ? _opt_lp_zorder.value() >= "4" : 0.0),
@@ -158,22 +162,6 @@ namespace eos
                 _l6pone(p[_sslp_prefix(prefix) + "::l_6'(1)@HQET"], *this),
                 _l6ppone(p[_sslp_prefix(prefix) + "::l_6''(1)@HQET"], *this)
             {
-                using std::placeholders::_1;
-
-                if (_opt_lp_model.value() == "exponential")
-                {
-                    _xi = [=](const double & q2) -> double
-                    {
-                        return _xi_exponential(q2);
-                    };
-                }
-                else
-                {
-                    _xi = [=](const double & q2) -> double
-                    {
-                        return _xi_power_series(q2);
-                    };
-                }
             }
 
             ~HQETFormFactorBase() = default;
@@ -188,7 +176,40 @@ namespace eos
             inline double _m_b_pole() const { return _m_b_1S() * (1 + 2.0 / 9.0 * power_of<2>(_alpha_s())); }
             inline double _m_c_pole() const { return _m_b_pole() - 3.40; }
             inline double _lambda_1() const { return -0.30; }
-            inline double _LambdaBar() const { return _mBar - _m_b_pole() + _lambda_1() / (2.0 * _m_b_1S()); }
+            template <typename T_ = double> T_ _LambdaBar() const
+            {
+                return make_variable<T_>(_mBar, _i_mBar) - _m_b_pole() + _lambda_1() / (2.0 * _m_b_1S());
+            }
+
+            /*
+             * Derivatives with respect to the HQE parameters
+             */
+            // indices of the parameters when computing derivatives
+            enum : unsigned
+            {
+                _i_xi = 0, _i_chi2 = 5, _i_chi3 = 8, _i_eta = 10,
+                _i_l1 = 13, _i_l2 = 16, _i_l3 = 19, _i_l4 = 22, _i_l5 = 25, _i_l6 = 28,
+                _i_mBar = 31, _i_a = 32, _n = 33
+            };
+
+            // the ids of the parameters in the order of their indices
+            std::array<Parameter::Id, _n> _ids() const
+            {
+                return
+                {{
+                    _xipone.id(), _xippone.id(), _xipppone.id(), _xippppone.id(), _xipppppone.id(),
+                    _chi2one.id(), _chi2pone.id(), _chi2ppone.id(),
+                    _chi3pone.id(), _chi3ppone.id(),
+                    _etaone.id(), _etapone.id(), _etappone.id(),
+                    _l1one.id(), _l1pone.id(), _l1ppone.id(),
+                    _l2one.id(), _l2pone.id(), _l2ppone.id(),
+                    _l3one.id(), _l3pone.id(), _l3ppone.id(),
+                    _l4one.id(), _l4pone.id(), _l4ppone.id(),
+                    _l5one.id(), _l5pone.id(), _l5ppone.id(),
+                    _l6one.id(), _l6pone.id(), _l6ppone.id(),
+                    _mBar.id(), _a.id()
+                }};
+            }
 
             /*
              * Interface to Process_-specific kinematics.
@@ -199,149 +220,171 @@ namespace eos
             /*
              * Isgur-Wise functions
              */
-            double _zw(const double & w) const
+            template <typename T_ = double> T_ _zw(const double & w) const
             {
-                return (std::sqrt(w + 1.0) - std::sqrt(2.0) * _a()) / (std::sqrt(w + 1.0) + std::sqrt(2.0) * _a());
+                const T_ a = make_variable<T_>(_a, _i_a);
+
+                return (std::sqrt(w + 1.0) - std::sqrt(2.0) * a) / (std::sqrt(w + 1.0) + std::sqrt(2.0) * a);
             }
 
-            double _z(const double & q2) const
+            template <typename T_ = double> T_ _z(const double & q2) const
             {
                 const double w = _w(q2);
 
-                return _zw(w);
+                return _zw<T_>(w);
             }
-            // uses a power series ansatz
-            double _xi_power_series(const double & q2) const
-            {
-                const double a = _a(), a2 = a * a, a3 = a * a2, a4 = a2 * a2, a5 = a3 * a2;
-
-                // expansion in z around z_0
-                const double  z_0 = (1.0 - a) / (1.0 + a);
-                const double  z   = (_z(q2) - z_0);
-                const double z2   =  z *  z;
-                const double z3   = z2 *  z * _enable_lp_z3;
-                const double z4   = z2 * z2 * _enable_lp_z4;
-                const double z5   = z3 * z2 * _enable_lp_z5;
-
-                const double wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
-                                  + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2
-                                  + (2.0 +       a) * pow(1.0 + a, 4) / (2.0 * a3) * z3
-                                  + (5.0 + 3.0 * a) * pow(1.0 + a, 5) / (8.0 * a4) * z4
-                                  + (3.0 + 2.0 * a) * pow(1.0 + a, 6) / (8.0 * a5) * z5;
 
-                const double wm12 =   4.0                  * pow(1.0 + a, 4) / a2         * z2
-                                  + ( 6.0 +  2.0 * a     ) * pow(1.0 + a, 5) / a3         * z3
-                                  + (25.0 + 14.0 * a + a2) * pow(1.0 + a, 6) / (4.0 * a4) * z4
-                                  + (11.0 +  8.0 * a + a2) * pow(1.0 + a, 7) / (2.0 * a5) * z5;
+            template <typename T_ = double> T_ _xi(const double & q2) const
+            {
+                if (_use_lp_exponential)
+                    return _xi_exponential<T_>(q2);
 
-                const double wm13 =   8.0                  * pow(1.0 + a, 6) / a3         * z3
-                                  + (18.0 +  6.0 * a     ) * pow(1.0 + a, 7) / a4         * z4
-                                  + (51.0 + 30.0 * a + a2) * pow(1.0 + a, 8) / (2.0 * a5) * z5;
+                return _xi_power_series<T_>(q2);
+            }
 
-                const double wm14 =  16.0             * pow(1.0 + a, 8) / a4 * z4
-                                  + (48.0 + 16.0 * a) * pow(1.0 + a, 9) / a5 * z5;
+            // uses a power series ansatz
+            template <typename T_ = double> T_ _xi_power_series(const double & q2) const
+            {
+                const T_ a = make_variable<T_>(_a, _i_a), a2 = a * a, a3 = a * a2, a4 = a2 * a2, a5 = a3 * a2;
 
-                const double wm15 = 32.0 * pow(1.0 + a, 5) / a5 * z5;
+                // expansion in z around z_0
+                const T_  z_0 = (1.0 - a) / (1.0 + a);
+                const T_  z   = (_z<T_>(q2) - z_0);
+                const T_ z2   =  z *  z;
+                const T_ z3   = z2 *  z * _enable_lp_z3;
+                const T_ z4   = z2 * z2 * _enable_lp_z4;
+                const T_ z5   = z3 * z2 * _enable_lp_z5;
+
+                const T_ wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
+                              + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2
+                              + (2.0 +       a) * pow(1.0 + a, 4) / (2.0 * a3) * z3
+                              + (5.0 + 3.0 * a) * pow(1.0 + a, 5) / (8.0 * a4) * z4
+                              + (3.0 + 2.0 * a) * pow(1.0 + a, 6) / (8.0 * a5) * z5;
+
+                const T_ wm12 =   4.0                  * pow(1.0 + a, 4) / a2         * z2
+                              + ( 6.0 +  2.0 * a     ) * pow(1.0 + a, 5) / a3         * z3
+                              + (25.0 + 14.0 * a + a2) * pow(1.0 + a, 6) / (4.0 * a4) * z4
+                              + (11.0 +  8.0 * a + a2) * pow(1.0 + a, 7) / (2.0 * a5) * z5;
+
+                const T_ wm13 =   8.0                  * pow(1.0 + a, 6) / a3         * z3
+                              + (18.0 +  6.0 * a     ) * pow(1.0 + a, 7) / a4         * z4
+                              + (51.0 + 30.0 * a + a2) * pow(1.0 + a, 8) / (2.0 * a5) * z5;
+
+                const T_ wm14 =  16.0             * pow(1.0 + a, 8) / a4 * z4
+                              + (48.0 + 16.0 * a) * pow(1.0 + a, 9) / a5 * z5;
+
+                const T_ wm15 = 32.0 * pow(1.0 + a, 5) / a5 * z5;
+
+                const T_ xipone     = make_variable<T_>(_xipone,     _i_xi + 0),
+                         xippone    = make_variable<T_>(_xippone,    _i_xi + 1),
+                         xipppone   = make_variable<T_>(_xipppone,   _i_xi + 2),
+                         xippppone  = make_variable<T_>(_xippppone,  _i_xi + 3),
+                         xipppppone = make_variable<T_>(_xipppppone, _i_xi + 4);
 
                 return 1.0
-                    + _xipone             * wm11
-                    + _xippone    / 2.0   * wm12
-                    + _xipppone   / 6.0   * wm13
-                    + _xippppone  / 24.0  * wm14
-                    + _xipppppone / 120.0 * wm15;
+                    + xipone             * wm11
+                    + xippone    / 2.0   * wm12
+                    + xipppone   / 6.0   * wm13
+                    + xippppone  / 24.0  * wm14
+                    + xipppppone / 120.0 * wm15;
             }
 
             // uses an exponential ansatz and expands in (w-1) first, then in z*
-            double _xi_exponential(const double & q2) const
+            template <typename T_ = double> T_ _xi_exponential(const double & q2) const
             {
-                const double a = _a(), a2 = a * a, a3 = a * a2, a4 = a2 * a2, a5 = a3 * a2;
+                const T_ a = make_variable<T_>(_a, _i_a), a2 = a * a, a3 = a * a2, a4 = a2 * a2, a5 = a3 * a2;
 
                 // expansion in z around z_0
-                const double  z_0 = (1.0 - a) / (1.0 + a);
-                const double  z   = (_z(q2) - z_0);
-                const double z2   =  z *  z;
-                const double z3   = z2 *  z * _enable_lp_z3;
-                const double z4   = z2 * z2 * _enable_lp_z4;
-                const double z5   = z3 * z2 * _enable_lp_z5;
+                const T_  z_0 = (1.0 - a) / (1.0 + a);
+                const T_  z   = (_z<T_>(q2) - z_0);
+                const T_ z2   =  z *  z;
+                const T_ z3   = z2 *  z * _enable_lp_z3;
+                const T_ z4   = z2 * z2 * _enable_lp_z4;
+                const T_ z5   = z3 * z2 * _enable_lp_z5;
+
+                const T_ wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
+                              + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2
+                              + (2.0 +       a) * pow(1.0 + a, 4) / (2.0 * a3) * z3
+                              + (5.0 + 3.0 * a) * pow(1.0 + a, 5) / (8.0 * a4) * z4
+                              + (3.0 + 2.0 * a) * pow(1.0 + a, 6) / (8.0 * a5) * z5;
 
-                const double wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
-                                  + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2
-                                  + (2.0 +       a) * pow(1.0 + a, 4) / (2.0 * a3) * z3
-                                  + (5.0 + 3.0 * a) * pow(1.0 + a, 5) / (8.0 * a4) * z4
-                                  + (3.0 + 2.0 * a) * pow(1.0 + a, 6) / (8.0 * a5) * z5;
+                const T_ wm12 =   4.0                  * pow(1.0 + a, 4) / a2         * z2
+                              + ( 6.0 +  2.0 * a     ) * pow(1.0 + a, 5) / a3         * z3
+                              + (25.0 + 14.0 * a + a2) * pow(1.0 + a, 6) / (4.0 * a4) * z4
+                              + (11.0 +  8.0 * a + a2) * pow(1.0 + a, 7) / (2.0 * a5) * z5;
 
-                const double wm12 =   4.0                  * pow(1.0 + a, 4) / a2         * z2
-                                  + ( 6.0 +  2.0 * a     ) * pow(1.0 + a, 5) / a3         * z3
-                                  + (25.0 + 14.0 * a + a2) * pow(1.0 + a, 6) / (4.0 * a4) * z4
-                                  + (11.0 +  8.0 * a + a2) * pow(1.0 + a, 7) / (2.0 * a5) * z5;
+                const T_ wm13 =   8.0                  * pow(1.0 + a, 6) / a3         * z3
+                              + (18.0 +  6.0 * a     ) * pow(1.0 + a, 7) / a4         * z4
+                              + (51.0 + 30.0 * a + a2) * pow(1.0 + a, 8) / (2.0 * a5) * z5;
 
-                const double wm13 =   8.0                  * pow(1.0 + a, 6) / a3         * z3
-                                  + (18.0 +  6.0 * a     ) * pow(1.0 + a, 7) / a4         * z4
-                                  + (51.0 + 30.0 * a + a2) * pow(1.0 + a, 8) / (2.0 * a5) * z5;
+                const T_ wm14 =  16.0             * pow(1.0 + a, 8) / a4 * z4
+                              + (48.0 + 16.0 * a) * pow(1.0 + a, 9) / a5 * z5;
 
-                const double wm14 =  16.0             * pow(1.0 + a, 8) / a4 * z4
-                                  + (48.0 + 16.0 * a) * pow(1.0 + a, 9) / a5 * z5;
+                const T_ wm15 = 32.0 * pow(1.0 + a, 5) / a5 * z5;
 
-                const double wm15 = 32.0 * pow(1.0 + a, 5) / a5 * z5;
+                const T_ xipone  = make_variable<T_>(_xipone,  _i_xi + 0),
+                         xippone = make_variable<T_>(_xippone, _i_xi + 1);
 
                 return (1.0
-                    + _xipone              * wm11
-                    - _xipone              * wm12
-                    + _xipone * 2.0 /  3.0 * wm13
-                    - _xipone       /  3.0 * wm14
-                    + _xipone * 2.0 / 15.0 * wm15)
-                    * (1.0 + _xippone      * wm11);
+                    + xipone              * wm11
+                    - xipone              * wm12
+                    + xipone * 2.0 /  3.0 * wm13
+                    - xipone       /  3.0 * wm14
+                    + xipone * 2.0 / 15.0 * wm15)
+                    * (1.0 + xippone      * wm11);
             }
 
-            double _chi2(const double & q2) const
+            template <typename T_ = double> T_ _chi2(const double & q2) const
             {
-                const double a = _a(), a2 = a * a;
+                const T_ a = make_variable<T_>(_a, _i_a), a2 = a * a;
 
                 // expansion in z around z_0
-                const double  z_0 = (1.0 - a) / (1.0 + a);
-                const double  z   = (_z(q2) - z_0);
-                const double z2   =  z * z * _enable_slp_z2;
+                const T_  z_0 = (1.0 - a) / (1.0 + a);
+                const T_  z   = (_z<T_>(q2) - z_0);
+                const T_ z2   =  z * z * _enable_slp_z2;
 
-                const double wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
-                                  + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
+                const T_ wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
+                              + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
 
-                const double wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
+                const T_ wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
 
-                return _chi2one + _chi2pone * wm11 + _chi2ppone / 2.0 * wm12;
+                return make_variable<T_>(_chi2one, _i_chi2 + 0) + make_variable<T_>(_chi2pone, _i_chi2 + 1) * wm11
+                    + make_variable<T_>(_chi2ppone, _i_chi2 + 2) / 2.0 * wm12;
             }
 
-            double _chi3(const double & q2) const
+            template <typename T_ = double> T_ _chi3(const double & q2) const
             {
-                const double a = _a(), a2 = a * a;
+                const T_ a = make_variable<T_>(_a, _i_a), a2 = a * a;
 
                 // expansion in z around z_0
-                const double  z_0 = (1.0 - a) / (1.0 + a);
-                const double  z   = (_z(q2) - z_0);
-                const double z2   =  z * z * _enable_slp_z2;
+                const T_  z_0 = (1.0 - a) / (1.0 + a);
+                const T_  z   = (_z<T_>(q2) - z_0);
+                const T_ z2   =  z * z * _enable_slp_z2;
 
-                const double wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
-                                  + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
+                const T_ wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
+                              + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
 
-                const double wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
+                const T_ wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
 
-                return 0.0 + _chi3pone * wm11 + _chi3ppone / 2.0 * wm12;
+                return 0.0 + make_variable<T_>(_chi3pone, _i_chi3 + 0) * wm11 + make_variable<T_>(_chi3ppone, _i_chi3 + 1) / 2.0 * wm12;
             }
 
-            double _eta(const double & q2) const
+            template <typename T_ = double> T_ _eta(const double & q2) const
             {
-                const double a = _a(), a2 = a * a;
+                const T_ a = make_variable<T_>(_a, _i_a), a2 = a * a;
 
                 // expansion in z around z_0
-                const double  z_0 = (1.0 - a) / (1.0 + a);
-                const double  z   = (_z(q2) - z_0);
-                const double z2   =  z * z * _enable_slp_z2;
+                const T_  z_0 = (1.0 - a) / (1.0 + a);
+                const T_  z   = (_z<T_>(q2) - z_0);
+                const T_ z2   =  z * z * _enable_slp_z2;
 
-                const double wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
-                                  + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
+                const T_ wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
+                              + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
 
-                const double wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
+                const T_ wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
 
-                return _etaone + _etapone * wm11 + _etappone / 2.0 * wm12;
+                return make_variable<T_>(_etaone, _i_eta + 0) + make_variable<T_>(_etapone, _i_eta + 1) * wm11
+                    + make_variable<T_>(_etappone, _i_eta + 2) / 2.0 * wm12;
             }
 
             /*
@@ -393,101 +436,107 @@ namespace eos
             }
 
             /* Power corrections */
-            inline double _l1(const double & w) const
+            template <typename T_ = double> T_ _l1(const double & w) const
             {
-                const double a = _a(), a2 = a * a;
+                const T_ a = make_variable<T_>(_a, _i_a), a2 = a * a;
 
                 // expansion in z around z_0
-                const double  z_0 = (1.0 - a) / (1.0 + a);
-                const double  z   = (_zw(w) - z_0) * _enable_sslp_z1;
-                const double z2   =  z * z * _enable_sslp_z2;
+                const T_  z_0 = (1.0 - a) / (1.0 + a);
+                const T_  z   = (_zw<T_>(w) - z_0) * _enable_sslp_z1;
+                const T_ z2   =  z * z * _enable_sslp_z2;
 
-                const double wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
-                                  + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
+                const T_ wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
+                              + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
 
-                const double wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
+                const T_ wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
 
-                return _l1one + _l1pone * wm11 + _l1ppone / 2.0 * wm12;
+                return make_variable<T_>(_l1one, _i_l1 + 0) + make_variable<T_>(_l1pone, _i_l1 + 1) * wm11
+                    + make_variable<T_>(_l1ppone, _i_l1 + 2) / 2.0 * wm12;
             }
-            inline double _l2(const double & w) const
+            template <typename T_ = double> T_ _l2(const double & w) const
             {
-                const double a = _a(), a2 = a * a;
+                const T_ a = make_variable<T_>(_a, _i_a), a2 = a * a;
 
                 // expansion in z around z_0
-                const double  z_0 = (1.0 - a) / (1.0 + a);
-                const double  z   = (_zw(w) - z_0) * _enable_sslp_z1;
-                const double z2   =  z * z * _enable_sslp_z2;
+                const T_  z_0 = (1.0 - a) / (1.0 + a);
+                const T_  z   = (_zw<T_>(w) - z_0) * _enable_sslp_z1;
+                const T_ z2   =  z * z * _enable_sslp_z2;
 
-                const double wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
-                                  + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
+                const T_ wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
+                              + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
 
-                const double wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
+                const T_ wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
 
-                return _l2one + _l2pone * wm11 + _l2ppone / 2.0 * wm12;
+                return make_variable<T_>(_l2one, _i_l2 + 0) + make_variable<T_>(_l2pone, _i_l2 + 1) * wm11
+                    + make_variable<T_>(_l2ppone, _i_l2 + 2) / 2.0 * wm12;
             }
-            inline double _l3(const double & w) const
+            template <typename T_ = double> T_ _l3(const double & w) const
             {
-                const double a = _a(), a2 = a * a;
+                const T_ a = make_variable<T_>(_a, _i_a), a2 = a * a;
 
                 // expansion in z around z_0
-                const double  z_0 = (1.0 - a) / (1.0 + a);
-                const double  z   = (_zw(w) - z_0) * _enable_sslp_z1;
-                const double z2   =  z * z * _enable_sslp_z2;
+                const T_  z_0 = (1.0 - a) / (1.0 + a);
+                const T_  z   = (_zw<T_>(w) - z_0) * _enable_sslp_z1;
+                const T_ z2   =  z * z * _enable_sslp_z2;
 
-                const double wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
-                                  + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
+                const T_ wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
+                              + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
 
-                const double wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
+                const T_ wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
 
-                return _l3one + _l3pone * wm11 + _l3ppone / 2.0 * wm12;
+                return make_variable<T_>(_l3one, _i_l3 + 0) + make_variable<T_>(_l3pone, _i_l3 + 1) * wm11
+                    + make_variable<T_>(_l3ppone, _i_l3 + 2) / 2.0 * wm12;
             }
-            inline double _l4(const double & w) const
+            template <typename T_ = double> T_ _l4(const double & w) const
             {
-                const double a = _a(), a2 = a * a;
+                const T_ a = make_variable<T_>(_a, _i_a), a2 = a * a;
 
                 // expansion in z around z_0
-                const double  z_0 = (1.0 - a) / (1.0 + a);
-                const double  z   = (_zw(w) - z_0) * _enable_sslp_z1;
-                const double z2   =  z * z * _enable_sslp_z2;
+                const T_  z_0 = (1.0 - a) / (1.0 + a);
+                const T_  z   = (_zw<T_>(w) - z_0) * _enable_sslp_z1;
+                const T_ z2   =  z * z * _enable_sslp_z2;
 
-                const double wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
-                                  + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
+                const T_ wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
+                              + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
 
-                const double wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
+                const T_ wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
 
-                return _l4one + _l4pone * wm11 + _l4ppone / 2.0 * wm12;
+                return make_variable<T_>(_l4one, _i_l4 + 0) + make_variable<T_>(_l4pone, _i_l4 + 1) * wm11
+                    + make_variable<T_>(_l4ppone, _i_l4 + 2) / 2.0 * wm12;
             }
-            inline double _l5(const double & w) const
+            template <typename T_ = double> T_ _l5(const double & w) const
             {
-                const double a = _a(), a2 = a * a;
+                const T_ a = make_variable<T_>(_a, _i_a), a2 = a * a;
 
                 // expansion in z around z_0
-                const double  z_0 = (1.0 - a) / (1.0 + a);
-                const double  z   = (_zw(w) - z_0) * _enable_sslp_z1;
-                const double z2   =  z * z * _enable_sslp_z2;
+                const T_  z_0 = (1.0 - a) / (1.0 + a);
+                const T_  z   = (_zw<T_>(w) - z_0) * _enable_sslp_z1;
+                const T_ z2   =  z * z * _enable_sslp_z2;
 
-                const double wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
-                                  + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
+                const T_ wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
+                              + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
 
-                const double wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
+                const T_ wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
 
-                return _l5one + _l5pone * wm11 + _l5ppone / 2.0 * wm12;
+                return make_variable<T_>(_l5one, _i_l5 + 0) + make_variable<T_>(_l5pone, _i_l5 + 1) * wm11
+                    + make_variable<T_>(_l5ppone, _i_l5 + 2) / 2.0 * wm12;
             }
-            inline double _l6(const double & w) const
+            template <typename T_ = double> T_ _l6(const double & w) const
             {
-                const double a = _a(), a2 = a * a;
+                const T_ a = make_variable<T_>(_a, _i_a), a2 = a * a;
 
                 // expansion in z around z_0
-                const double  z_0 = (1.0 - a) / (1.0 + a);
-                const double  z   = (_zw(w) - z_0) * _enable_sslp_z1;
-                const double z2   =  z * z * _enable_sslp_z2;
+                const T_  z_0 = (1.0 - a) / (1.0 + a);
+                const T_  z   = (_zw<T_>(w) - z_0) * _enable_sslp_z1;
+                const T_ z2   =  z * z * _enable_sslp_z2;
 
-                const double wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
-                                  + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
+                const T_ wm11 =  2.0            * pow(1.0 + a, 2) / a          * z
+                              + (3.0 +       a) * pow(1.0 + a, 3) / (2.0 * a2) * z2;
 
-                const double wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
+                const T_ wm12 =   4.0           * pow(1.0 + a, 4) / a2         * z2;
 
-                return _l6one + _l6pone * wm11 + _l6ppone / 2.0 * wm12;
+                return make_variable<T_>(_l6one, _i_l6 + 0) + make_variable<T_>(_l6pone, _i_l6 + 1) * wm11
+                    + make_variable<T_>(_l6ppone, _i_l6 + 2) / 2.0 * wm12;
             }
 
             /* Wilson Coefficients */
@@ -721,7 +770,7 @@ namespace eos
 
             /* HQET form factors h_i */
 
-            double _h_p(const double & q2) const
+            template <typename T_ = double> T_ _h_p(const double & q2) const
             {
                 const double m_b_pole = _m_b_pole();
                 const double m_c_pole = _m_c_pole();
@@ -731,25 +780,25 @@ namespace eos
 
                 const double as = _alpha_s() / M_PI;
 
-                const double xi  = _xi(q2);
-                const double chi2 = _chi2(q2);
-                const double chi3 = _chi3(q2);
+                const T_ xi  = _xi<T_>(q2);
+                const T_ chi2 = _chi2<T_>(q2);
+                const T_ chi3 = _chi3<T_>(q2);
 
-                const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
-                const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
+                const T_ eps_b = _LambdaBar<T_>() / (2.0 * m_b_pole);
+                const T_ eps_c = _LambdaBar<T_>() / (2.0 * m_c_pole);
 
                 // chi_1 is absorbed into def. of xi for LP and LV
-                const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
+                const T_ L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
 
-                double result = 1.0 + as * (_CV1(w, z) + (w + 1.0) / 2.0 * (_CV2(w, z) + _CV3(w, z)));
+                T_ result = 1.0 + as * (_CV1(w, z) + (w + 1.0) / 2.0 * (_CV2(w, z) + _CV3(w, z)));
                 result += eps_c * (L1);
                 result += eps_b * (L1);
-                result += eps_c * eps_c * _l1(w);
+                result += eps_c * eps_c * _l1<T_>(w);
 
                 return result * xi;
             }
 
-            double _h_m(const double & q2) const
+            template <typename T_ = double> T_ _h_m(const double & q2) const
             {
                 const double m_b_pole = _m_b_pole();
                 const double m_c_pole = _m_c_pole();
@@ -759,24 +808,24 @@ namespace eos
 
                 const double as = _alpha_s() / M_PI;
 
-                const double xi  = _xi(q2);
-                const double eta = _eta(q2);
+                const T_ xi  = _xi<T_>(q2);
+                const T_ eta = _eta<T_>(q2);
 
-                const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
-                const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
+                const T_ eps_b = _LambdaBar<T_>() / (2.0 * m_b_pole);
+                const T_ eps_c = _LambdaBar<T_>() / (2.0 * m_c_pole);
 
                 // chi_1 is absorbed into def. of xi for LP and LV
-                const double L4 = 2.0 * eta - 1.0;
+                const T_ L4 = 2.0 * eta - 1.0;
 
-                double result = (0.0 + as * (w + 1.0) / 2.0 * (_CV2(w, z) - _CV3(w, z)));
+                T_ result = (0.0 + as * (w + 1.0) / 2.0 * (_CV2(w, z) - _CV3(w, z)));
                 result += eps_c * L4;
                 result -= eps_b * L4;
-                result += eps_c * eps_c * _l4(w);
+                result += eps_c * eps_c * _l4<T_>(w);
 
                 return result * xi;
             }
 
-            double _h_S(const double & q2) const
+            template <typename T_ = double> T_ _h_S(const double & q2) const
             {
                 const double m_b_pole = _m_b_pole();
                 const double m_c_pole = _m_c_pole();
@@ -786,27 +835,27 @@ namespace eos
 
                 const double as = _alpha_s() / M_PI;
 
-                const double xi  = _xi(q2);
-                const double eta = _eta(q2);
-                const double chi2 = _chi2(q2);
-                const double chi3 = _chi3(q2);
+                const T_ xi  = _xi<T_>(q2);
+                const T_ eta = _eta<T_>(q2);
+                const T_ chi2 = _chi2<T_>(q2);
+                const T_ chi3 = _chi3<T_>(q2);
 
-                const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
-                const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
+                const T_ eps_b = _LambdaBar<T_>() / (2.0 * m_b_pole);
+                const T_ eps_c = _LambdaBar<T_>() / (2.0 * m_c_pole);
 
                 // chi_1 is absorbed into def. of xi for LP and LV
-                const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
-                const double L4 = 2.0 * eta - 1.0;
+                const T_ L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
+                const T_ L4 = 2.0 * eta - 1.0;
 
-                double result = (1.0 + as * _CS(w, z));
+                T_ result = (1.0 + as * _CS(w, z));
                 result += eps_c * (L1 - (w - 1.0) / (w + 1.0) * L4);
                 result += eps_b * (L1 - (w - 1.0) / (w + 1.0) * L4);
-                result += eps_c * eps_c * (_l1(w) - (w - 1.0) / (w + 1.0) * _l4(w));
+                result += eps_c * eps_c * (_l1<T_>(w) - (w - 1.0) / (w + 1.0) * _l4<T_>(w));
 
                 return result * xi;
             }
 
-            double _h_T(const double & q2) const
+            template <typename T_ = double> T_ _h_T(const double & q2) const
             {
                 const double m_b_pole = _m_b_pole();
                 const double m_c_pole = _m_c_pole();
@@ -816,26 +865,63 @@ namespace eos
 
                 const double as = _alpha_s() / M_PI;
 
-                const double xi  = _xi(q2);
-                const double eta = _eta(q2);
-                const double chi2 = _chi2(q2);
-                const double chi3 = _chi3(q2);
+                const T_ xi  = _xi<T_>(q2);
+                const T_ eta = _eta<T_>(q2);
+                const T_ chi2 = _chi2<T_>(q2);
+                const T_ chi3 = _chi3<T_>(q2);
 
-                const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
-                const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
+                const T_ eps_b = _LambdaBar<T_>() / (2.0 * m_b_pole);
+                const T_ eps_c = _LambdaBar<T_>() / (2.0 * m_c_pole);
 
                 // chi_1 is absorbed into def. of xi for LP and LV
-                const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
-                const double L4 = 2.0 * eta - 1.0;
+                const T_ L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
+                const T_ L4 = 2.0 * eta - 1.0;
 
-                double result = 1.0 + as * (_CT1(w, z) - _CT2(w, z) + _CT3(w, z));
+                T_ result = 1.0 + as * (_CT1(w, z) - _CT2(w, z) + _CT3(w, z));
                 result += eps_c * (L1 - L4);
                 result += eps_b * (L1 - L4);
-                result += eps_c * eps_c * (_l1(w) - _l4(w));
+                result += eps_c * eps_c * (_l1<T_>(w) - _l4<T_>(w));
 
                 return result * xi;
             }
 
+            /* form factors as scalars of type T_, i.e., as values or as values and derivatives */
+
+            template <typename T_> T_ _f_p(const double & q2) const
+            {
+                const double r = _m_P / _m_B;
+
+                // cf. [FKKM2008], eq. (22)
+                return 1.0 / (2.0 * sqrt(r)) * ((1.0 + r) * _h_p<T_>(q2) - (1.0 - r) * _h_m<T_>(q2));
+            }
+
+            template <typename T_> T_ _f_m(const double & q2) const
+            {
+                const double r = _m_P / _m_B;
+
+                // cf. [FKKM2008], eq. (22)
+                return 1.0 / (2.0 * sqrt(r)) * ((1.0 + r) * _h_m<T_>(q2) - (1.0 - r) * _h_p<T_>(q2));
+            }
+
+            template <typename T_> T_ _f_0(const double & q2) const
+            {
+                // We do not use the relation between f_0 and the (scale-dependent) h_S.
+                return _f_p<T_>(q2) + q2 / (_m_B * _m_B - _m_P * _m_P) * _f_m<T_>(q2);
+            }
+
+            template <typename T_> T_ _f_t(const double & q2) const
+            {
+                const double r = _m_P / _m_B;
+
+                // cf. [BJvD2019], eq. (A7)
+                return (1.0 + r) / (2.0 * sqrt(r)) * _h_T<T_>(q2);
+            }
+
+            template <typename T_> T_ _f_plus_T(const double & q2) const
+            {
+                return _f_t<T_>(q2) * q2 / _m_B / (_m_B + _m_P);
+            }
+
         public:
             HQETFormFactors(const Parameters & p, const Options & o) :
                 HQETFormFactorBase(p, o, Process_::hqe_prefix),
@@ -853,37 +939,52 @@ namespace eos
 
             virtual double f_p(const double & q2) const
             {
-                const double r = _m_P / _m_B;
-
-                // cf. [FKKM2008], eq. (22)
-                return 1.0 / (2.0 * sqrt(r)) * ((1.0 + r) * _h_p(q2) - (1.0 - r) * _h_m(q2));
+                return _f_p<double>(q2);
             }
 
             double f_m(const double & q2) const
             {
-                const double r = _m_P / _m_B;
-
-                // cf. [FKKM2008], eq. (22)
-                return 1.0 / (2.0 * sqrt(r)) * ((1.0 + r) * _h_m(q2) - (1.0 - r) * _h_p(q2));
+                return _f_m<double>(q2);
             }
 
             virtual double f_0(const double & q2) const
             {
-                // We do not use the relation between f_0 and the (scale-dependent) h_S.
-                return f_p(q2) + q2 / (_m_B * _m_B - _m_P * _m_P) * f_m(q2);
+                return _f_0<double>(q2);
             }
 
             virtual double f_t(const double & q2) const
             {
-                const double r = _m_P / _m_B;
-
-                // cf. [BJvD2019], eq. (A7)
-                return (1.0 + r) / (2.0 * sqrt(r)) * _h_T(q2);
+                return _f_t<double>(q2);
             }
 
             virtual double f_plus_T(const double & q2) const
             {
-                return f_t(q2) * q2 / _m_B / (_m_B + _m_P);
+                return _f_plus_T<double>(q2);
+            }
+
+            /*
+             * The derivatives cover the HQE parameters, i.e., the parameters of the Isgur-Wise functions,
+             * mBar, and a. They do not cover the hadron masses, which enter the recoil variable w
+             * and through it the Wilson coefficients.
+             */
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives(const std::string & name, const double & q2) const
+            {
+                using D = Dual<_n>;
+                using FormFactor = D (HQETFormFactors::*)(const double &) const;
+                static const std::map<std::string, FormFactor> form_factors
+                {
+                    { "f_p",      &HQETFormFactors::template _f_p<D>      },
+                    { "f_m",      &HQETFormFactors::template _f_m<D>      },
+                    { "f_0",      &HQETFormFactors::template _f_0<D>      },
+                    { "f_t",      &HQETFormFactors::template _f_t<D>      },
+                    { "f_plus_T", &HQETFormFactors::template _f_plus_T<D> },
+                };
+
+                auto i = form_factors.find(name);
+                if (form_factors.end() == i)
+                    throw InternalError("HQETFormFactors<PToP>::derivatives: unknown form factor '" + name + "'");
+
+                return paired_derivatives((this->*(i->second))(q2), _ids());
             }
 
             Diagnostics diagnostics() const
@@ -1057,7 +1158,7 @@ namespace eos
 
             /* HQET form factors h_i */
 
-            double _h_a1(const double & q2) const
+            template <typename T_ = double> T_ _h_a1(const double & q2) const
             {
                 const double m_b_pole = _m_b_pole();
                 const double m_c_pole = _m_c_pole();
@@ -1067,29 +1168,29 @@ namespace eos
 
                 const double as = _alpha_s() / M_PI;
 
-                const double xi  = _xi(q2);
-                const double eta = _eta(q2);
-                const double chi2 = _chi2(q2);
-                const double chi3 = _chi3(q2);
+                const T_ xi  = _xi<T_>(q2);
+                const T_ eta = _eta<T_>(q2);
+                const T_ chi2 = _chi2<T_>(q2);
+                const T_ chi3 = _chi3<T_>(q2);
 
-                const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
-                const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
+                const T_ eps_b = _LambdaBar<T_>() / (2.0 * m_b_pole);
+                const T_ eps_c = _LambdaBar<T_>() / (2.0 * m_c_pole);
 
                 // chi_1 is absorbed into def. of xi for LP and LV
-                const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
-                const double L2 = -4.0 * chi3;
-                const double L4 = 2.0 * eta - 1.0;
+                const T_ L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
+                const T_ L2 = -4.0 * chi3;
+                const T_ L4 = 2.0 * eta - 1.0;
                 const double L5 = -1.0;
 
-                double result = (1.0 + as * _CA1(w, z));
+                T_ result = (1.0 + as * _CA1(w, z));
                 result += eps_c * (L2 - L5 * (w - 1.0) / (w + 1.0));
                 result += eps_b * (L1 - L4 * (w - 1.0) / (w + 1.0));
-                result += eps_c * eps_c * (_l2(w) - (w - 1.0) / (w + 1.0) * _l5(w));
+                result += eps_c * eps_c * (_l2<T_>(w) - (w - 1.0) / (w + 1.0) * _l5<T_>(w));
 
                 return result * xi;
             }
 
-            double _h_a2(const double & q2) const
+            template <typename T_ = double> T_ _h_a2(const double & q2) const
             {
                 const double m_b_pole = _m_b_pole();
                 const double m_c_pole = _m_c_pole();
@@ -1099,24 +1200,24 @@ namespace eos
 
                 const double as = _alpha_s() / M_PI;
 
-                const double xi  = _xi(q2);
-                const double eta = _eta(q2);
-                const double chi2 = _chi2(q2);
+                const T_ xi  = _xi<T_>(q2);
+                const T_ eta = _eta<T_>(q2);
+                const T_ chi2 = _chi2<T_>(q2);
 
-                const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
+                const T_ eps_c = _LambdaBar<T_>() / (2.0 * m_c_pole);
 
                 // chi_1 is absorbed into def. of xi for LP and LV
-                const double L3 = 4.0 * chi2;
-                const double L6 = -2.0 * (1.0 + eta) / (w + 1.0);
+                const T_ L3 = 4.0 * chi2;
+                const T_ L6 = -2.0 * (1.0 + eta) / (w + 1.0);
 
-                double result = (0.0 + as * _CA2(w, z));
+                T_ result = (0.0 + as * _CA2(w, z));
                 result += eps_c * (L3 + L6);
-                result += eps_c * eps_c * (_l3(w) + _l6(w));
+                result += eps_c * eps_c * (_l3<T_>(w) + _l6<T_>(w));
 
                 return result * xi;
             }
 
-            double _h_a3(const double & q2) const
+            template <typename T_ = double> T_ _h_a3(const double & q2) const
             {
                 const double m_b_pole = _m_b_pole();
                 const double m_c_pole = _m_c_pole();
@@ -1126,31 +1227,31 @@ namespace eos
 
                 const double as = _alpha_s() / M_PI;
 
-                const double xi  = _xi(q2);
-                const double eta = _eta(q2);
-                const double chi2 = _chi2(q2);
-                const double chi3 = _chi3(q2);
+                const T_ xi  = _xi<T_>(q2);
+                const T_ eta = _eta<T_>(q2);
+                const T_ chi2 = _chi2<T_>(q2);
+                const T_ chi3 = _chi3<T_>(q2);
 
-                const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
-                const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
+                const T_ eps_b = _LambdaBar<T_>() / (2.0 * m_b_pole);
+                const T_ eps_c = _LambdaBar<T_>() / (2.0 * m_c_pole);
 
                 // chi_1 is absorbed into def. of xi for LP and LV
-                const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
-                const double L2 = -4.0 * chi3;
-                const double L3 = 4.0 * chi2;
-                const double L4 = 2.0 * eta - 1.0;
+                const T_ L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
+                const T_ L2 = -4.0 * chi3;
+                const T_ L3 = 4.0 * chi2;
+                const T_ L4 = 2.0 * eta - 1.0;
                 const double L5 = -1.0;
-                const double L6 = -2.0 * (1.0 + eta) / (w + 1.0);
+                const T_ L6 = -2.0 * (1.0 + eta) / (w + 1.0);
 
-                double result = (1.0 + as * (_CA1(w, z) +_CA3(w, z)));
+                T_ result = (1.0 + as * (_CA1(w, z) +_CA3(w, z)));
                 result += eps_c * (L2 - L3 + L6 - L5);
                 result += eps_b * (L1 - L4);
-                result += eps_c * eps_c * (_l2(w) - _l3(w) + _l6(w) - _l5(w));
+                result += eps_c * eps_c * (_l2<T_>(w) - _l3<T_>(w) + _l6<T_>(w) - _l5<T_>(w));
 
                 return result * xi;
             }
 
-            double _h_v(const double & q2) const
+            template <typename T_ = double> T_ _h_v(const double & q2) const
             {
                 const double m_b_pole = _m_b_pole();
                 const double m_c_pole = _m_c_pole();
@@ -1160,29 +1261,29 @@ namespace eos
 
                 const double as = _alpha_s() / M_PI;
 
-                const double xi  = _xi(q2);
-                const double eta = _eta(q2);
-                const double chi2 = _chi2(q2);
-                const double chi3 = _chi3(q2);
+                const T_ xi  = _xi<T_>(q2);
+                const T_ eta = _eta<T_>(q2);
+                const T_ chi2 = _chi2<T_>(q2);
+                const T_ chi3 = _chi3<T_>(q2);
 
-                const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
-                const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
+                const T_ eps_b = _LambdaBar<T_>() / (2.0 * m_b_pole);
+                const T_ eps_c = _LambdaBar<T_>() / (2.0 * m_c_pole);
 
                 // chi_1 is absorbed into def. of xi for LP and LV
-                const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
-                const double L2 = -4.0 * chi3;
-                const double L4 = 2.0 * eta - 1.0;
+                const T_ L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
+                const T_ L2 = -4.0 * chi3;
+                const T_ L4 = 2.0 * eta - 1.0;
                 const double L5 = -1.0;
 
-                double result = (1.0 + as * _CV1(w, z));
+                T_ result = (1.0 + as * _CV1(w, z));
                 result += eps_c * (L2 - L5);
                 result += eps_b * (L1 - L4);
-                result += eps_c * eps_c * (_l2(w) - _l5(w));
+                result += eps_c * eps_c * (_l2<T_>(w) - _l5<T_>(w));
 
                 return result * xi;
             }
 
-            double _h_t1(const double & q2) const
+            template <typename T_ = double> T_ _h_t1(const double & q2) const
             {
                 const double m_b_pole = _m_b_pole();
                 const double m_c_pole = _m_c_pole();
@@ -1192,26 +1293,26 @@ namespace eos
 
                 const double as = _alpha_s() / M_PI;
 
-                const double xi  = _xi(q2);
-                const double chi2 = _chi2(q2);
-                const double chi3 = _chi3(q2);
+                const T_ xi  = _xi<T_>(q2);
+                const T_ chi2 = _chi2<T_>(q2);
+                const T_ chi3 = _chi3<T_>(q2);
 
-                const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
-                const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
+                const T_ eps_b = _LambdaBar<T_>() / (2.0 * m_b_pole);
+                const T_ eps_c = _LambdaBar<T_>() / (2.0 * m_c_pole);
 
                 // chi_1 is absorbed into def. of xi for LP and LV
-                const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
-                const double L2 = -4.0 * chi3;
+                const T_ L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
+                const T_ L2 = -4.0 * chi3;
 
-                double result = (1.0 + as * (_CT1(w, z) + (w - 1.0) / 2.0 * (_CT2(w, z) - _CT3(w, z))));
+                T_ result = (1.0 + as * (_CT1(w, z) + (w - 1.0) / 2.0 * (_CT2(w, z) - _CT3(w, z))));
                 result += eps_c * L2;
                 result += eps_b * L1;
-                result += eps_c * eps_c * _l2(w);
+                result += eps_c * eps_c * _l2<T_>(w);
 
                 return result * xi;
             }
 
-            double _h_t2(const double & q2) const
+            template <typename T_ = double> T_ _h_t2(const double & q2) const
             {
                 const double m_b_pole = _m_b_pole();
                 const double m_c_pole = _m_c_pole();
@@ -1221,25 +1322,25 @@ namespace eos
 
                 const double as = _alpha_s() / M_PI;
 
-                const double xi  = _xi(q2);
-                const double eta = _eta(q2);
+                const T_ xi  = _xi<T_>(q2);
+                const T_ eta = _eta<T_>(q2);
 
-                const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
-                const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
+                const T_ eps_b = _LambdaBar<T_>() / (2.0 * m_b_pole);
+                const T_ eps_c = _LambdaBar<T_>() / (2.0 * m_c_pole);
 
                 // chi_1 is absorbed into def. of xi for LP and LV
-                const double L4 = 2.0 * eta - 1.0;
+                const T_ L4 = 2.0 * eta - 1.0;
                 const double L5 = -1.0;
 
-                double result = (0.0 + as * (w + 1.0) / 2.0 * (_CT2(w, z) + _CT3(w, z)));
+                T_ result = (0.0 + as * (w + 1.0) / 2.0 * (_CT2(w, z) + _CT3(w, z)));
                 result += eps_c * L5;
                 result -= eps_b * L4;
-                result += eps_c * eps_c * _l5(w);
+                result += eps_c * eps_c * _l5<T_>(w);
 
                 return result * xi;
             }
 
-            double _h_t3(const double & q2) const
+            template <typename T_ = double> T_ _h_t3(const double & q2) const
             {
                 const double m_b_pole = _m_b_pole();
                 const double m_c_pole = _m_c_pole();
@@ -1249,124 +1350,205 @@ namespace eos
 
                 const double as = _alpha_s() / M_PI;
 
-                const double xi  = _xi(q2);
-                const double eta = _eta(q2);
-                const double chi2 = _chi2(q2);
+                const T_ xi  = _xi<T_>(q2);
+                const T_ eta = _eta<T_>(q2);
+                const T_ chi2 = _chi2<T_>(q2);
 
-                const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
+                const T_ eps_c = _LambdaBar<T_>() / (2.0 * m_c_pole);
 
                 // chi_1 is absorbed into def. of xi for LP and LV
-                const double L3 = 4.0 * chi2;
-                const double L6 = -2.0 * (1.0 + eta) / (w + 1.0);
+                const T_ L3 = 4.0 * chi2;
+                const T_ L6 = -2.0 * (1.0 + eta) / (w + 1.0);
 
-                double result = (0.0 + as * _CT2(w, z));
+                T_ result = (0.0 + as * _CT2(w, z));
                 result += eps_c * (L6 - L3);
-                result += eps_c * eps_c * (_l6(w) - _l3(w));
+                result += eps_c * eps_c * (_l6<T_>(w) - _l3<T_>(w));
 
                 return result * xi;
             }
 
-        public:
-            HQETFormFactors(const Parameters & p, const Options & o) :
-                HQETFormFactorBase(p, o, Process_::hqe_prefix),
-                _m_B(p[Process_::name_B], *static_cast<ParameterUser *>(this)),
-                _m_V(p[Process_::name_V], *static_cast<ParameterUser *>(this))
-            {
-            }
-
-            ~HQETFormFactors() = default;
-
-            static FormFactors<PToV> * make(const Parameters & parameters, const Options & options)
-            {
-                return new HQETFormFactors(parameters, options);
-            }
+            /* form factors as scalars of type T_, i.e., as values or as values and derivatives */
 
-            virtual double v(const double & q2) const
+            template <typename T_> T_ _v(const double & q2) const
             {
                 const double r = _m_V / _m_B;
 
                 // cf. [FKKM2008], eq. (22)
-                return (1.0 + r) / 2.0 / sqrt(r) * _h_v(q2);
+                return (1.0 + r) / 2.0 / sqrt(r) * _h_v<T_>(q2);
             }
 
-            virtual double a_0(const double & q2) const
+            template <typename T_> T_ _a_0(const double & q2) const
             {
                 const double r = _m_V / _m_B;
                 const double w = _w(q2);
 
-                return 1.0 / (2.0 * sqrt(r)) * ((1.0 + w) * _h_a1(q2) + (r * w - 1.0) * _h_a2(q2) + (r - w) * _h_a3(q2));
+                return 1.0 / (2.0 * sqrt(r)) * ((1.0 + w) * _h_a1<T_>(q2) + (r * w - 1.0) * _h_a2<T_>(q2) + (r - w) * _h_a3<T_>(q2));
                 // cf. [FKKM2008], eq. (22)
                 //const double a_30 = (1.0 + r * r - 2.0 * r * w) / (4.0 * r * sqrt(r)) * (r * _h_a2(q2) - _h_a3(q2));
                 //return a_3(q2) - a_30;
             }
 
-            virtual double a_1(const double & q2) const
+            template <typename T_> T_ _a_1(const double & q2) const
             {
                 const double r = _m_V / _m_B;
                 const double w = _w(q2);
 
                 // cf. [FKKM2008], eq. (22)
-                return sqrt(r) * (1.0 + w) / (1.0 + r) * _h_a1(q2);
+                return sqrt(r) * (1.0 + w) / (1.0 + r) * _h_a1<T_>(q2);
             }
 
-            virtual double a_2(const double & q2) const
+            template <typename T_> T_ _a_2(const double & q2) const
             {
                 const double r = _m_V / _m_B;
 
                 // cf. [FKKM2008], eq. (22)
-                return (1.0 + r) / (2.0 * sqrt(r)) * (r * _h_a2(q2) + _h_a3(q2));
+                return (1.0 + r) / (2.0 * sqrt(r)) * (r * _h_a2<T_>(q2) + _h_a3<T_>(q2));
             }
 
-            double a_3(const double & q2) const
+            template <typename T_> T_ _a_3(const double & q2) const
             {
                 const double r = _m_V / _m_B;
 
                 // cf. [FKKM2008], below eq. (6)
-                return ((1.0 + r) * a_1(q2) - (1.0 - r) * a_2(q2)) / (2.0 * r);
+                return ((1.0 + r) * _a_1<T_>(q2) - (1.0 - r) * _a_2<T_>(q2)) / (2.0 * r);
             }
 
-            virtual double a_12(const double & q2) const
+            template <typename T_> T_ _a_12(const double & q2) const
             {
                 const double m_B = this->_m_B(), m_B2 = power_of<2>(m_B);
                 const double m_V = this->_m_V(), m_V2 = power_of<2>(m_V);
                 const double lambda = eos::lambda(m_B2, m_V2, q2);
 
-                double result = (m_B + m_V) * (m_B + m_V) * (m_B2 - m_V2 - q2) * a_1(q2) - lambda * a_2(q2);
+                T_ result = (m_B + m_V) * (m_B + m_V) * (m_B2 - m_V2 - q2) * _a_1<T_>(q2) - lambda * _a_2<T_>(q2);
                 result /= 16.0 * m_B * m_V2 * (m_B + m_V);
 
                 return result;
             }
 
-            virtual double t_1(const double & q2) const
+            template <typename T_> T_ _t_1(const double & q2) const
             {
                 const double r = _m_V / _m_B;
                 const double w = _w(q2);
 
-                return -1.0 / (2.0 * sqrt(r)) * ((1.0 - r) * _h_t2(q2) - (1.0 + r) * _h_t1(q2));
+                return -1.0 / (2.0 * sqrt(r)) * ((1.0 - r) * _h_t2<T_>(q2) - (1.0 + r) * _h_t1<T_>(q2));
             }
 
-            virtual double t_2(const double & q2) const
+            template <typename T_> T_ _t_2(const double & q2) const
             {
                 const double r = _m_V / _m_B;
                 const double w = _w(q2);
 
-                return +1.0 / (2.0 * sqrt(r)) * (2.0 * r * (w + 1.0) / (1.0 + r) * _h_t1(q2) - 2.0 * r * (w - 1.0) / (1.0 - r) * _h_t2(q2));
+                return +1.0 / (2.0 * sqrt(r)) * (2.0 * r * (w + 1.0) / (1.0 + r) * _h_t1<T_>(q2) - 2.0 * r * (w - 1.0) / (1.0 - r) * _h_t2<T_>(q2));
             }
 
-            virtual double t_3(const double & q2) const
+            template <typename T_> T_ _t_3(const double & q2) const
             {
                 const double r = _m_V / _m_B;
 
-                return +1.0 / (2.0 * sqrt(r)) * ((1.0 - r) * _h_t1(q2) - (1.0 + r) * _h_t2(q2) + (1.0 - r * r) * _h_t3(q2));
+                return +1.0 / (2.0 * sqrt(r)) * ((1.0 - r) * _h_t1<T_>(q2) - (1.0 + r) * _h_t2<T_>(q2) + (1.0 - r * r) * _h_t3<T_>(q2));
             }
 
-            virtual double t_23(const double & q2) const
+            template <typename T_> T_ _t_23(const double & q2) const
             {
                 const double m_B = this->_m_B(), m_B2 = power_of<2>(m_B);
                 const double m_V = this->_m_V(), m_V2 = power_of<2>(m_V);
                 const double lambda = eos::lambda(m_B2, m_V2, q2);
 
-                return ((m_B2 - m_V2) * (m_B2 + 3.0 * m_V2 - q2) * t_2(q2) - lambda * t_3(q2)) / (8.0 * m_B * m_V2 * (m_B - m_V));
+                return ((m_B2 - m_V2) * (m_B2 + 3.0 * m_V2 - q2) * _t_2<T_>(q2) - lambda * _t_3<T_>(q2)) / (8.0 * m_B * m_V2 * (m_B - m_V));
+            }
+
+        public:
+            HQETFormFactors(const Parameters & p, const Options & o) :
+                HQETFormFactorBase(p, o, Process_::hqe_prefix),
+                _m_B(p[Process_::name_B], *static_cast<ParameterUser *>(this)),
+                _m_V(p[Process_::name_V], *static_cast<ParameterUser *>(this))
+            {
+            }
+
+            ~HQETFormFactors() = default;
+
+            static FormFactors<PToV> * make(const Parameters & parameters, const Options & options)
+            {
+                return new HQETFormFactors(parameters, options);
+            }
+
+            virtual double v(const double & q2) const
+            {
+                return _v<double>(q2);
+            }
+
+            virtual double a_0(const double & q2) const
+            {
+                return _a_0<double>(q2);
+            }
+
+            virtual double a_1(const double & q2) const
+            {
+                return _a_1<double>(q2);
+            }
+
+            virtual double a_2(const double & q2) const
+            {
+                return _a_2<double>(q2);
+            }
+
+            double a_3(const double & q2) const
+            {
+                return _a_3<double>(q2);
+            }
+
+            virtual double a_12(const double & q2) const
+            {
+                return _a_12<double>(q2);
+            }
+
+            virtual double t_1(const double & q2) const
+            {
+                return _t_1<double>(q2);
+            }
+
+            virtual double t_2(const double & q2) const
+            {
+                return _t_2<double>(q2);
+            }
+
+            virtual double t_3(const double & q2) const
+            {
+                return _t_3<double>(q2);
+            }
+
+            virtual double t_23(const double & q2) const
+            {
+                return _t_23<double>(q2);
+            }
+
+            /*
+             * The derivatives cover the HQE parameters, i.e., the parameters of the Isgur-Wise functions,
+             * mBar, and a. They do not cover the hadron masses, which enter the recoil variable w
+             * and through it the Wilson coefficients.
+             */
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives(const std::string & name, const double & q2) const
+            {
+                using D = Dual<_n>;
+                using FormFactor = D (HQETFormFactors::*)(const double &) const;
+                static const std::map<std::string, FormFactor> form_factors
+                {
+                    { "v",    &HQETFormFactors::template _v<D>    },
+                    { "a_0",  &HQETFormFactors::template _a_0<D>  },
+                    { "a_1",  &HQETFormFactors::template _a_1<D>  },
+                    { "a_2",  &HQETFormFactors::template _a_2<D>  },
+                    { "a_12", &HQETFormFactors::template _a_12<D> },
+                    { "t_1",  &HQETFormFactors::template _t_1<D>  },
+                    { "t_2",  &HQETFormFactors::template _t_2<D>  },
+                    { "t_3",  &HQETFormFactors::template _t_3<D>  },
+                    { "t_23", &HQETFormFactors::template _t_23<D> },
+                };
+
+                auto i = form_factors.find(name);
+                if (form_factors.end() == i)
+                    throw InternalError("HQETFormFactors<PToV>::derivatives: unknown form factor '" + name + "'");
+
+                return paired_derivatives((this->*(i->second))(q2), _ids());
             }
 
             virtual double f_perp(const double &) const
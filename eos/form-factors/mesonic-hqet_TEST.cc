@@ -22,6 +22,8 @@
 #include <eos/form-factors/mesonic-hqet.hh>
 #include <eos/form-factors/mesonic-impl.hh>
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 using namespace test;
@@ -861,6 +863,44 @@ class BToDHQETFormFactorsTest :
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t( 8.0), +0.636037, eps);
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t(10.0), +1.040053, eps);
             }
+
+            // derivatives with respect to the HQE parameters
+            for (const auto & model : { "power-series", "exponential" })
+            {
+                static const double q2 = 4.0;
+
+                Parameters p = Parameters::Defaults();
+                HQETFormFactors<BToD, PToP> ff(p, Options{ { "model-lp", model }, { "z-order-lp", "5" }, { "z-order-sslp", "2" } });
+
+                const std::vector<std::pair<std::string, double (HQETFormFactors<BToD, PToP>::*)(const double &) const>> form_factors
+                {
+                    { "f_p", &HQETFormFactors<BToD, PToP>::f_p },
+                    { "f_0", &HQETFormFactors<BToD, PToP>::f_0 },
+                    { "f_t", &HQETFormFactors<BToD, PToP>::f_t },
+                };
+
+                for (const auto & f : form_factors)
+                {
+                    const auto derivatives = ff.derivatives(f.first, q2);
+                    TEST_CHECK_EQUAL(33u, derivatives.size());
+
+                    for (const auto & d : derivatives)
+                    {
+                        Parameter q = p[d.first];
+                        const double value = q(), h = 1.0e-5 * std::max(1.0, std::abs(value));
+
+                        q = value + h;
+                        const double f_hi = (ff.*(f.second))(q2);
+                        q = value - h;
+                        const double f_lo = (ff.*(f.second))(q2);
+                        q = value;
+
+                        TEST_CHECK_NEARLY_EQUAL(d.second, (f_hi - f_lo) / (2.0 * h), 1.0e-6 * std::max(1.0, std::abs(d.second)));
+                    }
+                }
+
+                TEST_CHECK_THROWS(InternalError, ff.derivatives("f_plus", q2));
+            }
         }
 } b_to_d_hqet_form_factors_test;
 
@@ -1538,6 +1578,44 @@ class BToDstarHQETFormFactorsTest :
 
                 TEST_CHECK_DIAGNOSTICS(diag, ref);
             }
+
+            // derivatives with respect to the HQE parameters
+            {
+                static const double q2 = 4.0;
+
+                Parameters p = Parameters::Defaults();
+                HQETFormFactors<BToDstar, PToV> ff(p, Options{ { "z-order-lp", "3" }, { "z-order-sslp", "2" } });
+
+                const std::vector<std::pair<std::string, double (HQETFormFactors<BToDstar, PToV>::*)(const double &) const>> form_factors
+                {
+                    { "v",    &HQETFormFactors<BToDstar, PToV>::v    },
+                    { "a_0",  &HQETFormFactors<BToDstar, PToV>::a_0  },
+                    { "a_1",  &HQETFormFactors<BToDstar, PToV>::a_1  },
+                    { "a_12", &HQETFormFactors<BToDstar, PToV>::a_12 },
+                    { "t_1",  &HQETFormFactors<BToDstar, PToV>::t_1  },
+                    { "t_23", &HQETFormFactors<BToDstar, PToV>::t_23 },
+                };
+
+                for (const auto & f : form_factors)
+                {
+                    const auto derivatives = ff.derivatives(f.first, q2);
+                    TEST_CHECK_EQUAL(33u, derivatives.size());
+
+                    for (const auto & d : derivatives)
+                    {
+                        Parameter q = p[d.first];
+                        const double value = q(), h = 1.0e-5 * std::max(1.0, std::abs(value));
+
+                        q = value + h;
+                        const double f_hi = (ff.*(f.second))(q2);
+                        q = value - h;
+                        const double f_lo = (ff.*(f.second))(q2);
+                        q = value;
+
+                        TEST_CHECK_NEARLY_EQUAL(d.second, (f_hi - f_lo) / (2.0 * h), 1.0e-6 * std::max(1.0, std::abs(d.second)));
+                    }
+                }
+            }
         }
 } b_to_dstar_hqet_form_factors_test;
 
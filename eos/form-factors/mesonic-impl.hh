@@ -31,6 +31,7 @@
 #include <eos/form-factors/analytic-b-to-p-lcsr.hh>
 #include <eos/form-factors/analytic-b-to-v-lcsr.hh>
 #include <eos/utils/derivative.hh>
+#include <eos/utils/dual.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/model.hh>
 #include <eos/utils/options.hh>
@@ -39,6 +40,7 @@
 
 #include <array>
 #include <limits>
+#include <map>
 
 #include <iostream> // <-- TODO: Remove!
 
@@ -675,6 +677,9 @@ namespace eos
             const double _tau_p, _tau_0;
             const double _z_0;
 
+            // indices of the parameters when computing derivatives
+            enum : unsigned { _i_A0 = 0, _i_A1 = 3, _i_V = 6, _i_T1 = 9, _i_T23 = 12, _i_A12 = 15, _i_T2 = 17, _n = 19 };
+
             static double _calc_tau_0(const double & m_B, const double & m_V)
             {
                 const double tau_p = power_of<2>(m_B + m_V);
@@ -687,19 +692,140 @@ namespace eos
                 return (std::sqrt(_tau_p - s) - std::sqrt(_tau_p - _tau_0)) / (std::sqrt(_tau_p - s) + std::sqrt(_tau_p - _tau_0));
             }
 
-            template <typename Parameter_>
-            double _calc_ff(const double & s, const double & m2_R, const std::array<Parameter_, 3> & a) const
+            template <typename T_>
+            T_ _calc_ff(const double & s, const double & m2_R, const std::array<T_, 3> & a) const
             {
                 const double diff_z = _calc_z(s) - _z_0;
                 return 1.0 / (1.0 - s / m2_R) *
                        (a[0] + a[1] * diff_z + a[2] * power_of<2>(diff_z));
             }
 
+            // the coefficients as scalars of type T_, i.e., as values or as variables for differentiation
+            template <typename T_>
+            static std::array<T_, 3> _coefficients(const std::array<UsedParameter, 3> & a, const unsigned & index)
+            {
+                return {{ make_variable<T_>(a[0], index + 0), make_variable<T_>(a[1], index + 1), make_variable<T_>(a[2], index + 2) }};
+            }
+
             static std::string _par_name(const std::string & ff_name)
             {
                 return std::string(Process_::label) + std::string("::alpha^") + ff_name + std::string("@BSZ2015");
             }
 
+            template <typename T_> T_ _v(const double & s) const
+            {
+                return _calc_ff(s, Process_::mR2_1m, _coefficients<T_>(_a_V, _i_V));
+            }
+
+            template <typename T_> T_ _a_0(const double & s) const
+            {
+                return _calc_ff(s, Process_::mR2_0m, _coefficients<T_>(_a_A0, _i_A0));
+            }
+
+            template <typename T_> T_ _a_1(const double & s) const
+            {
+                return _calc_ff(s, Process_::mR2_1p, _coefficients<T_>(_a_A1, _i_A1));
+            }
+
+            template <typename T_> T_ _a_2(const double & s) const
+            {
+                const double lambda = eos::lambda(_mB2, _mV2, s);
+
+                return (power_of<2>(_mB + _mV) * (_mB2 - _mV2 - s) * _a_1<T_>(s)
+                        - 16.0 * _mB * _mV2 * (_mB + _mV) * _a_12<T_>(s)) / lambda;
+            }
+
+            template <typename T_> T_ _a_12(const double & s) const
+            {
+                // use constraint (B.6) in [BSZ2015] to remove A_12(0)
+                std::array<T_, 3> values
+                {{
+                    make_variable<T_>(_kin_factor * _a_A0[0], _i_A0, _kin_factor),
+                    make_variable<T_>(_a_A12[1 - 1], _i_A12 + 0),
+                    make_variable<T_>(_a_A12[2 - 1], _i_A12 + 1),
+                }};
+
+                return _calc_ff(s, Process_::mR2_1p, values);
+            }
+
+            template <typename T_> T_ _t_1(const double & s) const
+            {
+                return _calc_ff(s, Process_::mR2_1m, _coefficients<T_>(_a_T1, _i_T1));
+            }
+
+            template <typename T_> T_ _t_2(const double & s) const
+            {
+                // use constraint T_1(0) = T_2(0) to replace T_2(0)
+                std::array<T_, 3> values
+                {{
+                    make_variable<T_>(_a_T1[0], _i_T1),
+                    make_variable<T_>(_a_T2[1 - 1], _i_T2 + 0),
+                    make_variable<T_>(_a_T2[2 - 1], _i_T2 + 1),
+                }};
+                return _calc_ff(s, Process_::mR2_1p, values);
+            }
+
+            template <typename T_> T_ _t_3(const double & s) const
+            {
+                const double lambda = eos::lambda(_mB2, _mV2, s);
+
+                return ((_mB2 - _mV2) * (_mB2 + 3.0 * _mV2 - s) * _t_2<T_>(s)
+                        - 8.0 * _mB * _mV2 * (_mB - _mV) * _t_23<T_>(s)) / lambda;
+            }
+
+            template <typename T_> T_ _t_23(const double & s) const
+            {
+                return _calc_ff(s, Process_::mR2_1p, _coefficients<T_>(_a_T23, _i_T23));
+            }
+
+            template <typename T_> T_ _f_perp(const double & s) const
+            {
+                const double lambda = eos::lambda(_mB2, _mV2, s);
+
+                return pow(2*lambda, 0.5) / _mB / (_mB + _mV) * _v<T_>(s);
+            }
+
+            template <typename T_> T_ _f_para(const double & s) const
+            {
+                return pow(2, 0.5) * (_mB + _mV) / _mB * _a_1<T_>(s);
+            }
+
+            template <typename T_> T_ _f_long(const double & s) const
+            {
+                const double lambda = eos::lambda(_mB2, _mV2, s);
+
+                return ((_mB2 - _mV2 - s) * pow(_mB + _mV, 2) * _a_1<T_>(s) - lambda * _a_2<T_>(s))
+                        / (2 * _mV * _mB2 * (_mB + _mV));
+            }
+
+            template <typename T_> T_ _f_perp_T(const double & s) const
+            {
+                const double lambda = eos::lambda(_mB2, _mV2, s);
+
+                return pow(2*lambda, 0.5) / _mB2 * _t_1<T_>(s);
+            }
+
+            template <typename T_> T_ _f_para_T(const double & s) const
+            {
+                return pow(2, 0.5) * (_mB2 - _mV2) / _mB2 * _t_2<T_>(s);
+            }
+
+            template <typename T_> T_ _f_long_T(const double & s) const
+            {
+                const double lambda = eos::lambda(_mB2, _mV2, s);
+
+                return s * (_mB2 + 3*_mV2 - s) / (2 * pow(_mB, 3) * _mV) * _t_2<T_>(s)
+                        - s * lambda / (2 * pow(_mB, 3) * _mV * (_mB2 - _mV2)) * _t_3<T_>(s);
+            }
+
+            template <typename T_> T_ _f_long_T_Normalized(const double & s) const
+            {
+                const double lambda = eos::lambda(_mB2, _mV2, s);
+
+                return _mB2 * (_mB2 + 3*_mV2 - s) / (2 * pow(_mB, 3) * _mV) * _t_2<T_>(s)
+                        - _mB2 * lambda / (2 * pow(_mB, 3) * _mV * (_mB2 - _mV2)) * _t_3<T_>(s);
+            }
+
         public:
             BSZ2015FormFactors(const Parameters & p, const Options &) :
                 _a_A0{{  UsedParameter(p[_par_name("A0_0")],  *this),
@@ -743,116 +869,186 @@ namespace eos
 
             virtual double v(const double & s) const
             {
-                return _calc_ff(s, Process_::mR2_1m, _a_V);
+                return _v<double>(s);
             }
 
             virtual double a_0(const double & s) const
             {
-                return _calc_ff(s, Process_::mR2_0m, _a_A0);
+                return _a_0<double>(s);
             }
 
             virtual double a_1(const double & s) const
             {
-                return _calc_ff(s, Process_::mR2_1p, _a_A1);
+                return _a_1<double>(s);
             }
 
             virtual double a_2(const double & s) const
             {
-                const double lambda = eos::lambda(_mB2, _mV2, s);
-
-                return (power_of<2>(_mB + _mV) * (_mB2 - _mV2 - s) * a_1(s)
-                        - 16.0 * _mB * _mV2 * (_mB + _mV) * a_12(s)) / lambda;
+                return _a_2<double>(s);
             }
 
             virtual double a_12(const double & s) const
             {
-                // use constraint (B.6) in [BSZ2015] to remove A_12(0)
-                std::array<double, 3> values
-                {{
-                    _kin_factor * _a_A0[0],
-                    _a_A12[1 - 1],
-                    _a_A12[2 - 1],
-                }};
-
-                return _calc_ff(s, Process_::mR2_1p, values);
+                return _a_12<double>(s);
             }
 
             virtual double t_1(const double & s) const
             {
-                return _calc_ff(s, Process_::mR2_1m, _a_T1);
+                return _t_1<double>(s);
             }
 
             virtual double t_2(const double & s) const
             {
-                // use constraint T_1(0) = T_2(0) to replace T_2(0)
-                std::array<double, 3> values
-                {{
-                    _a_T1[0],
-                    _a_T2[1 - 1],
-                    _a_T2[2 - 1],
-                }};
-                return _calc_ff(s, Process_::mR2_1p, values);
+                return _t_2<double>(s);
             }
 
             virtual double t_3(const double & s) const
             {
-                const double lambda = eos::lambda(_mB2, _mV2, s);
-
-                return ((_mB2 - _mV2) * (_mB2 + 3.0 * _mV2 - s) * t_2(s)
-                        - 8.0 * _mB * _mV2 * (_mB - _mV) * t_23(s)) / lambda;
+                return _t_3<double>(s);
             }
 
             virtual double t_23(const double & s) const
             {
-                return _calc_ff(s, Process_::mR2_1p, _a_T23);
+                return _t_23<double>(s);
             }
 
             virtual double f_perp(const double & s) const
             {
-                const double lambda = eos::lambda(_mB2, _mV2, s);
-
-                return pow(2*lambda, 0.5) / _mB / (_mB + _mV) * v(s);
+                return _f_perp<double>(s);
             }
 
             virtual double f_para(const double & s) const
             {
-                return pow(2, 0.5) * (_mB + _mV) / _mB * a_1(s);
+                return _f_para<double>(s);
             }
 
             virtual double f_long(const double & s) const
             {
-                const double lambda = eos::lambda(_mB2, _mV2, s);
-
-                return ((_mB2 - _mV2 - s) * pow(_mB + _mV, 2) * a_1(s) - lambda * a_2(s))
-                        / (2 * _mV * _mB2 * (_mB + _mV));
+                return _f_long<double>(s);
             }
 
             virtual double f_perp_T(const double & s) const
             {
-                const double lambda = eos::lambda(_mB2, _mV2, s);
-
-                return pow(2*lambda, 0.5) / _mB2 * t_1(s);
+                return _f_perp_T<double>(s);
             }
 
             virtual double f_para_T(const double & s) const
             {
-                return pow(2, 0.5) * (_mB2 - _mV2) / _mB2 * t_2(s);
+                return _f_para_T<double>(s);
             }
 
             virtual double f_long_T(const double & s) const
             {
-                const double lambda = eos::lambda(_mB2, _mV2, s);
-
-                return s * (_mB2 + 3*_mV2 - s) / (2 * pow(_mB, 3) * _mV) * t_2(s)
-                        - s * lambda / (2 * pow(_mB, 3) * _mV * (_mB2 - _mV2)) * t_3(s);
+                return _f_long_T<double>(s);
             }
 
             virtual double f_long_T_Normalized(const double & s) const
             {
-                const double lambda = eos::lambda(_mB2, _mV2, s);
+                return _f_long_T_Normalized<double>(s);
+            }
+
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives(const std::string & name, const double & s) const
+            {
+                using D = Dual<_n>;
+                using FormFactor = D (BSZ2015FormFactors::*)(const double &) const;
+                static const std::map<std::string, FormFactor> form_factors
+                {
+                    { "v",                   &BSZ2015FormFactors::template _v<D>                   },
+                    { "a_0",                 &BSZ2015FormFactors::template _a_0<D>                 },
+                    { "a_1",                 &BSZ2015FormFactors::template _a_1<D>                 },
+                    { "a_2",                 &BSZ2015FormFactors::template _a_2<D>                 },
+                    { "a_12",                &BSZ2015FormFactors::template _a_12<D>                },
+                    { "t_1",                 &BSZ2015FormFactors::template _t_1<D>                 },
+                    { "t_2",                 &BSZ2015FormFactors::template _t_2<D>                 },
+                    { "t_3",                 &BSZ2015FormFactors::template _t_3<D>                 },
+                    { "t_23",                &BSZ2015FormFactors::template _t_23<D>                },
+                    { "f_perp",              &BSZ2015FormFactors::template _f_perp<D>              },
+                    { "f_para",              &BSZ2015FormFactors::template _f_para<D>              },
+                    { "f_long",              &BSZ2015FormFactors::template _f_long<D>              },
+                    { "f_perp_T",            &BSZ2015FormFactors::template _f_perp_T<D>            },
+                    { "f_para_T",            &BSZ2015FormFactors::template _f_para_T<D>            },
+                    { "f_long_T",            &BSZ2015FormFactors::template _f_long_T<D>            },
+                    { "f_long_T_Normalized", &BSZ2015FormFactors::template _f_long_T_Normalized<D> },
+                };
+
+                auto i = form_factors.find(name);
+                if (form_factors.end() == i)
+                    throw InternalError("BSZ2015FormFactors<PToV>::derivatives: unknown form factor '" + name + "'");
+
+                const std::array<Parameter::Id, _n> ids
+                {{
+                    _a_A0[0].id(),  _a_A0[1].id(),  _a_A0[2].id(),
+                    _a_A1[0].id(),  _a_A1[1].id(),  _a_A1[2].id(),
+                    _a_V[0].id(),   _a_V[1].id(),   _a_V[2].id(),
+                    _a_T1[0].id(),  _a_T1[1].id(),  _a_T1[2].id(),
+                    _a_T23[0].id(), _a_T23[1].id(), _a_T23[2].id(),
+                    _a_A12[0].id(), _a_A12[1].id(),
+                    _a_T2[0].id(),  _a_T2[1].id()
+                }};
 
-                return _mB2 * (_mB2 + 3*_mV2 - s) / (2 * pow(_mB, 3) * _mV) * t_2(s)
-                        - _mB2 * lambda / (2 * pow(_mB, 3) * _mV * (_mB2 - _mV2)) * t_3(s);
+                return paired_derivatives((this->*(i->second))(s), ids);
+            }
+
+            virtual void evaluate(const double * s, const std::size_t & n, Values & result) const
+            {
+                result.resize(n);
+
+                // read the parameters only once for all points
+                const std::array<double, 3> a_A0{{  _a_A0[0],  _a_A0[1],  _a_A0[2]  }};
+                const std::array<double, 3> a_A1{{  _a_A1[0],  _a_A1[1],  _a_A1[2]  }};
+                const std::array<double, 3> a_V{{   _a_V[0],   _a_V[1],   _a_V[2]   }};
+                const std::array<double, 3> a_T1{{  _a_T1[0],  _a_T1[1],  _a_T1[2]  }};
+                const std::array<double, 3> a_T23{{ _a_T23[0], _a_T23[1], _a_T23[2] }};
+                // use constraint (B.6) in [BSZ2015] to remove A_12(0), and T_1(0) = T_2(0) to replace T_2(0)
+                const std::array<double, 3> a_A12{{ _kin_factor * a_A0[0], _a_A12[0], _a_A12[1] }};
+                const std::array<double, 3> a_T2{{  a_T1[0],               _a_T2[0],  _a_T2[1]  }};
+
+                for (std::size_t i = 0 ; i < n ; ++i)
+                {
+                    // z(s) and the pole factors are shared among all form factors
+                    const double diff_z = _calc_z(s[i]) - _z_0, diff_z2 = diff_z * diff_z;
+                    const double pole_0m = 1.0 / (1.0 - s[i] / Process_::mR2_0m);
+                    const double pole_1m = 1.0 / (1.0 - s[i] / Process_::mR2_1m);
+                    const double pole_1p = 1.0 / (1.0 - s[i] / Process_::mR2_1p);
+                    const double lambda  = eos::lambda(_mB2, _mV2, s[i]);
+
+                    const auto series = [&] (const std::array<double, 3> & a) { return a[0] + a[1] * diff_z + a[2] * diff_z2; };
+
+                    // A_2 and T_3 derive from A_1, A_12 and T_2, T_23, respectively
+                    const double a_1  = result.selected(ff_a_1  | ff_a_2) ? pole_1p * series(a_A1)  : 0.0;
+                    const double a_12 = result.selected(ff_a_12 | ff_a_2) ? pole_1p * series(a_A12) : 0.0;
+                    const double t_2  = result.selected(ff_t_2  | ff_t_3) ? pole_1p * series(a_T2)  : 0.0;
+                    const double t_23 = result.selected(ff_t_23 | ff_t_3) ? pole_1p * series(a_T23) : 0.0;
+
+                    if (result.selected(ff_v))
+                        result.v[i]    = pole_1m * series(a_V);
+
+                    if (result.selected(ff_a_0))
+                        result.a_0[i]  = pole_0m * series(a_A0);
+
+                    if (result.selected(ff_a_1))
+                        result.a_1[i]  = a_1;
+
+                    if (result.selected(ff_a_12))
+                        result.a_12[i] = a_12;
+
+                    if (result.selected(ff_a_2))
+                        result.a_2[i]  = (power_of<2>(_mB + _mV) * (_mB2 - _mV2 - s[i]) * a_1
+                                         - 16.0 * _mB * _mV2 * (_mB + _mV) * a_12) / lambda;
+
+                    if (result.selected(ff_t_1))
+                        result.t_1[i]  = pole_1m * series(a_T1);
+
+                    if (result.selected(ff_t_2))
+                        result.t_2[i]  = t_2;
+
+                    if (result.selected(ff_t_23))
+                        result.t_23[i] = t_23;
+
+                    if (result.selected(ff_t_3))
+                        result.t_3[i]  = ((_mB2 - _mV2) * (_mB2 + 3.0 * _mV2 - s[i]) * t_2
+                                         - 8.0 * _mB * _mV2 * (_mB - _mV) * t_23) / lambda;
+                }
             }
     };
 
@@ -887,6 +1083,39 @@ namespace eos
                     / (std::sqrt(tau_p - s) + std::sqrt(tau_p - tau_0));
             }
 
+            // the number of parameters when computing derivatives
+            enum : unsigned { _n = 6 };
+
+            template <typename T_> T_ _f_p(const double & s) const
+            {
+                const double z = _z(s), z2 = z * z, z3 = z * z2;
+                const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02;
+                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03;
+
+                const T_ f_plus_0 = make_variable<T_>(_f_plus_0, 0),
+                         b_plus_1 = make_variable<T_>(_b_plus_1, 1),
+                         b_plus_2 = make_variable<T_>(_b_plus_2, 2);
+
+                return f_plus_0 / (1.0 - s / Process_::m2_Br1m) * (1.0 + b_plus_1 * (zbar - z3bar / 3.0) + b_plus_2 * (z2bar + 2.0 * z3bar / 3.0));
+            }
+
+            template <typename T_> T_ _f_0(const double & s) const
+            {
+                const double z = _z(s), z2 = z * z, z3 = z * z2;
+                const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02;
+                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03;
+
+                // note that f_0(0) = f_+(0)!
+                // for f_0(s) we do not have an equation of motion to express _b_zero_K in terms of the
+                // other coefficients!
+                const T_ f_plus_0 = make_variable<T_>(_f_plus_0, 0),
+                         b_zero_1 = make_variable<T_>(_b_zero_1, 3),
+                         b_zero_2 = make_variable<T_>(_b_zero_2, 4),
+                         b_zero_3 = make_variable<T_>(_b_zero_3, 5);
+
+                return f_plus_0 / (1.0 - s / Process_::m2_Br0p) * (1.0 + b_zero_1 * zbar + b_zero_2 * z2bar + b_zero_3 * z3bar);
+            }
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options &) :
                 _f_plus_0(p[std::string(Process_::label) + "::f_+(0)@BCL2008"], *this),
@@ -899,23 +1128,12 @@ namespace eos
             }
             virtual double f_p(const double & s) const
             {
-                const double z = _z(s), z2 = z * z, z3 = z * z2;
-                const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02;
-                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03;
-
-                return _f_plus_0 / (1.0 - s / Process_::m2_Br1m) * (1.0 + _b_plus_1 * (zbar - z3bar / 3.0) + _b_plus_2 * (z2bar + 2.0 * z3bar / 3.0));
+                return _f_p<double>(s);
             }
 
             virtual double f_0(const double & s) const
             {
-                const double z = _z(s), z2 = z * z, z3 = z * z2;
-                const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02;
-                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03;
-
-                // note that f_0(0) = f_+(0)!
-                // for f_0(s) we do not have an equation of motion to express _b_zero_K in terms of the
-                // other coefficients!
-                return _f_plus_0 / (1.0 - s / Process_::m2_Br0p) * (1.0 + _b_zero_1 * zbar + _b_zero_2 * z2bar + _b_zero_3 * z3bar);
+                return _f_0<double>(s);
             }
 
             virtual double f_t(const double &) const
@@ -931,6 +1149,29 @@ namespace eos
 
                 return 0.0;
             }
+
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives(const std::string & name, const double & s) const
+            {
+                using D = Dual<_n>;
+
+                const std::array<Parameter::Id, _n> ids
+                {{
+                    _f_plus_0.id(),
+                    _b_plus_1.id(),
+                    _b_plus_2.id(),
+                    _b_zero_1.id(),
+                    _b_zero_2.id(),
+                    _b_zero_3.id()
+                }};
+
+                if ("f_p" == name)
+                    return paired_derivatives(_f_p<D>(s), ids);
+
+                if ("f_0" == name)
+                    return paired_derivatives(_f_0<D>(s), ids);
+
+                throw InternalError("BCL2008FormFactors::derivatives: unknown form factor '" + name + "'");
+            }
     };
 
     template <typename Process_> class BCL2008FormFactorBase<Process_, 4u, false> :
@@ -958,6 +1199,41 @@ namespace eos
                     / (std::sqrt(tau_p - s) + std::sqrt(tau_p - tau_0));
             }
 
+            // the number of parameters when computing derivatives
+            enum : unsigned { _n = 8 };
+
+            template <typename T_> T_ _f_p(const double & s) const
+            {
+                const double z = _z(s), z2 = z * z, z3 = z * z2, z4 = z * z3;
+                const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03;
+                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04;
+
+                const T_ f_plus_0 = make_variable<T_>(_f_plus_0, 0),
+                         b_plus_1 = make_variable<T_>(_b_plus_1, 1),
+                         b_plus_2 = make_variable<T_>(_b_plus_2, 2),
+                         b_plus_3 = make_variable<T_>(_b_plus_3, 3);
+
+                return f_plus_0 / (1.0 - s / Process_::m2_Br1m) * (1.0 + b_plus_1 * (zbar + z4bar / 4.0) + b_plus_2 * (z2bar - z4bar / 2.0) + b_plus_3 * (z3bar + 3.0 * z4bar / 4.0));
+            }
+
+            template <typename T_> T_ _f_0(const double & s) const
+            {
+                const double z = _z(s), z2 = z * z, z3 = z * z2, z4 = z * z3;
+                const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03;
+                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04;
+
+                // note that f_0(0) = f_+(0)!
+                // for f_0(s) we do not have an equation of motion to express _b_zero_K in terms of the
+                // other coefficients!
+                const T_ f_plus_0 = make_variable<T_>(_f_plus_0, 0),
+                         b_zero_1 = make_variable<T_>(_b_zero_1, 4),
+                         b_zero_2 = make_variable<T_>(_b_zero_2, 5),
+                         b_zero_3 = make_variable<T_>(_b_zero_3, 6),
+                         b_zero_4 = make_variable<T_>(_b_zero_4, 7);
+
+                return f_plus_0 / (1.0 - s / Process_::m2_Br0p) * (1.0 + b_zero_1 * zbar + b_zero_2 * z2bar + b_zero_3 * z3bar + b_zero_4 * z4bar);
+            }
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options &) :
                 _f_plus_0(p[std::string(Process_::label) + "::f_+(0)@BCL2008"], *this),
@@ -972,23 +1248,12 @@ namespace eos
             }
             virtual double f_p(const double & s) const
             {
-                const double z = _z(s), z2 = z * z, z3 = z * z2, z4 = z * z3;
-                const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03;
-                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04;
-
-                return _f_plus_0 / (1.0 - s / Process_::m2_Br1m) * (1.0 + _b_plus_1 * (zbar + z4bar / 4.0) + _b_plus_2 * (z2bar - z4bar / 2.0) + _b_plus_3 * (z3bar + 3.0 * z4bar / 4.0));
+                return _f_p<double>(s);
             }
 
             virtual double f_0(const double & s) const
             {
-                const double z = _z(s), z2 = z * z, z3 = z * z2, z4 = z * z3;
-                const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03;
-                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04;
-
-                // note that f_0(0) = f_+(0)!
-                // for f_0(s) we do not have an equation of motion to express _b_zero_K in terms of the
-                // other coefficients!
-                return _f_plus_0 / (1.0 - s / Process_::m2_Br0p) * (1.0 + _b_zero_1 * zbar + _b_zero_2 * z2bar + _b_zero_3 * z3bar + _b_zero_4 * z4bar);
+                return _f_0<double>(s);
             }
 
             virtual double f_t(const double &) const
@@ -1004,6 +1269,31 @@ namespace eos
 
                 return 0.0;
             }
+
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives(const std::string & name, const double & s) const
+            {
+                using D = Dual<_n>;
+
+                const std::array<Parameter::Id, _n> ids
+                {{
+                    _f_plus_0.id(),
+                    _b_plus_1.id(),
+                    _b_plus_2.id(),
+                    _b_plus_3.id(),
+                    _b_zero_1.id(),
+                    _b_zero_2.id(),
+                    _b_zero_3.id(),
+                    _b_zero_4.id()
+                }};
+
+                if ("f_p" == name)
+                    return paired_derivatives(_f_p<D>(s), ids);
+
+                if ("f_0" == name)
+                    return paired_derivatives(_f_0<D>(s), ids);
+
+                throw InternalError("BCL2008FormFactors::derivatives: unknown form factor '" + name + "'");
+            }
     };
 
     template <typename Process_> class BCL2008FormFactorBase<Process_, 5u, false> :
@@ -1031,6 +1321,43 @@ namespace eos
                     / (std::sqrt(tau_p - s) + std::sqrt(tau_p - tau_0));
             }
 
+            // the number of parameters when computing derivatives
+            enum : unsigned { _n = 10 };
+
+            template <typename T_> T_ _f_p(const double & s) const
+            {
+                const double z = _z(s), z2 = z * z, z3 = z * z2, z4 = z * z3, z5 = z * z4;
+                const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03, z05 = z0 * z04;
+                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04, z5bar = z5 - z05;
+
+                const T_ f_plus_0 = make_variable<T_>(_f_plus_0, 0),
+                         b_plus_1 = make_variable<T_>(_b_plus_1, 1),
+                         b_plus_2 = make_variable<T_>(_b_plus_2, 2),
+                         b_plus_3 = make_variable<T_>(_b_plus_3, 3),
+                         b_plus_4 = make_variable<T_>(_b_plus_4, 4);
+
+                return f_plus_0 / (1.0 - s / Process_::m2_Br1m) * (1.0 + b_plus_1 * (zbar - z5bar / 5.0) + b_plus_2 * (z2bar + 2.0 * z5bar / 5.0) + b_plus_3 * (z3bar - 3.0 * z5bar / 5.0) + b_plus_4 * (z4bar + 4.0 * z5bar / 5.0));
+            }
+
+            template <typename T_> T_ _f_0(const double & s) const
+            {
+                const double z = _z(s), z2 = z * z, z3 = z * z2, z4 = z * z3, z5 = z * z4;
+                const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03, z05 = z0 * z04;
+                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04, z5bar = z5 - z05;
+
+                // note that f_0(0) = f_+(0)!
+                // for f_0(s) we do not have an equation of motion to express _b_zero_K in terms of the
+                // other coefficients!
+                const T_ f_plus_0 = make_variable<T_>(_f_plus_0, 0),
+                         b_zero_1 = make_variable<T_>(_b_zero_1, 5),
+                         b_zero_2 = make_variable<T_>(_b_zero_2, 6),
+                         b_zero_3 = make_variable<T_>(_b_zero_3, 7),
+                         b_zero_4 = make_variable<T_>(_b_zero_4, 8),
+                         b_zero_5 = make_variable<T_>(_b_zero_5, 9);
+
+                return f_plus_0 / (1.0 - s / Process_::m2_Br0p) * (1.0 + b_zero_1 * zbar + b_zero_2 * z2bar + b_zero_3 * z3bar + b_zero_4 * z4bar + b_zero_5 * z5bar);
+            }
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options &) :
                 _f_plus_0(p[std::string(Process_::label) + "::f_+(0)@BCL2008"], *this),
@@ -1048,23 +1375,12 @@ namespace eos
             }
             virtual double f_p(const double & s) const
             {
-                const double z = _z(s), z2 = z * z, z3 = z * z2, z4 = z * z3, z5 = z * z4;
-                const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03, z05 = z0 * z04;
-                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04, z5bar = z5 - z05;
-
-                return _f_plus_0 / (1.0 - s / Process_::m2_Br1m) * (1.0 + _b_plus_1 * (zbar - z5bar / 5.0) + _b_plus_2 * (z2bar + 2.0 * z5bar / 5.0) + _b_plus_3 * (z3bar - 3.0 * z5bar / 5.0) + _b_plus_4 * (z4bar + 4.0 * z5bar / 5.0));
+                return _f_p<double>(s);
             }
 
             virtual double f_0(const double & s) const
             {
-                const double z = _z(s), z2 = z * z, z3 = z * z2, z4 = z * z3, z5 = z * z4;
-                const double z0 = _z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03, z05 = z0 * z04;
-                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04, z5bar = z5 - z05;
-
-                // note that f_0(0) = f_+(0)!
-                // for f_0(s) we do not have an equation of motion to express _b_zero_K in terms of the
-                // other coefficients!
-                return _f_plus_0 / (1.0 - s / Process_::m2_Br0p) * (1.0 + _b_zero_1 * zbar + _b_zero_2 * z2bar + _b_zero_3 * z3bar + _b_zero_4 * z4bar + _b_zero_5 * z5bar);
+                return _f_0<double>(s);
             }
 
             virtual double f_t(const double &) const
@@ -1080,6 +1396,33 @@ namespace eos
 
                 return 0.0;
             }
+
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives(const std::string & name, const double & s) const
+            {
+                using D = Dual<_n>;
+
+                const std::array<Parameter::Id, _n> ids
+                {{
+                    _f_plus_0.id(),
+                    _b_plus_1.id(),
+                    _b_plus_2.id(),
+                    _b_plus_3.id(),
+                    _b_plus_4.id(),
+                    _b_zero_1.id(),
+                    _b_zero_2.id(),
+                    _b_zero_3.id(),
+                    _b_zero_4.id(),
+                    _b_zero_5.id()
+                }};
+
+                if ("f_p" == name)
+                    return paired_derivatives(_f_p<D>(s), ids);
+
+                if ("f_0" == name)
+                    return paired_derivatives(_f_0<D>(s), ids);
+
+                throw InternalError("BCL2008FormFactors::derivatives: unknown form factor '" + name + "'");
+            }
     };
 
     template <typename Process_> class BCL2008FormFactorBase<Process_, 3u, true> :
@@ -1096,6 +1439,22 @@ namespace eos
              */
             UsedParameter _f_t_0,    _b_t_1,    _b_t_2;
 
+            // the number of tensor parameters when computing derivatives
+            enum : unsigned { _n_t = 3 };
+
+            template <typename T_> T_ _f_t(const double & s) const
+            {
+                const double z = this->_z(s), z2 = z * z, z3 = z * z2;
+                const double z0 = this->_z(0), z02 = z0 * z0, z03 = z0 * z02;
+                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03;
+
+                const T_ f_t_0 = make_variable<T_>(_f_t_0, 0),
+                         b_t_1 = make_variable<T_>(_b_t_1, 1),
+                         b_t_2 = make_variable<T_>(_b_t_2, 2);
+
+                return f_t_0 / (1.0 - s / Process_::m2_Br1m) * (1.0 + b_t_1 * (zbar - z3bar / 3.0) + b_t_2 * (z2bar + 2.0 * z3bar / 3.0));
+            }
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options & o) :
                 BCL2008FormFactorBase<Process_, 3u, false>(p, o),
@@ -1107,11 +1466,22 @@ namespace eos
 
             virtual double f_t(const double & s) const
             {
-                const double z = this->_z(s), z2 = z * z, z3 = z * z2;
-                const double z0 = this->_z(0), z02 = z0 * z0, z03 = z0 * z02;
-                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03;
+                return _f_t<double>(s);
+            }
 
-                return _f_t_0 / (1.0 - s / Process_::m2_Br1m) * (1.0 + _b_t_1 * (zbar - z3bar / 3.0) + _b_t_2 * (z2bar + 2.0 * z3bar / 3.0));
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives(const std::string & name, const double & s) const
+            {
+                if ("f_t" != name)
+                    return BCL2008FormFactorBase<Process_, 3u, false>::derivatives(name, s);
+
+                const std::array<Parameter::Id, _n_t> ids
+                {{
+                    _f_t_0.id(),
+                    _b_t_1.id(),
+                    _b_t_2.id()
+                }};
+
+                return paired_derivatives(_f_t<Dual<_n_t>>(s), ids);
             }
     };
 
@@ -1129,6 +1499,23 @@ namespace eos
              */
             UsedParameter _f_t_0,    _b_t_1,    _b_t_2,    _b_t_3;
 
+            // the number of tensor parameters when computing derivatives
+            enum : unsigned { _n_t = 4 };
+
+            template <typename T_> T_ _f_t(const double & s) const
+            {
+                const double z = this->_z(s), z2 = z * z, z3 = z * z2, z4 = z * z3;
+                const double z0 = this->_z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03;
+                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04;
+
+                const T_ f_t_0 = make_variable<T_>(_f_t_0, 0),
+                         b_t_1 = make_variable<T_>(_b_t_1, 1),
+                         b_t_2 = make_variable<T_>(_b_t_2, 2),
+                         b_t_3 = make_variable<T_>(_b_t_3, 3);
+
+                return f_t_0 / (1.0 - s / Process_::m2_Br1m) * (1.0 + b_t_1 * (zbar + z4bar / 4.0) + b_t_2 * (z2bar - z4bar / 2.0) + b_t_3 * (z3bar + 3.0 * z4bar / 4.0));
+            }
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options & o) :
                 BCL2008FormFactorBase<Process_, 4u, false>(p, o),
@@ -1142,11 +1529,23 @@ namespace eos
 
             virtual double f_t(const double & s) const
             {
-                const double z = this->_z(s), z2 = z * z, z3 = z * z2, z4 = z * z3;
-                const double z0 = this->_z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03;
-                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04;
+                return _f_t<double>(s);
+            }
 
-                return _f_t_0 / (1.0 - s / Process_::m2_Br1m) * (1.0 + _b_t_1 * (zbar + z4bar / 4.0) + _b_t_2 * (z2bar - z4bar / 2.0) + _b_t_3 * (z3bar + 3.0 * z4bar / 4.0));
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives(const std::string & name, const double & s) const
+            {
+                if ("f_t" != name)
+                    return BCL2008FormFactorBase<Process_, 4u, false>::derivatives(name, s);
+
+                const std::array<Parameter::Id, _n_t> ids
+                {{
+                    _f_t_0.id(),
+                    _b_t_1.id(),
+                    _b_t_2.id(),
+                    _b_t_3.id()
+                }};
+
+                return paired_derivatives(_f_t<Dual<_n_t>>(s), ids);
             }
     };
 
@@ -1164,6 +1563,24 @@ namespace eos
              */
             UsedParameter _f_t_0,    _b_t_1,    _b_t_2,    _b_t_3,    _b_t_4;
 
+            // the number of tensor parameters when computing derivatives
+            enum : unsigned { _n_t = 5 };
+
+            template <typename T_> T_ _f_t(const double & s) const
+            {
+                const double z = this->_z(s), z2 = z * z, z3 = z * z2, z4 = z * z3, z5 = z * z4;
+                const double z0 = this->_z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03, z05 = z0 * z04;
+                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04, z5bar = z5 - z05;
+
+                const T_ f_t_0 = make_variable<T_>(_f_t_0, 0),
+                         b_t_1 = make_variable<T_>(_b_t_1, 1),
+                         b_t_2 = make_variable<T_>(_b_t_2, 2),
+                         b_t_3 = make_variable<T_>(_b_t_3, 3),
+                         b_t_4 = make_variable<T_>(_b_t_4, 4);
+
+                return f_t_0 / (1.0 - s / Process_::m2_Br1m) * (1.0 + b_t_1 * (zbar - z5bar / 5.0) + b_t_2 * (z2bar + 2.0 * z5bar / 5.0) + b_t_3 * (z3bar - 3.0 * z5bar / 5.0) + b_t_4 * (z4bar + 4.0 * z5bar / 5.0));
+            }
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options & o) :
                 BCL2008FormFactorBase<Process_, 5u, false>(p, o),
@@ -1178,11 +1595,24 @@ namespace eos
 
             virtual double f_t(const double & s) const
             {
-                const double z = this->_z(s), z2 = z * z, z3 = z * z2, z4 = z * z3, z5 = z * z4;
-                const double z0 = this->_z(0), z02 = z0 * z0, z03 = z0 * z02, z04 = z0 * z03, z05 = z0 * z04;
-                const double zbar = z - z0, z2bar = z2 - z02, z3bar = z3 - z03, z4bar = z4 - z04, z5bar = z5 - z05;
+                return _f_t<double>(s);
+            }
+
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives(const std::string & name, const double & s) const
+            {
+                if ("f_t" != name)
+                    return BCL2008FormFactorBase<Process_, 5u, false>::derivatives(name, s);
 
-                return _f_t_0 / (1.0 - s / Process_::m2_Br1m) * (1.0 + _b_t_1 * (zbar - z5bar / 5.0) + _b_t_2 * (z2bar + 2.0 * z5bar / 5.0) + _b_t_3 * (z3bar - 3.0 * z5bar / 5.0) + _b_t_4 * (z4bar + 4.0 * z5bar / 5.0));
+                const std::array<Parameter::Id, _n_t> ids
+                {{
+                    _f_t_0.id(),
+                    _b_t_1.id(),
+                    _b_t_2.id(),
+                    _b_t_3.id(),
+                    _b_t_4.id()
+                }};
+
+                return paired_derivatives(_f_t<Dual<_n_t>>(s), ids);
             }
     };
 
@@ -1215,6 +1645,9 @@ namespace eos
             const double _tau_p, _tau_0;
             const double _z_0;
 
+            // indices of the parameters when computing derivatives
+            enum : unsigned { _i_fp = 0, _i_ft = 3, _i_fz = 6, _n = 8 };
+
             static double _calc_tau_0(const double & m_B, const double & m_P)
             {
                 const double tau_p = power_of<2>(m_B + m_P);
@@ -1227,19 +1660,54 @@ namespace eos
                 return (std::sqrt(_tau_p - s) - std::sqrt(_tau_p - _tau_0)) / (std::sqrt(_tau_p - s) + std::sqrt(_tau_p - _tau_0));
             }
 
-            template <typename Parameter_>
-            double _calc_ff(const double & s, const double & m2_R, const std::array<Parameter_, 3> & a) const
+            template <typename T_>
+            T_ _calc_ff(const double & s, const double & m2_R, const std::array<T_, 3> & a) const
             {
                 const double diff_z = _calc_z(s) - _z_0;
                 return 1.0 / (1.0 - s / m2_R) *
                        (a[0] + a[1] * diff_z + a[2] * power_of<2>(diff_z));
             }
 
+            // the coefficients as scalars of type T_, i.e., as values or as variables for differentiation
+            template <typename T_>
+            static std::array<T_, 3> _coefficients(const std::array<UsedParameter, 3> & a, const unsigned & index)
+            {
+                return {{ make_variable<T_>(a[0], index + 0), make_variable<T_>(a[1], index + 1), make_variable<T_>(a[2], index + 2) }};
+            }
+
             static std::string _par_name(const std::string & ff_name)
             {
                 return std::string(Process_::label) + std::string("::alpha^") + ff_name + std::string("@BSZ2015");
             }
 
+            template <typename T_> T_ _f_p(const double & s) const
+            {
+                return _calc_ff(s, Process_::m2_Br1m, _coefficients<T_>(_a_fp, _i_fp));
+            }
+
+            template <typename T_> T_ _f_t(const double & s) const
+            {
+                return _calc_ff(s, Process_::m2_Br1m, _coefficients<T_>(_a_ft, _i_ft));
+            }
+
+            template <typename T_> T_ _f_0(const double & s) const
+            {
+                // use equation of motion to replace f_0(0) by f_+(0)
+                std::array<T_, 3> values
+                {{
+                    make_variable<T_>(_a_fp[0], _i_fp),
+                    make_variable<T_>(_a_fz[1 - 1], _i_fz + 0),
+                    make_variable<T_>(_a_fz[2 - 1], _i_fz + 1),
+                }};
+
+                return _calc_ff(s, Process_::m2_Br0p, values);
+            }
+
+            template <typename T_> T_ _f_plus_T(const double & s) const
+            {
+                return _f_t<T_>(s) * s / _mB / (_mB + _mP);
+            }
+
         public:
             BSZ2015FormFactors(const Parameters & p, const Options &) :
                 _a_fp{{ UsedParameter(p[_par_name("f+_0")], *this),
@@ -1271,34 +1739,73 @@ namespace eos
 
             virtual double f_p(const double & s) const
             {
-                return _calc_ff(s, Process_::m2_Br1m, _a_fp);
+                return _f_p<double>(s);
             }
 
             virtual double f_t(const double & s) const
             {
-                return _calc_ff(s, Process_::m2_Br1m, _a_ft);
+                return _f_t<double>(s);
             }
 
             virtual double f_0(const double & s) const
             {
-                // use equation of motion to replace f_0(0) by f_+(0)
-                std::array<double, 3> values
+                return _f_0<double>(s);
+            }
+
+            virtual double f_plus_T(const double & s) const
+            {
+                return _f_plus_T<double>(s);
+            }
+
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives(const std::string & name, const double & s) const
+            {
+                using D = Dual<_n>;
+                using FormFactor = D (BSZ2015FormFactors::*)(const double &) const;
+                static const std::map<std::string, FormFactor> form_factors
+                {
+                    { "f_p",      &BSZ2015FormFactors::template _f_p<D>      },
+                    { "f_t",      &BSZ2015FormFactors::template _f_t<D>      },
+                    { "f_0",      &BSZ2015FormFactors::template _f_0<D>      },
+                    { "f_plus_T", &BSZ2015FormFactors::template _f_plus_T<D> },
+                };
+
+                auto i = form_factors.find(name);
+                if (form_factors.end() == i)
+                    throw InternalError("BSZ2015FormFactors<PToP>::derivatives: unknown form factor '" + name + "'");
+
+                const std::array<Parameter::Id, _n> ids
                 {{
-                    _a_fp[0],
-                    _a_fz[1 - 1],
-                    _a_fz[2 - 1],
+                    _a_fp[0].id(), _a_fp[1].id(), _a_fp[2].id(),
+                    _a_ft[0].id(), _a_ft[1].id(), _a_ft[2].id(),
+                    _a_fz[0].id(), _a_fz[1].id()
                 }};
 
-                return _calc_ff(s, Process_::m2_Br0p, values);
+                return paired_derivatives((this->*(i->second))(s), ids);
             }
 
-            virtual double f_plus_T(const double & s) const
+            virtual void evaluate(const double * s, const std::size_t & n, Values & result) const
             {
-                return _calc_ff(s, Process_::m2_Br1m, _a_ft) * s / _mB / (_mB + _mP);
+                result.resize(n);
+
+                // read the parameters only once for all points
+                const std::array<double, 3> a_fp{{ _a_fp[0], _a_fp[1], _a_fp[2] }};
+                // use equation of motion to replace f_0(0) by f_+(0)
+                const std::array<double, 3> a_fz{{ a_fp[0],  _a_fz[0], _a_fz[1] }};
+
+                for (std::size_t i = 0 ; i < n ; ++i)
+                {
+                    // z(s) is shared among all form factors
+                    const double diff_z = _calc_z(s[i]) - _z_0, diff_z2 = diff_z * diff_z;
+
+                    if (result.selected(ff_f_p))
+                        result.f_p[i] = (a_fp[0] + a_fp[1] * diff_z + a_fp[2] * diff_z2) / (1.0 - s[i] / Process_::m2_Br1m);
+
+                    if (result.selected(ff_f_0))
+                        result.f_0[i] = (a_fz[0] + a_fz[1] * diff_z + a_fz[2] * diff_z2) / (1.0 - s[i] / Process_::m2_Br0p);
+                }
             }
     };
 
-    /* Form Factors according to [BZ2004v2] */
     template <typename Process_> class BZ2004FormFactors<Process_, PToP> :
         public FormFactors<PToP>
     {
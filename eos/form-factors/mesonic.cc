@@ -147,6 +147,69 @@ namespace eos
     {
     }
 
+    std::vector<std::pair<Parameter::Id, double>>
+    FormFactors<PToV>::derivatives(const std::string & /*name*/, const double & /*s*/) const
+    {
+        throw InternalError("This form factor parametrization does not provide derivatives with respect to its parameters.");
+    }
+
+    FormFactors<PToV>::Values::Values(const unsigned & selection) :
+        selection(selection)
+    {
+    }
+
+    void
+    FormFactors<PToV>::Values::resize(const std::size_t & n)
+    {
+        const std::vector<std::pair<std::vector<double> *, unsigned>> values
+        {
+            { &v,    ff_v    }, { &a_0, ff_a_0 }, { &a_1, ff_a_1 }, { &a_2, ff_a_2 }, { &a_12, ff_a_12 },
+            { &t_1,  ff_t_1  }, { &t_2, ff_t_2 }, { &t_3, ff_t_3 }, { &t_23, ff_t_23 }
+        };
+
+        for (const auto & value : values)
+        {
+            value.first->resize(selected(value.second) ? n : 0);
+        }
+    }
+
+    void
+    FormFactors<PToV>::evaluate(const double * s, const std::size_t & n, Values & result) const
+    {
+        result.resize(n);
+
+        // only evaluate the selected form factors, each of which might be costly
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            if (result.selected(ff_v))
+                result.v[i]    = this->v(s[i]);
+
+            if (result.selected(ff_a_0))
+                result.a_0[i]  = this->a_0(s[i]);
+
+            if (result.selected(ff_a_1))
+                result.a_1[i]  = this->a_1(s[i]);
+
+            if (result.selected(ff_a_2))
+                result.a_2[i]  = this->a_2(s[i]);
+
+            if (result.selected(ff_a_12))
+                result.a_12[i] = this->a_12(s[i]);
+
+            if (result.selected(ff_t_1))
+                result.t_1[i]  = this->t_1(s[i]);
+
+            if (result.selected(ff_t_2))
+                result.t_2[i]  = this->t_2(s[i]);
+
+            if (result.selected(ff_t_3))
+                result.t_3[i]  = this->t_3(s[i]);
+
+            if (result.selected(ff_t_23))
+                result.t_23[i] = this->t_23(s[i]);
+        }
+    }
+
     std::shared_ptr<FormFactors<PToV>>
     FormFactorFactory<PToV>::create(const QualifiedName & name, const Parameters & parameters, const Options & options)
     {
@@ -305,6 +368,39 @@ namespace eos
 
     FormFactors<PToP>::~FormFactors() = default;
 
+    std::vector<std::pair<Parameter::Id, double>>
+    FormFactors<PToP>::derivatives(const std::string & /*name*/, const double & /*s*/) const
+    {
+        throw InternalError("This form factor parametrization does not provide derivatives with respect to its parameters.");
+    }
+
+    FormFactors<PToP>::Values::Values(const unsigned & selection) :
+        selection(selection)
+    {
+    }
+
+    void
+    FormFactors<PToP>::Values::resize(const std::size_t & n)
+    {
+        f_p.resize(selected(ff_f_p) ? n : 0);
+        f_0.resize(selected(ff_f_0) ? n : 0);
+    }
+
+    void
+    FormFactors<PToP>::evaluate(const double * s, const std::size_t & n, Values & result) const
+    {
+        result.resize(n);
+
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            if (result.selected(ff_f_p))
+                result.f_p[i] = this->f_p(s[i]);
+
+            if (result.selected(ff_f_0))
+                result.f_0[i] = this->f_0(s[i]);
+        }
+    }
+
     double FormFactors<PToP>::f_m(const double & /*s*/) const
     {
         return std::numeric_limits<double>::quiet_NaN();
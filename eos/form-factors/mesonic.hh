@@ -28,8 +28,11 @@
 #include <eos/utils/options.hh>
 #include <eos/utils/qualified-name.hh>
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace eos
 {
@@ -79,6 +82,65 @@ namespace eos
             virtual double f_long_T(const double & s) const = 0;
             virtual double f_long_T_Normalized(const double & s) const = 0;
 
+            /*!
+             * Retrieve the derivatives of one form factor with respect to the parameters of the parametrisation.
+             *
+             * The derivatives are exact, and obtained by forward-mode automatic differentiation.
+             * Parametrisations that do not support this throw InternalError.
+             *
+             * @param name The name of the form factor, i.e. the name of the respective member function.
+             * @param s    The squared momentum transfer.
+             * @return     Pairs of parameter id and partial derivative for all parameters with respect to which
+             *             the derivatives are known, including vanishing ones. Parameters that are not listed,
+             *             e.g. hadron masses, must be differentiated numerically.
+             */
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives(const std::string & name, const double & s) const;
+
+            /// Flags that select the form factors to be evaluated at several values of s.
+            enum Selection : unsigned
+            {
+                ff_v    = 1u << 0,
+                ff_a_0  = 1u << 1,
+                ff_a_1  = 1u << 2,
+                ff_a_2  = 1u << 3,
+                ff_a_12 = 1u << 4,
+                ff_t_1  = 1u << 5,
+                ff_t_2  = 1u << 6,
+                ff_t_3  = 1u << 7,
+                ff_t_23 = 1u << 8,
+                ff_all  = (1u << 9) - 1u
+            };
+
+            /// The values of the selected form factors at several values of s, with one array per form factor.
+            struct Values
+            {
+                /// The form factors to be evaluated. The arrays of all other form factors remain empty.
+                unsigned selection;
+
+                std::vector<double> v;
+                std::vector<double> a_0, a_1, a_2, a_12;
+                std::vector<double> t_1, t_2, t_3, t_23;
+
+                Values(const unsigned & selection = ff_all);
+
+                /// Whether any of the given form factors is selected.
+                bool selected(const unsigned & flags) const { return 0 != (selection & flags); }
+
+                void resize(const std::size_t & n);
+            };
+
+            /*!
+             * Evaluate the selected form factors among V, A_0, A_1, A_2, A_12, T_1, T_2, T_3 and T_23
+             * at several values of s at once.
+             *
+             * Parametrisations can override this to share the kinematic quantities, e.g. z(s) and the pole factors,
+             * among the form factors. The default implementation calls the selected individual form factors.
+             *
+             * @param s      The squared momentum transfers.
+             * @param n      The number of squared momentum transfers.
+             * @param result The form factor values; the arrays of the selected form factors are resized to n.
+             */
+            virtual void evaluate(const double * s, const std::size_t & n, Values & result) const;
     };
 
     template <>
@@ -105,6 +167,56 @@ namespace eos
 
             virtual double f_p_d1(const double & s) const;
             virtual double f_p_d2(const double & s) const;
+
+            /*!
+             * Retrieve the derivatives of one form factor with respect to the parameters of the parametrisation.
+             *
+             * The derivatives are exact, and obtained by forward-mode automatic differentiation.
+             * Parametrisations that do not support this throw InternalError.
+             *
+             * @param name The name of the form factor, i.e. the name of the respective member function.
+             * @param s    The squared momentum transfer.
+             * @return     Pairs of parameter id and partial derivative for all parameters with respect to which
+             *             the derivatives are known, including vanishing ones. Parameters that are not listed,
+             *             e.g. hadron masses, must be differentiated numerically.
+             */
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives(const std::string & name, const double & s) const;
+
+            /// Flags that select the form factors to be evaluated at several values of s.
+            enum Selection : unsigned
+            {
+                ff_f_p  = 1u << 0,
+                ff_f_0  = 1u << 1,
+                ff_all  = (1u << 2) - 1u
+            };
+
+            /// The values of the selected vector and scalar form factors at several values of s, with one array per form factor.
+            struct Values
+            {
+                /// The form factors to be evaluated. The arrays of all other form factors remain empty.
+                unsigned selection;
+
+                std::vector<double> f_p, f_0;
+
+                Values(const unsigned & selection = ff_all);
+
+                /// Whether any of the given form factors is selected.
+                bool selected(const unsigned & flags) const { return 0 != (selection & flags); }
+
+                void resize(const std::size_t & n);
+            };
+
+            /*!
+             * Evaluate the selected form factors among f_+ and f_0 at several values of s at once.
+             *
+             * Parametrisations can override this to share the kinematic quantities, e.g. z(s),
+             * among the form factors. The default implementation calls the selected individual form factors.
+             *
+             * @param s      The squared momentum transfers.
+             * @param n      The number of squared momentum transfers.
+             * @param result The form factor values; the arrays of the selected form factors are resized to n.
+             */
+            virtual void evaluate(const double * s, const std::size_t & n, Values & result) const;
     };
 
     template <>
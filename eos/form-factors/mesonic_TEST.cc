@@ -24,7 +24,9 @@
 #include <test/test.hh>
 #include <eos/form-factors/form-factors.hh>
 #include <eos/form-factors/mesonic-impl.hh>
+#include <eos/observable.hh>
 
+#include <algorithm>
 #include <vector>
 
 using namespace test;
@@ -113,6 +115,38 @@ class BCL2008FormFactorsTest :
                 TEST_CHECK_NEARLY_EQUAL(1.45892, ff->f_0(10.0), eps);
                 TEST_CHECK_NEARLY_EQUAL(1.91416, ff->f_0(15.0), eps);
                 TEST_CHECK_NEARLY_EQUAL(2.80533, ff->f_0(20.0), eps);
+
+                // derivatives with respect to the parameters
+                const auto derivatives = ff->derivatives("f_p", 10.0);
+                TEST_CHECK_EQUAL(6u, derivatives.size());
+                TEST_CHECK_EQUAL(3, std::count_if(derivatives.cbegin(), derivatives.cend(), [] (const auto & d) { return 0.0 != d.second; }));
+                for (const auto & d : derivatives)
+                {
+                    static const double h = 1.0e-4;
+
+                    Parameter q = p[d.first];
+                    const double value = q();
+
+                    q = value + h;
+                    const double f_hi = ff->f_p(10.0);
+                    q = value - h;
+                    const double f_lo = ff->f_p(10.0);
+                    q = value;
+
+                    TEST_CHECK_NEARLY_EQUAL(d.second, (f_hi - f_lo) / (2.0 * h), 1e-8);
+                }
+
+                // the form factor observables pass the derivatives on, as far as they are provided
+                {
+                    const Kinematics k{ { "q2", 10.0 } };
+                    const Options o{ { "form-factors", "BCL2008" } };
+
+                    ObservablePtr f_p = Observable::make("B->pi::f_+(q2)", p, k, o);
+                    TEST_CHECK(derivatives == f_p->derivatives());
+
+                    ObservablePtr f_m = Observable::make("B->pi::f_-(q2)", p, k, o);
+                    TEST_CHECK(f_m->derivatives().empty());
+                }
             }
         }
 } bcl2008_form_factors_test;
@@ -523,6 +557,21 @@ class BSZ2015FormFactorsTest :
                 TEST_CHECK_NEARLY_EQUAL(1.73442, ff->f_t(10.0), eps);
                 TEST_CHECK_NEARLY_EQUAL(2.64425, ff->f_t(15.0), eps);
                 TEST_CHECK_NEARLY_EQUAL(4.99850, ff->f_t(20.0), eps);
+
+                // batch evaluation
+                static const std::array<double, 5> s{{ 0.0, 5.0, 10.0, 15.0, 20.0 }};
+
+                FormFactors<PToP>::Values values;
+                ff->evaluate(s.data(), s.size(), values);
+
+                TEST_CHECK_EQUAL(s.size(), values.f_p.size());
+                TEST_CHECK_EQUAL(s.size(), values.f_0.size());
+
+                for (std::size_t i = 0 ; i < s.size() ; ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(ff->f_p(s[i]), values.f_p[i], 1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(ff->f_0(s[i]), values.f_0[i], 1e-14);
+                }
             }
         }
 } bsz2015_form_factors_test;
@@ -1286,6 +1335,101 @@ class BToKstarBSZ2015FormFactorsTest :
             TEST_CHECK_NEARLY_EQUAL(0.200925, ff->t_3(2.1), eps);
             TEST_CHECK_NEARLY_EQUAL(0.219004, ff->t_3(4.1), eps);
             TEST_CHECK_NEARLY_EQUAL(0.239587, ff->t_3(6.1), eps);
+
+            /* derivatives with respect to the parameters */
+            {
+                static const double s = 4.1, h = 1.0e-4;
+
+                const std::vector<std::pair<std::string, double (FormFactors<PToV>::*)(const double &) const>> form_factors
+                {
+                    { "v",      &FormFactors<PToV>::v      },
+                    { "a_12",   &FormFactors<PToV>::a_12   },
+                    { "a_2",    &FormFactors<PToV>::a_2    },
+                    { "t_3",    &FormFactors<PToV>::t_3    },
+                    { "f_long", &FormFactors<PToV>::f_long },
+                };
+
+                for (const auto & f : form_factors)
+                {
+                    for (const auto & d : ff->derivatives(f.first, s))
+                    {
+                        Parameter q = p[d.first];
+                        const double value = q();
+
+                        q = value + h;
+                        const double f_hi = ((*ff).*(f.second))(s);
+                        q = value - h;
+                        const double f_lo = ((*ff).*(f.second))(s);
+                        q = value;
+
+                        TEST_CHECK_NEARLY_EQUAL(d.second, (f_hi - f_lo) / (2.0 * h), 1e-8);
+                    }
+                }
+
+                // all parameters are covered, but A_12 only depends on A0_0 through the constraint (B.6) in [BSZ2015]
+                const auto nonzero = [&] (const std::string & name)
+                {
+                    const auto derivatives = ff->derivatives(name, s);
+                    TEST_CHECK_EQUAL(19u, derivatives.size());
+
+                    return std::count_if(derivatives.cbegin(), derivatives.cend(), [] (const auto & d) { return 0.0 != d.second; });
+                };
+                TEST_CHECK_EQUAL(3, nonzero("a_12"));
+                TEST_CHECK_EQUAL(6, nonzero("a_2"));
+                TEST_CHECK_EQUAL(6, nonzero("t_3"));
+
+                TEST_CHECK_THROWS(InternalError, ff->derivatives("f_plus", s));
+            }
+
+            /* batch evaluation */
+            {
+                static const std::array<double, 5> s{{ 0.1, 2.1, 4.1, 6.1, 12.0 }};
+
+                FormFactors<PToV>::Values values;
+                ff->evaluate(s.data(), s.size(), values);
+
+                TEST_CHECK_EQUAL(s.size(), values.v.size());
+                TEST_CHECK_EQUAL(s.size(), values.t_23.size());
+
+                for (std::size_t i = 0 ; i < s.size() ; ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(ff->v(s[i]),    values.v[i],    1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(ff->a_0(s[i]),  values.a_0[i],  1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(ff->a_1(s[i]),  values.a_1[i],  1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(ff->a_2(s[i]),  values.a_2[i],  1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(ff->a_12(s[i]), values.a_12[i], 1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(ff->t_1(s[i]),  values.t_1[i],  1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(ff->t_2(s[i]),  values.t_2[i],  1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(ff->t_3(s[i]),  values.t_3[i],  1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(ff->t_23(s[i]), values.t_23[i], 1e-14);
+                }
+
+                // only the selected form factors are evaluated, also if they derive from others
+                FormFactors<PToV>::Values selected(FormFactors<PToV>::ff_a_2 | FormFactors<PToV>::ff_t_3);
+                ff->evaluate(s.data(), s.size(), selected);
+
+                TEST_CHECK(selected.v.empty());
+                TEST_CHECK(selected.a_1.empty());
+                TEST_CHECK(selected.a_12.empty());
+                TEST_CHECK(selected.t_23.empty());
+                TEST_CHECK_EQUAL(s.size(), selected.a_2.size());
+                TEST_CHECK_EQUAL(s.size(), selected.t_3.size());
+
+                for (std::size_t i = 0 ; i < s.size() ; ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(ff->a_2(s[i]),  selected.a_2[i],  1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(ff->t_3(s[i]),  selected.t_3[i],  1e-14);
+                }
+
+                // the same holds for parametrisations without a dedicated batch evaluation
+                std::shared_ptr<FormFactors<PToV>> bz2004 = FormFactorFactory<PToV>::create("B->K^*::BZ2004", p, Options{ });
+                FormFactors<PToV>::Values scalar(FormFactors<PToV>::ff_v);
+                bz2004->evaluate(s.data(), s.size(), scalar);
+
+                TEST_CHECK(scalar.a_0.empty());
+                TEST_CHECK_EQUAL(s.size(), scalar.v.size());
+                TEST_CHECK_NEARLY_EQUAL(bz2004->v(s[1]), scalar.v[1], 1e-14);
+            }
         }
 } b_to_kstar_bsz2015_form_factors_test;
 
@@ -33,6 +33,76 @@
 
 namespace eos
 {
+    /* exact derivatives of form factors as observables, as far as the parametrisation provides them */
+    template <typename Transition_, typename ... Args_>
+    std::function<std::vector<std::pair<Parameter::Id, double>> (const FormFactors<Transition_> *, const Args_ & ...)>
+    make_form_factor_derivatives(double (FormFactors<Transition_>::*)(const Args_ & ...) const)
+    {
+        return nullptr;
+    }
+
+    template <typename Transition_>
+    std::function<std::vector<std::pair<Parameter::Id, double>> (const FormFactors<Transition_> *, const double &)>
+    make_form_factor_derivatives(double (FormFactors<Transition_>::* _function)(const double &) const,
+            const std::vector<std::pair<double (FormFactors<Transition_>::*)(const double &) const, std::string>> & names)
+    {
+        for (const auto & n : names)
+        {
+            if (n.first != _function)
+                continue;
+
+            const std::string name = n.second;
+
+            return [name] (const FormFactors<Transition_> * form_factors, const double & s)
+            {
+                return form_factors->derivatives(name, s);
+            };
+        }
+
+        return nullptr;
+    }
+
+    std::function<std::vector<std::pair<Parameter::Id, double>> (const FormFactors<PToP> *, const double &)>
+    make_form_factor_derivatives(double (FormFactors<PToP>::* _function)(const double &) const)
+    {
+        static const std::vector<std::pair<double (FormFactors<PToP>::*)(const double &) const, std::string>> names
+        {
+            { &FormFactors<PToP>::f_p,      "f_p"      },
+            { &FormFactors<PToP>::f_0,      "f_0"      },
+            { &FormFactors<PToP>::f_t,      "f_t"      },
+            { &FormFactors<PToP>::f_m,      "f_m"      },
+            { &FormFactors<PToP>::f_plus_T, "f_plus_T" },
+        };
+
+        return make_form_factor_derivatives<PToP>(_function, names);
+    }
+
+    std::function<std::vector<std::pair<Parameter::Id, double>> (const FormFactors<PToV> *, const double &)>
+    make_form_factor_derivatives(double (FormFactors<PToV>::* _function)(const double &) const)
+    {
+        static const std::vector<std::pair<double (FormFactors<PToV>::*)(const double &) const, std::string>> names
+        {
+            { &FormFactors<PToV>::v,                   "v"                   },
+            { &FormFactors<PToV>::a_0,                 "a_0"                 },
+            { &FormFactors<PToV>::a_1,                 "a_1"                 },
+            { &FormFactors<PToV>::a_2,                 "a_2"                 },
+            { &FormFactors<PToV>::a_12,                "a_12"                },
+            { &FormFactors<PToV>::t_1,                 "t_1"                 },
+            { &FormFactors<PToV>::t_2,                 "t_2"                 },
+            { &FormFactors<PToV>::t_3,                 "t_3"                 },
+            { &FormFactors<PToV>::t_23,                "t_23"                },
+            { &FormFactors<PToV>::f_perp,              "f_perp"              },
+            { &FormFactors<PToV>::f_para,              "f_para"              },
+            { &FormFactors<PToV>::f_long,              "f_long"              },
+            { &FormFactors<PToV>::f_perp_T,            "f_perp_T"            },
+            { &FormFactors<PToV>::f_para_T,            "f_para_T"            },
+            { &FormFactors<PToV>::f_long_T,            "f_long_T"            },
+            { &FormFactors<PToV>::f_long_T_Normalized, "f_long_T_Normalized" },
+        };
+
+        return make_form_factor_derivatives<PToV>(_function, names);
+    }
+
     /* form factors as observables */
     template <typename Transition_, typename Tuple_, typename ... Args_>
     std::pair<QualifiedName, ObservableEntryPtr> make_form_factor_adapter(const char * name,
@@ -44,7 +114,8 @@ namespace eos
         qnp::Prefix pp = qn.prefix_part();
         std::function<double (const FormFactors<Transition_> *, const Args_ & ...)> function(_function);
 
-        return std::make_pair(qn, std::make_shared<FormFactorAdapterEntry<Transition_, Args_ ...>>(qn, latex, Unit::None(), pp, function, kinematics_names));
+        return std::make_pair(qn, std::make_shared<FormFactorAdapterEntry<Transition_, Args_ ...>>(qn, latex, Unit::None(), pp, function,
+                    make_form_factor_derivatives(_function), kinematics_names));
     }
 
     template <typename Transition_, typename Tuple_, typename ... Args_>
@@ -56,7 +127,8 @@ namespace eos
         qnp::Prefix pp = qn.prefix_part();
         std::function<double (const FormFactors<Transition_> *, const Args_ & ...)> function(_function);
 
-        return std::make_pair(qn, std::make_shared<FormFactorAdapterEntry<Transition_, Args_ ...>>(qn, "", Unit::None(), pp, function, kinematics_names));
+        return std::make_pair(qn, std::make_shared<FormFactorAdapterEntry<Transition_, Args_ ...>>(qn, "", Unit::None(), pp, function,
+                    make_form_factor_derivatives(_function), kinematics_names));
     }
 
     // B -> P(seudoscalar)
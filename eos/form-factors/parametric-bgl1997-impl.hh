@@ -23,12 +23,15 @@
 #define EOS_GUARD_EOS_FORM_FACTORS_PARAMETRIC_BGL1997_IMPL_HH 1
 
 #include <eos/form-factors/parametric-bgl1997.hh>
+#include <eos/utils/dual.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/model.hh>
 #include <eos/utils/power_of.hh>
 
 #include <gsl/gsl_sf_dilog.h>
 
+#include <map>
+
 namespace eos
 {
     BGL1997FormFactorBase::BGL1997FormFactorBase(const Parameters &, const Options &, ParameterUser &, const double t_p, const double t_m) :
@@ -66,6 +69,13 @@ namespace eos
                * 1.0 / std::pow(sq_tp_t + sq_tp, c + 3.0);
     }
 
+    template <typename T_>
+    T_
+    BGL1997FormFactorBase::_series(const std::array<UsedParameter, 4> & a, const unsigned & index, const double & z)
+    {
+        return make_variable<T_>(a[0], index + 0) + make_variable<T_>(a[1], index + 1) * z
+            + make_variable<T_>(a[2], index + 2) * z * z + make_variable<T_>(a[3], index + 3) * z * z * z;
+    }
 
     // TODO hard-coded values of resonances from [BGS2017] table III with some changes (from Nico Gubernari)
     //  0^+ at 6.704, 7.122
@@ -118,82 +128,145 @@ namespace eos
         return new BGL1997FormFactors(parameters, options);
     }
 
-    double
-    BGL1997FormFactors<BToDstar>::g(const double & s) const
+    template <typename T_>
+    T_
+    BGL1997FormFactors<BToDstar>::_g(const double & s) const
     {
         // resonances for 1^-
         const double blaschke = _z(s, 6.329 * 6.329) * _z(s, 6.910 * 6.910) * _z(s, 7.020 * 7.020);
         const double phi      = _phi(s, _t_0, 96, 3, 3, 1, _chi_1m);
         const double z        = _z(s, _t_0);
-        const double series   = _a_g[0] + _a_g[1] * z + _a_g[2] * z * z + _a_g[3] * z * z * z;
+        const T_     series   = _series<T_>(_a_g, _i_g, z);
 
         return series / phi / blaschke;
     }
 
     double
-    BGL1997FormFactors<BToDstar>::f(const double & s) const
+    BGL1997FormFactors<BToDstar>::g(const double & s) const
+    {
+        return _g<double>(s);
+    }
+
+    template <typename T_>
+    T_
+    BGL1997FormFactors<BToDstar>::_f(const double & s) const
     {
         // resonances for 1^+
         const double blaschke = _z(s, 6.739 * 6.739) * _z(s, 6.750 * 6.750) * _z(s, 7.145 * 7.145) * _z(s, 7.150 * 7.150);
         const double phi      = _phi(s, _t_0, 24, 1, 1, 1, _chi_1p);
         const double z        = _z(s, _t_0);
-        const double series   = _a_f[0] + _a_f[1] * z + _a_f[2] * z * z + _a_f[3] * z * z * z;
+        const T_     series   = _series<T_>(_a_f, _i_f, z);
 
         return series / phi / blaschke;
     }
 
     double
-    BGL1997FormFactors<BToDstar>::F1(const double & s) const
+    BGL1997FormFactors<BToDstar>::f(const double & s) const
+    {
+        return _f<double>(s);
+    }
+
+    template <typename T_>
+    T_
+    BGL1997FormFactors<BToDstar>::_F1(const double & s) const
     {
         // resonances for 1^+
         const double blaschke = _z(s, 6.739 * 6.739) * _z(s, 6.750 * 6.750) * _z(s, 7.145 * 7.145) * _z(s, 7.150 * 7.150);
         const double phi      = _phi(s, _t_0, 48, 1, 1, 2, _chi_1p);
         const double z        = _z(s, _t_0);
-        const double series   = _a_F1[0] + _a_F1[1] * z + _a_F1[2] * z * z + _a_F1[3] * z * z * z;
+        const T_     series   = _series<T_>(_a_F1, _i_F1, z);
 
         return series / phi / blaschke;
     }
 
     double
-    BGL1997FormFactors<BToDstar>::F2(const double & s) const
+    BGL1997FormFactors<BToDstar>::F1(const double & s) const
+    {
+        return _F1<double>(s);
+    }
+
+    template <typename T_>
+    T_
+    BGL1997FormFactors<BToDstar>::_F2(const double & s) const
     {
         // resonances for 0^-
         const double blaschke = _z(s, 6.275 * 6.275) * _z(s, 6.871 * 6.871) * _z(s, 7.250 * 7.250);
         const double phi      = _phi(s, _t_0, 64, 3, 3, 1, _chi_0m);
         const double z        = _z(s, _t_0);
-        const double series   = _a_F2[0] + _a_F2[1] * z + _a_F2[2] * z * z + _a_F2[3] * z * z * z;
+        const T_     series   = _series<T_>(_a_F2, _i_F2, z);
 
         return series / phi / blaschke;
     }
 
+    double
+    BGL1997FormFactors<BToDstar>::F2(const double & s) const
+    {
+        return _F2<double>(s);
+    }
+
+    template <typename T_>
+    T_
+    BGL1997FormFactors<BToDstar>::_v(const double & s) const
+    {
+        return (_mB + _mV) / 2.0 * _g<T_>(s);
+    }
+
     double
     BGL1997FormFactors<BToDstar>::v(const double & s) const
     {
-        return (_mB + _mV) / 2.0 * g(s);
+        return _v<double>(s);
+    }
+
+    template <typename T_>
+    T_
+    BGL1997FormFactors<BToDstar>::_a_0(const double & s) const
+    {
+        return _F2<T_>(s) / 2.0;
     }
 
     double
     BGL1997FormFactors<BToDstar>::a_0(const double & s) const
     {
-        return F2(s) / 2.0;
+        return _a_0<double>(s);
+    }
+
+    template <typename T_>
+    T_
+    BGL1997FormFactors<BToDstar>::_a_1(const double & s) const
+    {
+        return 1.0/(_mB + _mV) * _f<T_>(s);
     }
 
     double
     BGL1997FormFactors<BToDstar>::a_1(const double & s) const
     {
-        return 1.0/(_mB + _mV) * f(s);
+        return _a_1<double>(s);
+    }
+
+    template <typename T_>
+    T_
+    BGL1997FormFactors<BToDstar>::_a_2(const double & s) const
+    {
+        return (_mB + _mV) / eos::lambda(_mB2, _mV2, s) * ((_mB2 - _mV2 - s) * _f<T_>(s) - 2.0 * _mV * _F1<T_>(s));
     }
 
     double
     BGL1997FormFactors<BToDstar>::a_2(const double & s) const
     {
-        return (_mB + _mV) / eos::lambda(_mB2, _mV2, s) * ((_mB2 - _mV2 - s) * f(s) - 2.0 * _mV * F1(s));
+        return _a_2<double>(s);
+    }
+
+    template <typename T_>
+    T_
+    BGL1997FormFactors<BToDstar>::_a_12(const double & s) const
+    {
+        return _F1<T_>(s) / (8.0 * _mB * _mV);
     }
 
     double
     BGL1997FormFactors<BToDstar>::a_12(const double & s) const
     {
-        return F1(s) / (8.0 * _mB * _mV);
+        return _a_12<double>(s);
     }
 
     double
@@ -264,6 +337,80 @@ namespace eos
 
 
 
+    std::vector<std::pair<Parameter::Id, double>>
+    BGL1997FormFactors<BToDstar>::derivatives(const std::string & name, const double & s) const
+    {
+        using D = Dual<_n>;
+        using FormFactor = D (BGL1997FormFactors<BToDstar>::*)(const double &) const;
+        static const std::map<std::string, FormFactor> form_factors
+        {
+            { "g",    &BGL1997FormFactors<BToDstar>::_g<D>    },
+            { "f",    &BGL1997FormFactors<BToDstar>::_f<D>    },
+            { "F1",   &BGL1997FormFactors<BToDstar>::_F1<D>   },
+            { "F2",   &BGL1997FormFactors<BToDstar>::_F2<D>   },
+            { "v",    &BGL1997FormFactors<BToDstar>::_v<D>    },
+            { "a_0",  &BGL1997FormFactors<BToDstar>::_a_0<D>  },
+            { "a_1",  &BGL1997FormFactors<BToDstar>::_a_1<D>  },
+            { "a_2",  &BGL1997FormFactors<BToDstar>::_a_2<D>  },
+            { "a_12", &BGL1997FormFactors<BToDstar>::_a_12<D> },
+        };
+
+        auto i = form_factors.find(name);
+        if (form_factors.end() == i)
+            throw InternalError("BGL1997FormFactors<BToDstar>::derivatives: unknown or unsupported form factor '" + name + "'");
+
+        const std::array<Parameter::Id, _n> ids
+        {{
+            _a_g[0].id(),  _a_g[1].id(),  _a_g[2].id(),  _a_g[3].id(),
+            _a_f[0].id(),  _a_f[1].id(),  _a_f[2].id(),  _a_f[3].id(),
+            _a_F1[0].id(), _a_F1[1].id(), _a_F1[2].id(), _a_F1[3].id(),
+            _a_F2[0].id(), _a_F2[1].id(), _a_F2[2].id(), _a_F2[3].id()
+        }};
+
+        return paired_derivatives((this->*(i->second))(s), ids);
+    }
+
+    void
+    BGL1997FormFactors<BToDstar>::evaluate(const double * s, const std::size_t & n, Values & result) const
+    {
+        result.resize(n);
+
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            // z(s) and the Blaschke factors are shared among all form factors
+            const double z           = _z(s[i], _t_0);
+            const double blaschke_1m = _z(s[i], 6.329 * 6.329) * _z(s[i], 6.910 * 6.910) * _z(s[i], 7.020 * 7.020);
+            const double blaschke_1p = _z(s[i], 6.739 * 6.739) * _z(s[i], 6.750 * 6.750) * _z(s[i], 7.145 * 7.145) * _z(s[i], 7.150 * 7.150);
+            const double blaschke_0m = _z(s[i], 6.275 * 6.275) * _z(s[i], 6.871 * 6.871) * _z(s[i], 7.250 * 7.250);
+
+            // A_2 derives from f and F1
+            const double f  = result.selected(ff_a_1  | ff_a_2) ? _series<double>(_a_f,  _i_f,  z) / _phi(s[i], _t_0, 24, 1, 1, 1, _chi_1p) / blaschke_1p : 0.0;
+            const double F1 = result.selected(ff_a_12 | ff_a_2) ? _series<double>(_a_F1, _i_F1, z) / _phi(s[i], _t_0, 48, 1, 1, 2, _chi_1p) / blaschke_1p : 0.0;
+
+            if (result.selected(ff_v))
+                result.v[i]    = (_mB + _mV) / 2.0 * _series<double>(_a_g, _i_g, z) / _phi(s[i], _t_0, 96, 3, 3, 1, _chi_1m) / blaschke_1m;
+
+            if (result.selected(ff_a_0))
+                result.a_0[i]  = _series<double>(_a_F2, _i_F2, z) / _phi(s[i], _t_0, 64, 3, 3, 1, _chi_0m) / blaschke_0m / 2.0;
+
+            if (result.selected(ff_a_1))
+                result.a_1[i]  = 1.0 / (_mB + _mV) * f;
+
+            if (result.selected(ff_a_2))
+                result.a_2[i]  = (_mB + _mV) / eos::lambda(_mB2, _mV2, s[i]) * ((_mB2 - _mV2 - s[i]) * f - 2.0 * _mV * F1);
+
+            if (result.selected(ff_a_12))
+                result.a_12[i] = F1 / (8.0 * _mB * _mV);
+
+            // tensor form factors are not yet implemented, cf. t_1() etc.
+            for (auto * t : { &result.t_1, &result.t_2, &result.t_3, &result.t_23 })
+            {
+                if (! t->empty())
+                    (*t)[i] = 0.0;
+            }
+        }
+    }
+
     std::string
     BGL1997FormFactors<BToD>::_par_name(const std::string & ff_name)
     {
@@ -301,30 +448,44 @@ namespace eos
         return new BGL1997FormFactors(parameters, options);
     }
 
-    double
-    BGL1997FormFactors<BToD>::f_p(const double & s) const
+    template <typename T_>
+    T_
+    BGL1997FormFactors<BToD>::_f_p(const double & s) const
     {
         // resonances for 1^-
         const double blaschke = _z(s, 6.329 * 6.329) * _z(s, 6.910 * 6.910) * _z(s, 7.020 * 7.020);
         const double phi      = _phi(s, _t_0, 48, 3, 3, 2, _chi_1m);
         const double z        = _z(s, _t_0);
-        const double series   = _a_f_p[0] + _a_f_p[1] * z + _a_f_p[2] * z * z + _a_f_p[3] * z * z * z;
+        const T_     series   = _series<T_>(_a_f_p, _i_f_p, z);
 
         return series / phi / blaschke;
     }
 
     double
-    BGL1997FormFactors<BToD>::f_0(const double & s) const
+    BGL1997FormFactors<BToD>::f_p(const double & s) const
+    {
+        return _f_p<double>(s);
+    }
+
+    template <typename T_>
+    T_
+    BGL1997FormFactors<BToD>::_f_0(const double & s) const
     {
         // resonances for 0^+
         const double blaschke = _z(s, 6.704 * 6.704) * _z(s, 7.122 * 7.122);
         const double phi      = _phi(s, _t_0, 16, 1, 1, 1, _chi_0p);
         const double z        = _z(s, _t_0);
-        const double series   = _a_f_0[0] + _a_f_0[1] * z + _a_f_0[2] * z * z + _a_f_0[3] * z * z * z;
+        const T_     series   = _series<T_>(_a_f_0, _i_f_0, z);
 
         return series / phi / blaschke;
     }
 
+    double
+    BGL1997FormFactors<BToD>::f_0(const double & s) const
+    {
+        return _f_0<double>(s);
+    }
+
     double
     BGL1997FormFactors<BToD>::f_t(const double & /*s*/) const
     {
@@ -336,6 +497,47 @@ namespace eos
     {
         return 0.0; //  TODO
     }
+
+    std::vector<std::pair<Parameter::Id, double>>
+    BGL1997FormFactors<BToD>::derivatives(const std::string & name, const double & s) const
+    {
+        using D = Dual<_n>;
+
+        const std::array<Parameter::Id, _n> ids
+        {{
+            _a_f_p[0].id(), _a_f_p[1].id(), _a_f_p[2].id(), _a_f_p[3].id(),
+            _a_f_0[0].id(), _a_f_0[1].id(), _a_f_0[2].id(), _a_f_0[3].id(),
+            _a_f_t[0].id(), _a_f_t[1].id(), _a_f_t[2].id(), _a_f_t[3].id()
+        }};
+
+        if ("f_p" == name)
+            return paired_derivatives(_f_p<D>(s), ids);
+
+        if ("f_0" == name)
+            return paired_derivatives(_f_0<D>(s), ids);
+
+        throw InternalError("BGL1997FormFactors<BToD>::derivatives: unknown or unsupported form factor '" + name + "'");
+    }
+
+    void
+    BGL1997FormFactors<BToD>::evaluate(const double * s, const std::size_t & n, Values & result) const
+    {
+        result.resize(n);
+
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            // z(s) is shared among all form factors
+            const double z           = _z(s[i], _t_0);
+            const double blaschke_1m = _z(s[i], 6.329 * 6.329) * _z(s[i], 6.910 * 6.910) * _z(s[i], 7.020 * 7.020);
+            const double blaschke_0p = _z(s[i], 6.704 * 6.704) * _z(s[i], 7.122 * 7.122);
+
+            if (result.selected(ff_f_p))
+                result.f_p[i] = _series<double>(_a_f_p, _i_f_p, z) / _phi(s[i], _t_0, 48, 3, 3, 2, _chi_1m) / blaschke_1m;
+
+            if (result.selected(ff_f_0))
+                result.f_0[i] = _series<double>(_a_f_0, _i_f_0, z) / _phi(s[i], _t_0, 16, 1, 1, 1, _chi_0p) / blaschke_0p;
+        }
+    }
 }
 
 #endif
@@ -40,6 +40,9 @@ namespace eos
             double _z(const double & t, const double & t_0) const;
             double _phi(const double & s, const double & t_0, const unsigned & K, const unsigned & a, const unsigned & b, const unsigned & c, const double & chi) const;
 
+            // the series in z, with the coefficients as scalars of type T_ starting at the index-th variable
+            template <typename T_> static T_ _series(const std::array<UsedParameter, 4> & a, const unsigned & index, const double & z);
+
             BGL1997FormFactorBase(const Parameters &, const Options &, ParameterUser &, const double t_p, const double t_m);
             ~BGL1997FormFactorBase();
     };
@@ -59,6 +62,20 @@ namespace eos
 
             static std::string _par_name(const std::string & ff_name);
 
+            // indices of the parameters when computing derivatives
+            enum : unsigned { _i_g = 0, _i_f = 4, _i_F1 = 8, _i_F2 = 12, _n = 16 };
+
+            template <typename T_> T_ _g(const double & s) const;
+            template <typename T_> T_ _f(const double & s) const;
+            template <typename T_> T_ _F1(const double & s) const;
+            template <typename T_> T_ _F2(const double & s) const;
+
+            template <typename T_> T_ _v(const double & s) const;
+            template <typename T_> T_ _a_0(const double & s) const;
+            template <typename T_> T_ _a_1(const double & s) const;
+            template <typename T_> T_ _a_2(const double & s) const;
+            template <typename T_> T_ _a_12(const double & s) const;
+
         public:
             BGL1997FormFactors(const Parameters &, const Options &);
             ~BGL1997FormFactors();
@@ -88,6 +105,10 @@ namespace eos
             virtual double f_para_T(const double & s) const;
             virtual double f_long_T(const double & s) const;
             virtual double f_long_T_Normalized(const double & s) const;
+
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives(const std::string & name, const double & s) const;
+
+            virtual void evaluate(const double * s, const std::size_t & n, Values & result) const;
     };
 
 
@@ -105,6 +126,12 @@ namespace eos
 
             static std::string _par_name(const std::string & ff_name);
 
+            // indices of the parameters when computing derivatives
+            enum : unsigned { _i_f_p = 0, _i_f_0 = 4, _i_f_t = 8, _n = 12 };
+
+            template <typename T_> T_ _f_p(const double & s) const;
+            template <typename T_> T_ _f_0(const double & s) const;
+
         public:
             BGL1997FormFactors(const Parameters &, const Options &);
             ~BGL1997FormFactors();
@@ -116,6 +143,10 @@ namespace eos
             virtual double f_t(const double & s) const;
 
             virtual double f_plus_T(const double & s) const;
+
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives(const std::string & name, const double & s) const;
+
+            virtual void evaluate(const double * s, const std::size_t & n, Values & result) const;
     };
 }
 
@@ -144,6 +144,21 @@ class BGL1997FormFactorsTest :
                 TEST_CHECK_NEARLY_EQUAL( 0.176818, ff.F2(-2.0), eps);
                 TEST_CHECK_NEARLY_EQUAL( 0.193605, ff.F2(+1.0), eps);
                 TEST_CHECK_NEARLY_EQUAL( 0.213869, ff.F2(+4.0), eps);
+
+                // batch evaluation
+                static const std::vector<double> s{ -2.0, +1.0, +4.0, +8.0 };
+
+                FormFactors<PToV>::Values values;
+                ff.evaluate(s.data(), s.size(), values);
+
+                for (std::size_t i = 0 ; i < s.size() ; ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(ff.v(s[i]),    values.v[i],    1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(ff.a_0(s[i]),  values.a_0[i],  1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(ff.a_1(s[i]),  values.a_1[i],  1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(ff.a_2(s[i]),  values.a_2[i],  1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(ff.a_12(s[i]), values.a_12[i], 1e-14);
+                }
             }
 
             /* B -> D FFs*/
@@ -185,6 +200,18 @@ class BGL1997FormFactorsTest :
                 TEST_CHECK_NEARLY_EQUAL( 1.66529, ff.f_0(-2.0), eps);
                 TEST_CHECK_NEARLY_EQUAL( 1.68264, ff.f_0(+1.0), eps);
                 TEST_CHECK_NEARLY_EQUAL( 1.70431, ff.f_0(+4.0), eps);
+
+                // batch evaluation
+                static const std::vector<double> s{ -2.0, +1.0, +4.0, +8.0 };
+
+                FormFactors<PToP>::Values values;
+                ff.evaluate(s.data(), s.size(), values);
+
+                for (std::size_t i = 0 ; i < s.size() ; ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(ff.f_p(s[i]), values.f_p[i], 1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(ff.f_0(s[i]), values.f_0[i], 1e-14);
+                }
             }
         }
 } BGL1997_form_factor_test;
@@ -36,6 +36,7 @@
 
 #include <algorithm>
 #include <map>
+#include <unordered_map>
 
 namespace eos
 {
@@ -50,30 +51,39 @@ namespace eos
         });
     }
 
-    std::map<QualifiedName, ObservableEntryPtr>
-    make_observable_entries()
-    {
-        std::map<QualifiedName, ObservableEntryPtr> observable_entries;
-
-        for (auto && section : make_observable_sections())
-        {
-            for (auto && group : section)
-            {
-                observable_entries.insert(group.begin(), group.end());
-            }
-        }
-        return observable_entries;
-    }
-
+    /*
+     * Holds the sections of all built-in observables, and all known observable entries.
+     *
+     * The entries are constructed only once per process and shared among all users.
+     * Entries are kept sorted by name for iteration, and are looked up by their short name
+     * through a hash table.
+     */
     class ObservableEntries :
         public InstantiationPolicy<ObservableEntries, Singleton>
     {
         private:
+            std::vector<ObservableSection> _sections;
+
             std::map<QualifiedName, std::shared_ptr<const ObservableEntry>> _entries;
 
+            std::unordered_map<std::string, std::shared_ptr<const ObservableEntry>> _index;
+
             ObservableEntries() :
-                _entries(make_observable_entries())
+                _sections(make_observable_sections())
             {
+                for (auto && section : _sections)
+                {
+                    for (auto && group : section)
+                    {
+                        _entries.insert(group.begin(), group.end());
+                    }
+                }
+
+                _index.reserve(2 * _entries.size());
+                for (const auto & e : _entries)
+                {
+                    _index.emplace(e.first.str(), e.second);
+                }
             }
 
             ~ObservableEntries() = default;
@@ -81,15 +91,32 @@ namespace eos
         public:
             friend class InstantiationPolicy<ObservableEntries, Singleton>;
 
+            const std::vector<ObservableSection> & sections() const
+            {
+                return _sections;
+            }
+
             const std::map<QualifiedName, std::shared_ptr<const ObservableEntry>> & entries() const
             {
                 return _entries;
             }
 
+            std::shared_ptr<const ObservableEntry> find(const QualifiedName & key) const
+            {
+                auto i = _index.find(key.str());
+                if (_index.end() == i)
+                    return nullptr;
+
+                return i->second;
+            }
+
             bool insert(const QualifiedName & key, const std::shared_ptr<const ObservableEntry> & value)
             {
                 auto inserted = _entries.insert(std::pair<QualifiedName, std::shared_ptr<const ObservableEntry>>(key, value));
 
+                if (inserted.second)
+                    _index.emplace(key.str(), value);
+
                 // true if the insertion was successfull
                 return inserted.second;
             }
@@ -98,14 +125,9 @@ namespace eos
     ObservablePtr
     Observable::make(const QualifiedName & name, const Parameters & parameters, const Kinematics & kinematics, const Options & _options)
     {
-        const std::map<QualifiedName, std::shared_ptr<const ObservableEntry>> & observable_entries = ObservableEntries::instance()->entries();
-
         // check if 'name' matches a simple observable
-        {
-            auto i = observable_entries.find(name);
-            if (observable_entries.end() != i)
-                return i->second->make(parameters, kinematics, name.options() + _options);
-        }
+        if (auto entry = ObservableEntries::instance()->find(name))
+            return entry->make(parameters, kinematics, name.options() + _options);
 
         // check if 'name' matches a parameter
         if (name.options().empty())
@@ -236,20 +258,12 @@ namespace eos
     template<>
     struct Implementation<Observables>
     {
-        std::vector<ObservableSection> observable_sections;
-
-        std::map<QualifiedName, ObservableEntryPtr> observable_entries;
+        // the sections are shared with all other instances
+        const std::vector<ObservableSection> & observable_sections;
 
         Implementation() :
-            observable_sections(make_observable_sections())
+            observable_sections(ObservableEntries::instance()->sections())
         {
-            for (auto && section : observable_sections)
-            {
-                for (auto && group : section)
-                {
-                    observable_entries.insert(group.begin(), group.end());
-                }
-            }
         }
     };
 
@@ -265,13 +279,7 @@ namespace eos
     ObservableEntryPtr
     Observables::operator[] (const QualifiedName & qn) const
     {
-        const auto & observable_entries = ObservableEntries::instance()->entries();
-
-        auto i = observable_entries.find(qn);
-        if (i != observable_entries.end())
-            return i->second;
-
-        return ObservableEntryPtr(nullptr);
+        return ObservableEntries::instance()->find(qn);
     }
 
     Observables::ObservableIterator
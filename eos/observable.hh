@@ -30,6 +30,8 @@
 #include <eos/utils/units.hh>
 
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace eos
 {
@@ -46,6 +48,20 @@ namespace eos
 
             virtual double evaluate() const = 0;
 
+            /*!
+             * Retrieve the exact partial derivatives of the observable with respect to its parameters.
+             *
+             * The result lists all parameters for which the derivatives are known, including
+             * vanishing ones. The derivatives with respect to any other parameter are not known,
+             * and must be obtained numerically. By default, no derivatives are known.
+             *
+             * @return Pairs of parameter id and partial derivative.
+             */
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives() const
+            {
+                return {};
+            }
+
             virtual Kinematics kinematics() = 0;
 
             virtual Parameters parameters() = 0;
@@ -34,6 +34,20 @@ class ObservableTest :
 
         virtual void run() const
         {
+            /* Test lookup of built-in observables */
+            {
+                auto observables = Observables();
+
+                TEST_CHECK(observables["B->pilnu::BR"]);
+                TEST_CHECK_EQUAL("B->pilnu::BR", observables["B->pilnu::BR;l=mu"]->name().str());
+                TEST_CHECK(! observables["B->pilnu::BRR"]);
+
+                // all instances share the same entries
+                TEST_CHECK(observables["B->pilnu::BR"] == Observables()["B->pilnu::BR"]);
+                TEST_CHECK_EQUAL(std::distance(observables.begin_sections(), observables.end_sections()),
+                        std::distance(Observables().begin_sections(), Observables().end_sections()));
+            }
+
             /* Test insertion of a new observable */
             {
                 auto observables = Observables();
@@ -138,5 +138,59 @@ class BToKDileptonBFS2004BobethCompatibilityTest :
             TEST_CHECK_RELATIVE_ERROR(d.integrated_forward_backward_asymmetry(1, 6), 0.1097985735, eps);
             TEST_CHECK_RELATIVE_ERROR(d.integrated_flat_term(1, 6), 0.2788261376, eps);
             TEST_CHECK_RELATIVE_ERROR(d.integrated_cp_asymmetry(1, 6), 0.00455162022, 8 * eps);
+
+            // the cacheable and the cached observables agree with the direct integration
+            {
+                Kinematics k
+                {
+                    { "q2_min", 1.0 }, { "q2_max", 6.0 }
+                };
+
+                ObservablePtr br = Observable::make("B->Kll::BR", p, k, oo);
+                const CacheableObservable * parent = dynamic_cast<const CacheableObservable *>(br.get());
+                TEST_CHECK(nullptr != parent);
+                TEST_CHECK_RELATIVE_ERROR(br->evaluate(), d.integrated_branching_ratio(1, 6), 1e-10);
+
+                const std::vector<std::pair<std::string, double>> references
+                {
+                    { "B->Kll::BRavg",    d.integrated_branching_ratio_cp_averaged(1, 6)            },
+                    { "B->Kll::A_CP",     d.integrated_cp_asymmetry(1, 6)                           },
+                    { "B->Kll::F_H",      d.integrated_flat_term(1, 6)                              },
+                    { "B->Kll::F_Havg",   d.integrated_flat_term_cp_averaged(1, 6)                  },
+                    { "B->Kll::A_FB",     d.integrated_forward_backward_asymmetry(1, 6)             },
+                    { "B->Kll::A_FBavg",  d.integrated_forward_backward_asymmetry_cp_averaged(1, 6) },
+                };
+
+                for (const auto & r : references)
+                {
+                    ObservablePtr o = Observable::make(r.first, p, k, oo);
+                    TEST_CHECK_RELATIVE_ERROR(o->evaluate(), r.second, 1e-10);
+
+                    ObservablePtr cached = dynamic_cast<const CacheableObservable *>(o.get())->make_cached_observable(parent);
+                    TEST_CHECK_RELATIVE_ERROR(cached->evaluate(), r.second, 1e-10);
+                }
+            }
+
+            // the same holds for the CP-conjugate decay
+            {
+                const Options oo_bar = oo + Options{ { "cp-conjugate", "true" } };
+
+                BToKDilepton d_bar(p, oo_bar);
+                Kinematics k
+                {
+                    { "q2_min", 1.0 }, { "q2_max", 6.0 }
+                };
+
+                ObservablePtr br = Observable::make("B->Kll::BR", p, k, oo_bar);
+                const CacheableObservable * parent = dynamic_cast<const CacheableObservable *>(br.get());
+                TEST_CHECK_RELATIVE_ERROR(br->evaluate(), d_bar.integrated_branching_ratio(1, 6), 1e-10);
+
+                ObservablePtr a_cp = Observable::make("B->Kll::A_CP", p, k, oo_bar);
+                ObservablePtr cached = dynamic_cast<const CacheableObservable *>(a_cp.get())->make_cached_observable(parent);
+                TEST_CHECK_RELATIVE_ERROR(cached->evaluate(), d.integrated_cp_asymmetry(1, 6), 1e-10);
+
+                const double br_avg = d.integrated_branching_ratio_cp_averaged(1, 6);
+                TEST_CHECK_RELATIVE_ERROR((d.integrated_branching_ratio(1, 6) + br->evaluate()) / 2.0, br_avg, 1e-10);
+            }
         }
 } b_to_k_dilepton_BFS2004_bobeth_compatibility_test;
@@ -22,6 +22,7 @@
 #include <eos/rare-b-decays/b-to-k-ll-bfs2004.hh>
 #include <eos/rare-b-decays/b-to-k-ll-gp2004.hh>
 #include <eos/rare-b-decays/b-to-k-ll-gvdv2020.hh>
+#include <eos/rare-b-decays/b-to-k-ll-impl.hh>
 #include <eos/utils/integrate.hh>
 #include <eos/utils/integrate-impl.hh>
 #include <eos/utils/power_of.hh>
@@ -35,22 +36,6 @@ namespace eos
     using std::norm;
     using std::sqrt;
 
-    struct BToKDilepton::AngularCoefficients
-    {
-        double a_l, b_l, c_l;
-
-        AngularCoefficients()
-        {
-        }
-
-        AngularCoefficients(const std::array<double, 3> & a) :
-            a_l(a[0]),
-            b_l(a[1]),
-            c_l(a[2])
-        {
-        }
-    };
-
     /*!
      * Implementation for the decay @f$\bar{B} \to \bar{K} \ell^+ \ell^-@f$.
      */
@@ -70,6 +55,10 @@ namespace eos
         UsedParameter tau;
         UsedParameter mu;
 
+        using IntermediateResult = BToKDilepton::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make(o.get("model", "WilsonScan"), p, o)),
             opt_l(o, "l", { "e", "mu", "tau" }, "mu"),
@@ -178,6 +167,23 @@ namespace eos
             return BToKDilepton::AngularCoefficients(integrated_angular_coefficients_array);
         }
 
+        // integrate the angular coefficients of the decay selected by the option 'cp-conjugate',
+        // and those of the CP-conjugate decay only on demand
+        void prepare(IntermediateResult & result, const double & s_min, const double & s_max) const
+        {
+            result.reset(amplitude_generator->cp_conjugate, [this, s_min, s_max] ()
+            {
+                return integrated_angular_coefficients(s_min, s_max);
+            });
+        }
+
+        const IntermediateResult * prepare(const double & s_min, const double & s_max)
+        {
+            prepare(intermediate_result, s_min, s_max);
+
+            return &intermediate_result;
+        }
+
         inline double beta_l(const double & s) const
         {
             return sqrt(1.0 - 4.0 * m_l * m_l / s);
@@ -249,30 +255,56 @@ namespace eos
     }
 
     // Integrated Observables
+    const BToKDilepton::IntermediateResult *
+    BToKDilepton::prepare(const double & s_min, const double & s_max) const
+    {
+        return _imp->prepare(s_min, s_max);
+    }
+
     double
     BToKDilepton::integrated_decay_width(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        return _imp->unnormalized_decay_width(a);
+        return integrated_decay_width(&ir);
+    }
+
+    double
+    BToKDilepton::integrated_decay_width(const IntermediateResult * ir) const
+    {
+        return _imp->unnormalized_decay_width(ir->a_c_selected());
     }
 
     double
     BToKDilepton::integrated_branching_ratio(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        return _imp->differential_branching_ratio(a);
+        return integrated_branching_ratio(&ir);
+    }
+
+    double
+    BToKDilepton::integrated_branching_ratio(const IntermediateResult * ir) const
+    {
+        return _imp->differential_branching_ratio(ir->a_c_selected());
     }
 
     double
     BToKDilepton::integrated_branching_ratio_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->amplitude_generator->cp_conjugate, false);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        double br = _imp->differential_branching_ratio(_imp->integrated_angular_coefficients(s_min, s_max));
-        _imp->amplitude_generator->cp_conjugate = true;
-        double br_bar = _imp->differential_branching_ratio(_imp->integrated_angular_coefficients(s_min, s_max));
+        return integrated_branching_ratio_cp_averaged(&ir);
+    }
+
+    double
+    BToKDilepton::integrated_branching_ratio_cp_averaged(const IntermediateResult * ir) const
+    {
+        double br = _imp->differential_branching_ratio(ir->a_c());
+        double br_bar = _imp->differential_branching_ratio(ir->a_c_bar());
 
         return (br + br_bar) / 2.0;
     }
@@ -280,11 +312,17 @@ namespace eos
     double
     BToKDilepton::integrated_cp_asymmetry(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->amplitude_generator->cp_conjugate, false);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_cp_asymmetry(&ir);
+    }
 
-        auto gamma     = _imp->unnormalized_decay_width(_imp->integrated_angular_coefficients(s_min, s_max));
-        _imp->amplitude_generator->cp_conjugate = true;
-        auto gamma_bar = _imp->unnormalized_decay_width(_imp->integrated_angular_coefficients(s_min, s_max));
+    double
+    BToKDilepton::integrated_cp_asymmetry(const IntermediateResult * ir) const
+    {
+        auto gamma     = _imp->unnormalized_decay_width(ir->a_c());
+        auto gamma_bar = _imp->unnormalized_decay_width(ir->a_c_bar());
 
         return (gamma - gamma_bar) / (gamma + gamma_bar);
     }
@@ -292,7 +330,16 @@ namespace eos
     double
     BToKDilepton::integrated_flat_term(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_flat_term(&ir);
+    }
+
+    double
+    BToKDilepton::integrated_flat_term(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a = ir->a_c_selected();
 
         return _imp->differential_flat_term_numerator(a) / _imp->unnormalized_decay_width(a);
     }
@@ -300,15 +347,19 @@ namespace eos
     double
     BToKDilepton::integrated_flat_term_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->amplitude_generator->cp_conjugate, false);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        double num_integrated = _imp->differential_flat_term_numerator(_imp->integrated_angular_coefficients(s_min, s_max));
-        double denom_integrated = _imp->unnormalized_decay_width(_imp->integrated_angular_coefficients(s_min, s_max));
-
-        _imp->amplitude_generator->cp_conjugate = true;
+        return integrated_flat_term_cp_averaged(&ir);
+    }
 
-        num_integrated += _imp->differential_flat_term_numerator(_imp->integrated_angular_coefficients(s_min, s_max));
-        denom_integrated += _imp->unnormalized_decay_width(_imp->integrated_angular_coefficients(s_min, s_max));
+    double
+    BToKDilepton::integrated_flat_term_cp_averaged(const IntermediateResult * ir) const
+    {
+        double num_integrated = _imp->differential_flat_term_numerator(ir->a_c())
+                + _imp->differential_flat_term_numerator(ir->a_c_bar());
+        double denom_integrated = _imp->unnormalized_decay_width(ir->a_c())
+                + _imp->unnormalized_decay_width(ir->a_c_bar());
 
         return num_integrated / denom_integrated;
     }
@@ -316,24 +367,36 @@ namespace eos
     double
     BToKDilepton::integrated_forward_backward_asymmetry(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        return _imp->differential_forward_backward_asymmetry_numerator(a) / _imp->unnormalized_decay_width(a);
+        return integrated_forward_backward_asymmetry(&ir);
+    }
+
+    double
+    BToKDilepton::integrated_forward_backward_asymmetry(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a = ir->a_c_selected();
 
+        return _imp->differential_forward_backward_asymmetry_numerator(a) / _imp->unnormalized_decay_width(a);
     }
 
     double
     BToKDilepton::integrated_forward_backward_asymmetry_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->amplitude_generator->cp_conjugate, false);
-
-        double num_integrated = _imp->differential_forward_backward_asymmetry_numerator(_imp->integrated_angular_coefficients(s_min, s_max));
-        double denom_integrated = _imp->unnormalized_decay_width(_imp->integrated_angular_coefficients(s_min, s_max));
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        _imp->amplitude_generator->cp_conjugate = true;
+        return integrated_forward_backward_asymmetry_cp_averaged(&ir);
+    }
 
-        num_integrated += _imp->differential_forward_backward_asymmetry_numerator(_imp->integrated_angular_coefficients(s_min, s_max));
-        denom_integrated += _imp->unnormalized_decay_width(_imp->integrated_angular_coefficients(s_min, s_max));
+    double
+    BToKDilepton::integrated_forward_backward_asymmetry_cp_averaged(const IntermediateResult * ir) const
+    {
+        double num_integrated = _imp->differential_forward_backward_asymmetry_numerator(ir->a_c())
+                + _imp->differential_forward_backward_asymmetry_numerator(ir->a_c_bar());
+        double denom_integrated = _imp->unnormalized_decay_width(ir->a_c())
+                + _imp->unnormalized_decay_width(ir->a_c_bar());
 
         return num_integrated / denom_integrated;
     }
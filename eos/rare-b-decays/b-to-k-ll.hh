@@ -19,7 +19,7 @@
  */
 
 #ifndef EOS_GUARD_EOS_RARE_B_DECAYS_B_TO_K_LL_HH
-#define EOS_GUARD_SRC_RARE_B_DECAYS_B_TO_K_LL_HH 1
+#define EOS_GUARD_EOS_RARE_B_DECAYS_B_TO_K_LL_HH 1
 
 #include <eos/utils/complex.hh>
 #include <eos/utils/options.hh>
@@ -44,6 +44,7 @@ namespace eos
             struct Amplitudes;
             class AmplitudeGenerator;
             struct DipoleFormFactors;
+            class IntermediateResult;
 
             // Differential Observables
             double differential_branching_ratio(const double & s) const;
@@ -55,14 +56,23 @@ namespace eos
             double two_differential_decay_width(const double & s, const double & c_theta_l) const;
 
             // Integrated Observables
+            const IntermediateResult * prepare(const double & s_min, const double & s_max) const;
             double integrated_decay_width(const double & s_min, const double & s_max) const;
+            double integrated_decay_width(const IntermediateResult *) const;
             double integrated_branching_ratio(const double & s_min, const double & s_max) const;
+            double integrated_branching_ratio(const IntermediateResult *) const;
             double integrated_branching_ratio_cp_averaged(const double & s_min, const double & s_max) const;
+            double integrated_branching_ratio_cp_averaged(const IntermediateResult *) const;
             double integrated_cp_asymmetry(const double & s_min, const double & s_max) const;
+            double integrated_cp_asymmetry(const IntermediateResult *) const;
             double integrated_flat_term(const double & s_min, const double & s_max) const;
+            double integrated_flat_term(const IntermediateResult *) const;
             double integrated_flat_term_cp_averaged(const double & s_min, const double & s_max) const;
+            double integrated_flat_term_cp_averaged(const IntermediateResult *) const;
             double integrated_forward_backward_asymmetry(const double & s_min, const double & s_max) const;
+            double integrated_forward_backward_asymmetry(const IntermediateResult *) const;
             double integrated_forward_backward_asymmetry_cp_averaged(const double & s_min, const double & s_max) const;
+            double integrated_forward_backward_asymmetry_cp_averaged(const IntermediateResult *) const;
             double integrated_ratio_muons_electrons(const double & s_min, const double & s_max) const;
 
             /*!
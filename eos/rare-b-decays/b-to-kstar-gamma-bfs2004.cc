@@ -163,7 +163,7 @@ namespace eos
         complex<double> C1f_top_perp_right = wc.c7prime() * (8.0 * std::log(m_b_PS / mu()) - L - 4.0 * (1.0 - mu_f() / m_b_PS));
         // cf. [BFS2001], Eqs. (34), (37), p. 9, s -> 0
         complex<double> C1nf_top_perp_left = (-1.0 / QCD::casimir_f) * (
-                (wc.c2() - wc.c1() / 6.0) * memoise(CharmLoops::F27_massive, mu(), 0.0, m_b_PS, m_c_pole) + c8eff * CharmLoops::F87_massless(mu, 0.0, m_b_PS));
+                (wc.c2() - wc.c1() / 6.0) * persistent_memoise("CharmLoops::F27_massive", CharmLoops::F27_massive, mu(), 0.0, m_b_PS, m_c_pole) + c8eff * CharmLoops::F87_massless(mu, 0.0, m_b_PS));
         const complex<double> C1nf_top_perp_right = 0.0;
 
         /* perpendicular, up sector */
@@ -174,7 +174,7 @@ namespace eos
         // cf. [BFS2001], Eqs. (34), (37), p. 9
         // [BFS2004], [S2004] have a different sign convention for F{12}{79}_massless than we!
         complex<double> C1nf_up_perp_left = (-1.0 / QCD::casimir_f) * (
-                (wc.c2() - wc.c1() / 6.0) * (memoise(CharmLoops::F27_massive, mu(), 0.0, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, 0.0, m_b_PS)));
+                (wc.c2() - wc.c1() / 6.0) * (persistent_memoise("CharmLoops::F27_massive", CharmLoops::F27_massive, mu(), 0.0, m_b_PS, m_c_pole) - CharmLoops::F27_massless(mu, 0.0, m_b_PS)));
         const complex<double> C1nf_up_perp_right = 0.0;
 
         // compute the factorizing contributions
@@ -78,4 +78,13 @@ namespace eos
         return s / m_B() / m_B();
     }
 
+    void
+    BToKstarDilepton::AmplitudeGenerator::amplitudes_batch(const double * q2, const std::size_t & n, BToKstarDilepton::Amplitudes * result) const
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            result[i] = this->amplitudes(q2[i]);
+        }
+    }
+
 }
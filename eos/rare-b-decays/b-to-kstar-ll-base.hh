@@ -26,6 +26,8 @@
 #include <eos/form-factors/mesonic.hh>
 #include <eos/rare-b-decays/b-to-kstar-ll.hh>
 
+#include <cstddef>
+
 namespace eos
 {
     class BToKstarDilepton::AmplitudeGenerator :
@@ -57,6 +59,19 @@ namespace eos
 
             virtual ~AmplitudeGenerator();
             virtual BToKstarDilepton::Amplitudes amplitudes(const double & q2) const = 0;
+
+            /*!
+             * Compute the amplitudes at several values of q^2 at once.
+             *
+             * The default implementation calls amplitudes(q2) for each point. Amplitude generators can
+             * override this to evaluate quantities that are shared among all points, e.g. the Wilson
+             * coefficients and the form factors, only once.
+             *
+             * @param q2     The values of q^2.
+             * @param n      The number of values of q^2.
+             * @param result The amplitudes, one per value of q^2.
+             */
+            virtual void amplitudes_batch(const double * q2, const std::size_t & n, BToKstarDilepton::Amplitudes * result) const;
     };
 
     struct BToKstarDilepton::DipoleFormFactors
@@ -100,18 +100,43 @@ namespace eos
 
     BToKstarDilepton::Amplitudes
     BToKstarDileptonAmplitudes<tag::GP2004>::amplitudes(const double & s) const
+    {
+        BToKstarDilepton::Amplitudes result;
+
+        amplitudes_batch(&s, 1, &result);
+
+        return result;
+    }
+
+    void
+    BToKstarDileptonAmplitudes<tag::GP2004>::amplitudes_batch(const double * q2, const std::size_t & n, BToKstarDilepton::Amplitudes * result) const
+    {
+        const WilsonCoefficients<BToS> wc = model->wilson_coefficients_b_to_s(mu(), lepton_flavour, cp_conjugate);
+
+        // only the form factors that enter the amplitudes
+        FormFactors<PToV>::Values ff(FormFactors<PToV>::ff_v | FormFactors<PToV>::ff_a_0 | FormFactors<PToV>::ff_a_1 | FormFactors<PToV>::ff_a_2
+                | FormFactors<PToV>::ff_t_1 | FormFactors<PToV>::ff_t_2 | FormFactors<PToV>::ff_t_3);
+        form_factors->evaluate(q2, n, ff);
+
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            result[i] = amplitudes(q2[i], wc, ff, i);
+        }
+    }
+
+    BToKstarDilepton::Amplitudes
+    BToKstarDileptonAmplitudes<tag::GP2004>::amplitudes(const double & s, const WilsonCoefficients<BToS> & wc,
+            const FormFactors<PToV>::Values & ff, const std::size_t & i) const
     {
         // compute J_i, [BHvD2010], p. 26, Eqs. (A1)-(A11)
         // TODO: possibly optimize the calculation
         BToKstarDilepton::Amplitudes result;
 
-        WilsonCoefficients<BToS> wc = model->wilson_coefficients_b_to_s(mu(), lepton_flavour, cp_conjugate);
-
         const double m_B2 = m_B * m_B, m_Kstar2 = m_Kstar * m_Kstar, m2_diff = m_B2 - m_Kstar2;
         const double m_Kstarhat = m_Kstar / m_B;
         const double m_Kstarhat2 = std::pow(m_Kstarhat, 2);
         const double s_hat = s / m_B / m_B;
-        const double a_1 = form_factors->a_1(s), a_2 = form_factors->a_2(s);
+        const double a_1 = ff.a_1[i], a_2 = ff.a_2[i];
         const double alpha_s = model->alpha_s(mu());
         const double norm_s = this->norm(s);
         const double lam = this->lambda(s);
@@ -150,7 +175,7 @@ namespace eos
         complex<double> wilson_perp_right = c910_plus_right + c7_plus * (m_b_MSbar() + m_s() + lambda_perp()) - subleading_perp;
         complex<double> wilson_perp_left  = c910_plus_left  + c7_plus * (m_b_MSbar() + m_s() + lambda_perp()) - subleading_perp;
 
-        double formfactor_perp = std::sqrt(2.0 * eos::lambda(1.0, m_Kstarhat2, s_hat)) / (1.0 + m_Kstarhat) * form_factors->v(s);
+        double formfactor_perp = std::sqrt(2.0 * eos::lambda(1.0, m_Kstarhat2, s_hat)) / (1.0 + m_Kstarhat) * ff.v[i];
         // cf. [BHvD2010], Eq. (3.13), p. 10
         result.a_perp_right = norm_s * prefactor_perp * wilson_perp_right * formfactor_perp;
         result.a_perp_left  = norm_s * prefactor_perp * wilson_perp_left  * formfactor_perp;
@@ -167,16 +192,16 @@ namespace eos
         // timelike
         result.a_time = norm_s * sqrt_lam / sqrt_s
             * (2.0 * (wc.c10() - wc.c10prime()) + s / m_l / (m_b_MSbar + m_s()) * (wc.cP() - wc.cPprime()))
-            * form_factors->a_0(s);
+            * ff.a_0[i];
 
         // scalar amplitude
-        result.a_scal = -2.0 * norm_s * sqrt_lam * (wc.cS() - wc.cSprime()) / (m_b_MSbar + m_s()) * form_factors->a_0(s);
+        result.a_scal = -2.0 * norm_s * sqrt_lam * (wc.cS() - wc.cSprime()) / (m_b_MSbar + m_s()) * ff.a_0[i];
 
         // tensor amplitudes [BHvD2012]  eqs. (B18 - B20)
         // no form factor relations used
-        const double ff_T1  = form_factors->t_1(s);
-        const double ff_T2  = form_factors->t_2(s);
-        const double ff_T3  = form_factors->t_3(s);
+        const double ff_T1  = ff.t_1[i];
+        const double ff_T2  = ff.t_2[i];
+        const double ff_T3  = ff.t_3[i];
 
         const double kin_tensor_1 = norm_s / m_Kstar * ((m_B2 + 3.0 * m_Kstar2 - s) * ff_T2 - lam / m2_diff * ff_T3);
         const double kin_tensor_2 = 2.0 * norm_s * sqrt_lam / sqrt_s * ff_T1;
@@ -56,6 +56,12 @@ namespace eos
 
             virtual BToKstarDilepton::Amplitudes amplitudes(const double & q2) const;
 
+            virtual void amplitudes_batch(const double * q2, const std::size_t & n, BToKstarDilepton::Amplitudes * result) const;
+
+            // the amplitudes at the i-th point of a batch
+            BToKstarDilepton::Amplitudes amplitudes(const double & q2, const WilsonCoefficients<BToS> & wc,
+                    const FormFactors<PToV>::Values & ff, const std::size_t & i) const;
+
             inline complex<double> c7eff(const WilsonCoefficients<BToS> & wc, const double & q2) const;
             inline complex<double> c9eff(const WilsonCoefficients<BToS> & wc, const double & q2) const;
             inline double m_b_PS() const;
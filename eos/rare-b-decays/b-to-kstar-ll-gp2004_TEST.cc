@@ -232,6 +232,55 @@ class BToKstarDileptonLowRecoilTest :
                     TEST_CHECK_RELATIVE_ERROR(d.integrated_transverse_asymmetry_2_cp_averaged(14.18, 19.21),     -4.91581e-1, eps);
                 }
 
+                /* cacheable and cached observables */
+                {
+                    static const double eps = 1e-10;
+
+                    Kinematics k
+                    {
+                        { "q2_min", 14.18 }, { "q2_max", 19.21 }
+                    };
+
+                    ObservablePtr br = Observable::make("B->K^*ll::BR", p, k, oo);
+                    const CacheableObservable * parent = dynamic_cast<const CacheableObservable *>(br.get());
+                    TEST_CHECK(nullptr != parent);
+                    TEST_CHECK_RELATIVE_ERROR(br->evaluate(), d.integrated_branching_ratio(14.18, 19.21), eps);
+
+                    const std::vector<std::pair<std::string, double>> references
+                    {
+                        { "B->K^*ll::BRavg",    d.integrated_branching_ratio_cp_averaged(14.18, 19.21)            },
+                        { "B->K^*ll::A_CP",     d.integrated_cp_asymmetry(14.18, 19.21)                           },
+                        { "B->K^*ll::A_FB",     d.integrated_forward_backward_asymmetry(14.18, 19.21)             },
+                        { "B->K^*ll::A_FBavg",  d.integrated_forward_backward_asymmetry_cp_averaged(14.18, 19.21) },
+                        { "B->K^*ll::F_L",      d.integrated_longitudinal_polarisation(14.18, 19.21)              },
+                        { "B->K^*ll::F_Lavg",   d.integrated_longitudinal_polarisation_cp_averaged(14.18, 19.21)  },
+                        { "B->K^*ll::J_9",      d.integrated_j_9(14.18, 19.21)                                    },
+                        { "B->K^*ll::A_9",      d.integrated_a_9(14.18, 19.21)                                    },
+                    };
+
+                    // the cached observables share the angular coefficients integrated by their parent
+                    for (const auto & r : references)
+                    {
+                        ObservablePtr o = Observable::make(r.first, p, k, oo);
+                        TEST_CHECK_RELATIVE_ERROR(o->evaluate(), r.second, eps);
+
+                        ObservablePtr cached = dynamic_cast<const CacheableObservable *>(o.get())->make_cached_observable(parent);
+                        TEST_CHECK_RELATIVE_ERROR(cached->evaluate(), r.second, eps);
+                    }
+
+                    // the CP-conjugate decay selects the other set of angular coefficients
+                    const Options oo_bar = oo + Options{ { "cp-conjugate", "true" } };
+                    BToKstarDilepton d_bar(p, oo_bar);
+
+                    ObservablePtr br_bar = Observable::make("B->K^*ll::BR", p, k, oo_bar);
+                    TEST_CHECK_RELATIVE_ERROR(br_bar->evaluate(), d_bar.integrated_branching_ratio(14.18, 19.21), eps);
+                    TEST_CHECK_RELATIVE_ERROR((br->evaluate() + br_bar->evaluate()) / 2.0, d.integrated_branching_ratio_cp_averaged(14.18, 19.21), eps);
+
+                    ObservablePtr a_cp_bar = Observable::make("B->K^*ll::A_CP", p, k, oo_bar);
+                    ObservablePtr cached = dynamic_cast<const CacheableObservable *>(a_cp_bar.get())->make_cached_observable(dynamic_cast<const CacheableObservable *>(br_bar.get()));
+                    TEST_CHECK_RELATIVE_ERROR(cached->evaluate(), d.integrated_cp_asymmetry(14.18, 19.21), eps);
+                }
+
                 /* transversity amplitudes at q^2 = 16.00 GeV^2 */
                 {
                     static const double eps = 1e-19; // 1e-7 smaller than results
@@ -47,17 +47,42 @@ namespace eos
     {
         BToKstarDilepton::Amplitudes result;
 
-        WilsonCoefficients<BToS> wc = model->wilson_coefficients_b_to_s(mu(), lepton_flavour, cp_conjugate);
+        amplitudes_batch(&s, 1, &result);
+
+        return result;
+    }
+
+    void
+    BToKstarDileptonAmplitudes<tag::GvDV2020>::amplitudes_batch(const double * q2, const std::size_t & n, BToKstarDilepton::Amplitudes * result) const
+    {
+        const WilsonCoefficients<BToS> wc = model->wilson_coefficients_b_to_s(mu(), lepton_flavour, cp_conjugate);
+
+        // only the form factors that enter the amplitudes
+        FormFactors<PToV>::Values ff(FormFactors<PToV>::ff_v | FormFactors<PToV>::ff_a_0 | FormFactors<PToV>::ff_a_1 | FormFactors<PToV>::ff_a_2
+                | FormFactors<PToV>::ff_t_1 | FormFactors<PToV>::ff_t_2 | FormFactors<PToV>::ff_t_3);
+        form_factors->evaluate(q2, n, ff);
+
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            result[i] = amplitudes(q2[i], wc, ff, i);
+        }
+    }
+
+    BToKstarDilepton::Amplitudes
+    BToKstarDileptonAmplitudes<tag::GvDV2020>::amplitudes(const double & s, const WilsonCoefficients<BToS> & wc,
+            const FormFactors<PToV>::Values & ff, const std::size_t & i) const
+    {
+        BToKstarDilepton::Amplitudes result;
 
         // classic form factors
         const double
-                ff_V  = form_factors->v(s),
-                ff_A0 = form_factors->a_0(s),
-                ff_A1 = form_factors->a_1(s),
-                ff_A2 = form_factors->a_2(s),
-                ff_T1 = form_factors->t_1(s),
-                ff_T2 = form_factors->t_2(s),
-                ff_T3 = form_factors->t_3(s);
+                ff_V  = ff.v[i],
+                ff_A0 = ff.a_0[i],
+                ff_A1 = ff.a_1[i],
+                ff_A2 = ff.a_2[i],
+                ff_T1 = ff.t_1[i],
+                ff_T2 = ff.t_2[i],
+                ff_T3 = ff.t_3[i];
 
         // kinematics
         const double
@@ -47,6 +47,12 @@ namespace eos
             ~BToKstarDileptonAmplitudes() = default;
 
             virtual BToKstarDilepton::Amplitudes amplitudes(const double & q2) const;
+
+            virtual void amplitudes_batch(const double * q2, const std::size_t & n, BToKstarDilepton::Amplitudes * result) const;
+
+            // the amplitudes at the i-th point of a batch
+            BToKstarDilepton::Amplitudes amplitudes(const double & q2, const WilsonCoefficients<BToS> & wc,
+                    const FormFactors<PToV>::Values & ff, const std::size_t & i) const;
     };
 }
 
@@ -0,0 +1,69 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_RARE_B_DECAYS_B_TO_KSTAR_LL_IMPL_HH
+#define EOS_GUARD_EOS_RARE_B_DECAYS_B_TO_KSTAR_LL_IMPL_HH 1
+
+#include <eos/rare-b-decays/b-to-kstar-ll.hh>
+#include <eos/rare-b-decays/cp-conjugate-angular-coefficients.hh>
+
+#include <array>
+
+namespace eos
+{
+    struct BToKstarDilepton::AngularCoefficients
+    {
+        double j1s, j1c;
+        double j2s, j2c;
+        double j3;
+        double j4;
+        double j5;
+        double j6s, j6c;
+        double j7;
+        double j8;
+        double j9;
+
+        AngularCoefficients()
+        {
+        }
+
+        AngularCoefficients(const std::array<double, 12> & a) :
+            j1s(a[0]),
+            j1c(a[1]),
+            j2s(a[2]),
+            j2c(a[3]),
+            j3(a[4]),
+            j4(a[5]),
+            j5(a[6]),
+            j6s(a[7]),
+            j6c(a[8]),
+            j7(a[9]),
+            j8(a[10]),
+            j9(a[11])
+        {
+        }
+    };
+
+    class BToKstarDilepton::IntermediateResult :
+        public CPConjugateAngularCoefficients<BToKstarDilepton::AngularCoefficients>
+    {
+    };
+}
+
+#endif
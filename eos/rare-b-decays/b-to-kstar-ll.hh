@@ -21,7 +21,7 @@
  */
 
 #ifndef EOS_GUARD_EOS_RARE_B_DECAYS_B_TO_KSTAR_LL_HH
-#define EOS_GUARD_SRC_RARE_B_DECAYS_B_TO_KSTAR_LL_HH 1
+#define EOS_GUARD_EOS_RARE_B_DECAYS_B_TO_KSTAR_LL_HH 1
 
 #include <eos/utils/complex.hh>
 #include <eos/utils/options.hh>
@@ -48,6 +48,7 @@ namespace eos
             struct Amplitudes;
             class AmplitudeGenerator;
             struct DipoleFormFactors;
+            class IntermediateResult;
 
             /*!
              * @name Signal PDFs
@@ -144,6 +145,17 @@ namespace eos
             double differential_j_1s_minus_3j_2s_cp_averaged(const double & s) const;
             // @}
 
+            /*!
+             * @name Intermediate result (@f$q^2@f$-integrated)
+             *
+             * Integrates the angular coefficients of both CP-conjugate decays
+             * over one bin. All @f$q^2@f$-integrated observables below can be
+             * evaluated from this intermediate result.
+             */
+            // @{
+            const IntermediateResult * prepare(const double & q2_min, const double & q2_max) const;
+            // @}
+
             /*!
              * @name Simple observables (@f$q^2@f$-integrated)
              *
@@ -153,15 +165,25 @@ namespace eos
              */
             // @{
             double integrated_decay_width(const double & q2_min, const double & q2_max) const;
+            double integrated_decay_width(const IntermediateResult *) const;
             double integrated_branching_ratio(const double & q2_min, const double & q2_max) const;
+            double integrated_branching_ratio(const IntermediateResult *) const;
             double integrated_branching_ratio_cp_averaged(const double & q2_min, const double & q2_max) const;
+            double integrated_branching_ratio_cp_averaged(const IntermediateResult *) const;
             double integrated_unnormalized_forward_backward_asymmetry(const double & s_min, const double & s_max) const;
+            double integrated_unnormalized_forward_backward_asymmetry(const IntermediateResult *) const;
             double integrated_forward_backward_asymmetry(const double & q2_min, const double & q2_max) const;
+            double integrated_forward_backward_asymmetry(const IntermediateResult *) const;
             double integrated_forward_backward_asymmetry_cp_averaged(const double & s_min, const double & s_max) const;
+            double integrated_forward_backward_asymmetry_cp_averaged(const IntermediateResult *) const;
             double integrated_longitudinal_polarisation(const double & q2_min, const double & q2_max) const;
+            double integrated_longitudinal_polarisation(const IntermediateResult *) const;
             double integrated_longitudinal_polarisation_cp_averaged(const double & q2_min, const double & q2_max) const;
+            double integrated_longitudinal_polarisation_cp_averaged(const IntermediateResult *) const;
             double integrated_transversal_polarisation(const double & q2_min, const double & q2_max) const;
+            double integrated_transversal_polarisation(const IntermediateResult *) const;
             double integrated_transversal_polarisation_cp_averaged(const double & q2_min, const double & q2_max) const;
+            double integrated_transversal_polarisation_cp_averaged(const IntermediateResult *) const;
             // @}
 
             /*!
@@ -174,6 +196,7 @@ namespace eos
              */
             // @{
             double integrated_cp_asymmetry(const double & q2_min, const double & q2_max) const;
+            double integrated_cp_asymmetry(const IntermediateResult *) const;
             // @}
 
             /*!
@@ -184,12 +207,19 @@ namespace eos
              */
             // @{
             double integrated_transverse_asymmetry_2(const double & q2_min, const double & q2_max) const;
+            double integrated_transverse_asymmetry_2(const IntermediateResult *) const;
             double integrated_transverse_asymmetry_2_cp_averaged(const double & q2_min, const double & q2_max) const;
+            double integrated_transverse_asymmetry_2_cp_averaged(const IntermediateResult *) const;
             double integrated_transverse_asymmetry_3(const double & q2_min, const double & q2_max) const;
+            double integrated_transverse_asymmetry_3(const IntermediateResult *) const;
             double integrated_transverse_asymmetry_4(const double & q2_min, const double & q2_max) const;
+            double integrated_transverse_asymmetry_4(const IntermediateResult *) const;
             double integrated_transverse_asymmetry_5(const double & q2_min, const double & q2_max) const;
+            double integrated_transverse_asymmetry_5(const IntermediateResult *) const;
             double integrated_transverse_asymmetry_re(const double & q2_min, const double & q2_max) const;
+            double integrated_transverse_asymmetry_re(const IntermediateResult *) const;
             double integrated_transverse_asymmetry_im(const double & q2_min, const double & q2_max) const;
+            double integrated_transverse_asymmetry_im(const IntermediateResult *) const;
             // @}
 
             /*!
@@ -200,8 +230,11 @@ namespace eos
              */
             // @{
             double integrated_p_prime_4(const double & q2_min, const double & q2_max) const;
+            double integrated_p_prime_4(const IntermediateResult *) const;
             double integrated_p_prime_5(const double & q2_min, const double & q2_max) const;
+            double integrated_p_prime_5(const IntermediateResult *) const;
             double integrated_p_prime_6(const double & q2_min, const double & q2_max) const;
+            double integrated_p_prime_6(const IntermediateResult *) const;
             // @}
 
             /*!
@@ -212,10 +245,15 @@ namespace eos
              */
             // @{
             double integrated_h_1(const double & q2_min, const double & q2_max) const;
+            double integrated_h_1(const IntermediateResult *) const;
             double integrated_h_2(const double & q2_min, const double & q2_max) const;
+            double integrated_h_2(const IntermediateResult *) const;
             double integrated_h_3(const double & q2_min, const double & q2_max) const;
+            double integrated_h_3(const IntermediateResult *) const;
             double integrated_h_4(const double & q2_min, const double & q2_max) const;
+            double integrated_h_4(const IntermediateResult *) const;
             double integrated_h_5(const double & q2_min, const double & q2_max) const;
+            double integrated_h_5(const IntermediateResult *) const;
             // @}
 
             /*!
@@ -223,21 +261,37 @@ namespace eos
              */
             // @{
             double integrated_j_1s(const double & q2_min, const double & q2_max) const;
+            double integrated_j_1s(const IntermediateResult *) const;
             double integrated_j_1c(const double & q2_min, const double & q2_max) const;
+            double integrated_j_1c(const IntermediateResult *) const;
             double integrated_j_2s(const double & q2_min, const double & q2_max) const;
+            double integrated_j_2s(const IntermediateResult *) const;
             double integrated_j_2c(const double & q2_min, const double & q2_max) const;
+            double integrated_j_2c(const IntermediateResult *) const;
             double integrated_j_3(const double & q2_min, const double & q2_max) const;
+            double integrated_j_3(const IntermediateResult *) const;
             double integrated_j_3_normalized(const double & q2_min, const double & q2_max) const;
+            double integrated_j_3_normalized(const IntermediateResult *) const;
             double integrated_j_3_normalized_cp_averaged(const double & q2_min, const double & q2_max) const;
+            double integrated_j_3_normalized_cp_averaged(const IntermediateResult *) const;
             double integrated_j_4(const double & q2_min, const double & q2_max) const;
+            double integrated_j_4(const IntermediateResult *) const;
             double integrated_j_5(const double & q2_min, const double & q2_max) const;
+            double integrated_j_5(const IntermediateResult *) const;
             double integrated_j_6s(const double & q2_min, const double & q2_max) const;
+            double integrated_j_6s(const IntermediateResult *) const;
             double integrated_j_6c(const double & q2_min, const double & q2_max) const;
+            double integrated_j_6c(const IntermediateResult *) const;
             double integrated_j_7(const double & q2_min, const double & q2_max) const;
+            double integrated_j_7(const IntermediateResult *) const;
             double integrated_j_8(const double & q2_min, const double & q2_max) const;
+            double integrated_j_8(const IntermediateResult *) const;
             double integrated_j_9(const double & q2_min, const double & q2_max) const;
+            double integrated_j_9(const IntermediateResult *) const;
             double integrated_j_9_normalized(const double & q2_min, const double & q2_max) const;
+            double integrated_j_9_normalized(const IntermediateResult *) const;
             double integrated_j_9_normalized_cp_averaged(const double & q2_min, const double & q2_max) const;
+            double integrated_j_9_normalized_cp_averaged(const IntermediateResult *) const;
             // @}
 
             /*!
@@ -245,17 +299,29 @@ namespace eos
              */
             // @{
             double integrated_s_1s(const double & q2_min, const double & q2_max) const;
+            double integrated_s_1s(const IntermediateResult *) const;
             double integrated_s_1c(const double & q2_min, const double & q2_max) const;
+            double integrated_s_1c(const IntermediateResult *) const;
             double integrated_s_2s(const double & q2_min, const double & q2_max) const;
+            double integrated_s_2s(const IntermediateResult *) const;
             double integrated_s_2c(const double & q2_min, const double & q2_max) const;
+            double integrated_s_2c(const IntermediateResult *) const;
             double integrated_s_3(const double & q2_min, const double & q2_max) const;
+            double integrated_s_3(const IntermediateResult *) const;
             double integrated_s_4(const double & q2_min, const double & q2_max) const;
+            double integrated_s_4(const IntermediateResult *) const;
             double integrated_s_5(const double & q2_min, const double & q2_max) const;
+            double integrated_s_5(const IntermediateResult *) const;
             double integrated_s_6s(const double & q2_min, const double & q2_max) const;
+            double integrated_s_6s(const IntermediateResult *) const;
             double integrated_s_6c(const double & q2_min, const double & q2_max) const;
+            double integrated_s_6c(const IntermediateResult *) const;
             double integrated_s_7(const double & q2_min, const double & q2_max) const;
+            double integrated_s_7(const IntermediateResult *) const;
             double integrated_s_8(const double & q2_min, const double & q2_max) const;
+            double integrated_s_8(const IntermediateResult *) const;
             double integrated_s_9(const double & q2_min, const double & q2_max) const;
+            double integrated_s_9(const IntermediateResult *) const;
             // @}
 
             /*!
@@ -266,71 +332,135 @@ namespace eos
             {
                 return integrated_s_1s(q2_min,q2_max);
             }
+            double integrated_s_1s_LHCb(const IntermediateResult * ir) const
+            {
+                return integrated_s_1s(ir);
+            }
             double integrated_s_1c_LHCb(const double & q2_min, const double & q2_max) const
             {
                 return integrated_s_1c(q2_min,q2_max);
             }
+            double integrated_s_1c_LHCb(const IntermediateResult * ir) const
+            {
+                return integrated_s_1c(ir);
+            }
             double integrated_s_2s_LHCb(const double & q2_min, const double & q2_max) const
             {
                 return integrated_s_2s(q2_min,q2_max);
             }
+            double integrated_s_2s_LHCb(const IntermediateResult * ir) const
+            {
+                return integrated_s_2s(ir);
+            }
             double integrated_s_2c_LHCb(const double & q2_min, const double & q2_max) const
             {
                 return integrated_s_2c(q2_min,q2_max);
             }
+            double integrated_s_2c_LHCb(const IntermediateResult * ir) const
+            {
+                return integrated_s_2c(ir);
+            }
             double integrated_s_3_LHCb(const double & q2_min, const double & q2_max) const
             {
                 return integrated_s_3(q2_min,q2_max);
             }
+            double integrated_s_3_LHCb(const IntermediateResult * ir) const
+            {
+                return integrated_s_3(ir);
+            }
             double integrated_s_4_LHCb(const double & q2_min, const double & q2_max) const
             {
                 return -integrated_s_4(q2_min,q2_max);
             }
+            double integrated_s_4_LHCb(const IntermediateResult * ir) const
+            {
+                return -integrated_s_4(ir);
+            }
             double integrated_s_5_LHCb(const double & q2_min, const double & q2_max) const
             {
                 return integrated_s_5(q2_min,q2_max);
             }
+            double integrated_s_5_LHCb(const IntermediateResult * ir) const
+            {
+                return integrated_s_5(ir);
+            }
             double integrated_s_6s_LHCb(const double & q2_min, const double & q2_max) const
             {
                 return -integrated_s_6s(q2_min,q2_max);
             }
+            double integrated_s_6s_LHCb(const IntermediateResult * ir) const
+            {
+                return -integrated_s_6s(ir);
+            }
             double integrated_s_6c_LHCb(const double & q2_min, const double & q2_max) const
             {
                 return  -integrated_s_6c(q2_min,q2_max);
             }
+            double integrated_s_6c_LHCb(const IntermediateResult * ir) const
+            {
+                return  -integrated_s_6c(ir);
+            }
             double integrated_s_7_LHCb(const double & q2_min, const double & q2_max) const
             {
                 return -integrated_s_7(q2_min,q2_max);
             }
+            double integrated_s_7_LHCb(const IntermediateResult * ir) const
+            {
+                return -integrated_s_7(ir);
+            }
             double integrated_s_8_LHCb(const double & q2_min, const double & q2_max) const
             {
                 return integrated_s_8(q2_min,q2_max);
             }
+            double integrated_s_8_LHCb(const IntermediateResult * ir) const
+            {
+                return integrated_s_8(ir);
+            }
             double integrated_s_9_LHCb(const double & q2_min, const double & q2_max) const
             {
                 return -integrated_s_9(q2_min,q2_max);
             }
+            double integrated_s_9_LHCb(const IntermediateResult * ir) const
+            {
+                return -integrated_s_9(ir);
+            }
             double integrated_forward_backward_asymmetry_LHCb(const double & q2_min, const double & q2_max) const
             {
                 return -integrated_forward_backward_asymmetry(q2_min,q2_max); 
             }
+            double integrated_forward_backward_asymmetry_LHCb(const IntermediateResult * ir) const
+            {
+                return -integrated_forward_backward_asymmetry(ir);
+            }
 
             /*!
              * @name CP-antisymmetrized angular observables (@f$q^2@f$-integrated)
              */
             // @{
             double integrated_a_1s(const double & q2_min, const double & q2_max) const;
+            double integrated_a_1s(const IntermediateResult *) const;
             double integrated_a_1c(const double & q2_min, const double & q2_max) const;
+            double integrated_a_1c(const IntermediateResult *) const;
             double integrated_a_2s(const double & q2_min, const double & q2_max) const;
+            double integrated_a_2s(const IntermediateResult *) const;
             double integrated_a_2c(const double & q2_min, const double & q2_max) const;
+            double integrated_a_2c(const IntermediateResult *) const;
             double integrated_a_3(const double & q2_min, const double & q2_max) const;
+            double integrated_a_3(const IntermediateResult *) const;
             double integrated_a_4(const double & q2_min, const double & q2_max) const;
+            double integrated_a_4(const IntermediateResult *) const;
             double integrated_a_5(const double & q2_min, const double & q2_max) const;
+            double integrated_a_5(const IntermediateResult *) const;
             double integrated_a_6s(const double & q2_min, const double & q2_max) const;
+            double integrated_a_6s(const IntermediateResult *) const;
             double integrated_a_6c(const double & q2_min, const double & q2_max) const;
+            double integrated_a_6c(const IntermediateResult *) const;
             double integrated_a_7(const double & q2_min, const double & q2_max) const;
+            double integrated_a_7(const IntermediateResult *) const;
             double integrated_a_8(const double & q2_min, const double & q2_max) const;
+            double integrated_a_8(const IntermediateResult *) const;
             double integrated_a_9(const double & q2_min, const double & q2_max) const;
+            double integrated_a_9(const IntermediateResult *) const;
             // @}
 
             /*!
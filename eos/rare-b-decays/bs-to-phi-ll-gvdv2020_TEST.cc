@@ -21,6 +21,9 @@
 #include <eos/utils/complex.hh>
 
 #include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -144,6 +147,38 @@ class BsToPhiDileptonGvDV2020Test :
 
             TEST_CHECK_RELATIVE_ERROR(real(amps.a_time),       -1.10463e-09, eps);
             TEST_CHECK_RELATIVE_ERROR(imag(amps.a_time),       -2.12580e-10, eps);
+
+            // the cacheable and the cached observables agree with the direct integration
+            {
+                static const double eps = 1e-10;
+
+                Kinematics k
+                {
+                    { "q2_min", 1.1 }, { "q2_max", 6.0 }
+                };
+
+                ObservablePtr br = Observable::make("B_s->phill::BR", p, k, oo);
+                const CacheableObservable * parent = dynamic_cast<const CacheableObservable *>(br.get());
+                TEST_CHECK(nullptr != parent);
+                TEST_CHECK_RELATIVE_ERROR(br->evaluate(), d.integrated_branching_ratio(1.1, 6.0), eps);
+
+                const std::vector<std::pair<std::string, double>> references
+                {
+                    { "B_s->phill::A_FB",   d.integrated_forward_backward_asymmetry(1.1, 6.0) },
+                    { "B_s->phill::F_L",    d.integrated_longitudinal_polarisation(1.1, 6.0)  },
+                    { "B_s->phill::S_3",    d.integrated_s_3(1.1, 6.0)                        },
+                    { "B_s->phill::A_9",    d.integrated_a_9(1.1, 6.0)                        },
+                };
+
+                for (const auto & r : references)
+                {
+                    ObservablePtr o = Observable::make(r.first, p, k, oo);
+                    TEST_CHECK_RELATIVE_ERROR(o->evaluate(), r.second, eps);
+
+                    ObservablePtr cached = dynamic_cast<const CacheableObservable *>(o.get())->make_cached_observable(parent);
+                    TEST_CHECK_RELATIVE_ERROR(cached->evaluate(), r.second, eps);
+                }
+            }
        }
     }
 } bs_to_phi_dilepton_GvDV2020_test;
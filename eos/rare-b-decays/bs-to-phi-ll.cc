@@ -19,6 +19,7 @@
 
 #include <eos/rare-b-decays/bs-to-phi-ll-base.hh>
 #include <eos/rare-b-decays/bs-to-phi-ll-gvdv2020.hh>
+#include <eos/rare-b-decays/bs-to-phi-ll-impl.hh>
 #include <eos/utils/integrate.hh>
 #include <eos/utils/integrate-impl.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
@@ -26,39 +27,6 @@
 
 namespace eos
 {
-    struct BsToPhiDilepton::AngularCoefficients
-    {
-        double j1s, j1c;
-        double j2s, j2c;
-        double j3;
-        double j4;
-        double j5;
-        double j6s, j6c;
-        double j7;
-        double j8;
-        double j9;
-
-        AngularCoefficients()
-        {
-        }
-
-        AngularCoefficients(const std::array<double, 12> & a) :
-            j1s(a[0]),
-            j1c(a[1]),
-            j2s(a[2]),
-            j2c(a[3]),
-            j3(a[4]),
-            j4(a[5]),
-            j5(a[6]),
-            j6s(a[7]),
-            j6c(a[8]),
-            j7(a[9]),
-            j8(a[10]),
-            j9(a[11])
-        {
-        }
-    };
-
     /*!
      * Implementation for the decay @f$\bar{B_s} \to \phi \ell^+ \ell^-@f$.
      */
@@ -76,6 +44,10 @@ namespace eos
         UsedParameter tau;
         UsedParameter mu;
 
+        using IntermediateResult = BsToPhiDilepton::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make(o.get("model", "WilsonScan"), p, o)),
             opt_l(o, "l", { "e", "mu", "tau" }, "mu"),
@@ -231,6 +203,23 @@ namespace eos
             return BsToPhiDilepton::AngularCoefficients(integrated_angular_coefficients_array);
         }
 
+        // integrate the angular coefficients of the decay selected by the option 'cp-conjugate',
+        // and those of the CP-conjugate decay only on demand
+        void prepare(IntermediateResult & result, const double & s_min, const double & s_max) const
+        {
+            result.reset(amplitude_generator->cp_conjugate, [this, s_min, s_max] ()
+            {
+                return integrated_angular_coefficients(s_min, s_max);
+            });
+        }
+
+        const IntermediateResult * prepare(const double & s_min, const double & s_max)
+        {
+            prepare(intermediate_result, s_min, s_max);
+
+            return &intermediate_result;
+        }
+
         inline double decay_width(const BsToPhiDilepton::AngularCoefficients & a_c)
         {
             // cf. [BHvD2010], p. 6, eq. (2.7)
@@ -638,33 +627,71 @@ namespace eos
         return 0.5 * (a_c.j1s + a_c_bar.j1s - 3.0 * (a_c.j2s + a_c_bar.j2s));
     }
 
+    const BsToPhiDilepton::IntermediateResult *
+    BsToPhiDilepton::prepare(const double & s_min, const double & s_max) const
+    {
+        return _imp->prepare(s_min, s_max);
+    }
+
     double
     BsToPhiDilepton::integrated_decay_width(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        return _imp->decay_width(a_c);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_decay_width(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_decay_width(const IntermediateResult * ir) const
+    {
+        return _imp->decay_width(ir->a_c_selected());
     }
 
     double
     BsToPhiDilepton::integrated_branching_ratio(const double & s_min, const double & s_max) const
     {
-        return integrated_decay_width(s_min, s_max) * _imp->tau() / _imp->hbar();
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_branching_ratio(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_branching_ratio(const IntermediateResult * ir) const
+    {
+        return integrated_decay_width(ir) * _imp->tau() / _imp->hbar();
     }
 
     double
     BsToPhiDilepton::integrated_branching_ratio_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->amplitude_generator->cp_conjugate, false);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        double br = integrated_branching_ratio(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        double br_bar = integrated_branching_ratio(s_min, s_max);
+        return integrated_branching_ratio_cp_averaged(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_branching_ratio_cp_averaged(const IntermediateResult * ir) const
+    {
+        double br = _imp->decay_width(ir->a_c()) * _imp->tau() / _imp->hbar();
+        double br_bar = _imp->decay_width(ir->a_c_bar()) * _imp->tau() / _imp->hbar();
 
         return 0.5 * (br + br_bar);
     }
 
     double
     BsToPhiDilepton::integrated_unnormalized_forward_backward_asymmetry(const double & s_min, const double & s_max) const
+    {
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_unnormalized_forward_backward_asymmetry(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_unnormalized_forward_backward_asymmetry(const IntermediateResult * ir) const
     {
         // Convert from asymmetry in the decay width to asymmetry in the BR
         // cf. [PDG2008] : Gamma = hbar / tau_B, pp. 5, 79
@@ -673,68 +700,122 @@ namespace eos
 
         // cf. [BHvD2010], eq. (2.8), p. 6
         // cf. [BHvD2012], eq. (A7)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        const AngularCoefficients & a_c = ir->a_c_selected();
 
         return (a_c.j6s + 0.5 * a_c.j6c) / Gamma;
-     }
+    }
 
     double
     BsToPhiDilepton::integrated_forward_backward_asymmetry(const double & s_min, const double & s_max) const
+    {
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_forward_backward_asymmetry(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_forward_backward_asymmetry(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], eq. (2.8), p. 6
         // cf. [BHvD2012], eq. (A7)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return (a_c.j6s + 0.5 * a_c.j6c) / _imp->decay_width(a_c);
     }
 
     double
     BsToPhiDilepton::integrated_forward_backward_asymmetry_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->amplitude_generator->cp_conjugate, false);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        double a_fb = integrated_forward_backward_asymmetry(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        double a_fb_bar = integrated_forward_backward_asymmetry(s_min, s_max);
+        return integrated_forward_backward_asymmetry_cp_averaged(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_forward_backward_asymmetry_cp_averaged(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
+
+        double a_fb = (a_c.j6s + 0.5 * a_c.j6c) / _imp->decay_width(a_c);
+        double a_fb_bar = (a_c_bar.j6s + 0.5 * a_c_bar.j6c) / _imp->decay_width(a_c_bar);
 
         return 0.5 * (a_fb + a_fb_bar);
     }
 
     double
     BsToPhiDilepton::integrated_longitudinal_polarisation(const double & s_min, const double & s_max) const
+    {
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_longitudinal_polarisation(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_longitudinal_polarisation(const IntermediateResult * ir) const
     {
         // cf. [BHvD2012], eq. (A9)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return (a_c.j1c - a_c.j2c / 3.0) / _imp->decay_width(a_c);
     }
 
     double
     BsToPhiDilepton::integrated_longitudinal_polarisation_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->amplitude_generator->cp_conjugate, false);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        double f_l = integrated_longitudinal_polarisation(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        double f_l_bar = integrated_longitudinal_polarisation(s_min, s_max);
+        return integrated_longitudinal_polarisation_cp_averaged(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_longitudinal_polarisation_cp_averaged(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
+
+        double f_l = (a_c.j1c - a_c.j2c / 3.0) / _imp->decay_width(a_c);
+        double f_l_bar = (a_c_bar.j1c - a_c_bar.j2c / 3.0) / _imp->decay_width(a_c_bar);
 
         return 0.5 * (f_l + f_l_bar);
     }
 
     double
     BsToPhiDilepton::integrated_transversal_polarisation(const double & s_min, const double & s_max) const
+    {
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_transversal_polarisation(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_transversal_polarisation(const IntermediateResult * ir) const
     {
         // cf. [BHvD2012], eq. (A10)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return 2.0 * (a_c.j1s - a_c.j2s / 3.0) / _imp->decay_width(a_c);
     }
 
     double
     BsToPhiDilepton::integrated_transversal_polarisation_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->amplitude_generator->cp_conjugate, false);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        double f_t = integrated_transversal_polarisation(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        double f_t_bar = integrated_transversal_polarisation(s_min, s_max);
+        return integrated_transversal_polarisation_cp_averaged(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_transversal_polarisation_cp_averaged(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
+
+        double f_t = 2.0 * (a_c.j1s - a_c.j2s / 3.0) / _imp->decay_width(a_c);
+        double f_t_bar = 2.0 * (a_c_bar.j1s - a_c_bar.j2s / 3.0) / _imp->decay_width(a_c_bar);
 
         return 0.5 * (f_t + f_t_bar);
     }
@@ -742,50 +823,89 @@ namespace eos
     double
     BsToPhiDilepton::integrated_cp_asymmetry(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->amplitude_generator->cp_conjugate, false);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        auto gamma     = _imp->decay_width(_imp->integrated_angular_coefficients(s_min, s_max));
-        _imp->amplitude_generator->cp_conjugate = true;
-        auto gamma_bar = _imp->decay_width(_imp->integrated_angular_coefficients(s_min, s_max));
+        return integrated_cp_asymmetry(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_cp_asymmetry(const IntermediateResult * ir) const
+    {
+        auto gamma     = _imp->decay_width(ir->a_c());
+        auto gamma_bar = _imp->decay_width(ir->a_c_bar());
 
         return (gamma - gamma_bar) / (gamma + gamma_bar);
     }
 
     double
     BsToPhiDilepton::integrated_transverse_asymmetry_2(const double & s_min, const double & s_max) const
+    {
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_transverse_asymmetry_2(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_transverse_asymmetry_2(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], eq. (2.10), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return 0.5 * a_c.j3 / a_c.j2s;
     }
 
     double
     BsToPhiDilepton::integrated_transverse_asymmetry_2_cp_averaged(const double & s_min, const double & s_max) const
     {
-        // cf. [BHvD2010], eq. (2.10), p. 6
-        Save<bool> save(_imp->amplitude_generator->cp_conjugate, false);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        double a_t_2 = integrated_transverse_asymmetry_2(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        double a_t_2_bar = integrated_transverse_asymmetry_2(s_min, s_max);
+        return integrated_transverse_asymmetry_2_cp_averaged(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_transverse_asymmetry_2_cp_averaged(const IntermediateResult * ir) const
+    {
+        // cf. [BHvD2010], eq. (2.10), p. 6
+        double a_t_2 = 0.5 * ir->a_c().j3 / ir->a_c().j2s;
+        double a_t_2_bar = 0.5 * ir->a_c_bar().j3 / ir->a_c_bar().j2s;
 
         return 0.5 * (a_t_2 + a_t_2_bar);
     }
 
     double
     BsToPhiDilepton::integrated_transverse_asymmetry_3(const double & s_min, const double & s_max) const
+    {
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_transverse_asymmetry_3(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_transverse_asymmetry_3(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], eq. (2.11), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        const AngularCoefficients & a_c = ir->a_c_selected();
 
         return sqrt((4.0 * power_of<2>(a_c.j4) + power_of<2>(a_c.j7)) / (-2.0 * a_c.j2c * (2.0 * a_c.j2s + a_c.j3)));
     }
 
     double
     BsToPhiDilepton::integrated_transverse_asymmetry_4(const double & s_min, const double & s_max) const
+    {
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_transverse_asymmetry_4(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_transverse_asymmetry_4(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], eq. (2.12), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        const AngularCoefficients & a_c = ir->a_c_selected();
 
         return sqrt((power_of<2>(a_c.j5) + 4.0 * power_of<2>(a_c.j8)) / (4.0 * power_of<2>(a_c.j4) + power_of<2>(a_c.j7)));
     }
@@ -793,7 +913,16 @@ namespace eos
     double
     BsToPhiDilepton::integrated_transverse_asymmetry_5(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_transverse_asymmetry_5(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_transverse_asymmetry_5(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
 
         // cf. [BS2011], eq. (34), p. 9 for the massless case
         return std::sqrt(16.0 * power_of<2>(a_c.j2s) - power_of<2>(a_c.j6s) - 4.0 * (power_of<2>(a_c.j3) + power_of<2>(a_c.j9)))
@@ -802,28 +931,52 @@ namespace eos
 
     double
     BsToPhiDilepton::integrated_transverse_asymmetry_re(const double & s_min, const double & s_max) const
+    {
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_transverse_asymmetry_re(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_transverse_asymmetry_re(const IntermediateResult * ir) const
     {
         // cf. [BS2011], eq. (38), p. 10
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return 0.25 * a_c.j6s / a_c.j2s;
     }
 
     double
     BsToPhiDilepton::integrated_transverse_asymmetry_im(const double & s_min, const double & s_max) const
+    {
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_transverse_asymmetry_im(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_transverse_asymmetry_im(const IntermediateResult * ir) const
     {
         // cf. [BS2011], eq. (30), p. 8
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return 0.5 * a_c.j9 / a_c.j2s;
     }
 
     double
     BsToPhiDilepton::integrated_p_prime_4(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->amplitude_generator->cp_conjugate, false);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        return integrated_p_prime_4(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_p_prime_4(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         // cf. [DMRV2012], p. 9, eq. (15)
         return (a_c.j4 + a_c_bar.j4) / std::sqrt(-1.0 * (a_c.j2c + a_c_bar.j2c) * (a_c.j2s + a_c_bar.j2s));
@@ -832,11 +985,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_p_prime_5(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->amplitude_generator->cp_conjugate, false);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        return integrated_p_prime_5(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_p_prime_5(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         // cf. [DMRV2012], p. 9, eq. (16)
         return (a_c.j5 + a_c_bar.j5) / (2.0 * std::sqrt(-1.0 * (a_c.j2c + a_c_bar.j2c) * (a_c.j2s + a_c_bar.j2s)));
@@ -845,11 +1004,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_p_prime_6(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->amplitude_generator->cp_conjugate, false);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        return integrated_p_prime_6(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_p_prime_6(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         // cf. [DMRV2012], p. 9, eq. (17)
         return -1.0 * (a_c.j7 + a_c_bar.j7) / (2.0 * std::sqrt(-1.0 * (a_c.j2c + a_c_bar.j2c) * (a_c.j2s + a_c_bar.j2s)));
@@ -857,39 +1022,84 @@ namespace eos
 
     double
     BsToPhiDilepton::integrated_h_1(const double & s_min, const double & s_max) const
+    {
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_h_1(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_h_1(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], p. 7, eq. (2.13)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return sqrt(2.0) * a_c.j4 / sqrt(-a_c.j2c * (2.0 * a_c.j2s - a_c.j3));
     }
 
     double
     BsToPhiDilepton::integrated_h_2(const double & s_min, const double & s_max) const
+    {
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_h_2(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_h_2(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], p. 7, eq. (2.14)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return  a_c.j5 / sqrt(-2.0 * a_c.j2c * (2.0 * a_c.j2s + a_c.j3));
     }
 
     double
     BsToPhiDilepton::integrated_h_3(const double & s_min, const double & s_max) const
+    {
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_h_3(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_h_3(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], p. 7, eq. (2.15)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return a_c.j6s / (2.0 * sqrt(power_of<2>(2.0 * a_c.j2s) - power_of<2>(a_c.j3)));
     }
 
     double
     BsToPhiDilepton::integrated_h_4(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_h_4(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_h_4(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return sqrt(2.0) * a_c.j8 / sqrt(-a_c.j2c * (2.0 * a_c.j2s + a_c.j3));
     }
 
     double
     BsToPhiDilepton::integrated_h_5(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_h_5(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_h_5(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return -a_c.j9 / sqrt(power_of<2>(2.0 * a_c.j2s) + power_of<2>(a_c.j3));
     }
 
@@ -897,120 +1107,258 @@ namespace eos
     double
     BsToPhiDilepton::integrated_j_1c(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_j_1c(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_1c(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return a_c.j1c;
     }
 
     double
     BsToPhiDilepton::integrated_j_1s(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_j_1s(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_1s(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return a_c.j1s;
     }
 
     double
     BsToPhiDilepton::integrated_j_2c(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_j_2c(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_2c(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return a_c.j2c;
     }
 
     double
     BsToPhiDilepton::integrated_j_2s(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_j_2s(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_2s(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return a_c.j2s;
     }
 
     double
     BsToPhiDilepton::integrated_j_3(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_j_3(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_3(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return a_c.j3;
     }
 
     double
     BsToPhiDilepton::integrated_j_3_normalized(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_j_3_normalized(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_3_normalized(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return a_c.j3 / _imp->decay_width(a_c);
     }
 
     double
     BsToPhiDilepton::integrated_j_3_normalized_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->amplitude_generator->cp_conjugate, false);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        return integrated_j_3_normalized_cp_averaged(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_3_normalized_cp_averaged(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return (a_c.j3 + a_c_bar.j3) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
     double
     BsToPhiDilepton::integrated_j_4(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_j_4(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_4(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return a_c.j4;
     }
 
     double
     BsToPhiDilepton::integrated_j_5(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_j_5(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_5(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return a_c.j5;
     }
 
     double
     BsToPhiDilepton::integrated_j_6c(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_j_6c(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_6c(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return a_c.j6c;
     }
 
     double
     BsToPhiDilepton::integrated_j_6s(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_j_6s(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_6s(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return a_c.j6s;
     }
 
     double
     BsToPhiDilepton::integrated_j_7(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_j_7(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_7(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return a_c.j7;
     }
 
     double
     BsToPhiDilepton::integrated_j_8(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_j_8(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_8(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return a_c.j8;
     }
 
     double
     BsToPhiDilepton::integrated_j_9(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_j_9(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_9(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return a_c.j9;
     }
 
     double
     BsToPhiDilepton::integrated_j_9_normalized(const double & s_min, const double & s_max) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_j_9_normalized(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_9_normalized(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c_selected();
         return a_c.j9 / _imp->decay_width(a_c);
     }
 
     double
     BsToPhiDilepton::integrated_j_9_normalized_cp_averaged(const double & s_min, const double & s_max) const
     {
-        Save<bool> save(_imp->amplitude_generator->cp_conjugate, false);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
 
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        return integrated_j_9_normalized_cp_averaged(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_j_9_normalized_cp_averaged(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return (a_c.j9 + a_c_bar.j9) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1019,10 +1367,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_s_1s(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_s_1s(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_s_1s(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j1s + a_c_bar.j1s) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1030,10 +1385,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_s_1c(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_s_1c(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_s_1c(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j1c + a_c_bar.j1c) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1041,10 +1403,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_s_2s(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_s_2s(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_s_2s(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j2s + a_c_bar.j2s) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1052,10 +1421,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_s_2c(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_s_2c(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_s_2c(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j2c + a_c_bar.j2c) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1063,10 +1439,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_s_3(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_s_3(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_s_3(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j3 + a_c_bar.j3) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1074,10 +1457,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_s_4(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_s_4(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_s_4(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j4 + a_c_bar.j4) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1085,10 +1475,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_s_5(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_s_5(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_s_5(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j5 + a_c_bar.j5) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1096,10 +1493,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_s_6s(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_s_6s(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_s_6s(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j6s + a_c_bar.j6s) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1107,22 +1511,36 @@ namespace eos
     double
     BsToPhiDilepton::integrated_s_6c(const double & s_min, const double & s_max) const
     {
-      Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-      AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-      _imp->amplitude_generator->cp_conjugate = true;
-      AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_s_6c(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_s_6c(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
-      return 4.0 / 3.0 * (a_c.j6c + a_c_bar.j6c) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
+        return 4.0 / 3.0 * (a_c.j6c + a_c_bar.j6c) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
 
 
     double
     BsToPhiDilepton::integrated_s_7(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_s_7(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_s_7(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j7 + a_c_bar.j7) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1130,10 +1548,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_s_8(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_s_8(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_s_8(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j8 + a_c_bar.j8) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1141,10 +1566,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_s_9(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_s_9(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_s_9(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j9 + a_c_bar.j9) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1153,10 +1585,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_a_1s(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_a_1s(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_a_1s(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j1s - a_c_bar.j1s) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1164,10 +1603,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_a_1c(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_a_1c(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_a_1c(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j1c - a_c_bar.j1c) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1175,10 +1621,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_a_2s(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_a_2s(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_a_2s(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j2s - a_c_bar.j2s) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1186,10 +1639,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_a_2c(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_a_2c(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_a_2c(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j2c - a_c_bar.j2c) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1197,10 +1657,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_a_3(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_a_3(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_a_3(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j3 - a_c_bar.j3) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1208,10 +1675,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_a_4(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_a_4(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_a_4(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j4 - a_c_bar.j4) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1219,10 +1693,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_a_5(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_a_5(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_a_5(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j5 - a_c_bar.j5) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1230,10 +1711,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_a_6s(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_a_6s(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_a_6s(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j6s - a_c_bar.j6s) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1241,10 +1729,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_a_7(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_a_7(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_a_7(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j7 - a_c_bar.j7) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1252,10 +1747,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_a_8(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_a_8(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_a_8(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j8 - a_c_bar.j8) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
@@ -1263,10 +1765,17 @@ namespace eos
     double
     BsToPhiDilepton::integrated_a_9(const double & s_min, const double & s_max) const
     {
-        Save<bool> cp_conjugate(_imp->amplitude_generator->cp_conjugate, false);
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
-        _imp->amplitude_generator->cp_conjugate = true;
-        AngularCoefficients a_c_bar = _imp->integrated_angular_coefficients(s_min, s_max);
+        IntermediateResult ir;
+        _imp->prepare(ir, s_min, s_max);
+
+        return integrated_a_9(&ir);
+    }
+
+    double
+    BsToPhiDilepton::integrated_a_9(const IntermediateResult * ir) const
+    {
+        const AngularCoefficients & a_c = ir->a_c();
+        const AngularCoefficients & a_c_bar = ir->a_c_bar();
 
         return 4.0 / 3.0 * (a_c.j9 - a_c_bar.j9) / (_imp->decay_width(a_c) + _imp->decay_width(a_c_bar));
     }
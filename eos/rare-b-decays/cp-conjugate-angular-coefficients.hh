@@ -0,0 +1,126 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_RARE_B_DECAYS_CP_CONJUGATE_ANGULAR_COEFFICIENTS_HH
+#define EOS_GUARD_EOS_RARE_B_DECAYS_CP_CONJUGATE_ANGULAR_COEFFICIENTS_HH 1
+
+#include <eos/observable.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
+#include <eos/utils/save.hh>
+
+#include <array>
+#include <functional>
+
+namespace eos
+{
+    /*!
+     * The q^2-integrated angular coefficients of both CP-conjugate decays within one bin,
+     * shared among all binned observables with the same parameters, kinematics and options.
+     *
+     * The angular coefficients of the decay selected by the option 'cp-conjugate' are integrated
+     * upon preparation. Those of the other decay are only integrated once an observable needs them,
+     * e.g., a CP asymmetry or a CP-averaged observable.
+     *
+     * @param AngularCoefficients_ The type of the angular coefficients of the decay.
+     */
+    template <typename AngularCoefficients_>
+    class CPConjugateAngularCoefficients :
+        public CacheableObservable::IntermediateResult
+    {
+        private:
+            mutable Mutex _mutex;
+
+            // the angular coefficients for cp_conjugate = false and cp_conjugate = true, respectively
+            mutable std::array<AngularCoefficients_, 2> _a_c;
+            mutable std::array<bool, 2> _integrated;
+
+            // the amplitude generator's flag that selects the CP-conjugate decay
+            bool * _cp_conjugate_flag;
+
+            // integrates the angular coefficients of the decay selected by the flag
+            std::function<AngularCoefficients_ ()> _integrate;
+
+            const AngularCoefficients_ & _angular_coefficients(const bool & cp_conjugate) const
+            {
+                Lock l(_mutex);
+
+                if (! _integrated[cp_conjugate])
+                {
+                    Save<bool> save(*_cp_conjugate_flag, cp_conjugate);
+
+                    _a_c[cp_conjugate] = _integrate();
+                    _integrated[cp_conjugate] = true;
+                }
+
+                return _a_c[cp_conjugate];
+            }
+
+        public:
+            // the value of the option 'cp-conjugate'
+            bool cp_conjugate;
+
+            CPConjugateAngularCoefficients() :
+                _integrated{{ false, false }},
+                _cp_conjugate_flag(nullptr),
+                cp_conjugate(false)
+            {
+            }
+
+            ~CPConjugateAngularCoefficients() = default;
+
+            /*!
+             * Discard all angular coefficients, and integrate those of the selected decay anew.
+             *
+             * @param cp_conjugate_flag The amplitude generator's flag, whose current value selects the decay.
+             * @param integrate         Integrates the angular coefficients of the decay that the flag selects.
+             */
+            void reset(bool & cp_conjugate_flag, const std::function<AngularCoefficients_ ()> & integrate)
+            {
+                Lock l(_mutex);
+
+                cp_conjugate = cp_conjugate_flag;
+                _cp_conjugate_flag = &cp_conjugate_flag;
+                _integrate = integrate;
+                _integrated = {{ false, false }};
+                _a_c[cp_conjugate] = _integrate();
+                _integrated[cp_conjugate] = true;
+            }
+
+            // the angular coefficients for cp_conjugate = false
+            inline const AngularCoefficients_ & a_c() const
+            {
+                return _angular_coefficients(false);
+            }
+
+            // the angular coefficients for cp_conjugate = true
+            inline const AngularCoefficients_ & a_c_bar() const
+            {
+                return _angular_coefficients(true);
+            }
+
+            // the angular coefficients of the decay selected by the option 'cp-conjugate'
+            inline const AngularCoefficients_ & a_c_selected() const
+            {
+                return _angular_coefficients(cp_conjugate);
+            }
+    };
+}
+
+#endif
@@ -360,8 +360,8 @@ namespace eos
 
             /* Corrections, cf. [HLMW2005], Table 6, p. 18 */
             std::vector<complex<double>> m7 = {
-                -pow(alpha_s_tilde, 2) * kappa * memoise(CharmLoops::F17_massive, mu(), s, m_b_msbar, m_c),
-                -pow(alpha_s_tilde, 2) * kappa * memoise(CharmLoops::F27_massive, mu(), s, m_b_msbar, m_c),
+                -pow(alpha_s_tilde, 2) * kappa * persistent_memoise("CharmLoops::F17_massive", CharmLoops::F17_massive, mu(), s, m_b_msbar, m_c),
+                -pow(alpha_s_tilde, 2) * kappa * persistent_memoise("CharmLoops::F27_massive", CharmLoops::F27_massive, mu(), s, m_b_msbar, m_c),
                 0.0,
                 0.0,
                 0.0,
@@ -377,8 +377,8 @@ namespace eos
             };
 
             std::vector<complex<double>> m9 = {
-                alpha_s_tilde * kappa * f(1, s_hat) - pow(alpha_s_tilde, 2) * kappa * memoise(CharmLoops::F19_massive, mu(), s, m_b_msbar, m_c),
-                alpha_s_tilde * kappa * f(2, s_hat) - pow(alpha_s_tilde, 2) * kappa * memoise(CharmLoops::F29_massive, mu(), s, m_b_msbar, m_c),
+                alpha_s_tilde * kappa * f(1, s_hat) - pow(alpha_s_tilde, 2) * kappa * persistent_memoise("CharmLoops::F19_massive", CharmLoops::F19_massive, mu(), s, m_b_msbar, m_c),
+                alpha_s_tilde * kappa * f(2, s_hat) - pow(alpha_s_tilde, 2) * kappa * persistent_memoise("CharmLoops::F29_massive", CharmLoops::F29_massive, mu(), s, m_b_msbar, m_c),
                 alpha_s_tilde * kappa * f(3, s_hat),
                 alpha_s_tilde * kappa * f(4, s_hat),
                 alpha_s_tilde * kappa * f(5, s_hat),
@@ -464,13 +464,13 @@ namespace eos
             static const double c_tau1 = 1.0 / 27.0;
             static const double c_tau2 = - 2.0 / 9.0;
             double z = pow(m_c / m_b_msbar, 2);
-            double itau_22 = real(memoise(Bremsstrahlung::itau_22, s_hat, z));
-            double itau_27 = real(memoise(Bremsstrahlung::itau_27, s_hat, z));
-            double itau_28 = real(memoise(Bremsstrahlung::itau_28, s_hat, z));
-            double itau_29 = real(memoise(Bremsstrahlung::itau_29, s_hat, z));
-            double tau_78 = memoise(Bremsstrahlung::tau_78, s_hat);
-            double tau_88 = memoise(Bremsstrahlung::tau_88, s_hat);
-            double tau_89 = memoise(Bremsstrahlung::tau_89, s_hat);
+            double itau_22 = real(persistent_memoise("Bremsstrahlung::itau_22", Bremsstrahlung::itau_22, s_hat, z));
+            double itau_27 = real(persistent_memoise("Bremsstrahlung::itau_27", Bremsstrahlung::itau_27, s_hat, z));
+            double itau_28 = real(persistent_memoise("Bremsstrahlung::itau_28", Bremsstrahlung::itau_28, s_hat, z));
+            double itau_29 = real(persistent_memoise("Bremsstrahlung::itau_29", Bremsstrahlung::itau_29, s_hat, z));
+            double tau_78 = persistent_memoise("Bremsstrahlung::tau_78", Bremsstrahlung::tau_78, s_hat);
+            double tau_88 = persistent_memoise("Bremsstrahlung::tau_88", Bremsstrahlung::tau_88, s_hat);
+            double tau_89 = persistent_memoise("Bremsstrahlung::tau_89", Bremsstrahlung::tau_89, s_hat);
             double b11 = pow(alpha_s_tilde, 3) * pow(kappa, 2) * itau_22 * c_tau1;
             double b12 = pow(alpha_s_tilde, 3) * pow(kappa, 2) * itau_22 * c_tau2 * 2.0;
             double b22 = pow(alpha_s_tilde, 3) * pow(kappa, 2) * itau_22 * QCD::casimir_f;
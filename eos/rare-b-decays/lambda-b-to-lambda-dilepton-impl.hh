@@ -0,0 +1,51 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_RARE_B_DECAYS_LAMBDA_B_TO_LAMBDA_DILEPTON_IMPL_HH
+#define EOS_GUARD_EOS_RARE_B_DECAYS_LAMBDA_B_TO_LAMBDA_DILEPTON_IMPL_HH 1
+
+#include <eos/observable.hh>
+#include <eos/rare-b-decays/lambda-b-to-lambda-dilepton.hh>
+
+#include <array>
+
+namespace eos
+{
+    namespace lambdab_to_lambda_dilepton
+    {
+        /*!
+         * The q^2-integrated angular observables K_1 to K_34 within one bin,
+         * shared among all binned observables with the same parameters, kinematics and options.
+         */
+        class IntermediateResult :
+            public CacheableObservable::IntermediateResult
+        {
+            public:
+                std::array<double, 34> k;
+
+                IntermediateResult()
+                {
+                }
+
+                ~IntermediateResult() = default;
+        };
+    }
+}
+
+#endif
@@ -21,6 +21,7 @@
 #include <eos/form-factors/baryonic.hh>
 #include <eos/rare-b-decays/charm-loops.hh>
 #include <eos/rare-b-decays/lambda-b-to-lambda-dilepton.hh>
+#include <eos/rare-b-decays/lambda-b-to-lambda-dilepton-impl.hh>
 #include <eos/utils/complex.hh>
 #include <eos/utils/destringify.hh>
 #include <eos/utils/integrate-impl.hh>
@@ -306,6 +307,10 @@ namespace eos
 
     template <> struct Implementation<LambdaBToLambdaDilepton<LargeRecoil>>
     {
+        using IntermediateResult = lambdab_to_lambda_dilepton::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
         std::shared_ptr<Model> model;
 
         UsedParameter hbar;
@@ -503,6 +508,18 @@ namespace eos
         {
             return lambdab_to_lambda_dilepton::AngularObservables{ _integrated_angular_observables(s_min, s_max) };
         }
+
+        inline void integrated_angular_observables(IntermediateResult & result, const double & s_min, const double & s_max)
+        {
+            result.k = _integrated_angular_observables(s_min, s_max);
+        }
+
+        const IntermediateResult * prepare(const double & s_min, const double & s_max)
+        {
+            integrated_angular_observables(intermediate_result, s_min, s_max);
+
+            return &intermediate_result;
+        }
     };
 
     LambdaBToLambdaDilepton<LargeRecoil>::LambdaBToLambdaDilepton(const Parameters & p, const Options & o) :
@@ -546,41 +563,101 @@ namespace eos
     }
 
     /* q^2-integrated observables */
+    const LambdaBToLambdaDilepton<LargeRecoil>::IntermediateResult *
+    LambdaBToLambdaDilepton<LargeRecoil>::prepare(const double & s_min, const double & s_max) const
+    {
+        return _imp->prepare(s_min, s_max);
+    }
+
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_branching_ratio(const double & s_min, const double & s_max) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).decay_width() * _imp->tau_Lambda_b / _imp->hbar;
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_branching_ratio(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_branching_ratio(const IntermediateResult * ir) const
+    {
+        return lambdab_to_lambda_dilepton::AngularObservables{ ir->k }.decay_width() * _imp->tau_Lambda_b / _imp->hbar;
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_leptonic(const double & s_min, const double & s_max) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_leptonic();
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_a_fb_leptonic(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_leptonic(const IntermediateResult * ir) const
+    {
+        return lambdab_to_lambda_dilepton::AngularObservables{ ir->k }.a_fb_leptonic();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_hadronic(const double & s_min, const double & s_max) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_hadronic();
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_a_fb_hadronic(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_hadronic(const IntermediateResult * ir) const
+    {
+        return lambdab_to_lambda_dilepton::AngularObservables{ ir->k }.a_fb_hadronic();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_combined(const double & s_min, const double & s_max) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_combined();
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_a_fb_combined(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_combined(const IntermediateResult * ir) const
+    {
+        return lambdab_to_lambda_dilepton::AngularObservables{ ir->k }.a_fb_combined();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_fzero(const double & s_min, const double & s_max) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).f_zero();
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_fzero(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_fzero(const IntermediateResult * ir) const
+    {
+        return lambdab_to_lambda_dilepton::AngularObservables{ ir->k }.f_zero();
     }
 
     /* Polarised angular observables */
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m1(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m1(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m1(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k1() / o.decay_width();
     }
 
@@ -588,237 +665,538 @@ namespace eos
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m2(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m2(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m2(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k2() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m3(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m3(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m3(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k3() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m4(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m4(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m4(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k4() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m5(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m5(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m5(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k5() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m6(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m6(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m6(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k6() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m7(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m7(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m7(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k7() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m8(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m8(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m8(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k8() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m9(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m9(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m9(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k9() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m10(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m10(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m10(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k10() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m11(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m11(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m11(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k11() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m12(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m12(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m12(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k12() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m13(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m13(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m13(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k13() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m14(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m14(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m14(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k14() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m15(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m15(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m15(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k15() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m16(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m16(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m16(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k16() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m17(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m17(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m17(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k17() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m18(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m18(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m18(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k18() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m19(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m19(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m19(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k19() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m20(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m20(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m20(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k20() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m21(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m21(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m21(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k21() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m22(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m22(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m22(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k22() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m23(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m23(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m23(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k23() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m24(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m24(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m24(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k24() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m25(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m25(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m25(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k25() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m26(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m26(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m26(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k26() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m27(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m27(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m27(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k27() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m28(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m28(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m28(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k28() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m29(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m29(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m29(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k29() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m30(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m30(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m30(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k30() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m31(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m31(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m31(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k31() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m32(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m32(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m32(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k32() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m33(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m33(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m33(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k33() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LargeRecoil>::integrated_m34(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m34(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m34(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k34() / o.decay_width();
     }
 
 
     template <> struct Implementation<LambdaBToLambdaDilepton<LowRecoil>>
     {
+        using IntermediateResult = lambdab_to_lambda_dilepton::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
         std::shared_ptr<Model> model;
 
         SwitchOption opt_l;
@@ -949,6 +1327,18 @@ namespace eos
         {
             return lambdab_to_lambda_dilepton::AngularObservables{ _integrated_angular_observables(s_min, s_max) };
         }
+
+        inline void integrated_angular_observables(IntermediateResult & result, const double & s_min, const double & s_max)
+        {
+            result.k = _integrated_angular_observables(s_min, s_max);
+        }
+
+        const IntermediateResult * prepare(const double & s_min, const double & s_max)
+        {
+            integrated_angular_observables(intermediate_result, s_min, s_max);
+
+            return &intermediate_result;
+        }
     };
 
     LambdaBToLambdaDilepton<LowRecoil>::LambdaBToLambdaDilepton(const Parameters & p, const Options & o) :
@@ -992,110 +1382,260 @@ namespace eos
     }
 
     /* q^2-integrated observables */
+    const LambdaBToLambdaDilepton<LowRecoil>::IntermediateResult *
+    LambdaBToLambdaDilepton<LowRecoil>::prepare(const double & s_min, const double & s_max) const
+    {
+        return _imp->prepare(s_min, s_max);
+    }
+
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_branching_ratio(const double & s_min, const double & s_max) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).decay_width() * _imp->tau_Lambda_b / _imp->hbar;
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_branching_ratio(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_branching_ratio(const IntermediateResult * ir) const
+    {
+        return lambdab_to_lambda_dilepton::AngularObservables{ ir->k }.decay_width() * _imp->tau_Lambda_b / _imp->hbar;
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_leptonic(const double & s_min, const double & s_max) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_leptonic();
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_a_fb_leptonic(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_leptonic(const IntermediateResult * ir) const
+    {
+        return lambdab_to_lambda_dilepton::AngularObservables{ ir->k }.a_fb_leptonic();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_hadronic(const double & s_min, const double & s_max) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_hadronic();
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_a_fb_hadronic(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_hadronic(const IntermediateResult * ir) const
+    {
+        return lambdab_to_lambda_dilepton::AngularObservables{ ir->k }.a_fb_hadronic();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_combined(const double & s_min, const double & s_max) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_combined();
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_a_fb_combined(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_combined(const IntermediateResult * ir) const
+    {
+        return lambdab_to_lambda_dilepton::AngularObservables{ ir->k }.a_fb_combined();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_fzero(const double & s_min, const double & s_max) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).f_zero();
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_fzero(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_fzero(const IntermediateResult * ir) const
+    {
+        return lambdab_to_lambda_dilepton::AngularObservables{ ir->k }.f_zero();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_k1ss(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_k1ss(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k1ss(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k1ss() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_k1cc(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_k1cc(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k1cc(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k1cc() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_k1c(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_k1c(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k1c(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k1c() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_k2ss(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_k2ss(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k2ss(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k2ss() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_k2cc(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_k2cc(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k2cc(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k2cc() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_k2c(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_k2c(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k2c(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k2c() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_k3sc(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_k3sc(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k3sc(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k3sc() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_k3s(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_k3s(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k3s(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k3s() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_k4sc(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_k4sc(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k4sc(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k4sc() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_k4s(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_k4s(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k4s(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k4s() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m1(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m1(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m1(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k1() / o.decay_width();
     }
 
@@ -1103,231 +1643,528 @@ namespace eos
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m2(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m2(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m2(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k2() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m3(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m3(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m3(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k3() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m4(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m4(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m4(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k4() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m5(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m5(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m5(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k5() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m6(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m6(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m6(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k6() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m7(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m7(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m7(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k7() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m8(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m8(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m8(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k8() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m9(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m9(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m9(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k9() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m10(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m10(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m10(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k10() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m11(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m11(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m11(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k11() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m12(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m12(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m12(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k12() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m13(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m13(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m13(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k13() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m14(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m14(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m14(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k14() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m15(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m15(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m15(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k15() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m16(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m16(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m16(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k16() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m17(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m17(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m17(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k17() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m18(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m18(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m18(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k18() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m19(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m19(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m19(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k19() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m20(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m20(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m20(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k20() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m21(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m21(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m21(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k21() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m22(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m22(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m22(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k22() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m23(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m23(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m23(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k23() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m24(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m24(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m24(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k24() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m25(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m25(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m25(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k25() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m26(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m26(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m26(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k26() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m27(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m27(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m27(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k27() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m28(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m28(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m28(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k28() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m29(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m29(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m29(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k29() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m30(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m30(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m30(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k30() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m31(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m31(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m31(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k31() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m32(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m32(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m32(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k32() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m33(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m33(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m33(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k33() / o.decay_width();
     }
 
     double
     LambdaBToLambdaDilepton<LowRecoil>::integrated_m34(const double & s_min, const double & s_max) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        IntermediateResult ir;
+        _imp->integrated_angular_observables(ir, s_min, s_max);
+
+        return integrated_m34(&ir);
+    }
+
+    double
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m34(const IntermediateResult * ir) const
+    {
+        auto o = lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
         return o.k34() / o.decay_width();
     }
 }
@@ -23,15 +23,20 @@
 #include <eos/rare-b-decays/b-to-ll.hh>
 #include <eos/rare-b-decays/b-to-k-charmonium.hh>
 #include <eos/rare-b-decays/b-to-k-ll.hh>
+#include <eos/rare-b-decays/b-to-k-ll-impl.hh>
 #include <eos/rare-b-decays/b-to-kstar-charmonium.hh>
 #include <eos/rare-b-decays/b-to-kstar-gamma.hh>
 #include <eos/rare-b-decays/b-to-kstar-ll.hh>
+#include <eos/rare-b-decays/b-to-kstar-ll-impl.hh>
 #include <eos/rare-b-decays/bs-to-phi-charmonium.hh>
 #include <eos/rare-b-decays/bs-to-phi-ll.hh>
+#include <eos/rare-b-decays/bs-to-phi-ll-impl.hh>
 #include <eos/rare-b-decays/inclusive-b-to-s-dilepton.hh>
 #include <eos/rare-b-decays/inclusive-b-to-s-gamma.hh>
 #include <eos/rare-b-decays/lambda-b-to-lambda-dilepton.hh>
+#include <eos/rare-b-decays/lambda-b-to-lambda-dilepton-impl.hh>
 #include <eos/rare-b-decays/nonlocal-formfactors.hh>
+#include <eos/utils/concrete-cacheable-observable.hh>
 #include <eos/utils/concrete_observable.hh>
 
 namespace eos
@@ -110,43 +115,51 @@ namespace eos
                         <<B->Kll::dBR/ds;l=e>>
                         )"),
 
-                make_observable("B->Kll::BR", R"(\mathcal{B}(\bar{B}\to \bar{K}\ell^+\ell^-))",
+                make_cacheable_observable("B->Kll::BR", R"(\mathcal{B}(\bar{B}\to \bar{K}\ell^+\ell^-))",
                         Unit::None(),
+                        &BToKDilepton::prepare,
                         &BToKDilepton::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->Kll::BRavg",
+                make_cacheable_observable("B->Kll::BRavg", "",
                         Unit::None(),
+                        &BToKDilepton::prepare,
                         &BToKDilepton::integrated_branching_ratio_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->Kll::A_CP", R"(A_\mathrm{CP}(\bar{B}\to \bar{K}\ell^+\ell^-))",
+                make_cacheable_observable("B->Kll::A_CP", R"(A_\mathrm{CP}(\bar{B}\to \bar{K}\ell^+\ell^-))",
                         Unit::None(),
+                        &BToKDilepton::prepare,
                         &BToKDilepton::integrated_cp_asymmetry,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->Kll::Gamma",
+                make_cacheable_observable("B->Kll::Gamma", "",
                         Unit::GeV(),
+                        &BToKDilepton::prepare,
                         &BToKDilepton::integrated_decay_width,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->Kll::F_H", R"(F_\mathrm{H}(\bar{B}\to \bar{K}\ell^+\ell^-))",
+                make_cacheable_observable("B->Kll::F_H", R"(F_\mathrm{H}(\bar{B}\to \bar{K}\ell^+\ell^-))",
                         Unit::None(),
+                        &BToKDilepton::prepare,
                         &BToKDilepton::integrated_flat_term,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->Kll::F_Havg",
+                make_cacheable_observable("B->Kll::F_Havg", "",
                         Unit::None(),
+                        &BToKDilepton::prepare,
                         &BToKDilepton::integrated_flat_term_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->Kll::A_FB", R"(A_\mathrm{FB}(\bar{B}\to \bar{K}\ell^+\ell^-))",
+                make_cacheable_observable("B->Kll::A_FB", R"(A_\mathrm{FB}(\bar{B}\to \bar{K}\ell^+\ell^-))",
                         Unit::None(),
+                        &BToKDilepton::prepare,
                         &BToKDilepton::integrated_forward_backward_asymmetry,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->Kll::A_FBavg",
+                make_cacheable_observable("B->Kll::A_FBavg", "",
                         Unit::None(),
+                        &BToKDilepton::prepare,
                         &BToKDilepton::integrated_forward_backward_asymmetry_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -667,104 +680,124 @@ namespace eos
                         <<B->K^*ll::dBR/ds;l=e>>
                         )"),
 
-                make_observable("B->K^*ll::A_FB",
+                make_cacheable_observable("B->K^*ll::A_FB", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_forward_backward_asymmetry,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::Abar_FB",
+                make_cacheable_observable("B->K^*ll::Abar_FB", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_unnormalized_forward_backward_asymmetry,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_FBavg",
+                make_cacheable_observable("B->K^*ll::A_FBavg", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_forward_backward_asymmetry_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
 
-                make_observable("B->K^*ll::BR",
+                make_cacheable_observable("B->K^*ll::BR", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::BRavg",
+                make_cacheable_observable("B->K^*ll::BRavg", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_branching_ratio_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_CP",
+                make_cacheable_observable("B->K^*ll::A_CP", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_cp_asymmetry,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::F_L",
+                make_cacheable_observable("B->K^*ll::F_L", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_longitudinal_polarisation,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::F_Lavg",
+                make_cacheable_observable("B->K^*ll::F_Lavg", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_longitudinal_polarisation_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::F_T",
+                make_cacheable_observable("B->K^*ll::F_T", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_transversal_polarisation,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::F_Tavg",
+                make_cacheable_observable("B->K^*ll::F_Tavg", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_transversal_polarisation_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_T^2",
+                make_cacheable_observable("B->K^*ll::A_T^2", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_transverse_asymmetry_2,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_T^2avg",
+                make_cacheable_observable("B->K^*ll::A_T^2avg", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_transverse_asymmetry_2_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_T^3",
+                make_cacheable_observable("B->K^*ll::A_T^3", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_transverse_asymmetry_3,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_T^4",
+                make_cacheable_observable("B->K^*ll::A_T^4", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_transverse_asymmetry_4,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_T^5",
+                make_cacheable_observable("B->K^*ll::A_T^5", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_transverse_asymmetry_5,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_T^re",
+                make_cacheable_observable("B->K^*ll::A_T^re", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_transverse_asymmetry_re,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::A_T^im",
+                make_cacheable_observable("B->K^*ll::A_T^im", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_transverse_asymmetry_im,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::P'_4",
+                make_cacheable_observable("B->K^*ll::P'_4", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_p_prime_4,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::P'_5",
+                make_cacheable_observable("B->K^*ll::P'_5", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_p_prime_5,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::P'_6",
+                make_cacheable_observable("B->K^*ll::P'_6", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_p_prime_6,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -793,28 +826,33 @@ namespace eos
                         &BToKstarDilepton::differential_h_5,
                         std::make_tuple("q2")),
 
-                make_observable("B->K^*ll::H_T^1",
+                make_cacheable_observable("B->K^*ll::H_T^1", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_h_1,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::H_T^2",
+                make_cacheable_observable("B->K^*ll::H_T^2", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_h_2,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::H_T^3",
+                make_cacheable_observable("B->K^*ll::H_T^3", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_h_3,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::H_T^4",
+                make_cacheable_observable("B->K^*ll::H_T^4", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_h_4,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::H_T^5",
+                make_cacheable_observable("B->K^*ll::H_T^5", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_h_5,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -822,189 +860,226 @@ namespace eos
                         Unit::GeV2(),
                         &BToKstarDilepton::a_fb_zero_crossing),
 
-                make_observable("B->K^*ll::Gamma",
+                make_cacheable_observable("B->K^*ll::Gamma", "",
                         Unit::GeV(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_decay_width,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_1s",
+                make_cacheable_observable("B->K^*ll::J_1s", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_1s,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_1c",
+                make_cacheable_observable("B->K^*ll::J_1c", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_1c,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_2s",
+                make_cacheable_observable("B->K^*ll::J_2s", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_2s,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_2c",
+                make_cacheable_observable("B->K^*ll::J_2c", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_2c,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_3",
+                make_cacheable_observable("B->K^*ll::J_3", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_3,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_3norm",
+                make_cacheable_observable("B->K^*ll::J_3norm", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_3_normalized,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_3normavg",
+                make_cacheable_observable("B->K^*ll::J_3normavg", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_3_normalized_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_4",
+                make_cacheable_observable("B->K^*ll::J_4", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_4,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_5",
+                make_cacheable_observable("B->K^*ll::J_5", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_5,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_6s",
+                make_cacheable_observable("B->K^*ll::J_6s", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_6s,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_6c",
+                make_cacheable_observable("B->K^*ll::J_6c", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_6c,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_7",
+                make_cacheable_observable("B->K^*ll::J_7", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_7,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_8",
+                make_cacheable_observable("B->K^*ll::J_8", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_8,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_9",
+                make_cacheable_observable("B->K^*ll::J_9", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_9,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_9norm",
+                make_cacheable_observable("B->K^*ll::J_9norm", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_9_normalized,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::J_9normavg",
+                make_cacheable_observable("B->K^*ll::J_9normavg", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_j_9_normalized_cp_averaged,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::S_3",
+                make_cacheable_observable("B->K^*ll::S_3", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_3,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::S_4",
+                make_cacheable_observable("B->K^*ll::S_4", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_4,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::S_5",
+                make_cacheable_observable("B->K^*ll::S_5", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_5,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::S_7",
+                make_cacheable_observable("B->K^*ll::S_7", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_7,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::S_8",
+                make_cacheable_observable("B->K^*ll::S_8", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_8,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B->K^*ll::S_9",
+                make_cacheable_observable("B->K^*ll::S_9", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_9,
                         std::make_tuple("q2_min", "q2_max")),
 
                 // here we put observables S_X in the LHCb angular conveniton:
-                make_observable("B->K^*ll::S_1s_LHCb",
+                make_cacheable_observable("B->K^*ll::S_1s_LHCb", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_1s_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B->K^*ll::S_1c_LHCb",
+                make_cacheable_observable("B->K^*ll::S_1c_LHCb", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_1c_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B->K^*ll::S_2s_LHCb",
+                make_cacheable_observable("B->K^*ll::S_2s_LHCb", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_2s_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B->K^*ll::S_2c_LHCb",
+                make_cacheable_observable("B->K^*ll::S_2c_LHCb", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_2c_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B->K^*ll::S_3_LHCb",
+                make_cacheable_observable("B->K^*ll::S_3_LHCb", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_3_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B->K^*ll::S_4_LHCb",
+                make_cacheable_observable("B->K^*ll::S_4_LHCb", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_4_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B->K^*ll::S_5_LHCb",
+                make_cacheable_observable("B->K^*ll::S_5_LHCb", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_5_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B->K^*ll::S_6s_LHCb",
+                make_cacheable_observable("B->K^*ll::S_6s_LHCb", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_6s_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B->K^*ll::S_6c_LHCb",
+                make_cacheable_observable("B->K^*ll::S_6c_LHCb", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_6c_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B->K^*ll::S_7_LHCb",
+                make_cacheable_observable("B->K^*ll::S_7_LHCb", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_7_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B->K^*ll::S_8_LHCb",
+                make_cacheable_observable("B->K^*ll::S_8_LHCb", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_8_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B->K^*ll::S_9_LHCb",
+                make_cacheable_observable("B->K^*ll::S_9_LHCb", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_s_9_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B->K^*ll::A_FB_LHCb",
+                make_cacheable_observable("B->K^*ll::A_FB_LHCb", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_forward_backward_asymmetry_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B->K^*ll::A_9",
+                make_cacheable_observable("B->K^*ll::A_9", "",
                         Unit::None(),
+                        &BToKstarDilepton::prepare,
                         &BToKstarDilepton::integrated_a_9,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -1054,140 +1129,167 @@ namespace eos
                         <<B_s->phill::dBR/ds;l=e>>
                         )"),
 
-                make_observable("B_s->phill::A_FB",
+                make_cacheable_observable("B_s->phill::A_FB", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_forward_backward_asymmetry,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->phill::BR",
+                make_cacheable_observable("B_s->phill::BR", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->phill::F_L",
+                make_cacheable_observable("B_s->phill::F_L", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_longitudinal_polarisation,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->phill::Gamma",
+                make_cacheable_observable("B_s->phill::Gamma", "",
                         Unit::GeV(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_decay_width,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->phill::S_3",
+                make_cacheable_observable("B_s->phill::S_3", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_3,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->phill::S_4",
+                make_cacheable_observable("B_s->phill::S_4", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_4,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->phill::S_5",
+                make_cacheable_observable("B_s->phill::S_5", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_5,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->phill::S_7",
+                make_cacheable_observable("B_s->phill::S_7", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_7,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->phill::S_8",
+                make_cacheable_observable("B_s->phill::S_8", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_8,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->phill::S_9",
+                make_cacheable_observable("B_s->phill::S_9", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_9,
                         std::make_tuple("q2_min", "q2_max")),
 
 
                 // here we put observables S_X in the LHCb angular conveniton:
-                make_observable("B_s->phill::S_1s_LHCb",
+                make_cacheable_observable("B_s->phill::S_1s_LHCb", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_1s_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->phill::S_1c_LHCb",
+                make_cacheable_observable("B_s->phill::S_1c_LHCb", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_1c_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->phill::S_2s_LHCb",
+                make_cacheable_observable("B_s->phill::S_2s_LHCb", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_2s_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->phill::S_2c_LHCb",
+                make_cacheable_observable("B_s->phill::S_2c_LHCb", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_2c_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->phill::S_3_LHCb",
+                make_cacheable_observable("B_s->phill::S_3_LHCb", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_3_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->phill::S_4_LHCb",
+                make_cacheable_observable("B_s->phill::S_4_LHCb", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_4_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->phill::S_5_LHCb",
+                make_cacheable_observable("B_s->phill::S_5_LHCb", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_5_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->phill::S_6s_LHCb",
+                make_cacheable_observable("B_s->phill::S_6s_LHCb", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_6s_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->phill::S_6c_LHCb",
+                make_cacheable_observable("B_s->phill::S_6c_LHCb", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_6c_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->phill::S_7_LHCb",
+                make_cacheable_observable("B_s->phill::S_7_LHCb", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_7_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->phill::S_8_LHCb",
+                make_cacheable_observable("B_s->phill::S_8_LHCb", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_8_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->phill::S_9_LHCb",
+                make_cacheable_observable("B_s->phill::S_9_LHCb", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_s_9_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->phill::A_FB_LHCb",
+                make_cacheable_observable("B_s->phill::A_FB_LHCb", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_forward_backward_asymmetry_LHCb,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->phill::A_5",
+                make_cacheable_observable("B_s->phill::A_5", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_a_5,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->phill::A_6s",
+                make_cacheable_observable("B_s->phill::A_6s", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_a_6s,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->phill::A_8",
+                make_cacheable_observable("B_s->phill::A_8", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_a_8,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->phill::A_9",
+                make_cacheable_observable("B_s->phill::A_9", "",
                         Unit::None(),
+                        &BsToPhiDilepton::prepare,
                         &BsToPhiDilepton::integrated_a_9,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -1248,8 +1350,9 @@ namespace eos
                         &LambdaBToLambdaDilepton<LargeRecoil>::differential_fzero,
                         std::make_tuple("q2")),
 
-                make_observable("Lambda_b->Lambdall::BR@LargeRecoil", R"(\mathcal{B}(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::BR@LargeRecoil", R"(\mathcal{B}(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LargeRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LargeRecoil>::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -1261,23 +1364,27 @@ namespace eos
                         <<Lambda_b->Lambdall::BR@LargeRecoil;l=e>>[q2_max=>q2_e_max,q2_min=>q2_e_min]
                         )"),
 
-                make_observable("Lambda_b->Lambdall::A_FB^l@LargeRecoil", R"(A_\mathrm{FB}^\ell(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::A_FB^l@LargeRecoil", R"(A_\mathrm{FB}^\ell(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LargeRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_leptonic,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::A_FB^h@LargeRecoil", R"(A_\mathrm{FB}^h(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::A_FB^h@LargeRecoil", R"(A_\mathrm{FB}^h(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LargeRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_hadronic,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::A_FB^c@LargeRecoil", R"(A_\mathrm{FB}^{h,\ell}(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::A_FB^c@LargeRecoil", R"(A_\mathrm{FB}^{h,\ell}(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LargeRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_combined,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::F_0@LargeRecoil", R"(F_0(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::F_0@LargeRecoil", R"(F_0(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LargeRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LargeRecoil>::integrated_fzero,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -1307,248 +1414,297 @@ namespace eos
                         &LambdaBToLambdaDilepton<LowRecoil>::differential_fzero,
                         std::make_tuple("q2")),
 
-                make_observable("Lambda_b->Lambdall::BR@LowRecoil", R"(\mathcal{B}(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::BR@LowRecoil", R"(\mathcal{B}(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::A_FB^l@LowRecoil", R"(A_\mathrm{FB}^\ell(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::A_FB^l@LowRecoil", R"(A_\mathrm{FB}^\ell(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_leptonic,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::A_FB^h@LowRecoil", R"(A_\mathrm{FB}^h(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::A_FB^h@LowRecoil", R"(A_\mathrm{FB}^h(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_hadronic,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::A_FB^c@LowRecoil", R"(A_\mathrm{FB}^{h,\ell}(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::A_FB^c@LowRecoil", R"(A_\mathrm{FB}^{h,\ell}(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_combined,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::F_0@LowRecoil", R"(F_0(\Lambda_b\to\Lambda\ell^+\ell^-))",
+                make_cacheable_observable("Lambda_b->Lambdall::F_0@LowRecoil", R"(F_0(\Lambda_b\to\Lambda\ell^+\ell^-))",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_fzero,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_1ss@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_1ss@LowRecoil", "",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k1ss,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_1cc@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_1cc@LowRecoil", "",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k1cc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_1c@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_1c@LowRecoil", "",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k1c,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_2ss@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_2ss@LowRecoil", "",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k2ss,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_2cc@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_2cc@LowRecoil", "",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k2cc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_2c@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_2c@LowRecoil", "",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k2c,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_3sc@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_3sc@LowRecoil", "",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k3sc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_3s@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_3s@LowRecoil", "",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k3s,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_4sc@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_4sc@LowRecoil", "",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k4sc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::K_4s@LowRecoil",
+                make_cacheable_observable("Lambda_b->Lambdall::K_4s@LowRecoil", "",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_k4s,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_1@LowRecoil", R"(M_1)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_1@LowRecoil", R"(M_1)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m1,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_2@LowRecoil", R"(M_2)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_2@LowRecoil", R"(M_2)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m2,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_3@LowRecoil", R"(M_3)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_3@LowRecoil", R"(M_3)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m3,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_4@LowRecoil", R"(M_4)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_4@LowRecoil", R"(M_4)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m4,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_5@LowRecoil", R"(M_5)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_5@LowRecoil", R"(M_5)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m5,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_6@LowRecoil", R"(M_6)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_6@LowRecoil", R"(M_6)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m6,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_7@LowRecoil", R"(M_7)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_7@LowRecoil", R"(M_7)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m7,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_8@LowRecoil", R"(M_8)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_8@LowRecoil", R"(M_8)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m8,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_9@LowRecoil", R"(M_9)",
+                make_cacheable_observable("Lambda_b->Lambdall::M_9@LowRecoil", R"(M_9)",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m9,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_10@LowRecoil", R"(M_{10})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_10@LowRecoil", R"(M_{10})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m10,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_11@LowRecoil", R"(M_{11})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_11@LowRecoil", R"(M_{11})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m11,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_12@LowRecoil", R"(M_{12})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_12@LowRecoil", R"(M_{12})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m12,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_13@LowRecoil", R"(M_{13})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_13@LowRecoil", R"(M_{13})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m13,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_14@LowRecoil", R"(M_{14})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_14@LowRecoil", R"(M_{14})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m14,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_15@LowRecoil", R"(M_{15})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_15@LowRecoil", R"(M_{15})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m15,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_16@LowRecoil", R"(M_{16})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_16@LowRecoil", R"(M_{16})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m16,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_17@LowRecoil", R"(M_{17})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_17@LowRecoil", R"(M_{17})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m17,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_18@LowRecoil", R"(M_{18})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_18@LowRecoil", R"(M_{18})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m18,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_19@LowRecoil", R"(M_{19})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_19@LowRecoil", R"(M_{19})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m19,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_20@LowRecoil", R"(M_{20})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_20@LowRecoil", R"(M_{20})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m20,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_21@LowRecoil", R"(M_{21})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_21@LowRecoil", R"(M_{21})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m21,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_22@LowRecoil", R"(M_{22})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_22@LowRecoil", R"(M_{22})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m22,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_23@LowRecoil", R"(M_{23})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_23@LowRecoil", R"(M_{23})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m23,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_24@LowRecoil", R"(M_{24})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_24@LowRecoil", R"(M_{24})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m24,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_25@LowRecoil", R"(M_{25})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_25@LowRecoil", R"(M_{25})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m25,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_26@LowRecoil", R"(M_{26})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_26@LowRecoil", R"(M_{26})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m26,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_27@LowRecoil", R"(M_{27})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_27@LowRecoil", R"(M_{27})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m27,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_28@LowRecoil", R"(M_{28})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_28@LowRecoil", R"(M_{28})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m28,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_29@LowRecoil", R"(M_{29})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_29@LowRecoil", R"(M_{29})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m29,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_30@LowRecoil", R"(M_{30})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_30@LowRecoil", R"(M_{30})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m30,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_31@LowRecoil", R"(M_{31})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_31@LowRecoil", R"(M_{31})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m31,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_32@LowRecoil", R"(M_{32})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_32@LowRecoil", R"(M_{32})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m32,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_33@LowRecoil", R"(M_{33})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_33@LowRecoil", R"(M_{33})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m33,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambdall::M_34@LowRecoil", R"(M_{34})",
+                make_cacheable_observable("Lambda_b->Lambdall::M_34@LowRecoil", R"(M_{34})",
                         Unit::None(),
+                        &LambdaBToLambdaDilepton<LowRecoil>::prepare,
                         &LambdaBToLambdaDilepton<LowRecoil>::integrated_m34,
                         std::make_tuple("q2_min", "q2_max")),
             }
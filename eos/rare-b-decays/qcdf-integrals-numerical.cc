@@ -22,6 +22,7 @@
 #include <eos/rare-b-decays/qcdf-integrals-impl.hh>
 #include <eos/utils/exception.hh>
 #include <eos/utils/integrate.hh>
+#include <eos/utils/persistent-cache.hh>
 #include <eos/utils/power_of.hh>
 #include <eos/utils/stringify.hh>
 
@@ -126,10 +127,9 @@ namespace eos
         return results;
     }
 
-    // charm case
-    template <>
-    QCDFIntegrals<BToKstarDilepton>
-    QCDFIntegralCalculator<BToKstarDilepton, tag::Numerical>::dilepton_charm_case(const double & s,
+    // charm case, without the persistent cache
+    static QCDFIntegrals<BToKstarDilepton>
+    integrate_dilepton_charm_case(const double & s,
             const double & m_c, const double & m_B, const double & m_V, const double & mu,
             const double & a_1_perp, const double & a_2_perp,
             const double & a_1_para, const double & a_2_para)
@@ -184,10 +184,20 @@ namespace eos
         return results;
     }
 
-    // bottom case
     template <>
     QCDFIntegrals<BToKstarDilepton>
-    QCDFIntegralCalculator<BToKstarDilepton, tag::Numerical>::dilepton_bottom_case(const double & s,
+    QCDFIntegralCalculator<BToKstarDilepton, tag::Numerical>::dilepton_charm_case(const double & s,
+            const double & m_c, const double & m_B, const double & m_V, const double & mu,
+            const double & a_1_perp, const double & a_2_perp,
+            const double & a_1_para, const double & a_2_para)
+    {
+        return PersistentCache::instance()->evaluate("QCDFIntegralCalculator<BToKstarDilepton, tag::Numerical>::dilepton_charm_case",
+                &integrate_dilepton_charm_case, s, m_c, m_B, m_V, mu, a_1_perp, a_2_perp, a_1_para, a_2_para);
+    }
+
+    // bottom case, without the persistent cache
+    static QCDFIntegrals<BToKstarDilepton>
+    integrate_dilepton_bottom_case(const double & s,
             const double & m_b, const double & m_B, const double & m_V, const double & mu,
             const double & a_1_perp, const double & a_2_perp,
             const double & a_1_para, const double & a_2_para)
@@ -241,4 +251,15 @@ namespace eos
 
         return results;
     }
+
+    template <>
+    QCDFIntegrals<BToKstarDilepton>
+    QCDFIntegralCalculator<BToKstarDilepton, tag::Numerical>::dilepton_bottom_case(const double & s,
+            const double & m_b, const double & m_B, const double & m_V, const double & mu,
+            const double & a_1_perp, const double & a_2_perp,
+            const double & a_1_para, const double & a_2_para)
+    {
+        return PersistentCache::instance()->evaluate("QCDFIntegralCalculator<BToKstarDilepton, tag::Numerical>::dilepton_bottom_case",
+                &integrate_dilepton_bottom_case, s, m_b, m_B, m_V, mu, a_1_perp, a_2_perp, a_1_para, a_2_para);
+    }
 }
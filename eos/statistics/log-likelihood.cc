@@ -24,13 +24,16 @@
 #include <eos/utils/observable_cache.hh>
 #include <eos/utils/power_of.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/profiler.hh>
 #include <eos/utils/verify.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <limits>
 #include <map>
+#include <numeric>
 
 #include <gsl/gsl_blas.h>
 #include <gsl/gsl_cdf.h>
@@ -135,11 +138,21 @@ namespace eos
                 return norm - power_of<2>(chi) / 2.0;
             }
 
+            virtual double upper_bound() const
+            {
+                return norm;
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return _number_of_observations;
             }
 
+            virtual std::vector<ObservableCache::Id> observable_ids() const
+            {
+                return { id };
+            }
+
             /*!
              * Mirror and shift the experimental distribution.
              *
@@ -314,11 +327,22 @@ namespace eos
                 return norm + alpha * value - std::exp(value);
             }
 
+            virtual double upper_bound() const
+            {
+                // the maximum is attained for exp(value) = alpha
+                return norm + alpha * std::log(alpha) - alpha;
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return _number_of_observations;
             }
 
+            virtual std::vector<ObservableCache::Id> observable_ids() const
+            {
+                return { id };
+            }
+
             // todo remove 3 sigma limits, or remove whole block altogether
             // draw from standard gamma, apply log, then shift and rescale
             virtual double sample(gsl_rng * rng) const
@@ -548,6 +572,17 @@ namespace eos
                 return norm + (alpha * beta - 1) * std::log(z) - std::pow(z, beta);
             }
 
+            virtual double upper_bound() const
+            {
+                // the maximum is attained for z^beta = (alpha * beta - 1) / beta
+                if ((beta <= 0.0) || (alpha * beta <= 1.0))
+                    return std::numeric_limits<double>::infinity();
+
+                const double zeta = (alpha * beta - 1.0) / beta;
+
+                return norm + zeta * std::log(zeta) - zeta;
+            }
+
             inline double mode() const
             {
                 return physical_limit + theta * std::pow(alpha - 1 / beta, 1 / beta);
@@ -558,6 +593,11 @@ namespace eos
                 return _number_of_observations;
             }
 
+            virtual std::vector<ObservableCache::Id> observable_ids() const
+            {
+                return { id };
+            }
+
             /*
              * Draw from standard gamma.
              * Usually one would have to perform an inverse Weibull transform,
@@ -749,6 +789,38 @@ namespace eos
                 return ret_val;
             }
 
+            double upper_bound() const
+            {
+                std::vector<double> bounds;
+                for (const auto & component : components)
+                    bounds.push_back((*component).upper_bound());
+
+                const double max_val = *std::max_element(bounds.cbegin(), bounds.cend());
+                if (! std::isfinite(max_val))
+                    return max_val;
+
+                double ret_val = 0;
+                auto b = bounds.cbegin();
+                for (auto w = weights.cbegin(); w != weights.cend() ; ++w, ++b)
+                {
+                    ret_val += *w * std::exp(*b - max_val);
+                }
+
+                return std::log(ret_val) + max_val;
+            }
+
+            std::vector<ObservableCache::Id> observable_ids() const
+            {
+                std::vector<ObservableCache::Id> result;
+                for (const auto & component : components)
+                {
+                    const auto ids = component->observable_ids();
+                    result.insert(result.end(), ids.cbegin(), ids.cend());
+                }
+
+                return result;
+            }
+
             unsigned number_of_observations() const
             {
                 unsigned ret_val = 0;
@@ -792,14 +864,8 @@ namespace eos
             // the normalization constant of the density
             const double _norm;
 
-            // cholesky matrix of covariance, and inverse of covariance
+            // lower triangular cholesky factor L of the covariance, with L L^T = covariance
             gsl_matrix * _chol;
-            gsl_matrix * _covariance_inv;
-
-            // temporary storage for evaluation
-            gsl_vector * _observables;
-            gsl_vector * _measurements;
-            gsl_vector * _measurements_2;
 
             MultivariateGaussianBlock(const ObservableCache & cache, const std::vector<ObservableCache::Id> && ids,
                     gsl_vector * mean, gsl_matrix * covariance, gsl_matrix * response, const unsigned & number_of_observations) :
@@ -812,11 +878,7 @@ namespace eos
                 _response(response),
                 _number_of_observations(number_of_observations),
                 _norm(compute_norm()),
-                _chol(gsl_matrix_alloc(covariance->size1, covariance->size2)),
-                _covariance_inv(gsl_matrix_alloc(covariance->size1, covariance->size2)),
-                _observables(gsl_vector_alloc(_dim_pred)),
-                _measurements(gsl_vector_alloc(_dim_meas)),
-                _measurements_2(gsl_vector_alloc(_dim_meas))
+                _chol(gsl_matrix_alloc(covariance->size1, covariance->size2))
             {
                 if (_covariance->size1 != _covariance->size2)
                     throw InternalError("MultivariateGaussianBlock: covariance matrix is not a square matrix");
@@ -833,7 +895,6 @@ namespace eos
                 // cholesky decomposition (informally: the sqrt of the covariance matrix)
                 // the GSL matrix contains both the cholesky and its transpose, see GSL reference, ch. 14.5
                 cholesky();
-                invert_covariance();
 
                 // keep only the lower and diagonal parts, set upper parts to zero
                 for (unsigned i = 0; i < _dim_meas ; ++i)
@@ -847,14 +908,10 @@ namespace eos
 
             virtual ~MultivariateGaussianBlock()
             {
-                gsl_matrix_free(_covariance_inv);
                 gsl_matrix_free(_chol);
                 gsl_matrix_free(_covariance);
                 gsl_matrix_free(_response);
 
-                gsl_vector_free(_measurements_2);
-                gsl_vector_free(_measurements);
-                gsl_vector_free(_observables);
                 gsl_vector_free(_mean);
             }
 
@@ -879,16 +936,18 @@ namespace eos
                     result += ")";
                 }
                 result += "), inverse covariance matrix = (";
+                gsl_matrix * covariance_inv = inverse_covariance();
                 for (std::size_t i = 0 ; i < k ; ++i)
                 {
                     result += "( ";
                     for (std::size_t j = 0 ; j < k ; ++j)
                     {
-                        result += stringify(gsl_matrix_get(_covariance_inv, i, j)) + " ";
+                        result += stringify(gsl_matrix_get(covariance_inv, i, j)) + " ";
                     }
                     result += ")";
                 }
                 result += " )";
+                gsl_matrix_free(covariance_inv);
 
                 if (0 == _number_of_observations)
                     result += "; no observation";
@@ -907,17 +966,21 @@ namespace eos
                 }
             }
 
-            // invert covariance matrix based on previously obtained Cholesky decomposition
-            void invert_covariance()
+            // invert covariance matrix based on previously obtained Cholesky decomposition; only used for display
+            gsl_matrix * inverse_covariance() const
             {
                 // copy cholesky matrix
-                gsl_matrix_memcpy(_covariance_inv, _chol);
+                gsl_matrix * result = gsl_matrix_alloc(_dim_meas, _dim_meas);
+                gsl_matrix_memcpy(result, _chol);
 
                 // compute inverse matrix from cholesky
-                if (GSL_SUCCESS != gsl_linalg_cholesky_invert(_covariance_inv))
+                if (GSL_SUCCESS != gsl_linalg_cholesky_invert(result))
                 {
+                    gsl_matrix_free(result);
                     throw InternalError("MultivariateGaussianBlock: Cholesky inversion failed");
                 }
+
+                return result;
             }
 
 
@@ -970,25 +1033,32 @@ namespace eos
 
             double chi_square() const
             {
-                // read observable values from cache, and subtract mean
+                // per-call storage, such that one block can be evaluated from several threads
+                std::vector<double> storage(_dim_pred + _dim_meas);
+
+                // read observable values from cache
                 for (auto i = 0u ; i < _dim_pred ; ++i)
                 {
-                    gsl_vector_set(_observables, i, _cache[_ids[i]]);
+                    storage[i] = _cache[_ids[i]];
                 }
 
+                gsl_vector_const_view o = gsl_vector_const_view_array(storage.data(), _dim_pred);
+                gsl_vector_view m = gsl_vector_view_array(storage.data() + _dim_pred, _dim_meas);
+
                 // prepare for centering
-                //   measurements <- mean
-                gsl_vector_memcpy(_measurements, _mean);
+                //   m <- mean
+                gsl_vector_memcpy(&m.vector, _mean);
 
                 // apply response matrix and center the gaussian:
-                //   measurements <- R * observables - measurements
-                gsl_blas_dgemv(CblasNoTrans, 1.0, _response, _observables, -1.0, _measurements);
+                //   m <- R * observables - m
+                gsl_blas_dgemv(CblasNoTrans, 1.0, _response, &o.vector, -1.0, &m.vector);
 
-                // observables <- inv(covariance) * measurements
-                gsl_blas_dgemv(CblasNoTrans, 1.0, _covariance_inv, _measurements, 0.0, _measurements_2);
+                // chi^2 = m^T inv(covariance) m = |inv(L) m|^2
+                //   m <- inv(L) * m
+                gsl_blas_dtrsv(CblasLower, CblasNoTrans, CblasNonUnit, _chol, &m.vector);
 
                 double result;
-                gsl_blas_ddot(_measurements, _measurements_2, &result);
+                gsl_blas_ddot(&m.vector, &m.vector, &result);
 
                 return result;
             }
@@ -998,29 +1068,31 @@ namespace eos
                 return _norm - 0.5 * chi_square();
             }
 
+            virtual double upper_bound() const
+            {
+                return _norm;
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return _number_of_observations;
             }
 
+            virtual std::vector<ObservableCache::Id> observable_ids() const
+            {
+                return _ids;
+            }
+
             virtual double sample(gsl_rng * rng) const
             {
-                // generate standard normals in observables
+                // To be consistent with the univariate Gaussian, we would center observables around theory,
+                // then compare to theory. Hence we can forget about theory, and stay centered on zero.
+                // For x = L * z with standard normals z, the chi^2 is x^T inv(covariance) x = z^T z.
+                double result = 0.0;
                 for (auto i = 0u ; i < _dim_meas ; ++i)
                 {
-                    gsl_vector_set(_measurements, i, gsl_ran_ugaussian(rng));
+                    result += power_of<2>(gsl_ran_ugaussian(rng));
                 }
-
-                // transform: observables2 <- _chol * observables
-                gsl_blas_dgemv(CblasNoTrans, 1.0, _chol, _measurements, 0.0, _measurements_2);
-
-                // To be consistent with the univariate Gaussian, we would center observables around theory,
-                // then compare to theory. Hence we can forget about theory, and stay centered on zero.
-                // transform: observables <- inv(covariance) * observables2
-                gsl_blas_dgemv(CblasNoTrans, 1.0, _covariance_inv, _measurements_2, 0.0, _measurements);
-
-                double result;
-                gsl_blas_ddot(_measurements, _measurements_2, &result);
                 result *= -0.5;
                 result += _norm;
 
@@ -1075,11 +1147,22 @@ namespace eos
                 return cache[id];
             }
 
+            virtual double upper_bound() const
+            {
+                // valid parameter points yield 0, invalid ones -inf
+                return 0.0;
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return 0.0;
             }
 
+            virtual std::vector<ObservableCache::Id> observable_ids() const
+            {
+                return { id };
+            }
+
             virtual double sample(gsl_rng * /*rng*/) const
             {
                 return 0.0;
@@ -1108,6 +1191,12 @@ namespace eos
     {
     }
 
+    double
+    LogLikelihoodBlock::upper_bound() const
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
     LogLikelihoodBlockPtr
     LogLikelihoodBlock::Gaussian(ObservableCache cache, const ObservablePtr & observable,
             const double & min, const double & central, const double & max,
@@ -1256,12 +1345,47 @@ namespace eos
         // Container for all named constraints
         std::vector<Constraint> constraints;
 
+        // For each constraint: the ids of its observables within the cache, and the sum of the upper bounds of its blocks
+        std::vector<std::vector<ObservableCache::Id>> constraint_observable_ids;
+        std::vector<double> constraint_upper_bounds;
+
+        // For each constraint: the running average of the wall time spent on its evaluation
+        std::vector<double> constraint_costs;
+
+        // For each constraint: the profiling sections of its blocks, once they have been evaluated while profiling
+        mutable std::vector<std::vector<Profiler::Section *>> block_sections;
+
         Implementation(const Parameters & parameters) :
             parameters(parameters),
             cache(parameters)
         {
         }
 
+        // prepare the bookkeeping for the blocks of a newly added constraint
+        void add_blocks(const Constraint & constraint)
+        {
+            // the ids of the constraint's observables, under which the blocks have added them to the cache
+            std::vector<ObservableCache::Id> ids;
+            for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks() ; b != b_end ; ++b)
+            {
+                const auto block_ids = (*b)->observable_ids();
+                ids.insert(ids.end(), block_ids.cbegin(), block_ids.cend());
+            }
+            std::sort(ids.begin(), ids.end());
+            ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+            constraint_observable_ids.push_back(std::move(ids));
+
+            double upper_bound = 0.0;
+            for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks() ; b != b_end ; ++b)
+            {
+                upper_bound += (*b)->upper_bound();
+            }
+            constraint_upper_bounds.push_back(upper_bound);
+            constraint_costs.push_back(0.0);
+
+            block_sections.push_back(std::vector<Profiler::Section *>(std::distance(constraint.begin_blocks(), constraint.end_blocks()), nullptr));
+        }
+
         std::pair<double, double>
         bootstrap_p_value(const unsigned & datasets)
         {
@@ -1337,16 +1461,44 @@ namespace eos
             return std::make_pair(p, uncertainty);
         }
 
+        // the profiling section of the i-th block of constraint c
+        Profiler::Section * block_section(const unsigned & c, const unsigned & i) const
+        {
+            auto & section = block_sections[c][i];
+            if (! section)
+            {
+                // name the blocks after their constraint, and number them if there are several
+                const std::string name = constraints[c].name().str();
+                section = Profiler::instance()->section("block", (1 == block_sections[c].size()) ? name : name + "#" + stringify(i));
+            }
+
+            return section;
+        }
+
+        double evaluate_block(const LogLikelihoodBlockPtr & block, const unsigned & c, const unsigned & i, const bool & profile) const
+        {
+            if (! profile)
+                return block->evaluate();
+
+            const auto start = Profiler::Clock::now();
+            const double result = block->evaluate();
+            Profiler::instance()->record(block_section(c, i), start, Profiler::Clock::now(), result);
+
+            return result;
+        }
+
         double log_likelihood() const
         {
+            const bool profile = Profiler::instance()->enabled();
             double result = 0.0;
 
             // loop over all likelihood blocks
-            for (const auto & constraint : constraints)
+            for (auto c = 0u ; c < constraints.size() ; ++c)
             {
-                for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks() ; b != b_end ; ++b)
+                unsigned i = 0;
+                for (auto b = constraints[c].begin_blocks(), b_end = constraints[c].end_blocks() ; b != b_end ; ++b, ++i)
                 {
-                    double llh = (*b)->evaluate();
+                    double llh = evaluate_block(*b, c, i, profile);
                     if (! std::isfinite(llh))
                         return -std::numeric_limits<double>::infinity();
 
@@ -1356,6 +1508,56 @@ namespace eos
 
             return result;
         }
+
+        double bounded_log_likelihood(const double & bound)
+        {
+            // evaluate the cheapest constraints first
+            std::vector<unsigned> order(constraints.size());
+            std::iota(order.begin(), order.end(), 0u);
+            std::stable_sort(order.begin(), order.end(), [this] (const unsigned & a, const unsigned & b)
+            {
+                return constraint_costs[a] < constraint_costs[b];
+            });
+
+            // the largest contribution that the remaining constraints can make
+            std::vector<double> remaining(order.size() + 1, 0.0);
+            for (auto i = order.size() ; i > 0 ; --i)
+            {
+                remaining[i - 1] = remaining[i] + constraint_upper_bounds[order[i - 1]];
+            }
+
+            if (remaining[0] < bound)
+                return -std::numeric_limits<double>::infinity();
+
+            const bool profile = Profiler::instance()->enabled();
+            double result = 0.0;
+            for (auto i = 0u ; i < order.size() ; ++i)
+            {
+                const auto & c = order[i];
+                const auto start = std::chrono::steady_clock::now();
+
+                cache.update(constraint_observable_ids[c]);
+
+                unsigned j = 0;
+                for (auto b = constraints[c].begin_blocks(), b_end = constraints[c].end_blocks() ; b != b_end ; ++b, ++j)
+                {
+                    double llh = evaluate_block(*b, c, j, profile);
+                    if (! std::isfinite(llh))
+                        return -std::numeric_limits<double>::infinity();
+
+                    result += llh;
+                }
+
+                // keep a running average, weighted towards the most recent evaluations
+                const double cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                constraint_costs[c] = (0.0 == constraint_costs[c]) ? cost : 0.75 * constraint_costs[c] + 0.25 * cost;
+
+                if (result + remaining[i + 1] < bound)
+                    return -std::numeric_limits<double>::infinity();
+            }
+
+            return result;
+        }
     };
 
     LogLikelihood::LogLikelihood(const Parameters & parameters) :
@@ -1374,6 +1576,7 @@ namespace eos
         LogLikelihoodBlockPtr b = LogLikelihoodBlock::Gaussian(_imp->cache, observable, min, central, max, number_of_observations);
         _imp->constraints.push_back(
             Constraint(observable->name(), std::vector<ObservablePtr>{ observable }, std::vector<LogLikelihoodBlockPtr>{ b }));
+        _imp->add_blocks(_imp->constraints.back());
     }
 
     void
@@ -1392,6 +1595,7 @@ namespace eos
 
         // retain a proper copy of the constraint to iterate over
         _imp->constraints.push_back(Constraint(constraint.name(), observables, blocks));
+        _imp->add_blocks(_imp->constraints.back());
     }
 
     LogLikelihood::ConstraintIterator
@@ -1460,4 +1664,10 @@ namespace eos
 
         return _imp->log_likelihood();
     }
+
+    double
+    LogLikelihood::bounded_evaluation(const double & bound) const
+    {
+        return _imp->bounded_log_likelihood(bound);
+    }
 }
@@ -61,9 +61,20 @@ namespace eos
             /// Compute the logarithm of the likelihood for this block.
             virtual double evaluate() const = 0;
 
+            /*!
+             * The least upper bound on the logarithm of the likelihood for this block,
+             * i.e., the largest value evaluate() can return for any prediction.
+             *
+             * @note The default implementation returns +inf, i.e., no bound is known.
+             */
+            virtual double upper_bound() const;
+
             /// The number of experimental observations (not observables!) used in this block.
             virtual unsigned number_of_observations() const = 0;
 
+            /// The ids of the observables within the cache whose predictions this block draws from.
+            virtual std::vector<ObservableCache::Id> observable_ids() const = 0;
+
             /*!
              * Sample from the logarithm of the likelihood for this block.
              * @warning Call prepare_sampling() before a call to sample() to
@@ -396,6 +407,21 @@ namespace eos
              * @note: all observables are recalculated
              */
             double operator()() const;
+
+            /*!
+             * Evaluate the log likelihood, but give up as soon as it cannot exceed a given bound.
+             *
+             * The constraints are evaluated one after another, ordered by their measured cost, and only the
+             * observables of the constraint at hand are updated. The evaluation stops once the partial
+             * log likelihood plus the upper bounds of the remaining constraints falls below the bound.
+             *
+             * @note Observables of the remaining constraints are not updated. Their predictions within the
+             *       observable cache are out of date until the next update.
+             *
+             * @param bound The value below which the log likelihood is of no interest.
+             * @return The log likelihood if it exceeds the bound, and -inf otherwise.
+             */
+            double bounded_evaluation(const double & bound) const;
             ///@}
     };
 
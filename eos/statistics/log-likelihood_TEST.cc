@@ -90,6 +90,35 @@ namespace eos
                     TEST_CHECK_NEARLY_EQUAL(llh(), -10.11630282317536, eps);
                 }
 
+                // bounded evaluation
+                {
+                    LogLikelihood llh(p);
+                    llh.add(ObservablePtr(new ObservableStub(p, "mass::b(MSbar)", k)), +4.24, +4.25, +4.30);
+                    llh.add(ObservablePtr(new ObservableStub(p, "mass::c",        k)), +1.33, +1.82, +1.90);
+                    llh.add(ObservablePtr(new ObservableStub(p, "mass::tau",      k)), +1.85, +2.00, +2.18);
+
+                    p["mass::b(MSbar)"] = 4.2;
+                    p["mass::c"] = 1.5;
+                    p["mass::tau"] = 2.28;
+
+                    // a low bound yields the full log(likelihood)
+                    TEST_CHECK_NEARLY_EQUAL(llh.bounded_evaluation(-20.0), -10.11630282317536, eps);
+                    TEST_CHECK_NEARLY_EQUAL(llh.bounded_evaluation(-std::numeric_limits<double>::infinity()), -10.11630282317536, eps);
+
+                    // a bound above the log(likelihood) yields -inf
+                    TEST_CHECK_EQUAL(llh.bounded_evaluation(-10.0), -std::numeric_limits<double>::infinity());
+
+                    // a bound above the largest possible log(likelihood) yields -inf without evaluating anything
+                    p["mass::b(MSbar)"] = 4.25;
+                    TEST_CHECK_EQUAL(llh.bounded_evaluation(+10.0), -std::numeric_limits<double>::infinity());
+                    TEST_CHECK_EQUAL(4.2, llh.observable_cache()[0]);
+
+                    // the regular evaluation updates the skipped observables
+                    p["mass::b(MSbar)"] = 4.2;
+                    TEST_CHECK_NEARLY_EQUAL(llh(), -10.11630282317536, eps);
+                    TEST_CHECK_NEARLY_EQUAL(llh.bounded_evaluation(-20.0), -10.11630282317536, eps);
+                }
+
                 // clone test
                 {
                     LogLikelihood llh1(p);
@@ -300,6 +329,7 @@ namespace eos
                     cache.update();
 
                     TEST_CHECK_RELATIVE_ERROR(log_gamma->evaluate(), +1.005543554, low_eps);
+                    TEST_CHECK(log_gamma->upper_bound() >= log_gamma->evaluate());
 
                     // pdf value at one sigma border
                     p["mass::b(MSbar)"] = central + 0.2;
@@ -517,6 +547,11 @@ namespace eos
                     auto block1 = LogLikelihoodBlock::Gaussian(cache, obs[0], +4.20, +4.30, +4.40);
                     auto block2 = LogLikelihoodBlock::Gaussian(cache, obs[1], +1.05, +1.10, +1.15);
 
+                    // the blocks know the ids of their observables within the cache
+                    TEST_CHECK(block->observable_ids() == (std::vector<ObservableCache::Id>{ 0, 1 }));
+                    TEST_CHECK(block1->observable_ids() == (std::vector<ObservableCache::Id>{ 0 }));
+                    TEST_CHECK(block2->observable_ids() == (std::vector<ObservableCache::Id>{ 1 }));
+
                     // update the common cache so observable now have values different from nan
                     p["mass::b(MSbar)"] = 4.35;
                     p["mass::c"] = 1.2;
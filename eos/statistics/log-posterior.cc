@@ -21,12 +21,25 @@
 
 #include <eos/statistics/log-posterior.hh>
 #include <eos/utils/density-impl.hh>
+#include <eos/utils/lock.hh>
 #include <eos/utils/log.hh>
+#include <eos/utils/mutex.hh>
 #include <eos/utils/power_of.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/profiler.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
 
 #include <gsl/gsl_cdf.h>
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <map>
+#include <set>
+#include <tuple>
+
 namespace eos
 {
     struct RangeError :
@@ -38,10 +51,373 @@ namespace eos
         }
     };
 
+    struct LogPosterior::ClonePool
+    {
+        Mutex mutex;
+
+        // the number of observations of the log(likelihood) at the time the clones were built
+        unsigned number_of_observations = 0;
+
+        std::vector<LogPosteriorPtr> clones;
+    };
+
+    template <>
+    struct Implementation<LogPosterior>
+    {
+        // the indices of all priors and constraints whose values depend on one or more varied parameters
+        struct Dependencies
+        {
+            std::vector<unsigned> priors;
+            std::vector<unsigned> constraints;
+        };
+
+        // determine for each varied parameter the priors and constraints that depend on it
+        static std::vector<Dependencies> dependencies(const LogPosterior & posterior)
+        {
+            const auto & descriptions = posterior._parameter_descriptions;
+            std::vector<Dependencies> result(descriptions.size());
+
+            std::vector<Parameter::Id> ids;
+            for (const auto & d : descriptions)
+            {
+                ids.push_back(posterior._parameters[d.parameter->name()].id());
+            }
+
+            for (unsigned p = 0 ; p < posterior._priors.size() ; ++p)
+            {
+                for (auto d = posterior._priors[p]->begin(), d_end = posterior._priors[p]->end() ; d != d_end ; ++d)
+                {
+                    result[posterior.index(d->parameter->name())].priors.push_back(p);
+                }
+            }
+
+            unsigned c = 0;
+            for (auto constraint = posterior._log_likelihood.begin(), constraint_end = posterior._log_likelihood.end() ; constraint != constraint_end ; ++constraint, ++c)
+            {
+                std::set<Parameter::Id> used;
+                // observables that do not report their parameters are assumed to depend on all parameters
+                bool uses_all = false;
+                for (auto o = constraint->begin_observables(), o_end = constraint->end_observables() ; o != o_end ; ++o)
+                {
+                    if ((*o)->begin() == (*o)->end())
+                        uses_all = true;
+
+                    used.insert((*o)->begin(), (*o)->end());
+                }
+
+                for (unsigned j = 0 ; j < ids.size() ; ++j)
+                {
+                    if (uses_all || (used.count(ids[j]) > 0))
+                        result[j].constraints.push_back(c);
+                }
+            }
+
+            return result;
+        }
+
+        // the priors and constraints that depend on both sets of parameters
+        static Dependencies intersection(const Dependencies & a, const Dependencies & b)
+        {
+            Dependencies result;
+            std::set_intersection(a.priors.cbegin(), a.priors.cend(), b.priors.cbegin(), b.priors.cend(),
+                    std::back_inserter(result.priors));
+            std::set_intersection(a.constraints.cbegin(), a.constraints.cend(), b.constraints.cbegin(), b.constraints.cend(),
+                    std::back_inserter(result.constraints));
+
+            return result;
+        }
+
+        // the ids of all observables within the cache that enter the given constraints
+        static std::vector<ObservableCache::Id> observable_ids(const std::vector<Constraint> & constraints, const std::vector<unsigned> & indices)
+        {
+            std::vector<ObservableCache::Id> result;
+            for (const auto & c : indices)
+            {
+                for (auto b = constraints[c].begin_blocks(), b_end = constraints[c].end_blocks() ; b != b_end ; ++b)
+                {
+                    const auto ids = (**b).observable_ids();
+                    result.insert(result.end(), ids.cbegin(), ids.cend());
+                }
+            }
+
+            std::sort(result.begin(), result.end());
+            result.erase(std::unique(result.begin(), result.end()), result.end());
+
+            return result;
+        }
+
+        // the part of the log(posterior) that arises from the given priors and constraints
+        static double partial_log_posterior(const LogPosterior & posterior, const std::vector<Constraint> & constraints, const Dependencies & d)
+        {
+            // only update the observables that enter the given constraints
+            if (! d.constraints.empty())
+                posterior._log_likelihood.observable_cache().update(observable_ids(constraints, d.constraints));
+
+            double result = 0.0;
+            for (const auto & p : d.priors)
+            {
+                result += (*posterior._priors[p])();
+            }
+
+            for (const auto & c : d.constraints)
+            {
+                for (auto b = constraints[c].begin_blocks(), b_end = constraints[c].end_blocks() ; b != b_end ; ++b)
+                {
+                    result += (**b).evaluate();
+                }
+            }
+
+            return result;
+        }
+
+        /*
+         * Take a number of independent clones from the posterior's pool, and create new ones if the
+         * pool runs short. The values of all parameters of the clones are synchronised with the posterior.
+         */
+        static std::vector<LogPosteriorPtr> acquire(const LogPosterior & posterior, const unsigned & number_of_clones)
+        {
+            auto & pool = *posterior._clone_pool;
+            std::vector<LogPosteriorPtr> result;
+
+            {
+                Lock l(pool.mutex);
+
+                // constraints that have been added since the clones were built are unknown to the clones
+                if (pool.number_of_observations != posterior._log_likelihood.number_of_observations())
+                {
+                    pool.clones.clear();
+                    pool.number_of_observations = posterior._log_likelihood.number_of_observations();
+                }
+
+                while ((result.size() < number_of_clones) && (! pool.clones.empty()))
+                {
+                    result.push_back(pool.clones.back());
+                    pool.clones.pop_back();
+                }
+            }
+
+            while (result.size() < number_of_clones)
+            {
+                result.push_back(posterior.old_clone());
+            }
+
+            std::vector<Parameter::Id> ids;
+            std::vector<double> values;
+            for (const auto & p : posterior._parameters)
+            {
+                ids.push_back(p.id());
+                values.push_back(p.evaluate());
+            }
+
+            for (auto & clone : result)
+            {
+                clone->_parameters.set_values(ids, values);
+            }
+
+            return result;
+        }
+
+        // return clones to the posterior's pool, keeping at most one clone per thread
+        static void release(const LogPosterior & posterior, std::vector<LogPosteriorPtr> & clones)
+        {
+            auto & pool = *posterior._clone_pool;
+
+            Lock l(pool.mutex);
+
+            for (auto & clone : clones)
+            {
+                if (pool.clones.size() >= ThreadPool::instance()->number_of_threads())
+                    break;
+
+                pool.clones.push_back(clone);
+            }
+
+            clones.clear();
+        }
+
+        /*
+         * Distribute a number of jobs across the ThreadPool. Each thread works on an independent clone,
+         * whose parameters are set to the given point before each job.
+         */
+        static void run(const LogPosterior & posterior, const double * point, const unsigned & number_of_jobs,
+                const std::function<void (const LogPosterior &, const std::vector<Constraint> &, const unsigned &)> & work)
+        {
+            if (0 == number_of_jobs)
+                return;
+
+            const unsigned number_of_clones = std::min(number_of_jobs, ThreadPool::instance()->number_of_threads());
+            const unsigned chunk_size = (number_of_jobs + number_of_clones - 1) / number_of_clones;
+
+            auto clones = acquire(posterior, number_of_clones);
+
+            ThreadPool::instance()->parallel_for(number_of_clones, [&] (unsigned k)
+            {
+                const LogPosterior & clone = *clones[k];
+                const auto & descriptions = clone._parameter_descriptions;
+                const std::vector<Constraint> constraints(clone._log_likelihood.begin(), clone._log_likelihood.end());
+
+                for (unsigned i = k * chunk_size, i_end = std::min(number_of_jobs, (k + 1) * chunk_size) ; i < i_end ; ++i)
+                {
+                    for (unsigned j = 0 ; j < descriptions.size() ; ++j)
+                    {
+                        descriptions[j].parameter->set(point[j]);
+                    }
+
+                    work(clone, constraints, i);
+                }
+            });
+
+            release(posterior, clones);
+        }
+
+        // the lower and upper points of a finite difference in one parameter, limited to the parameter's range
+        static std::pair<double, double> stencil(const ParameterDescription & d, const double & x, const double & relative_step)
+        {
+            const double h = relative_step * (d.max - d.min);
+
+            return std::make_pair(std::max(x - h, d.min), std::min(x + h, d.max));
+        }
+
+        /*
+         * Determine the contributions to the gradient of those constraints whose observables provide
+         * exact derivatives with respect to the respective parameter. Their predictions are linearised
+         * in the parameter, which leaves only a finite difference of the likelihood blocks in the
+         * predictions, and no re-evaluation of the observables. The constraints treated this way
+         * are removed from the dependencies. If anything fails, the dependencies remain unchanged.
+         */
+        static void exact_gradient(const LogPosterior & posterior, const double * point, const double & relative_step,
+                std::vector<Dependencies> & dependencies, double * result)
+        {
+            const unsigned dim = dependencies.size();
+            std::fill(result, result + dim, 0.0);
+
+            if (std::all_of(dependencies.cbegin(), dependencies.cend(), [] (const Dependencies & d) { return d.constraints.empty(); }))
+                return;
+
+            auto clones = acquire(posterior, 1);
+            const LogPosterior & clone = *clones.front();
+            const auto & descriptions = clone._parameter_descriptions;
+            const std::vector<Constraint> constraints(clone._log_likelihood.begin(), clone._log_likelihood.end());
+            ObservableCache cache = clone._log_likelihood.observable_cache();
+
+            std::vector<Dependencies> numeric_dependencies(dependencies);
+            std::vector<double> values(dim, 0.0);
+            try
+            {
+                for (unsigned j = 0 ; j < dim ; ++j)
+                {
+                    descriptions[j].parameter->set(point[j]);
+                }
+
+                std::vector<std::vector<ObservableCache::Id>> ids(constraints.size());
+                for (unsigned c = 0 ; c < constraints.size() ; ++c)
+                {
+                    ids[c] = observable_ids(constraints, { c });
+                }
+                cache.update();
+
+                // the exact derivatives of each observable, retrieved once needed
+                std::map<ObservableCache::Id, std::map<Parameter::Id, double>> derivatives;
+                auto derivatives_of = [&] (const ObservableCache::Id & id) -> const std::map<Parameter::Id, double> &
+                {
+                    auto i = derivatives.find(id);
+                    if (derivatives.end() == i)
+                    {
+                        const auto d = cache.observable(id)->derivatives();
+                        i = derivatives.emplace(id, std::map<Parameter::Id, double>(d.cbegin(), d.cend())).first;
+                    }
+
+                    return i->second;
+                };
+
+                for (unsigned j = 0 ; j < dim ; ++j)
+                {
+                    const auto & d = descriptions[j];
+                    const Parameter::Id parameter_id = clone._parameters[d.parameter->name()].id();
+                    const auto x = stencil(d, point[j], relative_step);
+
+                    std::vector<unsigned> numeric;
+                    for (const auto & c : dependencies[j].constraints)
+                    {
+                        // the constraint is treated exactly only if all of its observables that use the parameter provide its derivative
+                        std::vector<std::tuple<ObservableCache::Id, double, double>> slopes;
+                        bool exact = true;
+                        for (const auto & id : ids[c])
+                        {
+                            const ObservablePtr o = cache.observable(id);
+
+                            // observables that do not report their parameters are assumed to depend on all parameters
+                            const bool uses_all = (o->ParameterUser::begin() == o->ParameterUser::end());
+                            if ((! uses_all) && (std::find(o->ParameterUser::begin(), o->ParameterUser::end(), parameter_id) == o->ParameterUser::end()))
+                                continue;
+
+                            const auto & derivatives = derivatives_of(id);
+                            auto i = derivatives.find(parameter_id);
+                            if (derivatives.end() == i)
+                            {
+                                exact = false;
+                                break;
+                            }
+
+                            slopes.emplace_back(id, cache[id], i->second);
+                        }
+
+                        if (! exact)
+                        {
+                            numeric.push_back(c);
+                            continue;
+                        }
+
+                        auto f = [&] (const double & x_j)
+                        {
+                            for (const auto & s : slopes)
+                            {
+                                cache.set_prediction(std::get<0>(s), std::get<1>(s) + (x_j - point[j]) * std::get<2>(s));
+                            }
+
+                            double value = 0.0;
+                            for (auto b = constraints[c].begin_blocks(), b_end = constraints[c].end_blocks() ; b != b_end ; ++b)
+                            {
+                                value += (**b).evaluate();
+                            }
+
+                            return value;
+                        };
+
+                        const double f_hi = f(x.second);
+                        const double f_lo = f(x.first);
+                        for (const auto & s : slopes)
+                        {
+                            cache.set_prediction(std::get<0>(s), std::get<1>(s));
+                        }
+
+                        values[j] += (f_hi - f_lo) / (x.second - x.first);
+                    }
+
+                    numeric_dependencies[j].constraints = std::move(numeric);
+                }
+
+                std::copy(values.cbegin(), values.cend(), result);
+                dependencies = std::move(numeric_dependencies);
+            }
+            catch (eos::Exception & e)
+            {
+                Log::instance()->message("LogPosterior::gradient", ll_warning)
+                    << "Exception encountered when propagating exact derivatives, falling back to finite differences: " << e.what();
+
+                // the clone's predictions might have been overridden
+                cache.invalidate();
+            }
+
+            release(posterior, clones);
+        }
+    };
+
     LogPosterior::LogPosterior(const LogLikelihood & log_likelihood) :
         _log_likelihood(log_likelihood),
         _parameters(log_likelihood.parameters()),
-        _informative_priors(0)
+        _informative_priors(0),
+        _clone_pool(new ClonePool)
     {
     }
 
@@ -71,6 +447,9 @@ namespace eos
         // then add to prior container
         _priors.push_back(prior_clone);
 
+        // existing clones lack the new prior
+        _clone_pool.reset(new ClonePool);
+
         return true;
     }
 
@@ -117,6 +496,182 @@ namespace eos
         return log_posterior();
     }
 
+    double
+    LogPosterior::evaluate_bounded(const double & bound) const
+    {
+        return bounded_log_posterior(bound);
+    }
+
+    void
+    LogPosterior::evaluate_batch(const double * points, const unsigned & n, const unsigned & dim, double * results) const
+    {
+        if (dim != _parameter_descriptions.size())
+            throw InternalError("LogPosterior::evaluate_batch(): expected points of dimension " + stringify(_parameter_descriptions.size()) + ", got " + stringify(dim));
+
+        if (0 == n)
+            return;
+
+        // one independent clone per thread, each working on a contiguous range of points
+        const unsigned number_of_clones = std::min(n, ThreadPool::instance()->number_of_threads());
+        const unsigned chunk_size = (n + number_of_clones - 1) / number_of_clones;
+
+        auto clones = Implementation<LogPosterior>::acquire(*this, number_of_clones);
+
+        ThreadPool::instance()->parallel_for(number_of_clones, [&] (unsigned k)
+        {
+            const LogPosterior & clone = *clones[k];
+            const auto & descriptions = clone._parameter_descriptions;
+
+            for (unsigned i = k * chunk_size, i_end = std::min(n, (k + 1) * chunk_size) ; i < i_end ; ++i)
+            {
+                const double * point = points + i * dim;
+
+                for (unsigned j = 0 ; j < dim ; ++j)
+                {
+                    descriptions[j].parameter->set(point[j]);
+                }
+
+                try
+                {
+                    results[i] = clone.log_posterior();
+                }
+                catch (eos::Exception & e)
+                {
+                    Log::instance()->message("LogPosterior::evaluate_batch", ll_error)
+                        << "Exception encountered when evaluating log(posterior) for point #" << i << ": " << e.what();
+                    results[i] = -std::numeric_limits<double>::infinity();
+                }
+            }
+        });
+
+        Implementation<LogPosterior>::release(*this, clones);
+    }
+
+    void
+    LogPosterior::gradient(const double * point, const unsigned & dim, double * result, const double & relative_step) const
+    {
+        if (dim != _parameter_descriptions.size())
+            throw InternalError("LogPosterior::gradient(): expected a point of dimension " + stringify(_parameter_descriptions.size()) + ", got " + stringify(dim));
+
+        auto dependencies = Implementation<LogPosterior>::dependencies(*this);
+
+        // the contributions of constraints whose observables provide exact derivatives
+        std::vector<double> exact(dim);
+        Implementation<LogPosterior>::exact_gradient(*this, point, relative_step, dependencies, exact.data());
+
+        Implementation<LogPosterior>::run(*this, point, dim, [&] (const LogPosterior & clone, const std::vector<Constraint> & constraints, const unsigned & j)
+        {
+            const auto & d = clone._parameter_descriptions[j];
+            const auto x = Implementation<LogPosterior>::stencil(d, point[j], relative_step);
+
+            try
+            {
+                d.parameter->set(x.second);
+                const double f_hi = Implementation<LogPosterior>::partial_log_posterior(clone, constraints, dependencies[j]);
+                d.parameter->set(x.first);
+                const double f_lo = Implementation<LogPosterior>::partial_log_posterior(clone, constraints, dependencies[j]);
+
+                result[j] = (f_hi - f_lo) / (x.second - x.first) + exact[j];
+            }
+            catch (eos::Exception & e)
+            {
+                Log::instance()->message("LogPosterior::gradient", ll_error)
+                    << "Exception encountered when evaluating the derivative with respect to '" << d.parameter->name() << "': " << e.what();
+                result[j] = std::numeric_limits<double>::quiet_NaN();
+            }
+        });
+    }
+
+    void
+    LogPosterior::hessian(const double * point, const unsigned & dim, double * result, const double & relative_step) const
+    {
+        using Dependencies = Implementation<LogPosterior>::Dependencies;
+
+        if (dim != _parameter_descriptions.size())
+            throw InternalError("LogPosterior::hessian(): expected a point of dimension " + stringify(_parameter_descriptions.size()) + ", got " + stringify(dim));
+
+        const auto dependencies = Implementation<LogPosterior>::dependencies(*this);
+
+        // one job per diagonal element, and one job per off-diagonal element whose parameters share a dependency
+        std::vector<std::tuple<unsigned, unsigned, Dependencies>> jobs;
+        std::fill(result, result + dim * dim, 0.0);
+        for (unsigned j = 0 ; j < dim ; ++j)
+        {
+            jobs.emplace_back(j, j, dependencies[j]);
+
+            for (unsigned k = j + 1 ; k < dim ; ++k)
+            {
+                auto common = Implementation<LogPosterior>::intersection(dependencies[j], dependencies[k]);
+                if (common.priors.empty() && common.constraints.empty())
+                    continue;
+
+                jobs.emplace_back(j, k, std::move(common));
+            }
+        }
+
+        Implementation<LogPosterior>::run(*this, point, jobs.size(), [&] (const LogPosterior & clone, const std::vector<Constraint> & constraints, const unsigned & i)
+        {
+            const unsigned j = std::get<0>(jobs[i]), k = std::get<1>(jobs[i]);
+            const auto & d_j = clone._parameter_descriptions[j], & d_k = clone._parameter_descriptions[k];
+            const auto f = [&] () { return Implementation<LogPosterior>::partial_log_posterior(clone, constraints, std::get<2>(jobs[i])); };
+
+            double value;
+            try
+            {
+                if (j == k)
+                {
+                    const double x = point[j], h = relative_step * (d_j.max - d_j.min);
+
+                    // use a one-sided stencil at the boundaries of the parameter's range
+                    double s_lo = -h, s_hi = +h;
+                    if (x - h < d_j.min)
+                    {
+                        s_lo = +h; s_hi = +2.0 * h;
+                    }
+                    else if (x + h > d_j.max)
+                    {
+                        s_lo = -2.0 * h; s_hi = -h;
+                    }
+
+                    const double f_0 = f();
+                    d_j.parameter->set(x + s_lo);
+                    const double f_lo = f();
+                    d_j.parameter->set(x + s_hi);
+                    const double f_hi = f();
+
+                    // second divided difference on the points x, x + s_lo, x + s_hi
+                    value = 2.0 * (f_0 / (s_lo * s_hi) + f_lo / (s_lo * (s_lo - s_hi)) + f_hi / (s_hi * (s_hi - s_lo)));
+                }
+                else
+                {
+                    const auto x_j = Implementation<LogPosterior>::stencil(d_j, point[j], relative_step);
+                    const auto x_k = Implementation<LogPosterior>::stencil(d_k, point[k], relative_step);
+
+                    d_j.parameter->set(x_j.second); d_k.parameter->set(x_k.second);
+                    const double f_hi_hi = f();
+                    d_k.parameter->set(x_k.first);
+                    const double f_hi_lo = f();
+                    d_j.parameter->set(x_j.first);
+                    const double f_lo_lo = f();
+                    d_k.parameter->set(x_k.second);
+                    const double f_lo_hi = f();
+
+                    value = (f_hi_hi - f_hi_lo - f_lo_hi + f_lo_lo) / ((x_j.second - x_j.first) * (x_k.second - x_k.first));
+                }
+            }
+            catch (eos::Exception & e)
+            {
+                Log::instance()->message("LogPosterior::hessian", ll_error)
+                    << "Exception encountered when evaluating the second derivative with respect to '"
+                    << d_j.parameter->name() << "' and '" << d_k.parameter->name() << "': " << e.what();
+                value = std::numeric_limits<double>::quiet_NaN();
+            }
+
+            result[j * dim + k] = value;
+            result[k * dim + j] = value;
+        });
+    }
+
     Density::Iterator
     LogPosterior::begin() const
     {
@@ -158,7 +713,38 @@ namespace eos
     double
     LogPosterior::log_posterior() const
     {
-        return log_prior() + _log_likelihood();
+        static Profiler::Section * section = Profiler::instance()->section("posterior", "log_posterior");
+
+        const bool profile = Profiler::instance()->enabled();
+        const auto start = profile ? Profiler::Clock::now() : Profiler::Clock::time_point();
+
+        const double prior = log_prior();
+
+        // no need to evaluate any observable outside the support of the prior
+        const double result = (-std::numeric_limits<double>::infinity() == prior) ? prior : prior + _log_likelihood();
+
+        if (profile)
+            Profiler::instance()->record(section, start, Profiler::Clock::now(), result);
+
+        return result;
+    }
+
+    double
+    LogPosterior::bounded_log_posterior(const double & bound) const
+    {
+        // reject points outside the parameter ranges; flat priors do not do this on their own
+        for (const auto & d : _parameter_descriptions)
+        {
+            const double value = d.parameter->evaluate();
+            if ((value < d.min) || (value > d.max))
+                return -std::numeric_limits<double>::infinity();
+        }
+
+        const double prior = log_prior();
+        if (! std::isfinite(prior))
+            return -std::numeric_limits<double>::infinity();
+
+        return prior + _log_likelihood.bounded_evaluation(bound - prior);
     }
 
     double
@@ -30,6 +30,7 @@
 #include <eos/utils/verify.hh>
 #include <eos/utils/wrapped_forward_iterator.hh>
 
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -66,6 +67,60 @@ namespace eos
 
             virtual double evaluate() const;
 
+            /// Evaluate the log(posterior), but return -inf as soon as it is known to fall below a given bound.
+            virtual double evaluate_bounded(const double & bound) const;
+
+            /*!
+             * Evaluate the log(posterior) for a batch of parameter points.
+             *
+             * The points are distributed across the ThreadPool. Each thread works on
+             * an independent clone of this LogPosterior, including its LogLikelihood
+             * and ObservableCache. The clones are kept and reused by subsequent calls.
+             * The state of this object remains unchanged.
+             * Points for which the evaluation fails yield -inf.
+             *
+             * @param points      Row-major array of n x dim parameter values, with the
+             *                    columns in the order of parameter_descriptions().
+             * @param n           The number of parameter points.
+             * @param dim         The number of varied parameters.
+             * @param results     Array of n elements that receives the log(posterior) values.
+             */
+            void evaluate_batch(const double * points, const unsigned & n, const unsigned & dim, double * results) const;
+
+            /*!
+             * Compute the gradient of the log(posterior) by central finite differences.
+             *
+             * Each component re-evaluates only those priors and constraints that depend on
+             * the respective parameter, as determined from the parameters used by the constraints'
+             * observables. Constraints whose observables provide exact derivatives with respect to
+             * the parameter, see Observable::derivatives(), are not re-evaluated at all: their
+             * predictions are linearised in the parameter, and only the likelihood blocks are
+             * differentiated numerically in the predictions.
+             * The components are computed in parallel on independent clones of
+             * this LogPosterior; the state of this object remains unchanged.
+             * Components for which the evaluation fails yield NaN.
+             *
+             * @param point         Array of dim parameter values, in the order of parameter_descriptions().
+             * @param dim           The number of varied parameters.
+             * @param result        Array of dim elements that receives the gradient.
+             * @param relative_step The step size relative to each parameter's range.
+             */
+            void gradient(const double * point, const unsigned & dim, double * result, const double & relative_step = 1.0e-5) const;
+
+            /*!
+             * Compute the Hessian matrix of the log(posterior) by finite differences.
+             *
+             * As for gradient(), only the priors and constraints that depend on the respective
+             * parameters are re-evaluated. Off-diagonal elements for pairs of parameters
+             * that do not enter any common prior or constraint vanish identically and are not evaluated.
+             *
+             * @param point         Array of dim parameter values, in the order of parameter_descriptions().
+             * @param dim           The number of varied parameters.
+             * @param result        Row-major array of dim x dim elements that receives the Hessian matrix.
+             * @param relative_step The step size relative to each parameter's range.
+             */
+            void hessian(const double * point, const unsigned & dim, double * result, const double & relative_step = 1.0e-4) const;
+
             virtual Iterator begin() const;
             virtual Iterator end() const;
             ///@}
@@ -107,10 +162,29 @@ namespace eos
              */
             LogPriorPtr log_prior(const std::string & name) const;
 
-            /// Retrieve the overall Log(posterior)
-            /// Incorporate normalization constant, the evidence here in getter if available.
+            /*!
+             * Retrieve the overall Log(posterior)
+             * Incorporate normalization constant, the evidence here in getter if available.
+             *
+             * @note If the log(prior) is -inf, the log(likelihood) is not evaluated. In this case,
+             *       the predictions within the ObservableCache remain those of the last point for which
+             *       the log(likelihood) has been evaluated, until the cache is updated.
+             */
             double log_posterior() const;
 
+            /*!
+             * Retrieve the overall Log(posterior) if it exceeds a given bound, and -inf otherwise.
+             *
+             * Points outside the parameter ranges or the support of the prior are rejected
+             * before any observable is evaluated. Otherwise the constraints are evaluated
+             * by means of LogLikelihood::bounded_evaluation(). As with log_posterior(), the
+             * predictions within the ObservableCache are only up to date for the constraints
+             * that have been evaluated.
+             *
+             * @param bound The value below which the log(posterior) is of no interest.
+             */
+            double bounded_log_posterior(const double & bound) const;
+
             /*!
              * Add forward iterator and corresponding helper functions
              */
@@ -159,6 +233,11 @@ namespace eos
 
             /// names of all parameters. prevent using a parameter twice
             std::set<std::string> _parameter_names;
+
+            /// Independent clones for the parallel evaluation, built on first use and reused thereafter.
+            struct ClonePool;
+
+            std::shared_ptr<ClonePool> _clone_pool;
     };
 
     extern template class WrappedForwardIterator<LogPosterior::PriorIteratorTag, const LogPriorPtr>;
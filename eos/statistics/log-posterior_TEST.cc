@@ -21,10 +21,61 @@
 #include <config.h>
 
 #include <eos/statistics/log-posterior_TEST.hh>
+#include <eos/utils/expression.hh>
+#include <eos/utils/expression-observable.hh>
+
+#include <atomic>
+#include <memory>
 
 using namespace test;
 using namespace eos;
 
+namespace
+{
+    // the square of a parameter, which counts its evaluations and optionally provides its exact derivative
+    struct SquareTestObservable :
+        public TestObservable
+    {
+            std::shared_ptr<std::atomic<unsigned>> evaluations;
+
+            bool exact;
+
+            SquareTestObservable(const Parameters & p, const QualifiedName & mass_name, const std::shared_ptr<std::atomic<unsigned>> & evaluations, const bool & exact) :
+                TestObservable(p, Kinematics(), mass_name),
+                evaluations(evaluations),
+                exact(exact)
+            {
+                // distinguish from the TestObservable of the same parameter within the cache
+                set_option("square", "true");
+            }
+
+            virtual double evaluate() const
+            {
+                ++(*evaluations);
+
+                return mass() * mass();
+            }
+
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives() const
+            {
+                if (! exact)
+                    return {};
+
+                return { { mass.id(), 2.0 * mass() } };
+            }
+
+            virtual ObservablePtr clone() const
+            {
+                return ObservablePtr(new SquareTestObservable(p.clone(), mass_name, evaluations, exact));
+            }
+
+            virtual ObservablePtr clone(const Parameters & parameters) const
+            {
+                return ObservablePtr(new SquareTestObservable(parameters, mass_name, evaluations, exact));
+            }
+    };
+}
+
 class LogPosteriorTest :
     public TestCase
 {
@@ -122,6 +173,190 @@ class LogPosteriorTest :
                 TEST_CHECK_EQUAL(log_posterior.log_prior(), clone->log_prior());
             }
 
+            // batched evaluation
+            {
+                LogPosterior log_posterior = make_log_posterior(false);
+                log_posterior.add(LogPrior::Flat(log_posterior.parameters(), "mass::c", ParameterRange{ 1.4, 2.2 }), true);
+
+                const double m_b = log_posterior.parameters()["mass::b(MSbar)"];
+
+                static const unsigned n = 17, dim = 2;
+                std::vector<double> points(n * dim);
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    points[i * dim + 0] = 4.0 + 0.05 * i;
+                    points[i * dim + 1] = 1.5 + 0.02 * i;
+                }
+
+                std::vector<double> results(n, 0.0);
+                log_posterior.evaluate_batch(points.data(), n, dim, results.data());
+
+                auto reference = log_posterior.old_clone();
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    (*reference)[0]->set(points[i * dim + 0]);
+                    (*reference)[1]->set(points[i * dim + 1]);
+
+                    TEST_CHECK_RELATIVE_ERROR(results[i], reference->evaluate(), eps);
+                }
+
+                // the original object remains unchanged
+                TEST_CHECK_EQUAL(m_b, double(log_posterior.parameters()["mass::b(MSbar)"]));
+
+                // mismatching dimension
+                TEST_CHECK_THROWS(InternalError, log_posterior.evaluate_batch(points.data(), n, 1, results.data()));
+            }
+
+            // batched evaluation of a constraint on an expression observable
+            {
+                Parameters parameters = Parameters::Defaults();
+
+                // m_b / m_c = 3.2 +- 0.2
+                const exp::Expression ratio = exp::BinaryExpression('/',
+                        exp::ObservableNameExpression("mass::b(MSbar)", exp::KinematicsSpecification()),
+                        exp::ObservableNameExpression("mass::c", exp::KinematicsSpecification()));
+                LogLikelihood llh(parameters);
+                llh.add(ObservablePtr(new ExpressionObservable("test::m_b/m_c", parameters, Kinematics(), Options(), ratio)), 3.0, 3.2, 3.4);
+
+                LogPosterior log_posterior(llh);
+                log_posterior.add(LogPrior::Flat(parameters, "mass::b(MSbar)", ParameterRange{ 4.0, 4.5 }), false);
+                log_posterior.add(LogPrior::Flat(parameters, "mass::c", ParameterRange{ 1.2, 1.6 }), false);
+
+                static const unsigned n = 5, dim = 2;
+                std::vector<double> points(n * dim);
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    points[i * dim + 0] = 4.1 + 0.05 * i;
+                    points[i * dim + 1] = 1.3 + 0.02 * i;
+                }
+
+                // the clones add the sub-observables of the expression to their own caches
+                std::vector<double> results(n, 0.0);
+                log_posterior.evaluate_batch(points.data(), n, dim, results.data());
+
+                auto reference = log_posterior.old_clone();
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    (*reference)[0]->set(points[i * dim + 0]);
+                    (*reference)[1]->set(points[i * dim + 1]);
+
+                    TEST_CHECK(std::isfinite(results[i]));
+                    TEST_CHECK_RELATIVE_ERROR(results[i], reference->evaluate(), eps);
+                }
+
+                // log(posterior) = -(m_b / m_c - 3.2)^2 / (2 * 0.2^2) + const
+                const std::vector<double> point{ 4.2, 1.4 };
+                const double r = 4.2 / 1.4;
+                std::vector<double> gradient(dim, 0.0);
+                log_posterior.gradient(point.data(), dim, gradient.data());
+                TEST_CHECK_NEARLY_EQUAL(gradient[0], -(r - 3.2) / 0.04 / 1.4,             1e-4);
+                TEST_CHECK_NEARLY_EQUAL(gradient[1], +(r - 3.2) / 0.04 * 4.2 / (1.4 * 1.4), 1e-4);
+            }
+
+            // gradient and Hessian
+            {
+                LogPosterior log_posterior = make_log_posterior(false);
+                log_posterior.add(LogPrior::Flat(log_posterior.parameters(), "mass::c", ParameterRange{ 1.0, 1.6 }), true);
+
+                // a second constraint that only depends on mass::c
+                LogLikelihood llh = log_posterior.log_likelihood();
+                llh.add(ObservablePtr(new ObservableStub(log_posterior.parameters(), "mass::c")), 1.2, 1.3, 1.4);
+
+                const double m_b = log_posterior.parameters()["mass::b(MSbar)"];
+
+                static const unsigned dim = 2;
+                const std::vector<double> point{ 4.25, 1.35 };
+
+                // log(posterior) = -(m_b - 4.4)^2 / (2 * 0.1^2) - (m_b - 4.2)^2 / (2 * 0.1^2) - (m_c - 1.3)^2 / (2 * 0.1^2) + const
+                std::vector<double> gradient(dim, 0.0);
+                log_posterior.gradient(point.data(), dim, gradient.data());
+                TEST_CHECK_NEARLY_EQUAL(gradient[0], -(4.25 - 4.4) / 0.01 - (4.25 - 4.2) / 0.01, 1e-5);
+                TEST_CHECK_NEARLY_EQUAL(gradient[1], -(1.35 - 1.3) / 0.01,                       1e-5);
+
+                std::vector<double> hessian(dim * dim, 1.0);
+                log_posterior.hessian(point.data(), dim, hessian.data());
+                TEST_CHECK_NEARLY_EQUAL(hessian[0], -200.0, 1e-3);
+                TEST_CHECK_NEARLY_EQUAL(hessian[3], -100.0, 1e-3);
+                // no common dependency
+                TEST_CHECK_EQUAL(hessian[1], 0.0);
+                TEST_CHECK_EQUAL(hessian[2], 0.0);
+
+                // one-sided differences at the boundary of the parameter range
+                const std::vector<double> boundary{ 4.9, 1.0 };
+                log_posterior.hessian(boundary.data(), dim, hessian.data());
+                TEST_CHECK_NEARLY_EQUAL(hessian[0], -200.0, 1e-3);
+                TEST_CHECK_NEARLY_EQUAL(hessian[3], -100.0, 1e-3);
+
+                // the original object remains unchanged
+                TEST_CHECK_EQUAL(m_b, double(log_posterior.parameters()["mass::b(MSbar)"]));
+
+                // mismatching dimension
+                TEST_CHECK_THROWS(InternalError, log_posterior.gradient(point.data(), 1, gradient.data()));
+                TEST_CHECK_THROWS(InternalError, log_posterior.hessian(point.data(), 3, hessian.data()));
+
+                // the clones are reused across calls, and follow constraints added later on
+                log_posterior.gradient(point.data(), dim, gradient.data());
+                TEST_CHECK_NEARLY_EQUAL(gradient[1], -(1.35 - 1.3) / 0.01,                       1e-5);
+
+                llh.add(ObservablePtr(new ObservableStub(log_posterior.parameters(), "mass::c")), 1.3, 1.4, 1.5);
+                log_posterior.gradient(point.data(), dim, gradient.data());
+                TEST_CHECK_NEARLY_EQUAL(gradient[1], -(1.35 - 1.3) / 0.01 - (1.35 - 1.4) / 0.01, 1e-5);
+            }
+
+            // gradient with exact derivatives of the observables
+            {
+                Parameters parameters = Parameters::Defaults();
+                auto exact_evaluations   = std::make_shared<std::atomic<unsigned>>(0);
+                auto numeric_evaluations = std::make_shared<std::atomic<unsigned>>(0);
+
+                // m_c^2 = 1.6 +- 0.1 provides its derivative, m_b^2 = 17.5 +- 0.1 does not
+                LogLikelihood llh(parameters);
+                llh.add(ObservablePtr(new SquareTestObservable(parameters, "mass::c", exact_evaluations, true)), 1.5, 1.6, 1.7);
+                llh.add(ObservablePtr(new SquareTestObservable(parameters, "mass::b(MSbar)", numeric_evaluations, false)), 17.4, 17.5, 17.6);
+
+                LogPosterior log_posterior(llh);
+                log_posterior.add(LogPrior::Flat(parameters, "mass::c", ParameterRange{ 1.0, 1.6 }), false);
+                log_posterior.add(LogPrior::Flat(parameters, "mass::b(MSbar)", ParameterRange{ 4.0, 4.5 }), false);
+
+                static const unsigned dim = 2;
+                const std::vector<double> point{ 1.3, 4.2 };
+
+                // log(posterior) = -(m_c^2 - 1.6)^2 / (2 * 0.1^2) - (m_b^2 - 17.5)^2 / (2 * 0.1^2) + const
+                std::vector<double> gradient(dim, 0.0);
+                log_posterior.gradient(point.data(), dim, gradient.data());
+                TEST_CHECK_RELATIVE_ERROR(gradient[0], -(1.3 * 1.3 - 1.6)   / 0.01 * 2.0 * 1.3, 1e-6);
+                TEST_CHECK_RELATIVE_ERROR(gradient[1], -(4.2 * 4.2 - 17.5) / 0.01 * 2.0 * 4.2, 1e-6);
+
+                // the exact constraint is only evaluated at the point itself, the other one also on its stencil
+                *exact_evaluations = 0;
+                *numeric_evaluations = 0;
+                const std::vector<double> other_point{ 1.25, 4.15 };
+                log_posterior.gradient(other_point.data(), dim, gradient.data());
+                TEST_CHECK_RELATIVE_ERROR(gradient[0], -(1.25 * 1.25 - 1.6)   / 0.01 * 2.0 * 1.25, 1e-6);
+                TEST_CHECK_RELATIVE_ERROR(gradient[1], -(4.15 * 4.15 - 17.5) / 0.01 * 2.0 * 4.15, 1e-6);
+                TEST_CHECK_EQUAL(1u, exact_evaluations->load());
+                TEST_CHECK(numeric_evaluations->load() >= 3u);
+            }
+
+            // a constraint is only treated exactly if all of its observables provide the derivative
+            {
+                Parameters parameters = Parameters::Defaults();
+                auto evaluations = std::make_shared<std::atomic<unsigned>>(0);
+
+                // m_c^2 and m_c, where only the former provides its derivative
+                LogLikelihood llh(parameters);
+                llh.add(ObservablePtr(new SquareTestObservable(parameters, "mass::c", evaluations, true)), 1.5, 1.6, 1.7);
+                llh.add(ObservablePtr(new TestObservable(parameters, Kinematics(), "mass::c")), 1.2, 1.3, 1.4);
+
+                LogPosterior log_posterior(llh);
+                log_posterior.add(LogPrior::Flat(parameters, "mass::c", ParameterRange{ 1.0, 1.6 }), false);
+
+                const std::vector<double> point{ 1.35 };
+                std::vector<double> gradient(1, 0.0);
+                log_posterior.gradient(point.data(), 1, gradient.data());
+                TEST_CHECK_RELATIVE_ERROR(gradient[0], -(1.35 * 1.35 - 1.6) / 0.01 * 2.0 * 1.35 - (1.35 - 1.3) / 0.01, 1e-6);
+            }
+
             // nuisance properties.nuisance())
             {
                 LogPosterior log_posterior = make_log_posterior(false);
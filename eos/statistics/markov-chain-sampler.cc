@@ -0,0 +1,406 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/markov-chain-sampler.hh>
+#include <eos/statistics/sampling-impl.hh>
+#include <eos/utils/density.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/power_of.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/sample-store.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_rng.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+namespace eos
+{
+    namespace implementation
+    {
+        struct MarkovChain
+        {
+            DensityPtr density;
+
+            std::vector<ParameterDescription> descriptions;
+
+            unsigned dim;
+
+            gsl_rng * rng;
+
+            // current state of the chain
+            std::vector<double> current;
+
+            double current_log_density;
+
+            // proposal density, a multivariate Gaussian centered around the current point
+            std::vector<double> covariance;
+
+            std::vector<double> cholesky_factor;
+
+            double scale;
+
+            // draw the acceptance threshold before evaluating the proposal
+            bool delayed_acceptance;
+
+            bool adapted;
+
+            // accumulated history for the adaptation of the proposal
+            unsigned long history_size;
+
+            std::vector<double> history_sum;
+
+            std::vector<double> history_sum_of_products;
+
+            // statistics
+            unsigned long accepted;
+
+            unsigned long iterations;
+
+            MarkovChain(const DensityPtr & density, const unsigned long & seed, const double & initial_scale, const bool & delayed_acceptance) :
+                density(density),
+                rng(gsl_rng_alloc(gsl_rng_mt19937)),
+                scale(1.0),
+                delayed_acceptance(delayed_acceptance),
+                adapted(false),
+                history_size(0),
+                accepted(0),
+                iterations(0)
+            {
+                gsl_rng_set(rng, seed);
+
+                for (auto d = density->begin(), d_end = density->end() ; d != d_end ; ++d)
+                {
+                    descriptions.push_back(*d);
+                }
+                dim = descriptions.size();
+
+                // initial covariance: scaled variance of a flat distribution on each parameter's range
+                covariance.resize(dim * dim, 0.0);
+                for (unsigned i = 0 ; i < dim ; ++i)
+                {
+                    covariance[i * dim + i] = initial_scale * power_of<2>(descriptions[i].max - descriptions[i].min) / 12.0;
+                }
+                cholesky_factor = covariance;
+                if (! sampling::cholesky(cholesky_factor, dim))
+                    throw InternalError("MarkovChainSampler: parameter ranges must not be empty");
+
+                history_sum.resize(dim, 0.0);
+                history_sum_of_products.resize(dim * dim, 0.0);
+
+                // start from a random point with finite density
+                current.resize(dim);
+                current_log_density = -std::numeric_limits<double>::infinity();
+                for (unsigned attempt = 0 ; (attempt < 100) && ! std::isfinite(current_log_density) ; ++attempt)
+                {
+                    for (unsigned i = 0 ; i < dim ; ++i)
+                    {
+                        current[i] = descriptions[i].min + gsl_rng_uniform(rng) * (descriptions[i].max - descriptions[i].min);
+                    }
+
+                    current_log_density = sampling::evaluate(*density, descriptions, current.data());
+                }
+
+                if (! std::isfinite(current_log_density))
+                    throw InternalError("MarkovChainSampler: could not find a starting point with finite density");
+            }
+
+            ~MarkovChain()
+            {
+                gsl_rng_free(rng);
+            }
+
+            void step()
+            {
+                std::vector<double> z(dim), proposal(dim);
+                for (unsigned i = 0 ; i < dim ; ++i)
+                {
+                    z[i] = gsl_ran_ugaussian(rng);
+                }
+                sampling::transform(cholesky_factor, dim, current.data(), z.data(), std::sqrt(scale), proposal.data());
+
+                // the acceptance threshold does not depend on the proposal's density, and can be drawn first
+                const double log_u = std::log(gsl_rng_uniform_pos(rng));
+                const double bound = delayed_acceptance ? current_log_density + log_u : -std::numeric_limits<double>::infinity();
+
+                const double proposal_log_density = sampling::evaluate(*density, descriptions, proposal.data(), bound);
+
+                ++iterations;
+                if (log_u < proposal_log_density - current_log_density)
+                {
+                    current.swap(proposal);
+                    current_log_density = proposal_log_density;
+                    ++accepted;
+                }
+            }
+
+            void record_history()
+            {
+                ++history_size;
+                for (unsigned i = 0 ; i < dim ; ++i)
+                {
+                    history_sum[i] += current[i];
+
+                    for (unsigned j = 0 ; j <= i ; ++j)
+                    {
+                        history_sum_of_products[i * dim + j] += current[i] * current[j];
+                    }
+                }
+            }
+
+            // adapt the proposal to the covariance of all samples seen so far
+            void adapt()
+            {
+                static const double minimal_acceptance_rate = 0.15, maximal_acceptance_rate = 0.35, scale_multiplier = 1.5;
+
+                const double acceptance_rate = double(accepted) / iterations;
+
+                if (! adapted)
+                {
+                    // first adaptation; use the optimal scale for Gaussian targets
+                    scale = 2.38 * 2.38 / dim;
+                    adapted = true;
+                }
+                else if (acceptance_rate > maximal_acceptance_rate)
+                {
+                    scale *= scale_multiplier;
+                }
+                else if (acceptance_rate < minimal_acceptance_rate)
+                {
+                    scale /= scale_multiplier;
+                }
+
+                if (history_size > dim + 1)
+                {
+                    std::vector<double> empirical_covariance(dim * dim);
+                    for (unsigned i = 0 ; i < dim ; ++i)
+                    {
+                        for (unsigned j = 0 ; j <= i ; ++j)
+                        {
+                            const double value = (history_sum_of_products[i * dim + j] - history_sum[i] * history_sum[j] / history_size) / (history_size - 1);
+                            empirical_covariance[i * dim + j] = value;
+                            empirical_covariance[j * dim + i] = value;
+                        }
+                    }
+
+                    // keep the previous proposal if the empirical covariance is degenerate
+                    std::vector<double> factor = empirical_covariance;
+                    if (sampling::cholesky(factor, dim))
+                    {
+                        covariance.swap(empirical_covariance);
+                        cholesky_factor.swap(factor);
+                    }
+                }
+
+                accepted = 0;
+                iterations = 0;
+            }
+        };
+    }
+
+    template <>
+    struct Implementation<MarkovChainSampler>
+    {
+        MarkovChainSampler::Config config;
+
+        unsigned dim;
+
+        std::vector<std::unique_ptr<implementation::MarkovChain>> chains;
+
+        std::vector<double> samples;
+
+        std::vector<double> log_densities;
+
+        double acceptance_rate;
+
+        Implementation(const DensityPtr & density, const MarkovChainSampler::Config & config) :
+            config(config),
+            dim(0),
+            acceptance_rate(0.0)
+        {
+            for (unsigned c = 0 ; c < config.number_of_chains ; ++c)
+            {
+                chains.push_back(std::unique_ptr<implementation::MarkovChain>(
+                        new implementation::MarkovChain(density->clone(), config.seed + c, config.initial_scale, config.delayed_acceptance)));
+            }
+
+            dim = chains.front()->dim;
+        }
+
+        void run()
+        {
+            ThreadPool * pool = ThreadPool::instance();
+
+            for (unsigned p = 0 ; p < config.preruns ; ++p)
+            {
+                pool->parallel_for(chains.size(), [&] (unsigned c)
+                {
+                    auto & chain = *chains[c];
+
+                    for (unsigned i = 0 ; i < config.prerun_samples ; ++i)
+                    {
+                        chain.step();
+                        chain.record_history();
+                    }
+                });
+
+                double rate = 0.0;
+                for (auto & chain : chains)
+                {
+                    rate += double(chain->accepted) / chain->iterations;
+                    chain->adapt();
+                }
+
+                Log::instance()->message("MarkovChainSampler::run", ll_informational)
+                    << "Prerun " << p << ": average acceptance rate is " << 100.0 * rate / chains.size() << "%";
+            }
+
+            const unsigned samples_per_chain = config.samples;
+            samples.resize(chains.size() * samples_per_chain * dim);
+            log_densities.resize(chains.size() * samples_per_chain);
+
+            // when writing to a store, commit the samples in blocks, such that an interrupted run retains the completed blocks
+            std::unique_ptr<SampleStoreWriter> store;
+            if (! config.output.empty())
+                store.reset(new SampleStoreWriter(config.output, dim + 1));
+
+            static const unsigned samples_per_block = 100;
+            const unsigned block_size = store ? samples_per_block : samples_per_chain;
+
+            for (unsigned begin = 0 ; begin < samples_per_chain ; begin += block_size)
+            {
+                const unsigned end = std::min(samples_per_chain, begin + block_size);
+
+                pool->parallel_for(chains.size(), [&] (unsigned c)
+                {
+                    auto & chain = *chains[c];
+
+                    for (unsigned i = begin ; i < end ; ++i)
+                    {
+                        for (unsigned s = 0 ; s < config.stride ; ++s)
+                        {
+                            chain.step();
+                        }
+
+                        const unsigned row = c * samples_per_chain + i;
+                        std::copy(chain.current.cbegin(), chain.current.cend(), samples.begin() + row * dim);
+                        log_densities[row] = chain.current_log_density;
+                    }
+                });
+
+                if (! store)
+                    continue;
+
+                std::vector<double> output_row(dim + 1);
+                for (unsigned c = 0 ; c < chains.size() ; ++c)
+                {
+                    for (unsigned i = begin ; i < end ; ++i)
+                    {
+                        const unsigned row = c * samples_per_chain + i;
+                        std::copy(samples.cbegin() + row * dim, samples.cbegin() + (row + 1) * dim, output_row.begin());
+                        output_row[dim] = log_densities[row];
+                        store->append(output_row.data());
+                    }
+                }
+                store->flush();
+            }
+
+            acceptance_rate = 0.0;
+            for (auto & chain : chains)
+            {
+                acceptance_rate += double(chain->accepted) / chain->iterations;
+            }
+            acceptance_rate /= chains.size();
+
+            Log::instance()->message("MarkovChainSampler::run", ll_informational)
+                << "Main run: average acceptance rate is " << 100.0 * acceptance_rate << "%";
+        }
+    };
+
+    MarkovChainSampler::MarkovChainSampler(const DensityPtr & density, const Config & config) :
+        PrivateImplementationPattern<MarkovChainSampler>(new Implementation<MarkovChainSampler>(density, config))
+    {
+    }
+
+    MarkovChainSampler::~MarkovChainSampler()
+    {
+    }
+
+    void
+    MarkovChainSampler::run()
+    {
+        _imp->run();
+    }
+
+    unsigned
+    MarkovChainSampler::dimension() const
+    {
+        return _imp->dim;
+    }
+
+    unsigned
+    MarkovChainSampler::number_of_chains() const
+    {
+        return _imp->chains.size();
+    }
+
+    const std::vector<double> &
+    MarkovChainSampler::samples() const
+    {
+        return _imp->samples;
+    }
+
+    const std::vector<double> &
+    MarkovChainSampler::log_densities() const
+    {
+        return _imp->log_densities;
+    }
+
+    double
+    MarkovChainSampler::acceptance_rate() const
+    {
+        return _imp->acceptance_rate;
+    }
+
+    MarkovChainSampler::Config::Config() :
+        number_of_chains(1, 4096, 4),
+        prerun_samples(1, std::numeric_limits<unsigned>::max(), 500),
+        preruns(0, std::numeric_limits<unsigned>::max(), 3),
+        samples(1, std::numeric_limits<unsigned>::max(), 1000),
+        stride(1, std::numeric_limits<unsigned>::max(), 5),
+        initial_scale(std::numeric_limits<double>::epsilon(), 1.0, 0.1),
+        seed(1),
+        delayed_acceptance(false),
+        output("")
+    {
+    }
+
+    MarkovChainSampler::Config
+    MarkovChainSampler::Config::Default()
+    {
+        Config result;
+        result.number_of_chains = std::min(4096u, ThreadPool::instance()->number_of_threads());
+
+        return result;
+    }
+}
@@ -0,0 +1,138 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_MARKOV_CHAIN_SAMPLER_HH
+#define EOS_GUARD_EOS_STATISTICS_MARKOV_CHAIN_SAMPLER_HH 1
+
+#include <eos/utils/density-fwd.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+#include <eos/utils/verify.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * MarkovChainSampler draws samples from a Density by means of several
+     * independent, adaptive Metropolis-Hastings chains.
+     *
+     * Each chain works on its own clone of the density, and all chains
+     * run in parallel on the ThreadPool. The multivariate Gaussian proposal
+     * of each chain is adapted during a number of preruns to the covariance
+     * of the samples obtained so far. Its scale is adjusted to keep the
+     * acceptance rate between 15% and 35%. Samples of the preruns are discarded.
+     */
+    class MarkovChainSampler :
+        public PrivateImplementationPattern<MarkovChainSampler>
+    {
+        public:
+            struct Config;
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param density The density from which samples shall be drawn.
+             * @param config  The configuration of the sampler.
+             */
+            MarkovChainSampler(const DensityPtr & density, const Config & config);
+
+            /// Destructor.
+            ~MarkovChainSampler();
+            ///@}
+
+            /// Carry out the preruns, followed by the main run.
+            void run();
+
+            ///@name Accessors
+            ///@{
+            /// The number of varied parameters.
+            unsigned dimension() const;
+
+            /// The number of chains.
+            unsigned number_of_chains() const;
+
+            /*!
+             * The samples of the main run, as row-major array with one
+             * sample per row. The samples of chain i occupy a contiguous range of rows.
+             */
+            const std::vector<double> & samples() const;
+
+            /// The values of the log(density) for each sample of the main run.
+            const std::vector<double> & log_densities() const;
+
+            /// The acceptance rate of the main run, averaged over all chains.
+            double acceptance_rate() const;
+            ///@}
+    };
+
+    /*!
+     * Holds the configuration of a MarkovChainSampler.
+     */
+    struct MarkovChainSampler::Config
+    {
+        private:
+            /// Constructor.
+            Config();
+
+        public:
+            /// Named constructor for the default configuration.
+            static Config Default();
+
+            /// The number of independent chains.
+            VerifiedRange<unsigned> number_of_chains;
+
+            /// The number of iterations per chain in each prerun.
+            VerifiedRange<unsigned> prerun_samples;
+
+            /// The number of preruns, each followed by an adaptation of the proposal.
+            VerifiedRange<unsigned> preruns;
+
+            /// The number of samples per chain that are retained from the main run.
+            VerifiedRange<unsigned> samples;
+
+            /// The number of iterations per retained sample in the main run.
+            VerifiedRange<unsigned> stride;
+
+            /// The initial proposal covariance, relative to the variance of a flat distribution on each parameter's range.
+            VerifiedRange<double> initial_scale;
+
+            /// The seed of the random number generator of the first chain; subsequent chains use consecutive seeds.
+            unsigned long seed;
+
+            /*!
+             * Whether to draw the acceptance threshold before evaluating a proposal, such that the
+             * evaluation can stop as soon as the proposal is certain to be rejected; cf. Density::evaluate_bounded().
+             * The chains are identical to those without delayed acceptance, up to rounding. However, the
+             * observables of each constraint are then evaluated separately rather than all of them in parallel.
+             */
+            bool delayed_acceptance;
+
+            /*!
+             * The name of a sample store, to which the samples of the main run are appended while they are
+             * obtained; no store is written if empty. Each row holds one sample followed by its log(density).
+             * The rows are ordered by blocks of iterations, and within each block by chain.
+             */
+            std::string output;
+    };
+}
+
+#endif
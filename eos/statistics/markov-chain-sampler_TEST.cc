@@ -0,0 +1,110 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <config.h>
+
+#include <eos/statistics/log-posterior_TEST.hh>
+#include <eos/statistics/markov-chain-sampler.hh>
+#include <eos/utils/power_of.hh>
+#include <eos/utils/sample-store.hh>
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+#include <unistd.h>
+
+using namespace test;
+using namespace eos;
+
+class MarkovChainSamplerTest :
+    public TestCase
+{
+    public:
+        MarkovChainSamplerTest() :
+            TestCase("markov_chain_sampler_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // the posterior is a Gaussian with mean 4.3 and standard deviation sqrt(0.005)
+            LogPosterior log_posterior = make_log_posterior(false);
+
+            auto config = MarkovChainSampler::Config::Default();
+            config.number_of_chains = 4;
+            config.samples = 2000;
+            config.seed = 1234;
+
+            MarkovChainSampler sampler(log_posterior.clone(), config);
+            sampler.run();
+
+            TEST_CHECK_EQUAL(1u, sampler.dimension());
+            TEST_CHECK_EQUAL(4u, sampler.number_of_chains());
+            TEST_CHECK_EQUAL(4u * 2000u, sampler.samples().size());
+            TEST_CHECK_EQUAL(4u * 2000u, sampler.log_densities().size());
+            TEST_CHECK(sampler.acceptance_rate() > 0.15);
+            TEST_CHECK(sampler.acceptance_rate() < 0.65);
+
+            double mean = 0.0, variance = 0.0;
+            for (const auto & x : sampler.samples())
+            {
+                mean += x / sampler.samples().size();
+            }
+            for (const auto & x : sampler.samples())
+            {
+                variance += power_of<2>(x - mean) / sampler.samples().size();
+            }
+
+            TEST_CHECK_NEARLY_EQUAL(4.3,                  mean,                0.01);
+            TEST_CHECK_NEARLY_EQUAL(std::sqrt(0.005),     std::sqrt(variance), 0.01);
+
+            /* Samples are streamed to a sample store */
+            {
+                char directory[] = "/tmp/eos-markov-chain-sampler-XXXXXX";
+                TEST_CHECK(nullptr != ::mkdtemp(directory));
+
+                config.output = std::string(directory) + "/samples";
+                MarkovChainSampler streaming_sampler(log_posterior.clone(), config);
+                streaming_sampler.run();
+
+                {
+                    SampleStoreReader reader(config.output);
+                    TEST_CHECK_EQUAL(2u,                reader.columns());
+                    TEST_CHECK_EQUAL(4u * 2000u,        reader.rows());
+                    TEST_CHECK_EQUAL(2000u / 100u,      reader.chunks());
+
+                    // rows are ordered by blocks of 100 samples, and within each block by chain
+                    for (unsigned c = 0 ; c < 4 ; ++c)
+                    {
+                        for (unsigned i : { 0u, 99u, 100u, 1999u })
+                        {
+                            const unsigned row = (i / 100) * 4 * 100 + c * 100 + i % 100;
+                            TEST_CHECK_EQUAL(sampler.samples()[c * 2000 + i],       reader.row(row)[0]);
+                            TEST_CHECK_EQUAL(sampler.log_densities()[c * 2000 + i], reader.row(row)[1]);
+                        }
+                    }
+                }
+
+                std::remove((config.output + ".dat").c_str());
+                std::remove((config.output + ".idx").c_str());
+                ::rmdir(directory);
+            }
+        }
+} markov_chain_sampler_test;
@@ -0,0 +1,602 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/log-posterior.hh>
+#include <eos/statistics/nested-sampler.hh>
+#include <eos/statistics/sampling-impl.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_rng.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+
+namespace eos
+{
+    namespace implementation
+    {
+        // the region from which new live points are drawn
+        struct NestedSamplingBound
+        {
+            unsigned dim;
+
+            // center and Cholesky factor of the covariance of the live points
+            std::vector<double> mean;
+
+            std::vector<double> cholesky_factor;
+
+            // radius of the enlarged bounding ellipsoid, in units of the covariance
+            double radius;
+
+            // sample from the unit hypercube if the ellipsoid is larger than the hypercube
+            bool use_hypercube;
+
+            NestedSamplingBound(const unsigned & dim, const std::vector<const double *> & points, const double & enlargement) :
+                dim(dim),
+                mean(dim, 0.0),
+                cholesky_factor(dim * dim, 0.0),
+                radius(0.0),
+                use_hypercube(false)
+            {
+                for (const auto & p : points)
+                {
+                    for (unsigned i = 0 ; i < dim ; ++i)
+                    {
+                        mean[i] += p[i] / points.size();
+                    }
+                }
+
+                for (const auto & p : points)
+                {
+                    for (unsigned i = 0 ; i < dim ; ++i)
+                    {
+                        for (unsigned j = 0 ; j <= i ; ++j)
+                        {
+                            cholesky_factor[i * dim + j] += (p[i] - mean[i]) * (p[j] - mean[j]) / (points.size() - 1.0);
+                        }
+                    }
+                }
+
+                for (unsigned i = 0 ; i < dim ; ++i)
+                {
+                    for (unsigned j = 0 ; j < i ; ++j)
+                    {
+                        cholesky_factor[j * dim + i] = cholesky_factor[i * dim + j];
+                    }
+                }
+
+                // regularize a degenerate covariance
+                if (! sampling::cholesky(cholesky_factor, dim))
+                {
+                    use_hypercube = true;
+                    std::fill(cholesky_factor.begin(), cholesky_factor.end(), 0.0);
+                    for (unsigned i = 0 ; i < dim ; ++i)
+                    {
+                        cholesky_factor[i * dim + i] = 1.0 / std::sqrt(12.0);
+                    }
+
+                    return;
+                }
+
+                for (const auto & p : points)
+                {
+                    radius = std::max(radius, sampling::mahalanobis_distance(cholesky_factor, dim, p, mean.data()));
+                }
+                radius = std::sqrt(radius) * enlargement;
+
+                // the logarithm of the volume of the ellipsoid
+                const double log_volume = 0.5 * dim * std::log(M_PI) - std::lgamma(0.5 * dim + 1.0)
+                    + dim * std::log(radius) + 0.5 * sampling::log_determinant(cholesky_factor, dim);
+                use_hypercube = (log_volume >= 0.0);
+            }
+        };
+
+        struct NestedSamplingWorker
+        {
+            LogPosteriorPtr log_posterior;
+
+            LogLikelihood log_likelihood;
+
+            std::vector<LogPriorPtr> priors;
+
+            std::vector<ParameterDescription> descriptions;
+
+            unsigned dim;
+
+            gsl_rng * rng;
+
+            unsigned long evaluations;
+
+            NestedSamplingWorker(const LogPosterior & original, const unsigned long & seed) :
+                log_posterior(original.old_clone()),
+                log_likelihood(log_posterior->log_likelihood()),
+                priors(log_posterior->begin_priors(), log_posterior->end_priors()),
+                descriptions(log_posterior->parameter_descriptions()),
+                dim(descriptions.size()),
+                rng(gsl_rng_alloc(gsl_rng_mt19937)),
+                evaluations(0)
+            {
+                gsl_rng_set(rng, seed);
+
+                for (const auto & prior : priors)
+                {
+                    if (1 != std::distance(prior->begin(), prior->end()))
+                        throw InternalError("NestedSampler: all priors must be one-dimensional");
+                }
+            }
+
+            ~NestedSamplingWorker()
+            {
+                gsl_rng_free(rng);
+            }
+
+            // map a point of the unit hypercube onto the parameters and evaluate the log(likelihood) there
+            double evaluate(const double * u, double * theta)
+            {
+                ++evaluations;
+
+                for (unsigned i = 0 ; i < dim ; ++i)
+                {
+                    theta[i] = priors[i]->inverse_cdf(u[i]);
+                    descriptions[i].parameter->set(theta[i]);
+                }
+
+                try
+                {
+                    const double result = log_likelihood();
+
+                    return std::isnan(result) ? -std::numeric_limits<double>::infinity() : result;
+                }
+                catch (eos::Exception & e)
+                {
+                    return -std::numeric_limits<double>::infinity();
+                }
+            }
+
+            static bool in_hypercube(const std::vector<double> & u)
+            {
+                return std::all_of(u.cbegin(), u.cend(), [] (const double & x) { return (0.0 <= x) && (x <= 1.0); });
+            }
+
+            // a random direction, distributed uniformly on the unit sphere
+            void direction(std::vector<double> & z)
+            {
+                double norm = 0.0;
+                for (auto & x : z)
+                {
+                    x = gsl_ran_ugaussian(rng);
+                    norm += x * x;
+                }
+                norm = std::sqrt(norm);
+
+                for (auto & x : z)
+                {
+                    x /= norm;
+                }
+            }
+
+            void uniform(double * u)
+            {
+                for (unsigned i = 0 ; i < dim ; ++i)
+                {
+                    u[i] = gsl_rng_uniform(rng);
+                }
+            }
+
+            // draw a point from the bounding ellipsoid, and accept it if its log(likelihood) exceeds the threshold
+            bool propose_from_ellipsoid(const NestedSamplingBound & bound, const double & threshold, const unsigned & maximal_attempts,
+                    double * u, double * theta, double & log_likelihood)
+            {
+                std::vector<double> z(dim), candidate(dim);
+                for (unsigned attempt = 0 ; attempt < maximal_attempts ; ++attempt)
+                {
+                    if (bound.use_hypercube)
+                    {
+                        uniform(candidate.data());
+                    }
+                    else
+                    {
+                        direction(z);
+                        const double r = bound.radius * std::pow(gsl_rng_uniform(rng), 1.0 / dim);
+                        sampling::transform(bound.cholesky_factor, dim, bound.mean.data(), z.data(), r, candidate.data());
+
+                        if (! in_hypercube(candidate))
+                            continue;
+                    }
+
+                    const double value = evaluate(candidate.data(), theta);
+                    if (value > threshold)
+                    {
+                        std::copy(candidate.cbegin(), candidate.cend(), u);
+                        log_likelihood = value;
+
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            // move a copy of a live point by slice sampling along random directions
+            bool propose_from_slices(const NestedSamplingBound & bound, const double & threshold, const unsigned & steps,
+                    const unsigned & maximal_attempts, const double * start, double * u, double * theta, double & log_likelihood)
+            {
+                std::vector<double> current(start, start + dim), z(dim), d(dim), candidate(dim);
+                std::vector<double> origin(dim, 0.0);
+                double current_log_likelihood = -std::numeric_limits<double>::infinity();
+                unsigned attempts = 0;
+
+                auto inside = [&] (const double & t, double & value) -> bool
+                {
+                    for (unsigned i = 0 ; i < dim ; ++i)
+                    {
+                        candidate[i] = current[i] + t * d[i];
+                    }
+
+                    if (! in_hypercube(candidate))
+                        return false;
+
+                    ++attempts;
+                    value = evaluate(candidate.data(), theta);
+
+                    return value > threshold;
+                };
+
+                double value;
+                for (unsigned s = 0 ; s < steps ; ++s)
+                {
+                    // the direction is scaled to the extent of the live points
+                    direction(z);
+                    sampling::transform(bound.cholesky_factor, dim, origin.data(), z.data(), 1.0, d.data());
+
+                    // step out
+                    double left = -gsl_rng_uniform(rng), right = left + 1.0;
+                    while ((attempts < maximal_attempts) && inside(left, value))
+                        left -= 1.0;
+                    while ((attempts < maximal_attempts) && inside(right, value))
+                        right += 1.0;
+
+                    // shrink
+                    while (true)
+                    {
+                        if (attempts >= maximal_attempts)
+                            return false;
+
+                        const double t = left + gsl_rng_uniform(rng) * (right - left);
+                        if (inside(t, value))
+                        {
+                            current = candidate;
+                            current_log_likelihood = value;
+                            break;
+                        }
+
+                        if (t < 0.0)
+                            left = t;
+                        else
+                            right = t;
+                    }
+                }
+
+                // the last evaluated candidate is the final point, i.e., theta holds its parameters
+                std::copy(current.cbegin(), current.cend(), u);
+                log_likelihood = current_log_likelihood;
+
+                return true;
+            }
+        };
+    }
+
+    template <>
+    struct Implementation<NestedSampler>
+    {
+        NestedSampler::Config config;
+
+        unsigned dim;
+
+        std::vector<std::unique_ptr<implementation::NestedSamplingWorker>> workers;
+
+        // live points, in the unit hypercube and in parameter space
+        std::vector<double> live_u;
+
+        std::vector<double> live_theta;
+
+        std::vector<double> live_log_likelihoods;
+
+        // results
+        double log_evidence;
+
+        double information;
+
+        std::vector<double> samples;
+
+        std::vector<double> log_likelihoods;
+
+        std::vector<double> log_weights;
+
+        Implementation(const LogPosterior & log_posterior, const NestedSampler::Config & config) :
+            config(config),
+            dim(0),
+            log_evidence(-std::numeric_limits<double>::infinity()),
+            information(0.0)
+        {
+            for (unsigned j = 0 ; j < config.batch_size ; ++j)
+            {
+                workers.push_back(std::unique_ptr<implementation::NestedSamplingWorker>(
+                        new implementation::NestedSamplingWorker(log_posterior, config.seed + j)));
+            }
+
+            dim = workers.front()->dim;
+            if (0 == dim)
+                throw InternalError("NestedSampler: need at least one varied parameter");
+        }
+
+        void run()
+        {
+            static const double minus_infinity = -std::numeric_limits<double>::infinity();
+
+            ThreadPool * pool = ThreadPool::instance();
+            const unsigned number_of_live_points = config.live_points;
+            const unsigned batch_size = std::min<unsigned>(config.batch_size, number_of_live_points - 1);
+
+            // draw the initial live points from the prior
+            live_u.resize(number_of_live_points * dim);
+            live_theta.resize(number_of_live_points * dim);
+            live_log_likelihoods.resize(number_of_live_points);
+
+            const unsigned chunk_size = (number_of_live_points + workers.size() - 1) / workers.size();
+            pool->parallel_for(workers.size(), [&] (unsigned j)
+            {
+                auto & worker = *workers[j];
+
+                for (unsigned i = j * chunk_size, i_end = std::min(number_of_live_points, (j + 1) * chunk_size) ; i < i_end ; ++i)
+                {
+                    worker.uniform(&live_u[i * dim]);
+                    live_log_likelihoods[i] = worker.evaluate(&live_u[i * dim], &live_theta[i * dim]);
+                }
+            });
+
+            // discarded points and the logarithm of their prior mass
+            std::vector<double> log_masses;
+            samples.clear();
+            log_likelihoods.clear();
+            log_evidence = minus_infinity;
+            information = 0.0;
+
+            // accumulate the evidence and the information, following Skilling's algorithm
+            auto accumulate = [&] (const double & log_likelihood, const double & log_mass)
+            {
+                if (log_likelihood == minus_infinity)
+                    return;
+
+                const double log_weight = log_likelihood + log_mass;
+                const double previous = log_evidence;
+
+                if (previous == minus_infinity)
+                {
+                    log_evidence = log_weight;
+                    information = log_likelihood - log_evidence;
+
+                    return;
+                }
+
+                log_evidence = std::max(previous, log_weight) + std::log1p(std::exp(-std::abs(previous - log_weight)));
+                information = std::exp(log_weight - log_evidence) * log_likelihood
+                    + std::exp(previous - log_evidence) * (information + previous) - log_evidence;
+            };
+
+            auto discard = [&] (const unsigned & i, const double & log_mass)
+            {
+                samples.insert(samples.end(), live_theta.cbegin() + i * dim, live_theta.cbegin() + (i + 1) * dim);
+                log_likelihoods.push_back(live_log_likelihoods[i]);
+                log_masses.push_back(log_mass);
+                accumulate(live_log_likelihoods[i], log_mass);
+            };
+
+            std::vector<unsigned> order(number_of_live_points);
+            std::vector<char> failed(batch_size);
+
+            // the logarithm of the prior mass enclosed by the live points
+            double log_X = 0.0;
+
+            unsigned iteration = 0;
+            for ( ; iteration < config.maximal_iterations ; ++iteration)
+            {
+                const double log_likelihood_max = *std::max_element(live_log_likelihoods.cbegin(), live_log_likelihoods.cend());
+                if ((log_evidence != minus_infinity) && (std::log1p(std::exp(log_likelihood_max + log_X - log_evidence)) < config.tolerance))
+                    break;
+
+                std::iota(order.begin(), order.end(), 0u);
+                std::partial_sort(order.begin(), order.begin() + batch_size, order.end(),
+                        [&] (const unsigned & a, const unsigned & b) { return live_log_likelihoods[a] < live_log_likelihoods[b]; });
+
+                // remove the batch of live points with the lowest likelihoods, one at a time
+                for (unsigned j = 0 ; j < batch_size ; ++j)
+                {
+                    const double n = number_of_live_points - j;
+                    discard(order[j], log_X + std::log(-std::expm1(-1.0 / n)));
+                    log_X -= 1.0 / n;
+                }
+
+                const double threshold = live_log_likelihoods[order[batch_size - 1]];
+
+                std::vector<const double *> survivors;
+                for (auto i = order.cbegin() + batch_size ; i != order.cend() ; ++i)
+                {
+                    survivors.push_back(&live_u[*i * dim]);
+                }
+                const implementation::NestedSamplingBound bound(dim, survivors, config.enlargement);
+
+                pool->parallel_for(batch_size, [&] (unsigned j)
+                {
+                    auto & worker = *workers[j];
+                    const unsigned i = order[j];
+                    bool success;
+
+                    if (NestedSampler::Config::Proposal::ellipsoid == config.proposal)
+                    {
+                        success = worker.propose_from_ellipsoid(bound, threshold, config.maximal_attempts,
+                                &live_u[i * dim], &live_theta[i * dim], live_log_likelihoods[i]);
+                    }
+                    else
+                    {
+                        const double * start = survivors[gsl_rng_uniform_int(worker.rng, survivors.size())];
+                        success = worker.propose_from_slices(bound, threshold, config.slice_steps, config.maximal_attempts,
+                                start, &live_u[i * dim], &live_theta[i * dim], live_log_likelihoods[i]);
+                    }
+
+                    failed[j] = ! success;
+                });
+
+                if (std::any_of(failed.cbegin(), failed.cend(), [] (const char & f) { return f; }))
+                    throw InternalError("NestedSampler: could not find a new live point within " + stringify(unsigned(config.maximal_attempts)) + " attempts");
+            }
+
+            if (iteration == config.maximal_iterations)
+            {
+                Log::instance()->message("NestedSampler::run", ll_warning)
+                    << "Maximal number of iterations reached before the termination criterion was met";
+            }
+
+            // add the final live points, ordered by increasing likelihood, each representing an equal share of the remaining prior mass
+            std::iota(order.begin(), order.end(), 0u);
+            std::sort(order.begin(), order.end(),
+                    [&] (const unsigned & a, const unsigned & b) { return live_log_likelihoods[a] < live_log_likelihoods[b]; });
+            for (const auto & i : order)
+            {
+                discard(i, log_X - std::log(number_of_live_points));
+            }
+
+            log_weights.resize(log_likelihoods.size());
+            for (unsigned k = 0 ; k < log_likelihoods.size() ; ++k)
+            {
+                log_weights[k] = log_likelihoods[k] + log_masses[k] - log_evidence;
+            }
+
+            Log::instance()->message("NestedSampler::run", ll_informational)
+                << "Finished after " << iteration << " iterations and " << evaluations() << " evaluations: "
+                << "log(Z) = " << log_evidence << " +/- " << log_evidence_error();
+        }
+
+        double log_evidence_error() const
+        {
+            return std::sqrt(std::max(information, 0.0) / config.live_points);
+        }
+
+        unsigned long evaluations() const
+        {
+            unsigned long result = 0;
+            for (const auto & worker : workers)
+            {
+                result += worker->evaluations;
+            }
+
+            return result;
+        }
+    };
+
+    NestedSampler::NestedSampler(const LogPosterior & log_posterior, const Config & config) :
+        PrivateImplementationPattern<NestedSampler>(new Implementation<NestedSampler>(log_posterior, config))
+    {
+    }
+
+    NestedSampler::~NestedSampler()
+    {
+    }
+
+    void
+    NestedSampler::run()
+    {
+        _imp->run();
+    }
+
+    unsigned
+    NestedSampler::dimension() const
+    {
+        return _imp->dim;
+    }
+
+    double
+    NestedSampler::log_evidence() const
+    {
+        return _imp->log_evidence;
+    }
+
+    double
+    NestedSampler::log_evidence_error() const
+    {
+        return _imp->log_evidence_error();
+    }
+
+    double
+    NestedSampler::information() const
+    {
+        return _imp->information;
+    }
+
+    unsigned long
+    NestedSampler::evaluations() const
+    {
+        return _imp->evaluations();
+    }
+
+    const std::vector<double> &
+    NestedSampler::samples() const
+    {
+        return _imp->samples;
+    }
+
+    const std::vector<double> &
+    NestedSampler::log_likelihoods() const
+    {
+        return _imp->log_likelihoods;
+    }
+
+    const std::vector<double> &
+    NestedSampler::log_weights() const
+    {
+        return _imp->log_weights;
+    }
+
+    NestedSampler::Config::Config() :
+        live_points(2, std::numeric_limits<unsigned>::max(), 500),
+        batch_size(1, 4096, 8),
+        proposal(Proposal::ellipsoid),
+        enlargement(1.0, std::numeric_limits<double>::max(), 1.25),
+        slice_steps(1, std::numeric_limits<unsigned>::max(), 5),
+        maximal_attempts(1, std::numeric_limits<unsigned>::max(), 100000),
+        tolerance(std::numeric_limits<double>::epsilon(), std::numeric_limits<double>::max(), 0.01),
+        maximal_iterations(1, std::numeric_limits<unsigned>::max(), 1000000),
+        seed(1)
+    {
+    }
+
+    NestedSampler::Config
+    NestedSampler::Config::Default()
+    {
+        return Config();
+    }
+}
@@ -0,0 +1,150 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_NESTED_SAMPLER_HH
+#define EOS_GUARD_EOS_STATISTICS_NESTED_SAMPLER_HH 1
+
+#include <eos/statistics/log-posterior-fwd.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+#include <eos/utils/verify.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * NestedSampler computes the evidence of a LogPosterior by means of nested sampling,
+     * and yields weighted samples of the posterior as a by-product.
+     *
+     * The live points are sampled in the unit hypercube and mapped onto the parameters through
+     * the inverse cumulative distribution functions of the one-dimensional priors. New live points
+     * are drawn either from an enlarged ellipsoid that bounds the current live points, or by
+     * slice sampling along random directions, starting from one of the current live points.
+     *
+     * In each iteration, the live points with the lowest likelihoods are replaced by a batch of
+     * new points. The new points are obtained in parallel on the ThreadPool. Each point of a batch
+     * uses its own clone of the posterior and its own random number generator, i.e., the result
+     * does not depend on the number of threads. It does depend on the batch size, which therefore
+     * defaults to a fixed value rather than to the number of threads.
+     */
+    class NestedSampler :
+        public PrivateImplementationPattern<NestedSampler>
+    {
+        public:
+            struct Config;
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param log_posterior The posterior whose evidence shall be computed. All of its priors must be one-dimensional.
+             * @param config        The configuration of the sampler.
+             */
+            NestedSampler(const LogPosterior & log_posterior, const Config & config);
+
+            /// Destructor.
+            ~NestedSampler();
+            ///@}
+
+            /// Replace live points until the termination criterion is met, and add the final live points to the samples.
+            void run();
+
+            ///@name Accessors
+            ///@{
+            /// The number of varied parameters.
+            unsigned dimension() const;
+
+            /// The natural logarithm of the evidence.
+            double log_evidence() const;
+
+            /// The estimate of the statistical uncertainty of the log(evidence).
+            double log_evidence_error() const;
+
+            /// The information, i.e., the Kullback-Leibler divergence of the posterior from the prior.
+            double information() const;
+
+            /// The number of evaluations of the log(likelihood).
+            unsigned long evaluations() const;
+
+            /*!
+             * The samples, i.e., all discarded and the final live points, as row-major
+             * array with one sample per row. The rows are ordered by increasing likelihood.
+             */
+            const std::vector<double> & samples() const;
+
+            /// The values of the log(likelihood) for each sample.
+            const std::vector<double> & log_likelihoods() const;
+
+            /// The normalized logarithmic posterior weights of each sample.
+            const std::vector<double> & log_weights() const;
+            ///@}
+    };
+
+    /*!
+     * Holds the configuration of a NestedSampler.
+     */
+    struct NestedSampler::Config
+    {
+        private:
+            /// Constructor.
+            Config();
+
+        public:
+            /// Named constructor for the default configuration.
+            static Config Default();
+
+            /// The proposal for new live points.
+            enum class Proposal
+            {
+                ellipsoid,
+                slice
+            };
+
+            /// The number of live points.
+            VerifiedRange<unsigned> live_points;
+
+            /// The number of live points that are replaced in parallel in each iteration. Defaults to 8.
+            VerifiedRange<unsigned> batch_size;
+
+            /// The proposal for new live points.
+            Proposal proposal;
+
+            /// The factor by which the bounding ellipsoid of the live points is enlarged in each direction.
+            VerifiedRange<double> enlargement;
+
+            /// The number of slice sampling steps per new live point.
+            VerifiedRange<unsigned> slice_steps;
+
+            /// The largest number of candidates per new live point, after which the sampler gives up.
+            VerifiedRange<unsigned> maximal_attempts;
+
+            /// Sampling stops once the estimated contribution of the live points to the log(evidence) falls below this value.
+            VerifiedRange<double> tolerance;
+
+            /// The largest number of iterations.
+            VerifiedRange<unsigned> maximal_iterations;
+
+            /// The seed of the random number generator of the first point of each batch; subsequent points use consecutive seeds.
+            unsigned long seed;
+    };
+}
+
+#endif
@@ -0,0 +1,115 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <config.h>
+
+#include <eos/statistics/log-posterior_TEST.hh>
+#include <eos/statistics/nested-sampler.hh>
+#include <eos/utils/power_of.hh>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+class NestedSamplerTest :
+    public TestCase
+{
+    public:
+        NestedSamplerTest() :
+            TestCase("nested_sampler_test")
+        {
+        }
+
+        static void check_weighted_moments(const NestedSampler & sampler, const double & mean, const double & sigma)
+        {
+            const auto & samples = sampler.samples();
+            const auto & log_weights = sampler.log_weights();
+
+            double sum = 0.0, first = 0.0, second = 0.0;
+            for (unsigned i = 0 ; i < log_weights.size() ; ++i)
+            {
+                const double w = std::exp(log_weights[i]);
+                sum    += w;
+                first  += w * samples[i];
+                second += w * samples[i] * samples[i];
+            }
+
+            TEST_CHECK_NEARLY_EQUAL(1.0,   sum,                                    1e-10);
+            TEST_CHECK_NEARLY_EQUAL(mean,  first,                                  0.02);
+            TEST_CHECK_NEARLY_EQUAL(sigma, std::sqrt(second - first * first),     0.01);
+        }
+
+        virtual void run() const
+        {
+            // the default batch size does not depend on the hardware
+            TEST_CHECK_EQUAL(8u, unsigned(NestedSampler::Config::Default().batch_size));
+
+            auto config = NestedSampler::Config::Default();
+            config.live_points = 400;
+            config.batch_size = 4;
+            config.seed = 1234;
+
+            /* Flat prior; the evidence is the likelihood's integral over the prior range, divided by its length */
+            {
+                LogPosterior log_posterior = make_log_posterior(true);
+
+                NestedSampler sampler(log_posterior, config);
+                sampler.run();
+
+                TEST_CHECK_EQUAL(1u, sampler.dimension());
+                TEST_CHECK_EQUAL(sampler.samples().size(), sampler.log_likelihoods().size());
+                TEST_CHECK_EQUAL(sampler.samples().size(), sampler.log_weights().size());
+                TEST_CHECK(sampler.log_evidence_error() > 0.0);
+                TEST_CHECK(sampler.evaluations() > 400u);
+                TEST_CHECK_NEARLY_EQUAL(-std::log(1.2), sampler.log_evidence(), 4.0 * sampler.log_evidence_error());
+
+                // samples are ordered by increasing likelihood
+                TEST_CHECK(std::is_sorted(sampler.log_likelihoods().cbegin(), sampler.log_likelihoods().cend()));
+
+                check_weighted_moments(sampler, 4.2, 0.1);
+
+                // the result is reproducible
+                NestedSampler other(log_posterior, config);
+                other.run();
+                TEST_CHECK_EQUAL(sampler.log_evidence(), other.log_evidence());
+                TEST_CHECK_EQUAL(sampler.evaluations(),  other.evaluations());
+            }
+
+            /* Gaussian prior; the evidence is the overlap of two Gaussians */
+            {
+                LogPosterior log_posterior = make_log_posterior(false);
+                const double log_evidence = -0.5 * std::log(2.0 * M_PI * 0.02) - 1.0;
+
+                NestedSampler sampler(log_posterior, config);
+                sampler.run();
+
+                TEST_CHECK_NEARLY_EQUAL(log_evidence, sampler.log_evidence(), 4.0 * sampler.log_evidence_error());
+                check_weighted_moments(sampler, 4.3, std::sqrt(0.005));
+
+                config.proposal = NestedSampler::Config::Proposal::slice;
+                NestedSampler slice_sampler(log_posterior, config);
+                slice_sampler.run();
+
+                TEST_CHECK_NEARLY_EQUAL(log_evidence, slice_sampler.log_evidence(), 4.0 * slice_sampler.log_evidence_error());
+                check_weighted_moments(slice_sampler, 4.3, std::sqrt(0.005));
+            }
+        }
+} nested_sampler_test;
@@ -0,0 +1,511 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/population-monte-carlo-sampler.hh>
+#include <eos/statistics/sampling-impl.hh>
+#include <eos/utils/density.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_rng.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace eos
+{
+    namespace implementation
+    {
+        // a mixture component, together with the quantities required for its evaluation
+        struct PreparedComponent
+        {
+            PopulationMonteCarloSampler::Component component;
+
+            std::vector<double> cholesky_factor;
+
+            double log_normalization;
+
+            bool prepare(const unsigned & dim)
+            {
+                cholesky_factor = component.covariance;
+                if (! sampling::cholesky(cholesky_factor, dim))
+                    return false;
+
+                const double log_det = sampling::log_determinant(cholesky_factor, dim);
+                const double nu = component.degrees_of_freedom;
+
+                if (std::isinf(nu))
+                {
+                    log_normalization = -0.5 * (dim * std::log(2.0 * M_PI) + log_det);
+                }
+                else
+                {
+                    log_normalization = std::lgamma(0.5 * (nu + dim)) - std::lgamma(0.5 * nu)
+                        - 0.5 * dim * std::log(nu * M_PI) - 0.5 * log_det;
+                }
+
+                return true;
+            }
+
+            // log(density) as a function of the squared Mahalanobis distance
+            double log_pdf(const double & distance, const unsigned & dim) const
+            {
+                const double nu = component.degrees_of_freedom;
+
+                if (std::isinf(nu))
+                    return log_normalization - 0.5 * distance;
+
+                return log_normalization - 0.5 * (nu + dim) * std::log1p(distance / nu);
+            }
+        };
+    }
+
+    template <>
+    struct Implementation<PopulationMonteCarloSampler>
+    {
+        PopulationMonteCarloSampler::Config config;
+
+        unsigned dim;
+
+        gsl_rng * rng;
+
+        // one clone of the target density per thread
+        std::vector<DensityPtr> densities;
+
+        std::vector<std::vector<ParameterDescription>> descriptions;
+
+        std::vector<implementation::PreparedComponent> components;
+
+        std::vector<PopulationMonteCarloSampler::Component> proposal;
+
+        std::vector<double> samples;
+
+        std::vector<double> log_weights;
+
+        // squared Mahalanobis distances of each sample to each component, and the log(proposal density) of each sample
+        std::vector<double> distances;
+
+        std::vector<double> log_proposal;
+
+        Implementation(const DensityPtr & density, const std::vector<PopulationMonteCarloSampler::Component> & initial_proposal,
+                const PopulationMonteCarloSampler::Config & config) :
+            config(config),
+            dim(std::distance(density->begin(), density->end())),
+            rng(gsl_rng_alloc(gsl_rng_mt19937))
+        {
+            gsl_rng_set(rng, config.seed);
+
+            if (initial_proposal.empty())
+                throw InternalError("PopulationMonteCarloSampler: initial proposal has no components");
+
+            for (const auto & c : initial_proposal)
+            {
+                if ((c.mean.size() != dim) || (c.covariance.size() != dim * dim))
+                    throw InternalError("PopulationMonteCarloSampler: dimension of proposal component does not match the density's dimension " + stringify(dim));
+
+                implementation::PreparedComponent pc{ c, {}, 0.0 };
+                if (! pc.prepare(dim))
+                    throw InternalError("PopulationMonteCarloSampler: covariance of proposal component is not positive definite");
+
+                components.push_back(pc);
+            }
+            normalize();
+
+            for (unsigned t = 0, t_end = ThreadPool::instance()->number_of_threads() ; t < t_end ; ++t)
+            {
+                densities.push_back(density->clone());
+                descriptions.push_back(std::vector<ParameterDescription>(densities.back()->begin(), densities.back()->end()));
+            }
+        }
+
+        ~Implementation()
+        {
+            gsl_rng_free(rng);
+        }
+
+        // renormalize the component weights, and update the public proposal
+        void normalize()
+        {
+            double sum = 0.0;
+            for (const auto & c : components)
+            {
+                sum += c.component.weight;
+            }
+
+            proposal.clear();
+            for (auto & c : components)
+            {
+                c.component.weight /= sum;
+                proposal.push_back(c.component);
+            }
+        }
+
+        // draw N samples from the proposal and compute their importance weights
+        void draw(const unsigned & N)
+        {
+            const unsigned K = components.size();
+
+            samples.resize(N * dim);
+            log_weights.resize(N);
+            distances.resize(N * K);
+            log_proposal.resize(N);
+
+            std::vector<double> cumulative_weights;
+            double sum = 0.0;
+            for (const auto & c : components)
+            {
+                sum += c.component.weight;
+                cumulative_weights.push_back(sum);
+            }
+
+            std::vector<double> z(dim);
+            for (unsigned i = 0 ; i < N ; ++i)
+            {
+                const double u = gsl_rng_uniform(rng) * sum;
+                const unsigned k = std::min<unsigned>(K - 1, std::upper_bound(cumulative_weights.cbegin(), cumulative_weights.cend(), u) - cumulative_weights.cbegin());
+                const auto & c = components[k];
+
+                for (unsigned j = 0 ; j < dim ; ++j)
+                {
+                    z[j] = gsl_ran_ugaussian(rng);
+                }
+
+                const double nu = c.component.degrees_of_freedom;
+                const double scale = std::isinf(nu) ? 1.0 : std::sqrt(nu / gsl_ran_chisq(rng, nu));
+
+                sampling::transform(c.cholesky_factor, dim, c.component.mean.data(), z.data(), scale, samples.data() + i * dim);
+            }
+
+            // evaluate the target and the proposal densities in parallel, using one clone of the target per thread
+            const unsigned number_of_chunks = std::min<unsigned>(N, densities.size());
+            const unsigned chunk_size = (N + number_of_chunks - 1) / number_of_chunks;
+            ThreadPool::instance()->parallel_for(number_of_chunks, [&] (unsigned t)
+            {
+                for (unsigned i = t * chunk_size, i_end = std::min(N, (t + 1) * chunk_size) ; i < i_end ; ++i)
+                {
+                    const double * x = samples.data() + i * dim;
+
+                    double max = -std::numeric_limits<double>::infinity();
+                    std::vector<double> terms(K);
+                    for (unsigned k = 0 ; k < K ; ++k)
+                    {
+                        const auto & c = components[k];
+                        distances[i * K + k] = sampling::mahalanobis_distance(c.cholesky_factor, dim, x, c.component.mean.data());
+                        terms[k] = std::log(c.component.weight) + c.log_pdf(distances[i * K + k], dim);
+                        max = std::max(max, terms[k]);
+                    }
+
+                    double value = 0.0;
+                    for (unsigned k = 0 ; k < K ; ++k)
+                    {
+                        value += std::exp(terms[k] - max);
+                    }
+                    log_proposal[i] = max + std::log(value);
+
+                    log_weights[i] = sampling::evaluate(*densities[t], descriptions[t], x) - log_proposal[i];
+                }
+            });
+        }
+
+        // normalized importance weights of the most recent samples; returns false if all weights vanish
+        bool normalized_weights(std::vector<double> & weights) const
+        {
+            const unsigned N = log_weights.size();
+
+            double max = -std::numeric_limits<double>::infinity();
+            for (const auto & lw : log_weights)
+            {
+                if (std::isfinite(lw))
+                    max = std::max(max, lw);
+            }
+
+            weights.assign(N, 0.0);
+            if (! std::isfinite(max))
+                return false;
+
+            double sum = 0.0;
+            for (unsigned i = 0 ; i < N ; ++i)
+            {
+                weights[i] = std::isfinite(log_weights[i]) ? std::exp(log_weights[i] - max) : 0.0;
+                sum += weights[i];
+            }
+
+            for (auto & w : weights)
+            {
+                w /= sum;
+            }
+
+            return true;
+        }
+
+        double perplexity() const
+        {
+            std::vector<double> weights;
+            if (! normalized_weights(weights))
+                return 0.0;
+
+            double entropy = 0.0;
+            for (const auto & w : weights)
+            {
+                if (w > 0.0)
+                    entropy -= w * std::log(w);
+            }
+
+            return std::exp(entropy) / weights.size();
+        }
+
+        // Rao-Blackwellized update of the mixture components
+        void adapt()
+        {
+            std::vector<double> weights;
+            if (! normalized_weights(weights))
+            {
+                Log::instance()->message("PopulationMonteCarloSampler::adapt", ll_warning)
+                    << "All importance weights vanish; proposal is not adapted";
+                return;
+            }
+
+            const unsigned N = weights.size(), K = components.size();
+
+            std::vector<implementation::PreparedComponent> result;
+            for (unsigned k = 0 ; k < K ; ++k)
+            {
+                const auto & c = components[k];
+                const double nu = c.component.degrees_of_freedom;
+
+                // responsibilities, including the latent scale factors of Student-t components
+                std::vector<double> rho(N), rho_gamma(N);
+                double alpha = 0.0, norm = 0.0;
+                for (unsigned i = 0 ; i < N ; ++i)
+                {
+                    if (0.0 == weights[i])
+                        continue;
+
+                    const double d = distances[i * K + k];
+                    rho[i] = weights[i] * std::exp(std::log(c.component.weight) + c.log_pdf(d, dim) - log_proposal[i]);
+                    rho_gamma[i] = std::isinf(nu) ? rho[i] : rho[i] * (nu + dim) / (nu + d);
+                    alpha += rho[i];
+                    norm += rho_gamma[i];
+                }
+
+                // drop components that do not contribute any longer
+                if (! (alpha > std::numeric_limits<double>::epsilon() / K))
+                    continue;
+
+                implementation::PreparedComponent pc{ c.component, {}, 0.0 };
+                pc.component.weight = alpha;
+
+                std::fill(pc.component.mean.begin(), pc.component.mean.end(), 0.0);
+                for (unsigned i = 0 ; i < N ; ++i)
+                {
+                    for (unsigned j = 0 ; j < dim ; ++j)
+                    {
+                        pc.component.mean[j] += rho_gamma[i] * samples[i * dim + j] / norm;
+                    }
+                }
+
+                std::fill(pc.component.covariance.begin(), pc.component.covariance.end(), 0.0);
+                for (unsigned i = 0 ; i < N ; ++i)
+                {
+                    const double * x = samples.data() + i * dim;
+                    for (unsigned j = 0 ; j < dim ; ++j)
+                    {
+                        for (unsigned l = 0 ; l <= j ; ++l)
+                        {
+                            pc.component.covariance[j * dim + l] += rho_gamma[i] * (x[j] - pc.component.mean[j]) * (x[l] - pc.component.mean[l]) / alpha;
+                        }
+                    }
+                }
+                for (unsigned j = 0 ; j < dim ; ++j)
+                {
+                    for (unsigned l = 0 ; l < j ; ++l)
+                    {
+                        pc.component.covariance[l * dim + j] = pc.component.covariance[j * dim + l];
+                    }
+                }
+
+                // keep the previous component if the update is degenerate
+                if (! pc.prepare(dim))
+                {
+                    pc = c;
+                    pc.component.weight = alpha;
+                }
+
+                result.push_back(pc);
+            }
+
+            components.swap(result);
+            normalize();
+        }
+
+        double step()
+        {
+            draw(config.samples_per_step);
+            const double result = perplexity();
+            adapt();
+
+            return result;
+        }
+
+        void run()
+        {
+            for (unsigned s = 0 ; s < config.steps ; ++s)
+            {
+                const double p = step();
+
+                Log::instance()->message("PopulationMonteCarloSampler::run", ll_informational)
+                    << "Step " << s << ": perplexity is " << p << ", proposal has " << components.size() << " component(s)";
+
+                if (p > config.perplexity_threshold)
+                    break;
+            }
+
+            draw(config.final_samples);
+
+            Log::instance()->message("PopulationMonteCarloSampler::run", ll_informational)
+                << "Final step: perplexity is " << perplexity();
+        }
+    };
+
+    PopulationMonteCarloSampler::PopulationMonteCarloSampler(const DensityPtr & density, const std::vector<Component> & proposal, const Config & config) :
+        PrivateImplementationPattern<PopulationMonteCarloSampler>(new Implementation<PopulationMonteCarloSampler>(density, proposal, config))
+    {
+    }
+
+    PopulationMonteCarloSampler::~PopulationMonteCarloSampler()
+    {
+    }
+
+    std::vector<PopulationMonteCarloSampler::Component>
+    PopulationMonteCarloSampler::initial_proposal(const MarkovChainSampler & sampler, const unsigned & groups_per_chain, const double & degrees_of_freedom)
+    {
+        const unsigned dim = sampler.dimension();
+        const unsigned chains = sampler.number_of_chains();
+        const unsigned samples_per_chain = sampler.log_densities().size() / chains;
+        const unsigned group_size = samples_per_chain / std::max(1u, groups_per_chain);
+        const auto & samples = sampler.samples();
+
+        if (group_size < 2)
+            throw InternalError("PopulationMonteCarloSampler::initial_proposal: too few samples per group");
+
+        // rescale the covariance to the scale matrix of a Student-t distribution, if possible
+        const double scale = (std::isinf(degrees_of_freedom) || degrees_of_freedom <= 2.0) ? 1.0 : (degrees_of_freedom - 2.0) / degrees_of_freedom;
+
+        std::vector<Component> result;
+        for (unsigned c = 0 ; c < chains ; ++c)
+        {
+            for (unsigned g = 0 ; g < groups_per_chain ; ++g)
+            {
+                const double * begin = samples.data() + (c * samples_per_chain + g * group_size) * dim;
+
+                Component component{ 1.0, std::vector<double>(dim, 0.0), std::vector<double>(dim * dim, 0.0), degrees_of_freedom };
+                for (unsigned i = 0 ; i < group_size ; ++i)
+                {
+                    for (unsigned j = 0 ; j < dim ; ++j)
+                    {
+                        component.mean[j] += begin[i * dim + j] / group_size;
+                    }
+                }
+
+                for (unsigned i = 0 ; i < group_size ; ++i)
+                {
+                    for (unsigned j = 0 ; j < dim ; ++j)
+                    {
+                        for (unsigned l = 0 ; l < dim ; ++l)
+                        {
+                            component.covariance[j * dim + l] += scale * (begin[i * dim + j] - component.mean[j]) * (begin[i * dim + l] - component.mean[l]) / (group_size - 1);
+                        }
+                    }
+                }
+
+                // skip groups in which the chain did not move sufficiently
+                std::vector<double> factor = component.covariance;
+                if (! sampling::cholesky(factor, dim))
+                    continue;
+
+                result.push_back(component);
+            }
+        }
+
+        if (result.empty())
+            throw InternalError("PopulationMonteCarloSampler::initial_proposal: all groups of samples are degenerate");
+
+        for (auto & component : result)
+        {
+            component.weight = 1.0 / result.size();
+        }
+
+        return result;
+    }
+
+    double
+    PopulationMonteCarloSampler::step()
+    {
+        return _imp->step();
+    }
+
+    void
+    PopulationMonteCarloSampler::run()
+    {
+        _imp->run();
+    }
+
+    unsigned
+    PopulationMonteCarloSampler::dimension() const
+    {
+        return _imp->dim;
+    }
+
+    const std::vector<PopulationMonteCarloSampler::Component> &
+    PopulationMonteCarloSampler::proposal() const
+    {
+        return _imp->proposal;
+    }
+
+    const std::vector<double> &
+    PopulationMonteCarloSampler::samples() const
+    {
+        return _imp->samples;
+    }
+
+    const std::vector<double> &
+    PopulationMonteCarloSampler::log_weights() const
+    {
+        return _imp->log_weights;
+    }
+
+    PopulationMonteCarloSampler::Config::Config() :
+        samples_per_step(1, std::numeric_limits<unsigned>::max(), 1000),
+        steps(0, std::numeric_limits<unsigned>::max(), 10),
+        final_samples(1, std::numeric_limits<unsigned>::max(), 5000),
+        perplexity_threshold(0.0, 1.0, 1.0),
+        seed(1)
+    {
+    }
+
+    PopulationMonteCarloSampler::Config
+    PopulationMonteCarloSampler::Config::Default()
+    {
+        return Config();
+    }
+}
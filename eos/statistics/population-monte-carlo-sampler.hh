@@ -0,0 +1,151 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_POPULATION_MONTE_CARLO_SAMPLER_HH
+#define EOS_GUARD_EOS_STATISTICS_POPULATION_MONTE_CARLO_SAMPLER_HH 1
+
+#include <eos/statistics/markov-chain-sampler.hh>
+#include <eos/utils/density-fwd.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+#include <eos/utils/verify.hh>
+
+#include <limits>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * PopulationMonteCarloSampler draws weighted samples from a Density by means
+     * of adaptive importance sampling.
+     *
+     * The proposal density is a mixture of multivariate Gaussian or Student-t
+     * components. In each step, a population of samples is drawn from the proposal
+     * and the target density is evaluated for all samples in parallel on the ThreadPool,
+     * using one clone of the density per thread. The mixture is then adapted to the
+     * importance weights following the Rao-Blackwellized updates of
+     * Cappé et al., arXiv:0710.4242.
+     */
+    class PopulationMonteCarloSampler :
+        public PrivateImplementationPattern<PopulationMonteCarloSampler>
+    {
+        public:
+            struct Config;
+
+            /// A single component of the mixture density that serves as proposal.
+            struct Component
+            {
+                /// The component's weight within the mixture.
+                double weight;
+
+                /// The mean vector.
+                std::vector<double> mean;
+
+                /// The row-major covariance matrix (Gaussian) or scale matrix (Student-t).
+                std::vector<double> covariance;
+
+                /// The degrees of freedom; +inf yields a Gaussian component.
+                double degrees_of_freedom;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param density  The density from which samples shall be drawn.
+             * @param proposal The components of the initial proposal density.
+             * @param config   The configuration of the sampler.
+             */
+            PopulationMonteCarloSampler(const DensityPtr & density, const std::vector<Component> & proposal, const Config & config);
+
+            /// Destructor.
+            ~PopulationMonteCarloSampler();
+            ///@}
+
+            /*!
+             * Create an initial proposal from the samples of a MarkovChainSampler.
+             *
+             * The samples of each chain are divided into groups of consecutive samples;
+             * each group yields one component with the group's mean and covariance,
+             * similar to Beaujean and Caldwell, arXiv:1304.7808.
+             *
+             * @param sampler             The MarkovChainSampler, after its run.
+             * @param groups_per_chain    The number of components per chain.
+             * @param degrees_of_freedom  The degrees of freedom of all components; +inf yields Gaussian components.
+             */
+            static std::vector<Component> initial_proposal(const MarkovChainSampler & sampler, const unsigned & groups_per_chain,
+                    const double & degrees_of_freedom = std::numeric_limits<double>::infinity());
+
+            /*!
+             * Carry out a single step: draw samples, evaluate the target density, and adapt the proposal.
+             *
+             * @return The normalized perplexity of the importance weights of this step.
+             */
+            double step();
+
+            /// Carry out adaptation steps until the perplexity threshold is reached, then draw the final samples.
+            void run();
+
+            ///@name Accessors
+            ///@{
+            /// The number of varied parameters.
+            unsigned dimension() const;
+
+            /// The current proposal density.
+            const std::vector<Component> & proposal() const;
+
+            /// The most recent samples, as row-major array with one sample per row.
+            const std::vector<double> & samples() const;
+
+            /// The logarithmic importance weights of the most recent samples.
+            const std::vector<double> & log_weights() const;
+            ///@}
+    };
+
+    /*!
+     * Holds the configuration of a PopulationMonteCarloSampler.
+     */
+    struct PopulationMonteCarloSampler::Config
+    {
+        private:
+            /// Constructor.
+            Config();
+
+        public:
+            /// Named constructor for the default configuration.
+            static Config Default();
+
+            /// The number of samples drawn in each adaptation step.
+            VerifiedRange<unsigned> samples_per_step;
+
+            /// The maximal number of adaptation steps.
+            VerifiedRange<unsigned> steps;
+
+            /// The number of samples drawn after the adaptation has finished.
+            VerifiedRange<unsigned> final_samples;
+
+            /// The adaptation stops once the normalized perplexity of a step exceeds this threshold.
+            VerifiedRange<double> perplexity_threshold;
+
+            /// The seed of the random number generator.
+            unsigned long seed;
+    };
+}
+
+#endif
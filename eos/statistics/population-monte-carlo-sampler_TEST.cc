@@ -0,0 +1,94 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <config.h>
+
+#include <eos/statistics/log-posterior_TEST.hh>
+#include <eos/statistics/population-monte-carlo-sampler.hh>
+#include <eos/utils/power_of.hh>
+
+#include <cmath>
+#include <limits>
+
+using namespace test;
+using namespace eos;
+
+class PopulationMonteCarloSamplerTest :
+    public TestCase
+{
+    public:
+        PopulationMonteCarloSamplerTest() :
+            TestCase("population_monte_carlo_sampler_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // the posterior is a Gaussian with mean 4.3 and standard deviation sqrt(0.005)
+            LogPosterior log_posterior = make_log_posterior(false);
+
+            auto mcmc_config = MarkovChainSampler::Config::Default();
+            mcmc_config.number_of_chains = 2;
+            mcmc_config.samples = 500;
+
+            MarkovChainSampler mcmc(log_posterior.clone(), mcmc_config);
+            mcmc.run();
+
+            for (double degrees_of_freedom : { std::numeric_limits<double>::infinity(), 5.0 })
+            {
+                auto proposal = PopulationMonteCarloSampler::initial_proposal(mcmc, 2, degrees_of_freedom);
+                TEST_CHECK(proposal.size() <= 4u);
+
+                auto config = PopulationMonteCarloSampler::Config::Default();
+                config.samples_per_step = 500;
+                config.steps = 5;
+                config.final_samples = 5000;
+                config.perplexity_threshold = 0.95;
+
+                PopulationMonteCarloSampler sampler(log_posterior.clone(), proposal, config);
+                sampler.run();
+
+                TEST_CHECK_EQUAL(5000u, sampler.samples().size());
+                TEST_CHECK_EQUAL(5000u, sampler.log_weights().size());
+
+                double sum = 0.0;
+                for (const auto & c : sampler.proposal())
+                {
+                    sum += c.weight;
+                }
+                TEST_CHECK_NEARLY_EQUAL(1.0, sum, 1.0e-12);
+
+                double norm = 0.0, mean = 0.0, variance = 0.0;
+                for (unsigned i = 0 ; i < sampler.samples().size() ; ++i)
+                {
+                    const double w = std::exp(sampler.log_weights()[i]);
+                    norm += w;
+                    mean += w * sampler.samples()[i];
+                }
+                mean /= norm;
+                for (unsigned i = 0 ; i < sampler.samples().size() ; ++i)
+                {
+                    variance += std::exp(sampler.log_weights()[i]) * power_of<2>(sampler.samples()[i] - mean) / norm;
+                }
+
+                TEST_CHECK_NEARLY_EQUAL(4.3,                  mean,                0.01);
+                TEST_CHECK_NEARLY_EQUAL(std::sqrt(0.005),     std::sqrt(variance), 0.01);
+            }
+        }
+} population_monte_carlo_sampler_test;
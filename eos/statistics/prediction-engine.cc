@@ -0,0 +1,234 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/prediction-engine.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/mutex.hh>
+#include <eos/utils/observable_cache.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+namespace eos
+{
+    template <>
+    struct Implementation<PredictionEngine>
+    {
+        std::vector<QualifiedName> parameter_names;
+
+        // the cache of all observables, from which each thread obtains its clone
+        ObservableCache cache;
+
+        // the cache id of each observable, in the order given to the constructor
+        std::vector<ObservableCache::Id> ids;
+
+        unsigned number_of_threads;
+
+        static Parameters common_parameters(const std::vector<ObservablePtr> & observables)
+        {
+            if (observables.empty())
+                return Parameters::Defaults();
+
+            return observables.front()->parameters();
+        }
+
+        Implementation(const std::vector<QualifiedName> & parameter_names, const std::vector<ObservablePtr> & observables,
+                const unsigned & number_of_threads) :
+            parameter_names(parameter_names),
+            cache(common_parameters(observables)),
+            number_of_threads(number_of_threads > 0 ? number_of_threads : ThreadPool::instance()->number_of_threads())
+        {
+            // fail early for unknown parameters
+            for (const auto & name : parameter_names)
+            {
+                cache.parameters()[name];
+            }
+
+            for (const auto & o : observables)
+            {
+                ids.push_back(cache.add(o));
+            }
+        }
+
+        // an independent copy of the cache and the parameters that it reads from the points
+        struct Clone
+        {
+            ObservableCache cache;
+
+            std::vector<Parameter> parameters;
+
+            Clone(const ObservableCache & original, const std::vector<QualifiedName> & parameter_names) :
+                cache(original.clone(original.parameters().clone()))
+            {
+                for (const auto & name : parameter_names)
+                {
+                    parameters.push_back(this->cache.parameters()[name]);
+                }
+            }
+        };
+
+        // the clones that are not in use, which are kept across calls to predict()
+        Mutex mutex;
+
+        std::vector<std::unique_ptr<Clone>> clones;
+
+        /*
+         * Take a number of clones from the pool, and create new ones if the pool runs short.
+         * The values of all parameters of the clones are synchronised with the original cache.
+         */
+        std::vector<std::unique_ptr<Clone>> acquire(const unsigned & number_of_clones)
+        {
+            std::vector<std::unique_ptr<Clone>> result;
+
+            {
+                Lock l(mutex);
+
+                while ((result.size() < number_of_clones) && (! clones.empty()))
+                {
+                    result.push_back(std::move(clones.back()));
+                    clones.pop_back();
+                }
+            }
+
+            while (result.size() < number_of_clones)
+            {
+                result.push_back(std::unique_ptr<Clone>(new Clone(cache, parameter_names)));
+            }
+
+            std::vector<Parameter::Id> ids;
+            std::vector<double> values;
+            for (const auto & p : cache.parameters())
+            {
+                ids.push_back(p.id());
+                values.push_back(p.evaluate());
+            }
+
+            for (auto & clone : result)
+            {
+                clone->cache.parameters().set_values(ids, values);
+            }
+
+            return result;
+        }
+
+        // return clones to the pool, keeping at most one clone per thread
+        void release(std::vector<std::unique_ptr<Clone>> & used)
+        {
+            Lock l(mutex);
+
+            for (auto & clone : used)
+            {
+                if (clones.size() >= number_of_threads)
+                    break;
+
+                clones.push_back(std::move(clone));
+            }
+
+            used.clear();
+        }
+
+        void predict(const double * points, const unsigned & n, const unsigned & dim, double * results)
+        {
+            if (dim != parameter_names.size())
+                throw InternalError("PredictionEngine::predict(): expected points of dimension " + stringify(parameter_names.size()) + ", got " + stringify(dim));
+
+            const unsigned m = ids.size();
+            if ((0 == n) || (0 == m))
+                return;
+
+            // one independent clone per thread, each working on a contiguous range of points
+            const unsigned number_of_clones = std::min(n, number_of_threads);
+            const unsigned chunk_size = (n + number_of_clones - 1) / number_of_clones;
+
+            auto used = acquire(number_of_clones);
+
+            ThreadPool::instance()->parallel_for(number_of_clones, [&] (unsigned k)
+            {
+                Clone & clone = *used[k];
+
+                for (unsigned i = k * chunk_size, i_end = std::min(n, (k + 1) * chunk_size) ; i < i_end ; ++i)
+                {
+                    const double * point = points + i * dim;
+                    double * result = results + i * m;
+
+                    for (unsigned j = 0 ; j < dim ; ++j)
+                    {
+                        clone.parameters[j].set(point[j]);
+                    }
+
+                    try
+                    {
+                        clone.cache.update();
+
+                        for (unsigned j = 0 ; j < m ; ++j)
+                        {
+                            result[j] = clone.cache[ids[j]];
+                        }
+                    }
+                    // failures of individual observables yield NaN within the update; this catches all other failures
+                    catch (eos::Exception & e)
+                    {
+                        Log::instance()->message("PredictionEngine::predict", ll_error)
+                            << "Exception encountered when predicting the observables for point #" << i << ": " << e.what();
+                        std::fill(result, result + m, std::numeric_limits<double>::quiet_NaN());
+
+                        // do not rely on partial results of the failed update
+                        clone.cache.invalidate();
+                    }
+                }
+            });
+
+            release(used);
+        }
+    };
+
+    PredictionEngine::PredictionEngine(const std::vector<QualifiedName> & parameters, const std::vector<ObservablePtr> & observables,
+            const unsigned & number_of_threads) :
+        PrivateImplementationPattern<PredictionEngine>(new Implementation<PredictionEngine>(parameters, observables, number_of_threads))
+    {
+    }
+
+    PredictionEngine::~PredictionEngine()
+    {
+    }
+
+    unsigned
+    PredictionEngine::number_of_parameters() const
+    {
+        return _imp->parameter_names.size();
+    }
+
+    unsigned
+    PredictionEngine::number_of_observables() const
+    {
+        return _imp->ids.size();
+    }
+
+    void
+    PredictionEngine::predict(const double * points, const unsigned & n, const unsigned & dim, double * results) const
+    {
+        _imp->predict(points, n, dim, results);
+    }
+}
@@ -0,0 +1,82 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_PREDICTION_ENGINE_HH
+#define EOS_GUARD_EOS_STATISTICS_PREDICTION_ENGINE_HH 1
+
+#include <eos/observable.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+#include <eos/utils/qualified-name.hh>
+
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Predicts a set of observables for many parameter points, e.g. for the samples of a posterior.
+     *
+     * The parameter points are distributed across the ThreadPool. Each thread works on an independent
+     * clone of the observables, which share one ObservableCache and thereby any intermediate results.
+     * The clones are built upon first use, and are reused by subsequent calls to predict().
+     */
+    class PredictionEngine :
+        public PrivateImplementationPattern<PredictionEngine>
+    {
+        public:
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param parameters        The names of the parameters that are set from the columns of each parameter point.
+             * @param observables       The observables to be predicted. They must share one common Parameters object.
+             * @param number_of_threads The largest number of threads that work on the predictions concurrently.
+             *                          Defaults to the number of threads of the ThreadPool if set to 0.
+             */
+            PredictionEngine(const std::vector<QualifiedName> & parameters, const std::vector<ObservablePtr> & observables,
+                    const unsigned & number_of_threads = 0);
+
+            /// Destructor.
+            ~PredictionEngine();
+            ///@}
+
+            /// Retrieve the number of parameters per point.
+            unsigned number_of_parameters() const;
+
+            /// Retrieve the number of observables.
+            unsigned number_of_observables() const;
+
+            /*!
+             * Predict the observables for a number of parameter points.
+             *
+             * The observables given to the constructor remain unchanged. Parameters that are not
+             * set from the points take their current values in the observables' Parameters object.
+             * Predictions for which the evaluation fails yield NaN.
+             *
+             * @param points  Row-major array of n x dim parameter values, with the columns in the order of the parameters.
+             * @param n       The number of parameter points.
+             * @param dim     The number of parameters per point.
+             * @param results Preallocated row-major array of n x m elements that receives the predictions, with
+             *                one column for each of the m observables.
+             */
+            void predict(const double * points, const unsigned & n, const unsigned & dim, double * results) const;
+    };
+}
+
+#endif
@@ -0,0 +1,232 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/statistics/prediction-engine.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/expression.hh>
+#include <eos/utils/expression-observable.hh>
+#include <eos/utils/observable_stub.hh>
+
+#include <cmath>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    // the square root of the charm quark mass, which cannot be evaluated for negative masses
+    struct SqrtTestObservable :
+        public Observable
+    {
+            Parameters p;
+
+            Kinematics k;
+
+            Options o;
+
+            QualifiedName n;
+
+            UsedParameter m_c;
+
+            SqrtTestObservable(const Parameters & p, const Kinematics & k) :
+                p(p),
+                k(k),
+                n("test::sqrt(m_c)"),
+                m_c(p["mass::c"], *this)
+            {
+            }
+
+            virtual double evaluate() const
+            {
+                if (m_c() < 0.0)
+                    throw InternalError("SqrtTestObservable: negative mass");
+
+                return std::sqrt(m_c());
+            }
+
+            virtual ObservablePtr clone() const
+            {
+                return ObservablePtr(new SqrtTestObservable(p.clone(), k.clone()));
+            }
+
+            virtual ObservablePtr clone(const Parameters & parameters) const
+            {
+                return ObservablePtr(new SqrtTestObservable(parameters, k.clone()));
+            }
+
+            virtual Parameters parameters()
+            {
+                return p;
+            }
+
+            virtual Kinematics kinematics()
+            {
+                return k;
+            }
+
+            virtual Options options()
+            {
+                return o;
+            }
+
+            virtual const QualifiedName & name() const
+            {
+                return n;
+            }
+    };
+}
+
+class PredictionEngineTest :
+    public TestCase
+{
+    public:
+        PredictionEngineTest() :
+            TestCase("prediction_engine_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            Parameters p = Parameters::Defaults();
+            Kinematics k;
+
+            // the last observable depends on none of the parameters that are set from the points
+            const std::vector<ObservablePtr> observables
+            {
+                ObservablePtr(new ObservableStub(p, "mass::b(MSbar)", k)),
+                ObservablePtr(new SqrtTestObservable(p, k)),
+                ObservablePtr(new ObservableStub(p, "mass::s(2GeV)", k)),
+            };
+
+            const double m_b = p["mass::b(MSbar)"](), m_c = p["mass::c"](), m_s = p["mass::s(2GeV)"]();
+
+            /* predictions for several points, including a failing one */
+            {
+                PredictionEngine engine({ "mass::b(MSbar)", "mass::c" }, observables, 3);
+
+                TEST_CHECK_EQUAL(2u, engine.number_of_parameters());
+                TEST_CHECK_EQUAL(3u, engine.number_of_observables());
+
+                static const unsigned n = 7;
+                const std::vector<double> points
+                {
+                    4.10,  1.20,
+                    4.20,  1.30,
+                    4.30, -1.00,
+                    4.40,  1.40,
+                    4.50,  1.50,
+                    4.60,  1.60,
+                    4.70,  1.70,
+                };
+                std::vector<double> results(n * 3, 0.0);
+
+                engine.predict(points.data(), n, 2, results.data());
+
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(points[i * 2 + 0], results[i * 3 + 0], 1e-15);
+                    TEST_CHECK_NEARLY_EQUAL(m_s,               results[i * 3 + 2], 1e-15);
+
+                    // only the failing observable yields NaN
+                    if (2 == i)
+                    {
+                        TEST_CHECK(std::isnan(results[i * 3 + 1]));
+                        continue;
+                    }
+
+                    TEST_CHECK_NEARLY_EQUAL(std::sqrt(points[i * 2 + 1]), results[i * 3 + 1], 1e-15);
+                }
+
+                // the original parameters remain unchanged
+                TEST_CHECK_EQUAL(m_b, p["mass::b(MSbar)"]());
+                TEST_CHECK_EQUAL(m_c, p["mass::c"]());
+
+                // mismatch in the number of parameters
+                TEST_CHECK_THROWS(InternalError, engine.predict(points.data(), n, 3, results.data()));
+
+                // the reused clones follow changes of the other parameters
+                p["mass::s(2GeV)"] = 0.1;
+                engine.predict(points.data(), n, 2, results.data());
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(points[i * 2 + 0], results[i * 3 + 0], 1e-15);
+                    TEST_CHECK_NEARLY_EQUAL(0.1,               results[i * 3 + 2], 1e-15);
+                }
+                p["mass::s(2GeV)"] = m_s;
+            }
+
+            /* results do not depend on the number of threads */
+            {
+                static const unsigned n = 50;
+                std::vector<double> points(n);
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    points[i] = 1.0 + 0.01 * i;
+                }
+
+                std::vector<double> serial(n * 3), parallel(n * 3);
+                PredictionEngine({ "mass::c" }, observables, 1).predict(points.data(), n, 1, serial.data());
+                PredictionEngine({ "mass::c" }, observables, 4).predict(points.data(), n, 1, parallel.data());
+
+                for (unsigned i = 0 ; i < n * 3 ; ++i)
+                {
+                    TEST_CHECK_EQUAL(serial[i], parallel[i]);
+                }
+
+                TEST_CHECK_NEARLY_EQUAL(m_b,             serial[(n - 1) * 3 + 0], 1e-15);
+                TEST_CHECK_NEARLY_EQUAL(std::sqrt(1.49), serial[(n - 1) * 3 + 1], 1e-15);
+            }
+
+            /* expression observables, whose sub-observables are added to each clone's cache */
+            {
+                const exp::Expression ratio = exp::BinaryExpression('/',
+                        exp::ObservableNameExpression("mass::b(MSbar)", exp::KinematicsSpecification()),
+                        exp::ObservableNameExpression("mass::c", exp::KinematicsSpecification()));
+
+                const std::vector<ObservablePtr> expressions
+                {
+                    ObservablePtr(new ExpressionObservable("test::m_b/m_c", p, k, Options(), ratio)),
+                    ObservablePtr(new ObservableStub(p, "mass::c", k)),
+                };
+
+                PredictionEngine engine({ "mass::b(MSbar)", "mass::c" }, expressions, 2);
+
+                static const unsigned n = 5;
+                const std::vector<double> points
+                {
+                    4.10,  1.20,
+                    4.20,  1.30,
+                    4.30,  1.40,
+                    4.40,  1.50,
+                    4.50,  1.60,
+                };
+                std::vector<double> results(n * 2, 0.0);
+
+                engine.predict(points.data(), n, 2, results.data());
+
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(points[i * 2 + 0] / points[i * 2 + 1], results[i * 2 + 0], 1e-14);
+                    TEST_CHECK_NEARLY_EQUAL(points[i * 2 + 1],                     results[i * 2 + 1], 1e-15);
+                }
+            }
+        }
+} prediction_engine_test;
@@ -0,0 +1,152 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_SAMPLING_IMPL_HH
+#define EOS_GUARD_EOS_STATISTICS_SAMPLING_IMPL_HH 1
+
+#include <eos/utils/density.hh>
+#include <eos/utils/exception.hh>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace eos
+{
+    namespace sampling
+    {
+        /*!
+         * Replace a symmetric, positive-definite dim x dim matrix (row-major) by its
+         * lower-triangular Cholesky factor L, with A = L L^T. The upper triangle is zeroed.
+         *
+         * @return false if the matrix is not positive definite; the matrix is left in an unspecified state.
+         */
+        inline bool cholesky(std::vector<double> & a, const unsigned & dim)
+        {
+            for (unsigned j = 0 ; j < dim ; ++j)
+            {
+                double diagonal = a[j * dim + j];
+                for (unsigned k = 0 ; k < j ; ++k)
+                {
+                    diagonal -= a[j * dim + k] * a[j * dim + k];
+                }
+
+                if (! (diagonal > 0.0))
+                    return false;
+
+                const double l_jj = std::sqrt(diagonal);
+                a[j * dim + j] = l_jj;
+
+                for (unsigned i = j + 1 ; i < dim ; ++i)
+                {
+                    double value = a[i * dim + j];
+                    for (unsigned k = 0 ; k < j ; ++k)
+                    {
+                        value -= a[i * dim + k] * a[j * dim + k];
+                    }
+
+                    a[i * dim + j] = value / l_jj;
+                    a[j * dim + i] = 0.0;
+                }
+            }
+
+            return true;
+        }
+
+        /// Logarithm of the determinant of A = L L^T, given its Cholesky factor L.
+        inline double log_determinant(const std::vector<double> & l, const unsigned & dim)
+        {
+            double result = 0.0;
+            for (unsigned i = 0 ; i < dim ; ++i)
+            {
+                result += 2.0 * std::log(l[i * dim + i]);
+            }
+
+            return result;
+        }
+
+        /// Squared Mahalanobis distance (x - mu)^T A^-1 (x - mu), given the Cholesky factor L of A.
+        inline double mahalanobis_distance(const std::vector<double> & l, const unsigned & dim, const double * x, const double * mu)
+        {
+            // solve L y = x - mu by forward substitution, then return y^T y
+            std::vector<double> y(dim);
+            double result = 0.0;
+            for (unsigned i = 0 ; i < dim ; ++i)
+            {
+                double value = x[i] - mu[i];
+                for (unsigned k = 0 ; k < i ; ++k)
+                {
+                    value -= l[i * dim + k] * y[k];
+                }
+
+                y[i] = value / l[i * dim + i];
+                result += y[i] * y[i];
+            }
+
+            return result;
+        }
+
+        /// Compute x = mu + scale * L z.
+        inline void transform(const std::vector<double> & l, const unsigned & dim, const double * mu, const double * z, const double & scale, double * x)
+        {
+            for (unsigned i = 0 ; i < dim ; ++i)
+            {
+                double value = 0.0;
+                for (unsigned k = 0 ; k <= i ; ++k)
+                {
+                    value += l[i * dim + k] * z[k];
+                }
+
+                x[i] = mu[i] + scale * value;
+            }
+        }
+
+        /*!
+         * Evaluate a density at a given point.
+         *
+         * Points outside the parameter ranges, as well as points for which the
+         * evaluation fails, yield -inf. If a finite bound is given, the density may
+         * also yield -inf for points at which it falls below the bound.
+         */
+        inline double evaluate(const Density & density, const std::vector<ParameterDescription> & descriptions, const double * point,
+                const double & bound = -std::numeric_limits<double>::infinity())
+        {
+            for (unsigned i = 0 ; i < descriptions.size() ; ++i)
+            {
+                if ((point[i] < descriptions[i].min) || (descriptions[i].max < point[i]))
+                    return -std::numeric_limits<double>::infinity();
+
+                descriptions[i].parameter->set(point[i]);
+            }
+
+            try
+            {
+                const double result = std::isfinite(bound) ? density.evaluate_bounded(bound) : density.evaluate();
+
+                return std::isnan(result) ? -std::numeric_limits<double>::infinity() : result;
+            }
+            catch (eos::Exception & e)
+            {
+                return -std::numeric_limits<double>::infinity();
+            }
+        }
+    }
+}
+
+#endif
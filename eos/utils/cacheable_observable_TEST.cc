@@ -300,5 +300,96 @@ class CacheableObservableTest :
 
         }
 
+        // Test incremental updates of the cache
+        {
+            Parameters p = Parameters::Defaults();
+            p["mass::B_u"] = 5.27934;
+
+            Kinematics k({{"q2", 2.0}});
+
+            using TestCacheableObservable = class ConcreteCacheableObservable<TestCacheableObservableProvider, double>;
+
+            ObservablePtr cacheable_observable(new TestCacheableObservable("test::cacheable_observable1(q2)", p, k, Options(),
+                &TestCacheableObservableProvider::prepare,
+                &TestCacheableObservableProvider::evaluate1,
+                std::make_tuple("q2")
+            ));
+            ObservablePtr cacheable_observable2(new TestCacheableObservable("test::cacheable_observable2(q2)", p, k, Options(),
+                &TestCacheableObservableProvider::prepare,
+                &TestCacheableObservableProvider::evaluate1,
+                std::make_tuple("q2")
+            ));
+
+            ObservableCache cache(p);
+            ObservableCache::Id id1 = cache.add(cacheable_observable);
+            ObservableCache::Id id2 = cache.add(cacheable_observable2);
+
+            cache.update();
+            TEST_CHECK_NEARLY_EQUAL(cache[id1], 5.27934 - 2.0 * 2.0, 1.0e-5);
+            TEST_CHECK_NEARLY_EQUAL(cache[id2], 5.27934 - 2.0 * 2.0, 1.0e-5);
+
+            // changing an unused parameter leaves the predictions intact
+            p["mass::B_d"] = 5.0;
+            cache.update();
+            TEST_CHECK_NEARLY_EQUAL(cache[id1], 5.27934 - 2.0 * 2.0, 1.0e-5);
+            TEST_CHECK_NEARLY_EQUAL(cache[id2], 5.27934 - 2.0 * 2.0, 1.0e-5);
+
+            // changing a used parameter updates both the cacheable and the cached observable
+            p["mass::B_u"] = 6.0;
+            cache.update();
+            TEST_CHECK_NEARLY_EQUAL(cache[id1], 6.0 - 2.0 * 2.0, 1.0e-5);
+            TEST_CHECK_NEARLY_EQUAL(cache[id2], 6.0 - 2.0 * 2.0, 1.0e-5);
+
+            // changing a kinematic variable updates both the cacheable and the cached observable
+            k.set("q2", 1.0);
+            cache.update();
+            TEST_CHECK_NEARLY_EQUAL(cache[id1], 6.0 - 2.0 * 1.0, 1.0e-5);
+            TEST_CHECK_NEARLY_EQUAL(cache[id2], 6.0 - 2.0 * 1.0, 1.0e-5);
+        }
+
+        // Test partial updates of the cache
+        {
+            Parameters p = Parameters::Defaults();
+            p["mass::B_u"] = 5.27934;
+
+            Kinematics k({{"q2", 2.0}});
+
+            using TestCacheableObservable = class ConcreteCacheableObservable<TestCacheableObservableProvider, double>;
+
+            ObservablePtr cacheable_observable(new TestCacheableObservable("test::cacheable_observable1(q2)", p, k, Options(),
+                &TestCacheableObservableProvider::prepare,
+                &TestCacheableObservableProvider::evaluate1,
+                std::make_tuple("q2")
+            ));
+            ObservablePtr cacheable_observable2(new TestCacheableObservable("test::cacheable_observable2(q2)", p, k, Options(),
+                &TestCacheableObservableProvider::prepare,
+                &TestCacheableObservableProvider::evaluate1,
+                std::make_tuple("q2")
+            ));
+            ObservablePtr cacheable_observable3(new TestCacheableObservable("test::cacheable_observable3(q2)", p, Kinematics({{"q2", 3.0}}), Options(),
+                &TestCacheableObservableProvider::prepare,
+                &TestCacheableObservableProvider::evaluate1,
+                std::make_tuple("q2")
+            ));
+
+            ObservableCache cache(p);
+            ObservableCache::Id id1 = cache.add(cacheable_observable);
+            ObservableCache::Id id2 = cache.add(cacheable_observable2);
+            ObservableCache::Id id3 = cache.add(cacheable_observable3);
+
+            cache.update();
+            TEST_CHECK_NEARLY_EQUAL(cache[id3], 5.27934 - 2.0 * 3.0, 1.0e-5);
+
+            // updating the cached observable also updates its cacheable parent, but nothing else
+            p["mass::B_u"] = 6.0;
+            cache.update(std::vector<ObservableCache::Id>{ id2 });
+            TEST_CHECK_NEARLY_EQUAL(cache[id1], 6.0 - 2.0 * 2.0, 1.0e-5);
+            TEST_CHECK_NEARLY_EQUAL(cache[id2], 6.0 - 2.0 * 2.0, 1.0e-5);
+            TEST_CHECK_NEARLY_EQUAL(cache[id3], 5.27934 - 2.0 * 3.0, 1.0e-5);
+
+            // the remaining observable stays stale until the next update
+            cache.update();
+            TEST_CHECK_NEARLY_EQUAL(cache[id3], 6.0 - 2.0 * 3.0, 1.0e-5);
+        }
     }
 } cacheable_observable_test;
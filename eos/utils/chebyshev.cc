@@ -0,0 +1,340 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/chebyshev.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/mutex.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <memory>
+
+namespace eos
+{
+    ChebyshevSeries::ChebyshevSeries() :
+        _a(-1.0),
+        _b(+1.0)
+    {
+    }
+
+    ChebyshevSeries::ChebyshevSeries(const double & a, const double & b, const std::vector<double> & values) :
+        _a(a),
+        _b(b),
+        _coefficients(values.size(), 0.0)
+    {
+        if (values.size() < 2)
+            throw InternalError("ChebyshevSeries: need at least two function values, got " + stringify(values.size()));
+
+        if (! (a < b))
+            throw InternalError("ChebyshevSeries: invalid interval [" + stringify(a) + ", " + stringify(b) + "]");
+
+        // discrete cosine transform of type I
+        const unsigned n = values.size() - 1;
+        for (unsigned j = 0 ; j <= n ; ++j)
+        {
+            double c = 0.5 * (values[0] + ((j % 2 == 0) ? values[n] : -values[n]));
+            for (unsigned k = 1 ; k < n ; ++k)
+            {
+                c += values[k] * std::cos(M_PI * ((j * k) % (2 * n)) / n);
+            }
+
+            _coefficients[j] = 2.0 / n * c;
+        }
+
+        _coefficients[0] *= 0.5;
+        _coefficients[n] *= 0.5;
+    }
+
+    std::vector<double>
+    ChebyshevSeries::points(const double & a, const double & b, const unsigned & n)
+    {
+        std::vector<double> result(n + 1);
+
+        for (unsigned k = 0 ; k <= n ; ++k)
+        {
+            result[k] = 0.5 * (a + b) + 0.5 * (b - a) * std::cos(M_PI * k / n);
+        }
+
+        // avoid round-off errors at the end points
+        result[0] = b;
+        result[n] = a;
+
+        return result;
+    }
+
+    double
+    ChebyshevSeries::operator() (const double & x) const
+    {
+        if (_coefficients.empty())
+            return 0.0;
+
+        // Clenshaw's recurrence
+        const double t = (2.0 * x - _a - _b) / (_b - _a);
+        double b_1 = 0.0, b_2 = 0.0;
+        for (unsigned j = _coefficients.size() - 1 ; j > 0 ; --j)
+        {
+            const double b_0 = _coefficients[j] + 2.0 * t * b_1 - b_2;
+            b_2 = b_1;
+            b_1 = b_0;
+        }
+
+        return _coefficients[0] + t * b_1 - b_2;
+    }
+
+    const std::vector<double> &
+    ChebyshevSeries::coefficients() const
+    {
+        return _coefficients;
+    }
+
+    double
+    ChebyshevSeries::error_estimate() const
+    {
+        if (_coefficients.size() < 2)
+            return 0.0;
+
+        double scale = 0.0;
+        for (const auto & c : _coefficients)
+        {
+            scale = std::max(scale, std::abs(c));
+        }
+
+        if (0.0 == scale)
+            return 0.0;
+
+        const unsigned n = _coefficients.size() - 1;
+
+        return std::max(std::abs(_coefficients[n]), std::abs(_coefficients[n - 1])) / scale;
+    }
+
+    std::vector<ChebyshevSeries>
+    make_chebyshev_series(const std::vector<std::function<double (const double &)>> & functions,
+            const double & a, const double & b, const double & tolerance, const unsigned & max_intervals)
+    {
+        const unsigned m = functions.size();
+
+        std::vector<ChebyshevSeries> result(m);
+        std::vector<std::vector<double>> values(m);
+        std::vector<unsigned> pending(m);
+        for (unsigned i = 0 ; i < m ; ++i)
+        {
+            pending[i] = i;
+        }
+
+        Mutex mutex;
+        std::exception_ptr exception;
+
+        for (unsigned n = 8 ; ! pending.empty() ; n *= 2)
+        {
+            const auto points = ChebyshevSeries::points(a, b, n);
+
+            // the points with even index have been evaluated in the previous iteration, if any
+            const bool refine = (n > 8);
+            const unsigned stride = refine ? 2 : 1;
+            const unsigned offset = refine ? 1 : 0;
+            const unsigned new_points = refine ? n / 2 : n + 1;
+
+            std::vector<std::vector<double>> new_values(pending.size(), std::vector<double>(new_points));
+            ThreadPool::instance()->parallel_for(pending.size() * new_points, [&] (unsigned job)
+            {
+                const unsigned i = job / new_points, k = job % new_points;
+
+                try
+                {
+                    new_values[i][k] = functions[pending[i]](points[offset + stride * k]);
+                }
+                catch (...)
+                {
+                    Lock l(mutex);
+                    exception = std::current_exception();
+                }
+            });
+
+            if (exception)
+                std::rethrow_exception(exception);
+
+            std::vector<unsigned> still_pending;
+            for (unsigned i = 0 ; i < pending.size() ; ++i)
+            {
+                auto & v = values[pending[i]];
+
+                if (refine)
+                {
+                    std::vector<double> merged(n + 1);
+                    for (unsigned k = 0 ; k <= n ; ++k)
+                    {
+                        merged[k] = (k % 2 == 0) ? v[k / 2] : new_values[i][k / 2];
+                    }
+                    v.swap(merged);
+                }
+                else
+                {
+                    v.swap(new_values[i]);
+                }
+
+                result[pending[i]] = ChebyshevSeries(a, b, v);
+
+                // non-finite values cannot be improved upon by further refinement
+                const double error = result[pending[i]].error_estimate();
+                if (! std::isfinite(error) || (error <= tolerance))
+                    continue;
+
+                if (2 * n > max_intervals)
+                {
+                    Log::instance()->message("make_chebyshev_series", ll_warning)
+                        << "Chebyshev series for function #" << pending[i] << " on [" << a << ", " << b << "] does not meet the tolerance "
+                        << tolerance << " with " << n << " intervals; estimated error is " << error;
+                    continue;
+                }
+
+                still_pending.push_back(pending[i]);
+            }
+
+            pending.swap(still_pending);
+        }
+
+        return result;
+    }
+
+    template <>
+    struct Implementation<ChebyshevInterpolation>
+    {
+        Parameters parameters;
+
+        const ParameterUser * user;
+
+        std::vector<std::function<double (const double &)>> functions;
+
+        double a, b;
+
+        double tolerance;
+
+        // the interpolants, and the sum of the version counters of all used parameters at their construction
+        struct Interpolants
+        {
+            unsigned long version;
+
+            std::vector<ChebyshevSeries> series;
+        };
+
+        // guards the members below, but not the construction of the interpolants
+        Mutex mutex;
+
+        // the parameters on which the functions depend, resolved upon first evaluation
+        bool resolved;
+        std::vector<Parameter> used_parameters;
+
+        // the most recently constructed interpolants, which are never modified once published
+        std::shared_ptr<const Interpolants> interpolants;
+
+        Implementation(const Parameters & parameters, const ParameterUser & user,
+                const std::vector<std::function<double (const double &)>> & functions,
+                const double & a, const double & b, const double & tolerance) :
+            parameters(parameters),
+            user(&user),
+            functions(functions),
+            a(a),
+            b(b),
+            tolerance(tolerance),
+            resolved(false)
+        {
+            if (! (a < b))
+                throw InternalError("ChebyshevInterpolation: invalid interval [" + stringify(a) + ", " + stringify(b) + "]");
+
+            if (! (tolerance > 0.0))
+                throw InternalError("ChebyshevInterpolation: tolerance must be positive, got " + stringify(tolerance));
+        }
+
+        // retrieve the interpolants for the current parameter values, constructing them if needed
+        std::shared_ptr<const Interpolants> current()
+        {
+            unsigned long version = 0;
+
+            {
+                Lock l(mutex);
+
+                if (! resolved)
+                {
+                    for (const auto & id : *user)
+                    {
+                        used_parameters.push_back(parameters[id]);
+                    }
+
+                    user = nullptr;
+                    resolved = true;
+                }
+
+                for (const auto & p : used_parameters)
+                {
+                    version += p.version();
+                }
+
+                if (interpolants && (interpolants->version == version))
+                    return interpolants;
+            }
+
+            // construct the interpolants without holding the lock. The construction runs on the ThreadPool,
+            // whose jobs might evaluate this interpolation themselves. Concurrent callers might construct the
+            // same interpolants redundantly.
+            std::shared_ptr<const Interpolants> result(new Interpolants{ version, make_chebyshev_series(functions, a, b, tolerance) });
+
+            {
+                Lock l(mutex);
+
+                // version counters only ever increase, and so does their sum; never replace newer interpolants
+                if ((! interpolants) || (interpolants->version < version))
+                    interpolants = result;
+            }
+
+            return result;
+        }
+    };
+
+    ChebyshevInterpolation::ChebyshevInterpolation(const Parameters & parameters, const ParameterUser & user,
+            const std::vector<std::function<double (const double &)>> & functions,
+            const double & a, const double & b, const double & tolerance) :
+        PrivateImplementationPattern<ChebyshevInterpolation>(new Implementation<ChebyshevInterpolation>(parameters, user, functions, a, b, tolerance))
+    {
+    }
+
+    ChebyshevInterpolation::~ChebyshevInterpolation()
+    {
+    }
+
+    bool
+    ChebyshevInterpolation::contains(const double & x) const
+    {
+        return (_imp->a <= x) && (x <= _imp->b);
+    }
+
+    double
+    ChebyshevInterpolation::evaluate(const unsigned & index, const double & x) const
+    {
+        if (index >= _imp->functions.size())
+            throw InternalError("ChebyshevInterpolation::evaluate: index " + stringify(index) + " out of range");
+
+        return _imp->current()->series[index](x);
+    }
+}
@@ -0,0 +1,142 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_CHEBYSHEV_HH
+#define EOS_GUARD_EOS_UTILS_CHEBYSHEV_HH 1
+
+#include <eos/utils/parameters.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <functional>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * A finite Chebyshev series that approximates a real-valued function on the interval [a, b].
+     *
+     * The series is constructed from the function's values at the n + 1 Chebyshev points
+     * of the second kind, x_k = (a + b) / 2 + (b - a) / 2 * cos(pi * k / n), k = 0, ..., n.
+     */
+    class ChebyshevSeries
+    {
+        private:
+            double _a, _b;
+
+            std::vector<double> _coefficients;
+
+        public:
+            ///@name Basic Functions
+            ///@{
+            /// Constructor for an empty series, which evaluates to zero.
+            ChebyshevSeries();
+
+            /*!
+             * Constructor.
+             *
+             * @param a      The lower end of the interval.
+             * @param b      The upper end of the interval.
+             * @param values The function values at the n + 1 points as returned by ChebyshevSeries::points(a, b, n).
+             */
+            ChebyshevSeries(const double & a, const double & b, const std::vector<double> & values);
+            ///@}
+
+            /*!
+             * The n + 1 Chebyshev points of the second kind on the interval [a, b], in descending order.
+             *
+             * The points for n are a subset of the points for 2 n, i.e., the point k for n is the point 2 k for 2 n.
+             */
+            static std::vector<double> points(const double & a, const double & b, const unsigned & n);
+
+            /// Evaluate the series at x.
+            double operator() (const double & x) const;
+
+            /// Retrieve the series' coefficients c_0, ..., c_n.
+            const std::vector<double> & coefficients() const;
+
+            /*!
+             * Estimate the relative truncation error of the series, using the magnitude of its last two
+             * coefficients relative to its largest coefficient.
+             */
+            double error_estimate() const;
+    };
+
+    /*!
+     * Construct the Chebyshev series of several functions on the interval [a, b] to a common tolerance.
+     *
+     * The functions are evaluated in parallel. Starting with 8 intervals, the number of intervals is
+     * doubled for all functions whose series do not yet meet the tolerance, reusing all previous function values.
+     *
+     * @param functions     The functions to be approximated.
+     * @param a             The lower end of the interval.
+     * @param b             The upper end of the interval.
+     * @param tolerance     The target for the relative truncation error of each series.
+     * @param max_intervals The largest number of intervals.
+     */
+    std::vector<ChebyshevSeries> make_chebyshev_series(const std::vector<std::function<double (const double &)>> & functions,
+            const double & a, const double & b, const double & tolerance, const unsigned & max_intervals = 256);
+
+    /*!
+     * Interpolation of several functions of one real variable, whose values depend on a set of parameters.
+     *
+     * The interpolants are lazily (re)constructed whenever the value of at least one of the
+     * parameters used by the functions has changed.
+     *
+     * Evaluation is thread-safe. The interpolants are constructed on the ThreadPool without holding
+     * a lock, and then published for subsequent evaluations.
+     */
+    class ChebyshevInterpolation :
+        public PrivateImplementationPattern<ChebyshevInterpolation>
+    {
+        public:
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param parameters The parameters on which the functions depend.
+             * @param user       The user of the parameters on which the functions depend. Its set of parameter
+             *                   ids is only read upon the first evaluation, and needs to stay alive until then.
+             * @param functions  The functions to be interpolated.
+             * @param a          The lower end of the interpolation interval.
+             * @param b          The upper end of the interpolation interval.
+             * @param tolerance  The target for the relative truncation error of each interpolant.
+             */
+            ChebyshevInterpolation(const Parameters & parameters, const ParameterUser & user,
+                    const std::vector<std::function<double (const double &)>> & functions,
+                    const double & a, const double & b, const double & tolerance);
+
+            /// Destructor.
+            ~ChebyshevInterpolation();
+            ///@}
+
+            /// Check if x lies within the interpolation interval.
+            bool contains(const double & x) const;
+
+            /*!
+             * Evaluate one of the interpolants.
+             *
+             * @param index The index of the function to be interpolated.
+             * @param x     The point of evaluation, which must lie within the interpolation interval.
+             */
+            double evaluate(const unsigned & index, const double & x) const;
+    };
+}
+
+#endif
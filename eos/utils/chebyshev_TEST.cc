@@ -0,0 +1,144 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/chebyshev.hh>
+#include <eos/utils/power_of.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class ChebyshevTest :
+    public TestCase
+{
+    public:
+        ChebyshevTest() :
+            TestCase("chebyshev_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            /* Series of a polynomial is exact */
+            {
+                const auto f = [] (const double & x) { return 1.0 - 2.0 * x + 0.5 * x * x * x; };
+                const auto points = ChebyshevSeries::points(-2.0, 3.0, 8);
+
+                TEST_CHECK_EQUAL(points.size(), 9u);
+                TEST_CHECK_EQUAL(points.front(), 3.0);
+                TEST_CHECK_EQUAL(points.back(), -2.0);
+
+                std::vector<double> values;
+                for (const auto & x : points)
+                {
+                    values.push_back(f(x));
+                }
+
+                ChebyshevSeries s(-2.0, 3.0, values);
+
+                TEST_CHECK_NEARLY_EQUAL(s(-2.0), f(-2.0), 1e-12);
+                TEST_CHECK_NEARLY_EQUAL(s(-0.7), f(-0.7), 1e-12);
+                TEST_CHECK_NEARLY_EQUAL(s( 1.3), f( 1.3), 1e-12);
+                TEST_CHECK_NEARLY_EQUAL(s( 3.0), f( 3.0), 1e-12);
+
+                // all coefficients beyond the cubic one vanish
+                for (unsigned j = 4 ; j < s.coefficients().size() ; ++j)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(s.coefficients()[j], 0.0, 1e-13);
+                }
+                TEST_CHECK(s.error_estimate() < 1e-13);
+            }
+
+            /* Adaptive construction meets the tolerance */
+            {
+                const std::vector<std::function<double (const double &)>> functions
+                {
+                    [] (const double & x) { return std::exp(x); },
+                    [] (const double & x) { return 1.0 / (1.0 - x / 30.0); },
+                    [] (const double & x) { return std::sin(3.0 * x); }
+                };
+
+                const auto series = make_chebyshev_series(functions, -10.0, 10.0, 1e-10);
+                TEST_CHECK_EQUAL(series.size(), 3u);
+
+                // the tolerance applies relative to the largest magnitude of each function
+                for (double x = -10.0 ; x <= 10.0 ; x += 0.37)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(series[0](x), std::exp(x),            1e-9 * std::exp(10.0));
+                    TEST_CHECK_NEARLY_EQUAL(series[1](x), 1.0 / (1.0 - x / 30.0), 1e-9);
+                    TEST_CHECK_NEARLY_EQUAL(series[2](x), std::sin(3.0 * x),      1e-9);
+                }
+
+                // the smooth pole-like function needs fewer points than the oscillating one
+                TEST_CHECK(series[1].coefficients().size() < series[2].coefficients().size());
+            }
+
+            /* Interpolation is rebuilt when the parameters change */
+            {
+                Parameters p = Parameters::Defaults();
+                Parameter m_c = p["mass::c"];
+                ParameterUser u;
+                u.uses(m_c.id());
+
+                std::atomic<unsigned> evaluations(0);
+                const std::vector<std::function<double (const double &)>> functions
+                {
+                    [&] (const double & x) { ++evaluations; return m_c() * x * x; }
+                };
+
+                ChebyshevInterpolation interpolation(p, u, functions, 0.0, 10.0, 1e-8);
+
+                TEST_CHECK(interpolation.contains(0.0));
+                TEST_CHECK(interpolation.contains(10.0));
+                TEST_CHECK(! interpolation.contains(10.5));
+
+                m_c = 1.5;
+                TEST_CHECK_NEARLY_EQUAL(interpolation.evaluate(0, 2.0), 6.0, 1e-12);
+                const unsigned evaluations_first = evaluations.load();
+                TEST_CHECK(evaluations_first > 0);
+
+                // same parameter point: no further evaluations
+                TEST_CHECK_NEARLY_EQUAL(interpolation.evaluate(0, 3.0), 13.5, 1e-12);
+                TEST_CHECK_EQUAL(evaluations.load(), evaluations_first);
+
+                // new parameter point
+                m_c = 2.0;
+                TEST_CHECK_NEARLY_EQUAL(interpolation.evaluate(0, 3.0), 18.0, 1e-12);
+                TEST_CHECK(evaluations.load() > evaluations_first);
+
+                // concurrent evaluation from within the ThreadPool, which also constructs the interpolants
+                m_c = 3.0;
+                std::vector<double> results(64);
+                ThreadPool::instance()->parallel_for(results.size(), [&] (unsigned i)
+                {
+                    results[i] = interpolation.evaluate(0, 0.15 * i);
+                });
+
+                for (unsigned i = 0 ; i < results.size() ; ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(results[i], 3.0 * power_of<2>(0.15 * i), 1e-10);
+                }
+            }
+        }
+} chebyshev_test;
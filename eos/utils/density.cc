@@ -29,6 +29,12 @@ namespace eos
     {
     }
 
+    double
+    Density::evaluate_bounded(const double &) const
+    {
+        return evaluate();
+    }
+
     template class WrappedForwardIterator<Density::IteratorTag, const ParameterDescription>;
 
     template <>
@@ -42,6 +42,17 @@ namespace eos
              */
             virtual double evaluate() const = 0;
 
+            /*!
+             * Evaluate the density function at the current parameter point
+             * on the _log_ scale, if it exceeds a given bound.
+             *
+             * Implementations may return -inf as soon as the density is found
+             * to fall below the bound. The default implementation calls evaluate().
+             *
+             * @param bound The value below which the log(density) is of no interest.
+             */
+            virtual double evaluate_bounded(const double & bound) const;
+
             /// Create an independent copy of this density function.
             virtual DensityPtr clone() const = 0;
 
@@ -0,0 +1,237 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_DUAL_HH
+#define EOS_GUARD_EOS_UTILS_DUAL_HH 1
+
+#include <array>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * A dual number for forward-mode automatic differentiation with respect to n_ variables.
+     *
+     * Carries the value of an expression together with its partial derivatives with respect to
+     * the n_ variables, which are propagated exactly through all arithmetic operations.
+     */
+    template <unsigned n_> struct Dual
+    {
+        double value;
+
+        std::array<double, n_> derivatives;
+
+        /// Constructor for a constant, i.e. all derivatives vanish.
+        Dual(const double & value = 0.0) :
+            value(value)
+        {
+            derivatives.fill(0.0);
+        }
+
+        /*!
+         * Create the index-th variable.
+         *
+         * @param value The value of the variable.
+         * @param index The index of the variable, with 0 <= index < n_.
+         * @param seed  The derivative of the variable with respect to itself.
+         */
+        static Dual variable(const double & value, const unsigned & index, const double & seed = 1.0)
+        {
+            Dual result(value);
+            result.derivatives[index] = seed;
+
+            return result;
+        }
+
+        Dual & operator+= (const Dual & other)
+        {
+            value += other.value;
+            for (unsigned i = 0 ; i < n_ ; ++i)
+                derivatives[i] += other.derivatives[i];
+
+            return *this;
+        }
+
+        Dual & operator-= (const Dual & other)
+        {
+            value -= other.value;
+            for (unsigned i = 0 ; i < n_ ; ++i)
+                derivatives[i] -= other.derivatives[i];
+
+            return *this;
+        }
+
+        Dual & operator*= (const Dual & other)
+        {
+            for (unsigned i = 0 ; i < n_ ; ++i)
+                derivatives[i] = derivatives[i] * other.value + value * other.derivatives[i];
+            value *= other.value;
+
+            return *this;
+        }
+
+        Dual & operator/= (const Dual & other)
+        {
+            const double inverse = 1.0 / other.value;
+            value *= inverse;
+            for (unsigned i = 0 ; i < n_ ; ++i)
+                derivatives[i] = (derivatives[i] - value * other.derivatives[i]) * inverse;
+
+            return *this;
+        }
+
+        Dual & operator*= (const double & other)
+        {
+            value *= other;
+            for (unsigned i = 0 ; i < n_ ; ++i)
+                derivatives[i] *= other;
+
+            return *this;
+        }
+
+        Dual & operator/= (const double & other)
+        {
+            return *this *= (1.0 / other);
+        }
+
+        ///@name Elementary functions, found by argument-dependent lookup only
+        ///@{
+        friend Dual sqrt(const Dual & x)
+        {
+            const double value = std::sqrt(x.value);
+
+            Dual result(x);
+            result *= 0.5 / value;
+            result.value = value;
+
+            return result;
+        }
+
+        friend Dual exp(const Dual & x)
+        {
+            const double value = std::exp(x.value);
+
+            Dual result(x);
+            result *= value;
+            result.value = value;
+
+            return result;
+        }
+
+        friend Dual log(const Dual & x)
+        {
+            Dual result(x);
+            result /= x.value;
+            result.value = std::log(x.value);
+
+            return result;
+        }
+
+        friend Dual pow(const Dual & x, const double & a)
+        {
+            const double value = std::pow(x.value, a);
+
+            Dual result(x);
+            result *= a * std::pow(x.value, a - 1.0);
+            result.value = value;
+
+            return result;
+        }
+        ///@}
+    };
+
+    template <unsigned n_> Dual<n_> operator- (const Dual<n_> & x)
+    {
+        Dual<n_> result(x);
+        result *= -1.0;
+
+        return result;
+    }
+
+    template <unsigned n_> Dual<n_> operator+ (Dual<n_> x, const Dual<n_> & y) { return x += y; }
+    template <unsigned n_> Dual<n_> operator+ (Dual<n_> x, const double & y)   { return x += Dual<n_>(y); }
+    template <unsigned n_> Dual<n_> operator+ (const double & x, Dual<n_> y)   { return y += Dual<n_>(x); }
+
+    template <unsigned n_> Dual<n_> operator- (Dual<n_> x, const Dual<n_> & y) { return x -= y; }
+    template <unsigned n_> Dual<n_> operator- (Dual<n_> x, const double & y)   { return x -= Dual<n_>(y); }
+    template <unsigned n_> Dual<n_> operator- (const double & x, const Dual<n_> & y) { return Dual<n_>(x) -= y; }
+
+    template <unsigned n_> Dual<n_> operator* (Dual<n_> x, const Dual<n_> & y) { return x *= y; }
+    template <unsigned n_> Dual<n_> operator* (Dual<n_> x, const double & y)   { return x *= y; }
+    template <unsigned n_> Dual<n_> operator* (const double & x, Dual<n_> y)   { return y *= x; }
+
+    template <unsigned n_> Dual<n_> operator/ (Dual<n_> x, const Dual<n_> & y) { return x /= y; }
+    template <unsigned n_> Dual<n_> operator/ (Dual<n_> x, const double & y)   { return x /= y; }
+    template <unsigned n_> Dual<n_> operator/ (const double & x, const Dual<n_> & y) { return Dual<n_>(x) /= y; }
+
+    /*!
+     * Create a scalar of type T_ from the value of a variable.
+     *
+     * For T_ = double, this is the value itself. For dual numbers, this creates the index-th variable
+     * with the derivative seed, such that the same code computes either values or values and derivatives.
+     */
+    template <typename T_> struct ScalarTraits;
+
+    template <> struct ScalarTraits<double>
+    {
+        static double variable(const double & value, const unsigned &, const double & = 1.0)
+        {
+            return value;
+        }
+    };
+
+    template <unsigned n_> struct ScalarTraits<Dual<n_>>
+    {
+        static Dual<n_> variable(const double & value, const unsigned & index, const double & seed = 1.0)
+        {
+            return Dual<n_>::variable(value, index, seed);
+        }
+    };
+
+    template <typename T_> T_ make_variable(const double & value, const unsigned & index, const double & seed = 1.0)
+    {
+        return ScalarTraits<T_>::variable(value, index, seed);
+    }
+
+    /*!
+     * Pair the derivatives of a dual number with the identifiers of the respective variables.
+     *
+     * All n_ derivatives are paired, including the vanishing ones, so that the result
+     * also states with respect to which variables the derivatives are known.
+     *
+     * @param x   The dual number.
+     * @param ids The identifiers of the n_ variables, e.g. parameter ids.
+     */
+    template <unsigned n_, typename Ids_>
+    std::vector<std::pair<typename Ids_::value_type, double>> paired_derivatives(const Dual<n_> & x, const Ids_ & ids)
+    {
+        std::vector<std::pair<typename Ids_::value_type, double>> result;
+        result.reserve(n_);
+        for (unsigned i = 0 ; i < n_ ; ++i)
+        {
+            result.emplace_back(ids[i], x.derivatives[i]);
+        }
+
+        return result;
+    }
+}
+
+#endif
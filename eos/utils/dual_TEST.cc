@@ -0,0 +1,91 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/dual.hh>
+
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+class DualTest :
+    public TestCase
+{
+    public:
+        DualTest() :
+            TestCase("dual_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-14;
+
+            /* Arithmetic */
+            {
+                const Dual<2> x = Dual<2>::variable(1.5, 0), y = Dual<2>::variable(-0.5, 1);
+
+                // f(x, y) = (x * y + 3 x - 2) / (x - y) - y / 4
+                const Dual<2> f = (x * y + 3.0 * x - 2.0) / (x - y) - y / 4.0;
+
+                const double n = 1.5 * -0.5 + 4.5 - 2.0, d = 2.0;
+                TEST_CHECK_NEARLY_EQUAL(f.value, n / d + 0.125, eps);
+                TEST_CHECK_NEARLY_EQUAL(f.derivatives[0], (-0.5 + 3.0) / d - n / (d * d),          eps);
+                TEST_CHECK_NEARLY_EQUAL(f.derivatives[1], 1.5 / d + n / (d * d) - 0.25,            eps);
+
+                const Dual<2> g = -(1.0 / x) + (2.0 - y);
+                TEST_CHECK_NEARLY_EQUAL(g.value,          -1.0 / 1.5 + 2.5, eps);
+                TEST_CHECK_NEARLY_EQUAL(g.derivatives[0], 1.0 / 2.25,       eps);
+                TEST_CHECK_NEARLY_EQUAL(g.derivatives[1], -1.0,             eps);
+            }
+
+            /* Elementary functions */
+            {
+                const Dual<1> x = Dual<1>::variable(2.0, 0);
+
+                TEST_CHECK_NEARLY_EQUAL(sqrt(x).derivatives[0],     0.5 / std::sqrt(2.0),        eps);
+                TEST_CHECK_NEARLY_EQUAL(exp(x).derivatives[0],      std::exp(2.0),               eps);
+                TEST_CHECK_NEARLY_EQUAL(log(x).derivatives[0],      0.5,                         eps);
+                TEST_CHECK_NEARLY_EQUAL(pow(x, 1.5).derivatives[0], 1.5 * std::sqrt(2.0),        eps);
+                TEST_CHECK_NEARLY_EQUAL(pow(x, 1.5).value,          std::pow(2.0, 1.5),          eps);
+            }
+
+            /* Variables of scalar type */
+            {
+                TEST_CHECK_EQUAL(make_variable<double>(3.0, 1), 3.0);
+
+                const auto x = make_variable<Dual<3>>(3.0, 1, 2.0);
+                TEST_CHECK_EQUAL(x.value, 3.0);
+                TEST_CHECK_EQUAL(x.derivatives[0], 0.0);
+                TEST_CHECK_EQUAL(x.derivatives[1], 2.0);
+                TEST_CHECK_EQUAL(x.derivatives[2], 0.0);
+
+                const std::array<unsigned, 3> ids{{ 7, 8, 9 }};
+                const auto derivatives = paired_derivatives(x * x, ids);
+                TEST_CHECK_EQUAL(derivatives.size(), 3u);
+                TEST_CHECK_EQUAL(derivatives[0].first, 7u);
+                TEST_CHECK_EQUAL(derivatives[0].second, 0.0);
+                TEST_CHECK_EQUAL(derivatives[1].first, 8u);
+                TEST_CHECK_NEARLY_EQUAL(derivatives[1].second, 12.0, eps);
+                TEST_CHECK_EQUAL(derivatives[2].first, 9u);
+                TEST_CHECK_EQUAL(derivatives[2].second, 0.0);
+            }
+        }
+} dual_test;
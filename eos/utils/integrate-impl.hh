@@ -31,6 +31,75 @@
 
 namespace eos
 {
+    namespace implementation
+    {
+        // Simpson's rule for the n + 1 equidistant samples y, refined by Aitken's Delta^2 rule.
+        // Returns false if the refinement is too large, i.e., if more sampling points are needed.
+        template <std::size_t k>
+        bool simpson_aitken(const std::array<double, k> * y, const unsigned & n, const double & h, std::array<double, k> & result)
+        {
+            std::array<double, k> Q0; Q0.fill(0.0);
+            std::array<double, k> Q1; Q1.fill(0.0);
+            std::array<double, k> Q2; Q2.fill(0.0);
+
+            for (unsigned i = 0 ; i < n / 8 ; ++i)
+            {
+                Q0 = Q0 + y[8 * i] + 4.0 * y[8 * i + 4] + y[8 * i + 4];
+            }
+            for (unsigned i = 0 ; i < n / 4 ; ++i)
+            {
+                Q1 = Q1 + y[4 * i] + 4.0 * y[4 * i + 2] + y[4 * i + 4];
+            }
+            for (unsigned i = 0 ; i < n / 2 ; ++i)
+            {
+                Q2 = Q2 + y[2 * i] + 4.0 * y[2 * i + 1] + y[2 * i + 2];
+            }
+
+            Q0 = (h / 3.0 * 4.0) * Q0;
+            Q1 = (h / 3.0 * 2.0) * Q1;
+            Q2 = (h / 3.0) * Q2;
+
+            std::array<double, k> denom = Q0 + Q2 - 2.0 * Q1;
+            std::array<double, k> num = Q2 - Q1;
+            std::array<double, k> correction = divide(mult(num, num), denom);
+
+            bool correction_valid = true;
+            for (unsigned i = 0 ; i < k ; ++i)
+            {
+                if (std::isnan(correction[i]))
+                {
+                    correction_valid = false;
+                    break;
+                }
+            }
+
+            if (!correction_valid)
+            {
+                result = Q2;
+
+                return true;
+            }
+
+            for (unsigned i = 0 ; i < k ; ++i)
+            {
+                if ((abs(correction[i] / Q2[i])) > 1.0)
+                {
+#if 0
+                    std::cerr << "Q0 = " << Q0 << std::endl;
+                    std::cerr << "Q1 = " << Q1 << std::endl;
+                    std::cerr << "Q2 = " << Q2 << std::endl;
+                    std::cerr << "Reintegrating with twice the number of data points" << std::endl;
+#endif
+                    return false;
+                }
+            }
+
+            result = Q2 - correction;
+
+            return true;
+        }
+    }
+
     template <std::size_t k> std::array<double, k> integrate1D(const std::function<std::array<double, k> (const double &)> & f, unsigned n, const double & a, const double & b)
     {
         if (n & 0x1)
@@ -43,79 +112,45 @@ namespace eos
         double h = (b - a) / n;
 
         // evaluate function for every sampling point
-        std::vector<std::array<double, k>> y;
+        std::vector<std::array<double, k>> y(n + 1);
         for (unsigned i = 0 ; i < n + 1 ; ++i)
         {
-            y.push_back(f(a + i * h));
+            y[i] = f(a + i * h);
         }
 
-        std::array<double, k> Q0; Q0.fill(0.0);
-        std::array<double, k> Q1; Q1.fill(0.0);
-        std::array<double, k> Q2; Q2.fill(0.0);
+        std::array<double, k> result;
+        if (implementation::simpson_aitken(y.data(), n, h, result))
+            return result;
 
-        for (unsigned i = 0 ; i < n / 8 ; ++i)
-        {
-            Q0 = Q0 + y[8 * i] + 4.0 * y[8 * i + 4] + y[8 * i + 4];
-        }
-        for (unsigned i = 0 ; i < n / 4 ; ++i)
-        {
-            Q1 = Q1 + y[4 * i] + 4.0 * y[4 * i + 2] + y[4 * i + 4];
-        }
-        for (unsigned i = 0 ; i < n / 2 ; ++i)
-        {
-            Q2 = Q2 + y[2 * i] + 4.0 * y[2 * i + 1] + y[2 * i + 2];
-        }
+        return integrate1D(f, 2 * n, a, b);
+    }
 
-        Q0 = (h / 3.0 * 4.0) * Q0;
-        Q1 = (h / 3.0 * 2.0) * Q1;
-        Q2 = (h / 3.0) * Q2;
+    template <std::size_t k> std::array<double, k> integrate1D(const batch::fadd<k> & f, unsigned n, const double & a, const double & b)
+    {
+        if (n & 0x1)
+            n += 1;
 
-        std::array<double, k> denom = Q0 + Q2 - 2.0 * Q1;
-        std::array<double, k> num = Q2 - Q1;
-        std::array<double, k> correction = divide(mult(num, num), denom);
+        if (n < 16)
+            n = 16;
 
-        bool correction_valid = true;
-        for (unsigned i = 0 ; i < k ; ++i)
-        {
-            if (std::isnan(correction[i]))
-            {
-                correction_valid = false;
-                break;
-            }
-        }
+        // step width
+        double h = (b - a) / n;
 
-        if (!correction_valid)
+        // evaluate function for all sampling points at once
+        std::vector<double> x(n + 1);
+        for (unsigned i = 0 ; i < n + 1 ; ++i)
         {
-            return Q2;
+            x[i] = a + i * h;
         }
-        else
-        {
-            bool correction_small = true;
 
-            for (unsigned i = 0 ; i < k ; ++i)
-            {
-                if ((abs(correction[i] / Q2[i])) > 1.0)
-                {
-                    correction_small = false;
-                    break;
-                }
-            }
+        std::vector<std::array<double, k>> y(n + 1);
+        f(x.data(), y.data(), n + 1);
 
-            if (correction_small)
-            {
-                return Q2 - correction;
-            }
-            else
-            {
-#if 0
-                std::cerr << "Q0 = " << Q0 << std::endl;
-                std::cerr << "Q1 = " << Q1 << std::endl;
-                std::cerr << "Q2 = " << Q2 << std::endl;
-                std::cerr << "Reintegrating with twice the number of data points" << std::endl;
-#endif
-                return integrate1D(f, 2 * n, a, b);
-            }
-        }
+        std::array<double, k> result;
+        if (implementation::simpson_aitken(y.data(), n, h, result))
+            return result;
+
+        return integrate1D(f, 2 * n, a, b);
     }
 
     namespace cubature
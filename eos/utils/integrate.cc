@@ -20,9 +20,14 @@
 
 #include <eos/utils/integrate.hh>
 #include <eos/utils/matrix.hh>
+#include <eos/utils/stringify.hh>
 
 #include <gsl/gsl_errno.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <limits>
 #include <vector>
 
@@ -41,6 +46,57 @@ namespace eos
     using std::real;
     using std::imag;
 
+    namespace implementation
+    {
+        // Simpson's rule for the n + 1 equidistant samples y, refined by Aitken's Delta^2 rule.
+        // Returns false if the refinement is too large, i.e., if more sampling points are needed.
+        bool simpson_aitken(const double * y, const unsigned & n, const double & h, double & result)
+        {
+            double Q0 = 0.0, Q1 = 0.0, Q2 = 0.0;
+            for (unsigned k(0) ; k < n / 8 ; ++k)
+            {
+                Q0 += y[8 * k] + 4.0 * y[8 * k + 4] + y[8 * k + 4];
+            }
+            for (unsigned k(0) ; k < n / 4 ; ++k)
+            {
+                Q1 += y[4 * k] + 4.0 * y[4 * k + 2] + y[4 * k + 4];
+            }
+            for (unsigned k(0) ; k < n / 2 ; ++k)
+            {
+                Q2 += y[2 * k] + 4.0 * y[2 * k + 1] + y[2 * k + 2];
+            }
+
+            Q0 = Q0 * h / 3.0 * 4.0;
+            Q1 = Q1 * h / 3.0 * 2.0;
+            Q2 = Q2 * h / 3.0;
+
+            double denom = (Q0 + Q2 - 2.0 * Q1);
+            double num = Q2 - Q1;
+            double correction = num * num / denom;
+
+            if (std::isnan(correction))
+            {
+                result = Q2;
+            }
+            else if (abs(correction / Q2) < 1.0)
+            {
+                result = Q2 - correction;
+            }
+            else
+            {
+#if 0
+                std::cerr << "Q0 = " << Q0 << std::endl;
+                std::cerr << "Q1 = " << Q1 << std::endl;
+                std::cerr << "Q2 = " << Q2 << std::endl;
+                std::cerr << "Reintegrating with twice the number of data points" << std::endl;
+#endif
+                return false;
+            }
+
+            return true;
+        }
+    }
+
     double integrate1D(const std::function<double (const double &)> & f, unsigned n, const double & a, const double & b)
     {
         if (n & 0x1)
@@ -50,52 +106,42 @@ namespace eos
             n = 16;
 
         double h = (b - a) / n;
-        std::vector<double> y;
+        std::vector<double> y(n + 1);
 
         for (unsigned k(0) ; k < n + 1 ; ++k)
         {
-            y.push_back(f(a + k * h));
+            y[k] = f(a + k * h);
         }
 
-        double Q0 = 0.0, Q1 = 0.0, Q2 = 0.0;
-        for (unsigned k(0) ; k < n / 8 ; ++k)
-        {
-            Q0 += y[8 * k] + 4.0 * y[8 * k + 4] + y[8 * k + 4];
-        }
-        for (unsigned k(0) ; k < n / 4 ; ++k)
-        {
-            Q1 += y[4 * k] + 4.0 * y[4 * k + 2] + y[4 * k + 4];
-        }
-        for (unsigned k(0) ; k < n / 2 ; ++k)
+        double result;
+        if (! implementation::simpson_aitken(y.data(), n, h, result))
         {
-            Q2 += y[2 * k] + 4.0 * y[2 * k + 1] + y[2 * k + 2];
+            result = integrate1D(f, 2 * n, a, b);
         }
 
-        Q0 = Q0 * h / 3.0 * 4.0;
-        Q1 = Q1 * h / 3.0 * 2.0;
-        Q2 = Q2 * h / 3.0;
+        return result;
+    }
 
-        double denom = (Q0 + Q2 - 2.0 * Q1);
-        double num = Q2 - Q1;
-        double correction = num * num / denom;
-        double result;
+    double integrate1D(const batch::fdd & f, unsigned n, const double & a, const double & b)
+    {
+        if (n & 0x1)
+            n += 1;
 
-        if (std::isnan(correction))
-        {
-            result = Q2;
-        }
-        else if (abs(correction / Q2) < 1.0)
+        if (n < 16)
+            n = 16;
+
+        double h = (b - a) / n;
+        std::vector<double> x(n + 1), y(n + 1);
+
+        for (unsigned k(0) ; k < n + 1 ; ++k)
         {
-            result = Q2 - correction;
+            x[k] = a + k * h;
         }
-        else
+        f(x.data(), y.data(), n + 1);
+
+        double result;
+        if (! implementation::simpson_aitken(y.data(), n, h, result))
         {
-#if 0
-            std::cerr << "Q0 = " << Q0 << std::endl;
-            std::cerr << "Q1 = " << Q1 << std::endl;
-            std::cerr << "Q2 = " << Q2 << std::endl;
-            std::cerr << "Reintegrating with twice the number of data points" << std::endl;
-#endif
             result = integrate1D(f, 2 * n, a, b);
         }
 
@@ -282,6 +328,505 @@ namespace eos
         return result;
     }
 
+    GaussLegendre::Config::Config() :
+        _order(16),
+        _subintervals(1)
+    {
+    }
+
+    unsigned GaussLegendre::Config::order() const
+    {
+        return _order;
+    }
+
+    GaussLegendre::Config & GaussLegendre::Config::order(const unsigned & x)
+    {
+        if ((x < 1) || (x > GaussLegendre::maximal_order))
+            throw InternalError("GaussLegendre::Config: order must be in the range [1, " + stringify(GaussLegendre::maximal_order) + "]");
+
+        _order = x;
+        return *this;
+    }
+
+    unsigned GaussLegendre::Config::subintervals() const
+    {
+        return _subintervals;
+    }
+
+    GaussLegendre::Config & GaussLegendre::Config::subintervals(const unsigned & x)
+    {
+        if (x < 1)
+            throw InternalError("GaussLegendre::Config: need at least one subinterval");
+
+        _subintervals = x;
+        return *this;
+    }
+
+    namespace implementation
+    {
+        // nodes and weights of the Gauss-Legendre rules on [-1, 1]
+        struct GaussLegendreRules
+        {
+            std::array<std::vector<double>, GaussLegendre::maximal_order + 1> nodes, weights;
+
+            GaussLegendreRules()
+            {
+                for (unsigned n = 1 ; n <= GaussLegendre::maximal_order ; ++n)
+                {
+                    nodes[n].resize(n);
+                    weights[n].resize(n);
+
+                    // the rule is symmetric; find the non-negative roots of P_n by Newton's method
+                    for (unsigned i = 0 ; i < (n + 1) / 2 ; ++i)
+                    {
+                        double x = std::cos(M_PI * (i + 0.75) / (n + 0.5)), dp = 0.0;
+
+                        for (unsigned iteration = 0 ; iteration < 100 ; ++iteration)
+                        {
+                            // evaluate P_n(x) and its derivative by recursion
+                            double p0 = 1.0, p1 = x;
+                            for (unsigned l = 2 ; l <= n ; ++l)
+                            {
+                                const double p2 = ((2.0 * l - 1.0) * x * p1 - (l - 1.0) * p0) / l;
+                                p0 = p1;
+                                p1 = p2;
+                            }
+                            dp = n * (x * p1 - p0) / (x * x - 1.0);
+
+                            const double delta = p1 / dp;
+                            x -= delta;
+
+                            if (std::abs(delta) < 1.0e-15)
+                                break;
+                        }
+
+                        const double w = 2.0 / ((1.0 - x * x) * dp * dp);
+                        nodes[n][i] = -x;
+                        nodes[n][n - 1 - i] = x;
+                        weights[n][i] = w;
+                        weights[n][n - 1 - i] = w;
+                    }
+                }
+            }
+
+            static const GaussLegendreRules & instance()
+            {
+                static const GaussLegendreRules rules;
+
+                return rules;
+            }
+        };
+
+        // nodes and weights of the 7-point Gauss / 15-point Kronrod rule on [-1, 1], cf. QUADPACK's qk15
+        static const double gk15_nodes[8] =
+        {
+            0.991455371120812639206854697526329, 0.949107912342758524526189684047851,
+            0.864864423359769072789712788640926, 0.741531185599394439863864773280788,
+            0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+            0.207784955007898467600689403773245, 0.000000000000000000000000000000000
+        };
+
+        static const double gk15_kronrod_weights[8] =
+        {
+            0.022935322010529224963732008058970, 0.063092092629978553290700663189204,
+            0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+            0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+            0.204432940075298892414161999234649, 0.209482141084727828012999174891714
+        };
+
+        // weights of the Gauss nodes gk15_nodes[1], gk15_nodes[3], gk15_nodes[5] and gk15_nodes[7]
+        static const double gk15_gauss_weights[4] =
+        {
+            0.129484966168869693270611432679082, 0.279705391489276667901467771423780,
+            0.381830050505118944950369775488975, 0.417959183673469387755102040816327
+        };
+
+        struct GaussKronrodInterval
+        {
+            double a, b, result, error;
+        };
+
+        // the abscissae of the 15-point rule on [a, b]
+        void gk15_abscissae(const double & a, const double & b, double * x)
+        {
+            const double center = 0.5 * (a + b), half_length = 0.5 * (b - a);
+
+            for (unsigned j = 0 ; j < 7 ; ++j)
+            {
+                x[2 * j]     = center - half_length * gk15_nodes[j];
+                x[2 * j + 1] = center + half_length * gk15_nodes[j];
+            }
+            x[14] = center;
+        }
+
+        // apply the 15-point rule to the integrand values y at the abscissae of gk15_abscissae
+        void gk15_apply(GaussKronrodInterval & interval, const double * y)
+        {
+            const double half_length = 0.5 * (interval.b - interval.a);
+            const double f_center = y[14];
+
+            double result_gauss = f_center * gk15_gauss_weights[3];
+            double result_kronrod = f_center * gk15_kronrod_weights[7];
+            double result_abs = std::abs(result_kronrod);
+
+            for (unsigned j = 0 ; j < 7 ; ++j)
+            {
+                const double f_sum = y[2 * j] + y[2 * j + 1];
+
+                result_kronrod += gk15_kronrod_weights[j] * f_sum;
+                result_abs     += gk15_kronrod_weights[j] * (std::abs(y[2 * j]) + std::abs(y[2 * j + 1]));
+
+                if (1 == j % 2)
+                    result_gauss += gk15_gauss_weights[j / 2] * f_sum;
+            }
+
+            const double mean = result_kronrod * 0.5;
+            double result_asc = gk15_kronrod_weights[7] * std::abs(f_center - mean);
+            for (unsigned j = 0 ; j < 7 ; ++j)
+            {
+                result_asc += gk15_kronrod_weights[j] * (std::abs(y[2 * j] - mean) + std::abs(y[2 * j + 1] - mean));
+            }
+
+            interval.result = result_kronrod * half_length;
+            result_abs *= std::abs(half_length);
+            result_asc *= std::abs(half_length);
+
+            // rescale the error estimate as in QUADPACK
+            double error = std::abs((result_kronrod - result_gauss) * half_length);
+            if ((0.0 != result_asc) && (0.0 != error))
+                error = result_asc * std::min(1.0, std::pow(200.0 * error / result_asc, 1.5));
+
+            if (result_abs > std::numeric_limits<double>::min() / (50.0 * std::numeric_limits<double>::epsilon()))
+                error = std::max(50.0 * std::numeric_limits<double>::epsilon() * result_abs, error);
+
+            interval.error = error;
+        }
+    }
+
+    template <>
+    double integrate<GaussLegendre>(const batch::fdd & f, const double & a, const double & b, const GaussLegendre::Config & config)
+    {
+        const auto & rules = implementation::GaussLegendreRules::instance();
+        const auto & nodes = rules.nodes[config.order()];
+        const auto & weights = rules.weights[config.order()];
+        const unsigned order = config.order(), subintervals = config.subintervals();
+        const double half_length = 0.5 * (b - a) / subintervals;
+
+        std::vector<double> x(order * subintervals), y(order * subintervals);
+        for (unsigned i = 0 ; i < subintervals ; ++i)
+        {
+            const double center = a + (2.0 * i + 1.0) * half_length;
+
+            for (unsigned j = 0 ; j < order ; ++j)
+            {
+                x[i * order + j] = center + half_length * nodes[j];
+            }
+        }
+
+        f(x.data(), y.data(), x.size());
+
+        double result = 0.0;
+        for (unsigned i = 0 ; i < subintervals ; ++i)
+        {
+            for (unsigned j = 0 ; j < order ; ++j)
+            {
+                result += weights[j] * y[i * order + j];
+            }
+        }
+
+        return result * half_length;
+    }
+
+    template <>
+    double integrate<GaussKronrod>(const batch::fdd & f, const double & a, const double & b, const GaussKronrod::Config & config)
+    {
+        using implementation::GaussKronrodInterval;
+
+        std::vector<GaussKronrodInterval> intervals;
+        intervals.reserve(config.limit());
+
+        double x[30], y[30];
+
+        intervals.push_back(GaussKronrodInterval{ a, b, 0.0, 0.0 });
+        implementation::gk15_abscissae(a, b, x);
+        f(x, y, 15);
+        implementation::gk15_apply(intervals.back(), y);
+
+        while (true)
+        {
+            double result = 0.0, error = 0.0;
+            for (const auto & i : intervals)
+            {
+                result += i.result;
+                error  += i.error;
+            }
+
+            if (error <= std::max(config.epsabs(), config.epsrel() * std::abs(result)))
+                return result;
+
+            if (intervals.size() >= config.limit())
+                throw IntegrationError("GaussKronrod: maximum number of subdivisions reached");
+
+            // bisect the subinterval with the largest error estimate
+            auto worst = std::max_element(intervals.begin(), intervals.end(),
+                    [] (const GaussKronrodInterval & lhs, const GaussKronrodInterval & rhs) { return lhs.error < rhs.error; });
+
+            const double a1 = worst->a, b2 = worst->b, mid = 0.5 * (a1 + b2);
+            if ((mid <= std::min(a1, b2)) || (mid >= std::max(a1, b2)))
+                throw IntegrationError("GaussKronrod: subinterval too small to be bisected");
+
+            GaussKronrodInterval left{ a1, mid, 0.0, 0.0 }, right{ mid, b2, 0.0, 0.0 };
+            implementation::gk15_abscissae(a1, mid, x);
+            implementation::gk15_abscissae(mid, b2, x + 15);
+            f(x, y, 30);
+            implementation::gk15_apply(left, y);
+            implementation::gk15_apply(right, y + 15);
+
+            *worst = left;
+            intervals.push_back(right);
+        }
+    }
+
+    GaussKronrod::Config::Config() :
+        _qng(),
+        _limit(1000)
+    {
+    }
+
+    double GaussKronrod::Config::epsabs() const
+    {
+        return _qng.epsabs();
+    }
+
+    GaussKronrod::Config & GaussKronrod::Config::epsabs(const double & x)
+    {
+        _qng.epsabs(x);
+        return *this;
+    }
+
+    double GaussKronrod::Config::epsrel() const
+    {
+        return _qng.epsrel();
+    }
+
+    GaussKronrod::Config & GaussKronrod::Config::epsrel(const double & x)
+    {
+        _qng.epsrel(x);
+        return *this;
+    }
+
+    unsigned GaussKronrod::Config::limit() const
+    {
+        return _limit;
+    }
+
+    GaussKronrod::Config & GaussKronrod::Config::limit(const unsigned & x)
+    {
+        if (x < 1)
+            throw InternalError("GaussKronrod::Config: need at least one subinterval");
+
+        _limit = x;
+        return *this;
+    }
+
+    LatticeRule::Config::Config() :
+        _qng(),
+        _shifts(8),
+        _minimal_points(1u << 10),
+        _maximal_points(1u << 16)
+    {
+    }
+
+    double LatticeRule::Config::epsabs() const
+    {
+        return _qng.epsabs();
+    }
+
+    LatticeRule::Config & LatticeRule::Config::epsabs(const double & x)
+    {
+        _qng.epsabs(x);
+        return *this;
+    }
+
+    double LatticeRule::Config::epsrel() const
+    {
+        return _qng.epsrel();
+    }
+
+    LatticeRule::Config & LatticeRule::Config::epsrel(const double & x)
+    {
+        _qng.epsrel(x);
+        return *this;
+    }
+
+    unsigned LatticeRule::Config::shifts() const
+    {
+        return _shifts;
+    }
+
+    LatticeRule::Config & LatticeRule::Config::shifts(const unsigned & x)
+    {
+        if (x < 2)
+            throw InternalError("LatticeRule::Config: need at least two shifts to estimate the error");
+
+        _shifts = x;
+        return *this;
+    }
+
+    std::size_t LatticeRule::Config::minimal_points() const
+    {
+        return _minimal_points;
+    }
+
+    LatticeRule::Config & LatticeRule::Config::minimal_points(const std::size_t & x)
+    {
+        if ((x < 2) || (x > LatticeRule::maximal_points) || (0 != (x & (x - 1))))
+            throw InternalError("LatticeRule::Config: number of points must be a power of 2 in the range [2, " + stringify(LatticeRule::maximal_points) + "]");
+
+        _minimal_points = x;
+        _maximal_points = std::max(_maximal_points, x);
+        return *this;
+    }
+
+    std::size_t LatticeRule::Config::maximal_points() const
+    {
+        return _maximal_points;
+    }
+
+    LatticeRule::Config & LatticeRule::Config::maximal_points(const std::size_t & x)
+    {
+        if ((x < 2) || (x > LatticeRule::maximal_points) || (0 != (x & (x - 1))))
+            throw InternalError("LatticeRule::Config: number of points must be a power of 2 in the range [2, " + stringify(LatticeRule::maximal_points) + "]");
+
+        _maximal_points = x;
+        _minimal_points = std::min(_minimal_points, x);
+        return *this;
+    }
+
+    namespace implementation
+    {
+        // generating vector of the embedded lattice sequence, constructed component-by-component
+        // to minimise the worst-case error P_2 for all lattices of 2^8 to 2^20 points
+        static const std::uint64_t lattice_generating_vector[LatticeRule::maximal_dimension] =
+        {
+            1u, 182667u, 944301u
+        };
+
+        // deterministic shifts in [0, 1), generated with the SplitMix64 algorithm from a fixed seed
+        std::vector<double> lattice_shifts(const unsigned & count)
+        {
+            std::vector<double> result(count);
+            std::uint64_t state = 0x4e0b0c7a3c5d2f19u;
+
+            for (auto & r : result)
+            {
+                std::uint64_t z = (state += 0x9e3779b97f4a7c15u);
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9u;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebu;
+                z = z ^ (z >> 31);
+
+                r = (z >> 11) * 0x1.0p-53;
+            }
+
+            return result;
+        }
+    }
+
+    template <std::size_t dim_>
+    LatticeRule::Result integrate(const batch::fdmd<dim_> & f,
+                                  const std::array<double, dim_> & a,
+                                  const std::array<double, dim_> & b,
+                                  const LatticeRule::Config & config)
+    {
+        static_assert((dim_ >= 1) && (dim_ <= LatticeRule::maximal_dimension), "LatticeRule: unsupported dimension");
+
+        const unsigned shifts = config.shifts();
+        const std::vector<double> shift = implementation::lattice_shifts(shifts * dim_);
+
+        double volume = 1.0;
+        for (unsigned j = 0 ; j < dim_ ; ++j)
+        {
+            volume *= b[j] - a[j];
+        }
+
+        // the sums of the integrand values for each shift
+        std::vector<double> sums(shifts, 0.0);
+        std::vector<std::array<double, dim_>> x;
+        std::vector<double> y;
+
+        // evaluate the lattice points i = first, first + stride, ... < n
+        auto accumulate = [&] (const std::size_t & n, const std::size_t & first, const std::size_t & stride)
+        {
+            const std::size_t count = (n - first + stride - 1) / stride;
+            x.resize(count);
+            y.resize(count);
+
+            for (unsigned s = 0 ; s < shifts ; ++s)
+            {
+                for (std::size_t k = 0 ; k < count ; ++k)
+                {
+                    const std::uint64_t i = first + k * stride;
+
+                    for (unsigned j = 0 ; j < dim_ ; ++j)
+                    {
+                        const double u = double((i * implementation::lattice_generating_vector[j]) % n) / n + shift[s * dim_ + j];
+                        const double v = u - std::floor(u);
+
+                        // tent transformation
+                        x[k][j] = a[j] + (b[j] - a[j]) * (1.0 - std::abs(2.0 * v - 1.0));
+                    }
+                }
+
+                f(x.data(), y.data(), count);
+
+                for (std::size_t k = 0 ; k < count ; ++k)
+                {
+                    sums[s] += y[k];
+                }
+            }
+        };
+
+        std::size_t n = config.minimal_points();
+        accumulate(n, 0, 1);
+
+        LatticeRule::Result result{ 0.0, 0.0, 0 };
+        while (true)
+        {
+            double mean = 0.0, variance = 0.0;
+            for (unsigned s = 0 ; s < shifts ; ++s)
+            {
+                mean += sums[s];
+            }
+            mean /= shifts;
+
+            for (unsigned s = 0 ; s < shifts ; ++s)
+            {
+                variance += (sums[s] - mean) * (sums[s] - mean);
+            }
+            variance /= (shifts - 1.0);
+
+            result.value = mean * volume / n;
+            result.error = std::sqrt(variance / shifts) * std::abs(volume) / n;
+            result.evaluations = shifts * n;
+
+            if (result.error <= std::max(config.epsabs(), config.epsrel() * std::abs(result.value)))
+                break;
+
+            if (2 * n > config.maximal_points())
+                break;
+
+            // the points of the lattice of n points are the even points of the lattice of 2 n points
+            n *= 2;
+            accumulate(n, 1, 2);
+        }
+
+        return result;
+    }
+
+    template LatticeRule::Result integrate<1>(const batch::fdmd<1> &, const std::array<double, 1> &, const std::array<double, 1> &, const LatticeRule::Config &);
+    template LatticeRule::Result integrate<2>(const batch::fdmd<2> &, const std::array<double, 2> &, const std::array<double, 2> &, const LatticeRule::Config &);
+    template LatticeRule::Result integrate<3>(const batch::fdmd<3> &, const std::array<double, 3> &, const std::array<double, 3> &, const LatticeRule::Config &);
+
     namespace cubature
     {
         Config::Config() :
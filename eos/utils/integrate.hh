@@ -52,6 +52,42 @@ namespace eos
     template <std::size_t k> std::array<double, k> integrate1D(const std::function<std::array<double, k> (const double &)> & f, unsigned n, const double & a, const double & b);
     /// @}
 
+namespace batch
+{
+    /*!
+     * Integrand that is evaluated for a batch of sampling points at once.
+     *
+     * Called as f(x, y, n), it must write the values of the integrand at the n sampling points
+     * x[0], ..., x[n - 1] to y[0], ..., y[n - 1]. The arrays do not overlap.
+     */
+    using fdd = std::function<void (const double * x, double * y, const std::size_t & n)>;
+
+    /// Batch integrand with k_ real-valued components per sampling point.
+    template <std::size_t k_>
+    using fadd = std::function<void (const double * x, std::array<double, k_> * y, const std::size_t & n)>;
+
+    /// Batch integrand of dim_ real-valued parameters.
+    template <std::size_t dim_>
+    using fdmd = std::function<void (const std::array<double, dim_> * x, double * y, const std::size_t & n)>;
+}
+
+    /// @{
+    /*!
+     * Numerically integrate functions of one real-valued parameter, evaluating all
+     * sampling points in a single call to the batch integrand.
+     *
+     * Uses the same rule as integrate1D for non-batch integrands.
+     *
+     * @param f      Batch integrand.
+     * @param n      Number of evaluations, must be a power of 2.
+     * @param a      Lower limit of the domain of integration.
+     * @param b      Upper limit of the domain of integration.
+     */
+    double integrate1D(const batch::fdd & f, unsigned n, const double & a, const double & b);
+
+    template <std::size_t k> std::array<double, k> integrate1D(const batch::fadd<k> & f, unsigned n, const double & a, const double & b);
+    /// @}
+
 namespace GSL
 {
     using fdd = std::function<double(const double &)>;
@@ -111,6 +147,117 @@ namespace GSL
     static thread_local QAGS::Workspace work_space;
 }
 
+    /*!
+     * Fixed-order Gauss-Legendre quadrature on a number of equally-sized subintervals.
+     *
+     * The nodes and weights of all supported orders are computed once and then shared.
+     * All sampling points are handed to the batch integrand in a single call.
+     */
+    struct GaussLegendre
+    {
+        /// The maximal supported order of the rule.
+        static constexpr unsigned maximal_order = 64;
+
+        class Config
+        {
+            public:
+                Config();
+
+                unsigned order() const;
+                Config& order(const unsigned& x);
+
+                unsigned subintervals() const;
+                Config& subintervals(const unsigned& x);
+            private:
+                unsigned _order, _subintervals;
+        };
+    };
+
+    /*!
+     * Adaptive 7-point Gauss / 15-point Kronrod quadrature.
+     *
+     * Follows the QAG algorithm of QUADPACK, bisecting the subinterval with the largest error
+     * estimate until the requested accuracy is reached. The sampling points of both halves of
+     * a bisected subinterval are handed to the batch integrand in a single call.
+     */
+    struct GaussKronrod
+    {
+        class Config
+        {
+            public:
+                Config();
+
+                double epsabs() const;
+                Config& epsabs(const double& x);
+
+                double epsrel() const;
+                Config& epsrel(const double& x);
+
+                unsigned limit() const;
+                Config& limit(const unsigned& x);
+            private:
+                GSL::QNG::Config _qng;
+                unsigned _limit;
+        };
+    };
+
+    /*!
+     * Randomly-shifted rank-1 lattice rule for integrands of up to three real-valued parameters.
+     *
+     * The integrand is periodised with the tent (baker's) transformation and integrated with
+     * an embedded sequence of lattices of 2^m points, using the generating vector (1, 182667, 944301).
+     * The error is estimated from the spread of the results for a number of random shifts of the
+     * lattice. The shifts are drawn from a generator with a fixed seed, i.e., the result is
+     * reproducible. The number of lattice points is doubled until either the requested accuracy
+     * or the maximal number of points is reached, reusing all previous evaluations. All sampling
+     * points of one shift and one refinement step are handed to the batch integrand in a single call.
+     */
+    struct LatticeRule
+    {
+        /// The maximal supported dimension of the domain of integration.
+        static constexpr unsigned maximal_dimension = 3;
+
+        /// The maximal supported number of lattice points.
+        static constexpr std::size_t maximal_points = 1u << 20;
+
+        class Config
+        {
+            public:
+                Config();
+
+                double epsabs() const;
+                Config& epsabs(const double& x);
+
+                double epsrel() const;
+                Config& epsrel(const double& x);
+
+                unsigned shifts() const;
+                Config& shifts(const unsigned& x);
+
+                std::size_t minimal_points() const;
+                Config& minimal_points(const std::size_t& x);
+
+                std::size_t maximal_points() const;
+                Config& maximal_points(const std::size_t& x);
+            private:
+                GSL::QNG::Config _qng;
+                unsigned _shifts;
+                std::size_t _minimal_points, _maximal_points;
+        };
+
+        struct Result
+        {
+            /// The estimate of the integral.
+            double value;
+
+            /// The estimate of the standard error of value.
+            double error;
+
+            /// The number of integrand evaluations.
+            std::size_t evaluations;
+        };
+    };
+
     /*!
      * Numerically integrate functions of one real-valued parameter.
      *
@@ -124,6 +271,18 @@ namespace GSL
                      const double &a, const double &b,
                      const typename Method_::Config &config = typename Method_::Config());
 
+    /*!
+     * Numerically integrate batch integrands of one real-valued parameter.
+     *
+     * Two methods are available:
+     * 1) `GaussLegendre`: fixed-order Gauss-Legendre rules
+     * 2) `GaussKronrod`: the adaptive Gauss-Kronrod rule
+     */
+    template <typename Method_>
+    double integrate(const batch::fdd & f,
+                     const double &a, const double &b,
+                     const typename Method_::Config &config = typename Method_::Config());
+
 namespace cubature
 {
     template <size_t dim_>
@@ -158,6 +317,20 @@ namespace cubature
                      const std::array<double, dim_> &b,
                      const cubature::Config &config = cubature::Config());
 
+    /*!
+     * Numerically integrate batch integrands of one or more than one variable
+     * with a randomly-shifted lattice rule.
+     *
+     * Unlike the adaptive methods, no exception is thrown if the requested accuracy
+     * cannot be reached with the maximal number of lattice points. Instead, the
+     * accuracy that has been reached is returned alongside the result.
+     */
+    template <std::size_t dim_>
+    LatticeRule::Result integrate(const batch::fdmd<dim_> & f,
+                                  const std::array<double, dim_> & a,
+                                  const std::array<double, dim_> & b,
+                                  const LatticeRule::Config & config);
+
     class IntegrationError :
         public Exception
     {
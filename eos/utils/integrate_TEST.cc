@@ -111,5 +111,120 @@ class IntegrateTest :
             };
             auto q5 = integrate(cubature::fdd<dim>(f5lam), a_5, b_5, config_cubature);
             TEST_CHECK_RELATIVE_ERROR(q5, 1.0, eps);
+
+            // batch integrands
+            {
+                batch::fdd f3batch = [] (const double * x, double * y, const std::size_t & n)
+                {
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        y[i] = f3(x[i]);
+                    }
+                };
+                batch::fdd f4batch = [] (const double * x, double * y, const std::size_t & n)
+                {
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        y[i] = f4(x[i]);
+                    }
+                };
+
+                // the batch variant of integrate1D uses the same rule
+                TEST_CHECK_EQUAL(q3, integrate1D(f3batch, 16, 0.00, 10.0));
+
+                batch::fadd<2> f34batch = [] (const double * x, std::array<double, 2> * y, const std::size_t & n)
+                {
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        y[i] = std::array<double, 2>{{ f3(x[i]), f4(x[i]) }};
+                    }
+                };
+                std::function<std::array<double, 2> (const double &)> f34 = [] (const double & x)
+                {
+                    return std::array<double, 2>{{ f3(x), f4(x) }};
+                };
+                auto q34batch = integrate1D(f34batch, 16, 1.0, std::exp(1));
+                auto q34 = integrate1D(f34, 16, 1.0, std::exp(1));
+                TEST_CHECK_EQUAL(q34[0], q34batch[0]);
+                TEST_CHECK_EQUAL(q34[1], q34batch[1]);
+
+                // Gauss-Legendre rules are exact for polynomials of degree 2 * order - 1
+                for (unsigned order : { 1u, 2u, 5u, 16u, 64u })
+                {
+                    const unsigned degree = 2 * order - 1;
+                    batch::fdd monomial = [degree] (const double * x, double * y, const std::size_t & n)
+                    {
+                        for (std::size_t i = 0 ; i < n ; ++i)
+                        {
+                            y[i] = std::pow(x[i], degree);
+                        }
+                    };
+                    auto config_GL = GaussLegendre::Config().order(order);
+                    TEST_CHECK_NEARLY_EQUAL((std::pow(2.0, degree + 1) - 1.0) / (degree + 1),
+                            integrate<GaussLegendre>(monomial, 1.0, 2.0, config_GL), 1e-13 * std::pow(2.0, degree + 1));
+                }
+
+                auto config_GL = GaussLegendre::Config().order(16).subintervals(4);
+                TEST_CHECK_RELATIVE_ERROR(i3, integrate<GaussLegendre>(f3batch, 0.0, 10.0, config_GL), 1e-12);
+                TEST_CHECK_THROWS(InternalError, GaussLegendre::Config().order(GaussLegendre::maximal_order + 1));
+
+                auto config_GK = GaussKronrod::Config().epsrel(1e-12);
+                TEST_CHECK_RELATIVE_ERROR(i4, integrate<GaussKronrod>(f4batch, 1.0, std::exp(1), config_GK), 1e-12);
+
+                // integrable singularity at x = 0
+                batch::fdd sqrt_inverse = [] (const double * x, double * y, const std::size_t & n)
+                {
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        y[i] = 1.0 / std::sqrt(x[i]);
+                    }
+                };
+                TEST_CHECK_RELATIVE_ERROR(2.0, integrate<GaussKronrod>(sqrt_inverse, 0.0, 1.0, GaussKronrod::Config().epsrel(1e-8)), 1e-8);
+                TEST_CHECK_THROWS(IntegrationError, integrate<GaussKronrod>(sqrt_inverse, 0.0, 1.0, GaussKronrod::Config().epsrel(1e-8).limit(3)));
+            }
+
+            // lattice rule
+            {
+                batch::fdmd<3> f3d = [] (const std::array<double, 3> * x, double * y, const std::size_t & n)
+                {
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        y[i] = std::exp(x[i][0]) * std::cos(x[i][1]) / (1.0 + x[i][2]);
+                    }
+                };
+                const double i3d = (std::exp(1.0) - 1.0) * std::sin(2.0) * std::log(2.0);
+
+                auto config_LR = LatticeRule::Config().epsrel(1e-7);
+                auto r3d = integrate<3>(f3d, { 0.0, 0.0, 0.0 }, { 1.0, 2.0, 1.0 }, config_LR);
+                TEST_CHECK(r3d.error <= 1e-7 * std::abs(r3d.value));
+                TEST_CHECK_RELATIVE_ERROR(i3d, r3d.value, 1e-6);
+
+                // the result is reproducible
+                auto r3d_again = integrate<3>(f3d, { 0.0, 0.0, 0.0 }, { 1.0, 2.0, 1.0 }, config_LR);
+                TEST_CHECK_EQUAL(r3d.value, r3d_again.value);
+                TEST_CHECK_EQUAL(r3d.error, r3d_again.error);
+                TEST_CHECK_EQUAL(r3d.evaluations, r3d_again.evaluations);
+
+                // the number of points is bounded
+                auto config_LR_bounded = LatticeRule::Config().epsrel(1e-15).shifts(4).minimal_points(256).maximal_points(1024);
+                auto r3d_bounded = integrate<3>(f3d, { 0.0, 0.0, 0.0 }, { 1.0, 2.0, 1.0 }, config_LR_bounded);
+                TEST_CHECK_EQUAL(4u * 1024u, r3d_bounded.evaluations);
+                TEST_CHECK_RELATIVE_ERROR(i3d, r3d_bounded.value, 1e-4);
+
+                // Morokoff test function
+                batch::fdmd<2> f2d = [] (const std::array<double, 2> * x, double * y, const std::size_t & n)
+                {
+                    for (std::size_t i = 0 ; i < n ; ++i)
+                    {
+                        y[i] = 2.25 * std::sqrt(x[i][0] * x[i][1]);
+                    }
+                };
+                auto r2d = integrate<2>(f2d, { 0.0, 0.0 }, { 1.0, 1.0 }, LatticeRule::Config().epsrel(1e-5));
+                TEST_CHECK_RELATIVE_ERROR(1.0, r2d.value, 1e-4);
+
+                TEST_CHECK_THROWS(InternalError, LatticeRule::Config().minimal_points(1000));
+                TEST_CHECK_THROWS(InternalError, LatticeRule::Config().maximal_points(2 * LatticeRule::maximal_points));
+                TEST_CHECK_THROWS(InternalError, LatticeRule::Config().shifts(1));
+            }
         }
 } model_test;
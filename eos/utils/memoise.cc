@@ -38,6 +38,14 @@ namespace eos
         _clear_functions.push_back(clear_function);
     }
 
+    void
+    MemoisationControl::register_statistics_function(const std::function<MemoisationStatistics ()> & statistics_function)
+    {
+        Lock l(*_mutex);
+
+        _statistics_functions.push_back(statistics_function);
+    }
+
     void
     MemoisationControl::clear()
     {
@@ -48,4 +56,18 @@ namespace eos
             _clear_function();
         }
     }
+
+    MemoisationStatistics
+    MemoisationControl::statistics()
+    {
+        Lock l(*_mutex);
+
+        MemoisationStatistics result;
+        for (auto & _statistics_function : _statistics_functions)
+        {
+            result += _statistics_function();
+        }
+
+        return result;
+    }
 }
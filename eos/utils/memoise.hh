@@ -25,7 +25,9 @@
 #include <eos/utils/instantiation_policy-impl.hh>
 #include <eos/utils/lock.hh>
 #include <eos/utils/mutex.hh>
+#include <eos/utils/persistent-cache.hh>
 
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <tuple>
@@ -96,6 +98,30 @@ namespace eos
         };
     }
 
+    /*!
+     * Counters describing the efficiency of one or more Memoiser objects.
+     */
+    struct MemoisationStatistics
+    {
+        /// The number of lookups that were answered from memory.
+        unsigned long hits = 0;
+
+        /// The number of lookups that required a call to the memoised function.
+        unsigned long misses = 0;
+
+        /// The number of memoisations that were evicted to make room for new ones.
+        unsigned long evictions = 0;
+
+        MemoisationStatistics & operator+= (const MemoisationStatistics & rhs)
+        {
+            hits      += rhs.hits;
+            misses    += rhs.misses;
+            evictions += rhs.evictions;
+
+            return *this;
+        }
+    };
+
     class MemoisationControl :
         public InstantiationPolicy<MemoisationControl, Singleton>
     {
@@ -104,6 +130,8 @@ namespace eos
 
             std::vector<std::function<void ()>> _clear_functions;
 
+            std::vector<std::function<MemoisationStatistics ()>> _statistics_functions;
+
         public:
             MemoisationControl();
 
@@ -111,9 +139,22 @@ namespace eos
 
             void register_clear_function(const std::function<void ()> & clear_function);
 
+            void register_statistics_function(const std::function<MemoisationStatistics ()> & statistics_function);
+
             void clear();
+
+            /// Retrieve the accumulated counters of all memoisers.
+            MemoisationStatistics statistics();
     };
 
+    /*!
+     * Memoiser keeps the results of previous calls to functions with identical signature.
+     *
+     * The memoisations are distributed across a fixed number of shards, each guarded by
+     * its own mutex. The memoised function is called outside of any lock.
+     * Each shard holds a bounded number of memoisations; when a shard is full, an existing
+     * memoisation is evicted following the CLOCK (second chance) policy.
+     */
     template <typename Result_, typename ... Params_>
     class Memoiser :
         public InstantiationPolicy<Memoiser<Result_, Params_ ...>, Singleton>
@@ -122,57 +163,175 @@ namespace eos
             using FunctionType = Result_(*)(const Params_ & ...);
             using KeyType = std::tuple<FunctionType, Params_...>;
 
+            /// The number of independent shards.
+            static constexpr unsigned number_of_shards = 64u;
+
+            /// The maximal number of memoisations per shard.
+            static constexpr unsigned shard_capacity = 1600u;
+
         private:
-            Mutex * const _mutex;
+            struct Entry
+            {
+                KeyType key;
 
-            std::unordered_map<KeyType, Result_> _memoisations;
+                Result_ result;
 
-        public:
-            Memoiser() :
-                _mutex(new Mutex)
+                bool referenced;
+            };
+
+            struct Shard
             {
-                MemoisationControl::instance()->register_clear_function(std::bind(&Memoiser<Result_, Params_ ...>::clear, this));
-            }
+                Mutex mutex;
 
-            ~Memoiser()
+                std::unordered_map<KeyType, unsigned> index;
+
+                std::vector<Entry> entries;
+
+                unsigned hand = 0;
+
+                MemoisationStatistics statistics;
+            };
+
+            std::array<Shard, number_of_shards> _shards;
+
+            Shard & shard(const KeyType & key)
             {
-                delete _mutex;
+                // mix the bits of the hash, since the tuple hash is a plain xor of its elements
+                uint64_t h = std::hash<KeyType>()(key);
+                h ^= h >> 33;
+                h *= 0xff51afd7ed558ccdull;
+                h ^= h >> 33;
+
+                return _shards[h % number_of_shards];
             }
 
-            Result_ operator() (const FunctionType & f, const Params_ & ... p)
+            // insert a new memoisation into a full or non-full shard; the shard must be locked
+            static void insert(Shard & s, const KeyType & key, const Result_ & result)
             {
-                Lock l(*_mutex);
+                if (s.entries.size() < shard_capacity)
+                {
+                    s.index.emplace(key, s.entries.size());
+                    s.entries.push_back(Entry{ key, result, false });
 
-                KeyType key(f, p ...);
-                auto i = _memoisations.find(key);
+                    return;
+                }
 
-                if (_memoisations.end() != i)
-                    return i->second;
+                // find a victim that has not been referenced since the hand passed it last
+                while (s.entries[s.hand].referenced)
+                {
+                    s.entries[s.hand].referenced = false;
+                    s.hand = (s.hand + 1) % shard_capacity;
+                }
+
+                Entry & victim = s.entries[s.hand];
+                s.index.erase(victim.key);
+                ++s.statistics.evictions;
 
-                Result_ result = f(p ...);
+                victim = Entry{ key, result, false };
+                s.index.emplace(key, s.hand);
+                s.hand = (s.hand + 1) % shard_capacity;
+            }
+
+            // look up a memoisation, or compute and memoise the result on a miss
+            template <typename Compute_>
+            Result_ lookup_or_compute(const KeyType & key, const Compute_ & compute)
+            {
+                Shard & s = shard(key);
 
-                if (_memoisations.size() > 100000u)
                 {
-                    _memoisations.clear();
+                    Lock l(s.mutex);
+
+                    auto i = s.index.find(key);
+                    if (s.index.end() != i)
+                    {
+                        Entry & entry = s.entries[i->second];
+                        entry.referenced = true;
+                        ++s.statistics.hits;
+
+                        return entry.result;
+                    }
+
+                    ++s.statistics.misses;
                 }
 
-                _memoisations.insert(std::pair<KeyType, Result_>(key, result));
+                // do not hold the lock while computing the result
+                Result_ result = compute();
+
+                {
+                    Lock l(s.mutex);
+
+                    // another thread might have memoised the same key in the meantime
+                    if (s.index.end() == s.index.find(key))
+                    {
+                        insert(s, key, result);
+                    }
+                }
 
                 return result;
             }
 
+        public:
+            Memoiser()
+            {
+                MemoisationControl::instance()->register_clear_function(std::bind(&Memoiser<Result_, Params_ ...>::clear, this));
+                MemoisationControl::instance()->register_statistics_function(std::bind(&Memoiser<Result_, Params_ ...>::statistics, this));
+            }
+
+            ~Memoiser() = default;
+
+            Result_ operator() (const FunctionType & f, const Params_ & ... p)
+            {
+                return lookup_or_compute(KeyType(f, p ...), [&] () { return f(p ...); });
+            }
+
+            /*!
+             * Return the result of f(p ...), resorting to the PersistentCache before calling f.
+             *
+             * @param id A stable and unique identifier of f.
+             * @param f  The function.
+             * @param p  The arguments of f.
+             */
+            Result_ operator() (const char * id, const FunctionType & f, const Params_ & ... p)
+            {
+                return lookup_or_compute(KeyType(f, p ...), [&] () { return PersistentCache::instance()->evaluate(id, f, p ...); });
+            }
+
             void clear()
             {
-                Lock l(*_mutex);
+                for (auto & s : _shards)
+                {
+                    Lock l(s.mutex);
+
+                    s.index.clear();
+                    s.entries.clear();
+                    s.hand = 0;
+                }
+            }
+
+            unsigned number_of_memoisations()
+            {
+                unsigned result = 0;
+                for (auto & s : _shards)
+                {
+                    Lock l(s.mutex);
+
+                    result += s.entries.size();
+                }
 
-                _memoisations.clear();
+                return result;
             }
 
-            unsigned number_of_memoisations() const
+            MemoisationStatistics statistics()
             {
-                Lock l(*_mutex);
+                MemoisationStatistics result;
+                for (auto & s : _shards)
+                {
+                    Lock l(s.mutex);
+
+                    result += s.statistics;
+                }
 
-                return _memoisations.size();
+                return result;
             }
     };
 
@@ -182,11 +341,30 @@ namespace eos
         return (*Memoiser<typename implementation::ResultOf<FunctionType_>::Type, Params ...>::instance())(f, p ...);
     }
 
+    /*!
+     * Memoise the result of f(p ...) in memory and, if enabled, in the PersistentCache.
+     *
+     * @param id A stable and unique identifier of f, which must change whenever the results of f change.
+     * @param f  The function.
+     * @param p  The arguments of f.
+     */
+    template <typename FunctionType_, typename ... Params>
+    typename implementation::ResultOf<FunctionType_>::Type persistent_memoise(const char * id, FunctionType_ f, const Params & ... p)
+    {
+        return (*Memoiser<typename implementation::ResultOf<FunctionType_>::Type, Params ...>::instance())(id, f, p ...);
+    }
+
     template <typename FunctionType_, typename ... Params>
     unsigned number_of_memoisations(FunctionType_, const Params & ...)
     {
         return Memoiser<typename implementation::ResultOf<FunctionType_>::Type, Params ...>::instance()->number_of_memoisations();
     }
+
+    template <typename FunctionType_, typename ... Params>
+    MemoisationStatistics memoisation_statistics(FunctionType_, const Params & ...)
+    {
+        return Memoiser<typename implementation::ResultOf<FunctionType_>::Type, Params ...>::instance()->statistics();
+    }
 }
 
 #endif
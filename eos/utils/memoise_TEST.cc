@@ -44,6 +44,11 @@ class MemoiseTest :
             return std::complex<double>(x, y);
         }
 
+        static double f3(const double & x)
+        {
+            return 2.0 * x;
+        }
+
         virtual void run() const
         {
             /* f1 */
@@ -104,5 +109,40 @@ class MemoiseTest :
                 TEST_CHECK_EQUAL(0, number_of_memoisations(f1, 0.0, 0.0));
                 TEST_CHECK_EQUAL(0, number_of_memoisations(f2, 0.0, 0.0));
             }
+
+            /* Test the statistics and the bounded number of memoisations */
+            {
+                using Memoiser3 = Memoiser<double, double>;
+                const unsigned capacity = Memoiser3::number_of_shards * Memoiser3::shard_capacity;
+
+                TEST_CHECK_EQUAL(0, number_of_memoisations(f3, 0.0));
+                TEST_CHECK_EQUAL(6.0, memoise(f3, 3.0));
+                TEST_CHECK_EQUAL(6.0, memoise(f3, 3.0));
+                TEST_CHECK_EQUAL(1, memoisation_statistics(f3, 0.0).hits);
+                TEST_CHECK_EQUAL(1, memoisation_statistics(f3, 0.0).misses);
+                TEST_CHECK_EQUAL(0, memoisation_statistics(f3, 0.0).evictions);
+
+                for (unsigned i = 0 ; i < 2 * capacity ; ++i)
+                {
+                    TEST_CHECK_EQUAL(2.0 * i, memoise(f3, double(i)));
+                }
+
+                TEST_CHECK(number_of_memoisations(f3, 0.0) <= capacity);
+                TEST_CHECK(memoisation_statistics(f3, 0.0).evictions > 0);
+                TEST_CHECK_EQUAL(number_of_memoisations(f3, 0.0) + memoisation_statistics(f3, 0.0).evictions,
+                        memoisation_statistics(f3, 0.0).misses);
+            }
+
+            /* Test memoisation backed by the persistent cache */
+            {
+                MemoisationControl::instance()->clear();
+
+                TEST_CHECK_EQUAL(0, number_of_memoisations(f1, 0.0, 0.0));
+                TEST_CHECK_EQUAL(0.5, persistent_memoise("MemoiseTest::f1", f1, 1.0, 2.0));
+                TEST_CHECK_EQUAL(1, number_of_memoisations(f1, 0.0, 0.0));
+                TEST_CHECK_EQUAL(0.5, persistent_memoise("MemoiseTest::f1", f1, 1.0, 2.0));
+                TEST_CHECK_EQUAL(0.5, memoise(f1, 1.0, 2.0));
+                TEST_CHECK_EQUAL(1, number_of_memoisations(f1, 0.0, 0.0));
+            }
         }
 } memoise_test;
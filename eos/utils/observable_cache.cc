@@ -24,6 +24,7 @@
 #include <eos/utils/observable_cache.hh>
 #include <eos/utils/observable_set.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/profiler.hh>
 #include <eos/utils/thread_pool.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
@@ -43,6 +44,38 @@ namespace eos
     };
     template class WrappedForwardIterator<ObservableCache::IteratorTag, ObservablePtr>;
 
+    namespace implementation
+    {
+        // collect the ids of all cached observables within an expression
+        struct CachedObservableIdCollector
+        {
+            std::vector<ObservableCache::Id> ids;
+
+            void visit(const exp::BinaryExpression & e)
+            {
+                e.lhs.accept(*this);
+                e.rhs.accept(*this);
+            }
+
+            void visit(const exp::ConstantExpression &)
+            {
+            }
+
+            void visit(const exp::ObservableNameExpression &)
+            {
+            }
+
+            void visit(const exp::ObservableExpression &)
+            {
+            }
+
+            void visit(const exp::CachedObservableExpression & e)
+            {
+                ids.push_back(e.id);
+            }
+        };
+    }
+
     template <> struct
     Implementation<ObservableCache>
     {
@@ -58,8 +91,8 @@ namespace eos
         // Contains each cacheable observable and its associated index
         std::multimap<std::type_index, std::tuple<CacheableObservable *, ObservableCache::Id>> cacheable_observables;
 
-        // Contains each cached observable and its associated index
-        std::vector<std::tuple<ObservablePtr, ObservableCache::Id>> cached_observables;
+        // Contains each cached observable, its associated index, and the index of the cacheable observable it draws from
+        std::vector<std::tuple<ObservablePtr, ObservableCache::Id, ObservableCache::Id>> cached_observables;
 
         // Contains each expression observable and its associated index
         std::vector<std::tuple<ObservablePtr, ObservableCache::Id>> expression_observables;
@@ -67,6 +100,27 @@ namespace eos
         // Contains values of all observables
         std::vector<double> predictions;
 
+        // Contains the ids of the parameters used by each observable
+        std::vector<std::vector<Parameter::Id>> observable_parameter_ids;
+
+        // Contains the ids of the observables within the cache whose predictions each observable draws from
+        std::vector<std::vector<ObservableCache::Id>> observable_dependencies;
+
+        // Contains the profiling section of each observable, once it has been evaluated while profiling
+        std::vector<Profiler::Section *> observable_sections;
+
+        // Contains the kinematics of each observable, and their values at the time of the last update
+        std::vector<std::tuple<Kinematics, std::vector<double>>> observable_kinematics;
+
+        // Flags each observable that must be re-evaluated in the next update
+        std::vector<char> stale;
+
+        // Contains each parameter used by any observable, and its version at the time of the last update
+        std::map<Parameter::Id, std::tuple<Parameter, unsigned long>> used_parameters;
+
+        // Flags each parameter (by id) whose value has changed since the last update
+        std::vector<char> changed_parameters;
+
         Implementation(const Parameters & parameters) :
             parameters(parameters)
         {
@@ -99,6 +153,105 @@ namespace eos
             return true;
         }
 
+        static std::vector<double> kinematic_values(const Kinematics & kinematics)
+        {
+            std::vector<double> result;
+            for (const auto & k : kinematics)
+            {
+                result.push_back(k.evaluate());
+            }
+
+            return result;
+        }
+
+        void register_dependencies(const ObservablePtr & observable, const std::vector<ObservableCache::Id> & dependencies = {})
+        {
+            std::vector<Parameter::Id> ids(observable->ParameterUser::begin(), observable->ParameterUser::end());
+            for (const auto & id : ids)
+            {
+                if (used_parameters.count(id) > 0)
+                    continue;
+
+                // use an impossible version as the last known one, which marks the parameter as changed in the next update
+                used_parameters.emplace(id, std::make_tuple(parameters[id], std::numeric_limits<unsigned long>::max()));
+
+                if (id >= changed_parameters.size())
+                    changed_parameters.resize(id + 1, 0);
+            }
+
+            Kinematics kinematics = observable->kinematics();
+            observable_parameter_ids.push_back(std::move(ids));
+            observable_dependencies.push_back(dependencies);
+            observable_sections.push_back(nullptr);
+            observable_kinematics.push_back(std::make_tuple(kinematics, kinematic_values(kinematics)));
+            stale.push_back(1);
+        }
+
+        // the profiling section of an observable, which is named after its current kinematics
+        Profiler::Section * observable_section(const ObservableCache::Id & idx)
+        {
+            auto & section = observable_sections[idx];
+            if (! section)
+            {
+                const auto & o = observables[idx];
+                section = Profiler::instance()->section("observable",
+                        o->name().str() + "[" + o->kinematics().as_string() + "];" + o->options().as_string());
+            }
+
+            return section;
+        }
+
+        // determine which observables need to be re-evaluated, based on the changes since the last update
+        void determine_stale_observables()
+        {
+            for (auto & up : used_parameters)
+            {
+                auto & parameter    = std::get<0>(up.second);
+                auto & last_version = std::get<1>(up.second);
+                const unsigned long version = parameter.version();
+
+                changed_parameters[up.first] = (version != last_version);
+                last_version = version;
+            }
+
+            for (ObservableCache::Id idx = 0 ; idx < observables.size() ; ++idx)
+            {
+                // keep track of the kinematics even for observables that are already stale
+                auto & kinematics = observable_kinematics[idx];
+                auto values = kinematic_values(std::get<0>(kinematics));
+                if (values != std::get<1>(kinematics))
+                {
+                    std::get<1>(kinematics) = std::move(values);
+                    stale[idx] = 1;
+                    observable_sections[idx] = nullptr;
+                }
+
+                if (stale[idx])
+                    continue;
+
+                const auto & ids = observable_parameter_ids[idx];
+
+                // observables that do not report their parameters are always re-evaluated
+                if (ids.empty())
+                {
+                    stale[idx] = 1;
+                    continue;
+                }
+
+                if (std::any_of(ids.cbegin(), ids.cend(), [this](const Parameter::Id & id) { return changed_parameters[id]; }))
+                {
+                    stale[idx] = 1;
+                }
+            }
+
+            // cached observables depend on the intermediate result of their cacheable observable
+            for (const auto & co : cached_observables)
+            {
+                if (stale[std::get<2>(co)])
+                    stale[std::get<1>(co)] = 1;
+            }
+        }
+
         ObservableCache::Id add(const ObservablePtr & observable, const ObservableCache & cache)
         {
             if (observable->parameters() != parameters)
@@ -126,8 +279,12 @@ namespace eos
                 // ensure that the new index is correct, since the ExpressionCacher is capable to modify our cache
                 index = observables.size();
 
+                implementation::CachedObservableIdCollector collector;
+                static_cast<ExpressionObservable *>(cached_expression_observable.get())->expression().accept(collector);
+
                 observables.push_back(cached_expression_observable);
                 predictions.push_back(std::numeric_limits<double>::quiet_NaN());
+                register_dependencies(cached_expression_observable, collector.ids);
                 expression_observables.push_back(std::make_tuple(cached_expression_observable, index));
 
                 return index;
@@ -155,7 +312,8 @@ namespace eos
                     // add the newly created cached observable
                     observables.push_back(cached_observable);
                     predictions.push_back(std::numeric_limits<double>::quiet_NaN());
-                    cached_observables.push_back(std::make_tuple(cached_observable, index));
+                    register_dependencies(cached_observable, { std::get<1>(c->second) });
+                    cached_observables.push_back(std::make_tuple(cached_observable, index, std::get<1>(c->second)));
 
                     return index;
                 }
@@ -163,6 +321,7 @@ namespace eos
                 // else add this new cacheable observable
                 observables.push_back(observable);
                 predictions.push_back(std::numeric_limits<double>::quiet_NaN());
+                register_dependencies(observable);
                 cacheable_observables.insert(std::make_pair(type_index, std::make_tuple(cacheable_observable, index)));
 
                 return index;
@@ -172,6 +331,7 @@ namespace eos
                 // add this new regular observable
                 observables.push_back(observable);
                 predictions.push_back(std::numeric_limits<double>::quiet_NaN());
+                register_dependencies(observable);
                 regular_observables.push_back(std::make_tuple(observable, index));
 
                 return index;
@@ -179,144 +339,186 @@ namespace eos
 
             throw InternalError("should not be reached");
         }
-    };
 
-    ObservableCache::ObservableCache(const Parameters & parameters) :
-        PrivateImplementationPattern<ObservableCache>(new Implementation<ObservableCache>(parameters))
-    {
-    }
+        // mark an observable and all the observables it draws from as selected
+        void select(const ObservableCache::Id & id, std::vector<char> & selected) const
+        {
+            if (selected[id])
+                return;
 
-    ObservableCache::~ObservableCache()
-    {
-    }
+            selected[id] = 1;
+            for (const auto & dependency : observable_dependencies[id])
+            {
+                select(dependency, selected);
+            }
+        }
 
-    ObservableCache::Id
-    ObservableCache::add(const ObservablePtr & observable)
-    {
-        return _imp->add(observable, *this);
-    }
+        // re-evaluate all stale observables; if 'selected' is not empty, restrict the evaluation to the selected observables
+        void update(const std::vector<char> & selected)
+        {
+            static Profiler::Section * update_section = Profiler::instance()->section("cache", "update");
 
-    void
-    ObservableCache::update()
-    {
-        // parallelize the evaluation of the observables
-        std::vector<Ticket> cacheable_tickets;
-        cacheable_tickets.reserve(_imp->cacheable_observables.size());
+            const bool profile = Profiler::instance()->enabled();
+            const auto update_start = profile ? Profiler::Clock::now() : Profiler::Clock::time_point();
 
-        // evaluate all cacheable observables in parallel
-        for (auto co : _imp->cacheable_observables)
-        {
-            auto f = [=]() {
-                auto & o   = std::get<0>(co.second);
-                auto & idx = std::get<1>(co.second);
-                try
-                {
-                    _imp->predictions[idx] = o->evaluate();
-                }
-                catch (eos::Exception & e)
-                {
-                    Log::instance()->message("ObservableCache::update", ll_error)
-                        << "Exception encountered when evaluating cacheable observable '" << o->name() << "[" << o->kinematics().as_string() << "];" << o->options().as_string() << "': "
-                        << e.what();
-                    _imp->predictions[idx] = std::numeric_limits<double>::quiet_NaN();
+            // only re-evaluate those observables that are affected by changes since the last update
+            determine_stale_observables();
 
-                }
+            auto is_due = [&] (const ObservableCache::Id & idx) -> bool
+            {
+                return selected.empty() || selected[idx];
             };
-            cacheable_tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
-        }
 
-        std::vector<Ticket> regular_tickets;
-        regular_tickets.reserve(_imp->regular_observables.size());
+            // collect the stale observables of each kind
+            std::vector<std::tuple<Observable *, ObservableCache::Id>> stale_cacheable_observables;
+            for (const auto & co : cacheable_observables)
+            {
+                if (stale[std::get<1>(co.second)] && is_due(std::get<1>(co.second)))
+                    stale_cacheable_observables.push_back(std::make_tuple(std::get<0>(co.second), std::get<1>(co.second)));
+            }
 
-        // evaluate all regular observables in parallel
-        for (auto ro : _imp->regular_observables)
-        {
-            auto f = [=]() {
-                auto & o   = std::get<0>(ro);
-                auto & idx = std::get<1>(ro);
+            std::vector<std::tuple<Observable *, ObservableCache::Id>> stale_regular_observables;
+            for (const auto & ro : regular_observables)
+            {
+                if (stale[std::get<1>(ro)] && is_due(std::get<1>(ro)))
+                    stale_regular_observables.push_back(std::make_tuple(std::get<0>(ro).get(), std::get<1>(ro)));
+            }
+
+            std::vector<std::tuple<Observable *, ObservableCache::Id>> stale_cached_observables;
+            for (const auto & co : cached_observables)
+            {
+                if (stale[std::get<1>(co)] && is_due(std::get<1>(co)))
+                    stale_cached_observables.push_back(std::make_tuple(std::get<0>(co).get(), std::get<1>(co)));
+            }
+
+            auto evaluate = [this, profile] (const std::tuple<Observable *, ObservableCache::Id> & observable, const char * kind)
+            {
+                auto & o   = std::get<0>(observable);
+                auto & idx = std::get<1>(observable);
+                const auto start = profile ? Profiler::Clock::now() : Profiler::Clock::time_point();
                 try
                 {
-                    _imp->predictions[idx] = o->evaluate();
+                    predictions[idx] = o->evaluate();
                 }
                 catch (eos::Exception & e)
                 {
                     Log::instance()->message("ObservableCache::update", ll_error)
-                        << "Exception encountered when evaluating regular observable '" << o->name() << "[" << o->kinematics().as_string() << "];" << o->options().as_string() << "': "
+                        << "Exception encountered when evaluating " << kind << " observable '" << o->name() << "[" << o->kinematics().as_string() << "];" << o->options().as_string() << "': "
                         << e.what();
-                    _imp->predictions[idx] = std::numeric_limits<double>::quiet_NaN();
-
+                    predictions[idx] = std::numeric_limits<double>::quiet_NaN();
                 }
-            };
-            regular_tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
-        }
 
-        // await completion of the cacheable observables
-        for (auto ticket : cacheable_tickets)
-        {
-            ticket.wait();
-        }
+                if (profile)
+                    Profiler::instance()->record(observable_section(idx), start, Profiler::Clock::now(), predictions[idx]);
+            };
 
-        std::vector<Ticket> cached_tickets;
-        cached_tickets.reserve(_imp->cached_observables.size());
+            // evaluate all cacheable and all regular observables in parallel
+            //
+            // The calling thread participates in the evaluation. This permits calling
+            // update() from within a job of the ThreadPool, e.g., when evaluating
+            // independent clones of a LogPosterior in parallel.
+            const unsigned number_of_cacheable_observables = stale_cacheable_observables.size();
+            ThreadPool::instance()->parallel_for(number_of_cacheable_observables + stale_regular_observables.size(), [&] (unsigned i)
+            {
+                if (i < number_of_cacheable_observables)
+                    evaluate(stale_cacheable_observables[i], "cacheable");
+                else
+                    evaluate(stale_regular_observables[i - number_of_cacheable_observables], "regular");
+            });
+
+            // evaluate all cached observables in parallel, once their cacheable parents are up to date
+            ThreadPool::instance()->parallel_for(stale_cached_observables.size(),
+                    [&] (unsigned i) { evaluate(stale_cached_observables[i], "cached"); });
+
+            // evaluate all expression observables in a serial fashion
+            //
+            // This is necessary, since an expression observable can rely on
+            // another expression observable, which would be located earlier in
+            // the sequence.
+            // Serial evaluation ensures that no race conditions arise.
+            // There is not reason to optimize this, since expression observables
+            // are evaluated very quickly.
+            // For the same reason, expression observables are always re-evaluated.
+            for (auto eo : expression_observables)
+            {
+                auto & o   = std::get<0>(eo);
+                auto & idx = std::get<1>(eo);
+                if (! is_due(idx))
+                    continue;
 
-        // evaluate all cached observables in parallel
-        for (auto co : _imp->cached_observables)
-        {
-            auto f = [=]() {
-                auto & o   = std::get<0>(co);
-                auto & idx = std::get<1>(co);
+                const auto start = profile ? Profiler::Clock::now() : Profiler::Clock::time_point();
                 try
                 {
-                    _imp->predictions[idx] = o->evaluate();
+                    predictions[idx] = o->evaluate();
                 }
                 catch (eos::Exception & e)
                 {
                     Log::instance()->message("ObservableCache::update", ll_error)
-                        << "Exception encountered when evaluating cached observable '" << o->name() << "[" << o->kinematics().as_string() << "];" << o->options().as_string() << "': "
+                        << "Exception encountered when evaluating expression observable '" << o->name() << "[" << o->kinematics().as_string() << "];" << o->options().as_string() << "': "
                         << e.what();
-                    _imp->predictions[idx] = std::numeric_limits<double>::quiet_NaN();
-
+                    predictions[idx] = std::numeric_limits<double>::quiet_NaN();
                 }
-            };
-            cached_tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
-        }
 
-        // await completion of the regular observables
-        for (auto ticket : regular_tickets)
-        {
-            ticket.wait();
-        }
-
-        // await completion of the cached observables
-        for (auto ticket : cached_tickets)
-        {
-            ticket.wait();
-        }
+                if (profile)
+                    Profiler::instance()->record(observable_section(idx), start, Profiler::Clock::now(), predictions[idx]);
+            }
 
-        // evaluate all expression observables in a serial fashion
-        //
-        // This is necessary, since an expression observable can rely on
-        // another expression observable, which would be located earlier in
-        // the sequence.
-        // Serial evaluation ensures that no race conditions arise.
-        // There is not reason to optimize this, since expression observables
-        // are evaluated very quickly.
-        for (auto eo : _imp->expression_observables)
-        {
-            auto & o   = std::get<0>(eo);
-            auto & idx = std::get<1>(eo);
-            try
+            // observables that were not selected remain stale until their next evaluation
+            if (selected.empty())
             {
-                _imp->predictions[idx] = o->evaluate();
+                std::fill(stale.begin(), stale.end(), 0);
             }
-            catch (eos::Exception & e)
+            else
             {
-                Log::instance()->message("ObservableCache::update", ll_error)
-                    << "Exception encountered when evaluating expression observable '" << o->name() << "[" << o->kinematics().as_string() << "];" << o->options().as_string() << "': "
-                    << e.what();
-                _imp->predictions[idx] = std::numeric_limits<double>::quiet_NaN();
+                for (ObservableCache::Id idx = 0 ; idx < stale.size() ; ++idx)
+                {
+                    if (selected[idx])
+                        stale[idx] = 0;
+                }
             }
+
+            if (profile)
+                Profiler::instance()->record(update_section, update_start, Profiler::Clock::now());
+        }
+    };
+
+    ObservableCache::ObservableCache(const Parameters & parameters) :
+        PrivateImplementationPattern<ObservableCache>(new Implementation<ObservableCache>(parameters))
+    {
+    }
+
+    ObservableCache::~ObservableCache()
+    {
+    }
+
+    ObservableCache::Id
+    ObservableCache::add(const ObservablePtr & observable)
+    {
+        return _imp->add(observable, *this);
+    }
+
+    void
+    ObservableCache::update()
+    {
+        _imp->update(std::vector<char>());
+    }
+
+    void
+    ObservableCache::update(const std::vector<ObservableCache::Id> & ids)
+    {
+        std::vector<char> selected(_imp->observables.size(), 0);
+        for (const auto & id : ids)
+        {
+            _imp->select(id, selected);
         }
+
+        _imp->update(selected);
+    }
+
+    void
+    ObservableCache::invalidate()
+    {
+        std::fill(_imp->stale.begin(), _imp->stale.end(), 1);
     }
 
     Parameters
@@ -331,6 +533,12 @@ namespace eos
         return _imp->predictions[id];
     }
 
+    void
+    ObservableCache::set_prediction(const ObservableCache::Id & id, const double & value)
+    {
+        _imp->predictions[id] = value;
+    }
+
     ObservablePtr
     ObservableCache::observable(const ObservableCache::Id & id) const
     {
@@ -364,7 +572,8 @@ namespace eos
         {
             // cloning cached observables creates independent *cacheable* observables
             // adding them back creates new and independent cached observables
-            result._imp->add((*o)->clone(parameters), *this);
+            // expression observables add their sub-observables to the new cache
+            result._imp->add((*o)->clone(parameters), result);
         }
 
         result.update();
@@ -56,9 +56,29 @@ namespace eos
              */
             Id add(const ObservablePtr & observable);
 
-            /// Update the predictions for all observables.
+            /*!
+             * Update the predictions for all observables.
+             *
+             * Only those observables are re-evaluated that use at least one parameter
+             * or kinematic variable whose value has changed since the last update.
+             * Observables that do not report any used parameters are always re-evaluated.
+             */
             void update();
 
+            /*!
+             * Update the predictions for a subset of the observables.
+             *
+             * Only the given observables and the observables whose predictions they draw
+             * from are re-evaluated, if stale. All other observables remain stale until
+             * they are updated.
+             *
+             * @param ids The ids of the observables which shall be updated.
+             */
+            void update(const std::vector<Id> & ids);
+
+            /// Force the re-evaluation of all observables in the next update.
+            void invalidate();
+
             /// Retrieve the cache's common Parameters object.
             Parameters parameters() const;
 
@@ -76,6 +96,18 @@ namespace eos
              */
             double operator[] (const ObservableCache::Id & id) const;
 
+            /*!
+             * Override the prediction for a given observable until its next re-evaluation.
+             *
+             * This permits evaluating likelihoods for hypothetical predictions, e.g., when
+             * propagating exact derivatives. The caller is responsible for restoring the
+             * original prediction.
+             *
+             * @param id    The unique ObservableCache::Id whose associated observable's prediction shall be overridden.
+             * @param value The new prediction.
+             */
+            void set_prediction(const ObservableCache::Id & id, const double & value);
+
             /// Retrieve the number of independent predictions from the cache.
             unsigned size() const;
 
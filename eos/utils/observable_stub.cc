@@ -66,6 +66,12 @@ namespace eos
         return _imp->parameter.evaluate();
     }
 
+    std::vector<std::pair<Parameter::Id, double>>
+    ObservableStub::derivatives() const
+    {
+        return { { _imp->parameter.id(), 1.0 } };
+    }
+
     Kinematics
     ObservableStub::kinematics()
     {
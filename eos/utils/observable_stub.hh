@@ -39,6 +39,8 @@ namespace eos
 
             virtual double evaluate() const;
 
+            virtual std::vector<std::pair<Parameter::Id, double>> derivatives() const;
+
             virtual Kinematics kinematics();
 
             virtual Parameters parameters();
@@ -47,6 +47,11 @@ class ObservableStubTest :
 
                 p = p.central();
                 TEST_CHECK_EQUAL(p(), o->evaluate());
+
+                const auto derivatives = o->derivatives();
+                TEST_CHECK_EQUAL(1u, derivatives.size());
+                TEST_CHECK_EQUAL(p.id(), derivatives[0].first);
+                TEST_CHECK_EQUAL(1.0, derivatives[0].second);
             }
 
             // Cloning w/ anonymous parameters
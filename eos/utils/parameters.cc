@@ -30,7 +30,9 @@
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
 #include <cmath>
+#include <cstddef>
 #include <map>
+#include <new>
 #include <random>
 #include <vector>
 
@@ -186,21 +188,71 @@ namespace eos
     struct Parameter::Data :
         Parameter::Template
     {
-        double value;
-
         Parameter::Id id;
 
         Data(const Parameter::Template & t, const Parameter::Id & i) :
             Parameter::Template(t),
-            value(t.central),
             id(i)
         {
         }
     };
 
+    namespace implementation
+    {
+        // allocates storage that starts on a cache line boundary
+        template <typename T_>
+        struct CacheLineAllocator
+        {
+            using value_type = T_;
+
+            static constexpr std::size_t alignment = 64;
+
+            CacheLineAllocator() = default;
+
+            template <typename U_> CacheLineAllocator(const CacheLineAllocator<U_> &) { }
+
+            T_ * allocate(std::size_t n)
+            {
+                return static_cast<T_ *>(::operator new(n * sizeof(T_), std::align_val_t(alignment)));
+            }
+
+            void deallocate(T_ * p, std::size_t)
+            {
+                ::operator delete(p, std::align_val_t(alignment));
+            }
+
+            template <typename U_> bool operator== (const CacheLineAllocator<U_> &) const { return true; }
+            template <typename U_> bool operator!= (const CacheLineAllocator<U_> &) const { return false; }
+        };
+    }
+
+    /*
+     * The numeric values and their modification counters are stored in dense arrays, separate
+     * from the parameters' meta data. Evaluating or setting a parameter therefore only touches
+     * the cache lines that hold its value and version.
+     */
     struct Parameters::Data
     {
-        std::vector<Parameter::Data> data;
+        std::vector<double, implementation::CacheLineAllocator<double>> values;
+
+        std::vector<unsigned long> versions;
+
+        std::vector<Parameter::Data> metadata;
+
+        void add(const Parameter::Template & t, const Parameter::Id & id)
+        {
+            metadata.push_back(Parameter::Data(t, id));
+            values.push_back(t.central);
+            versions.push_back(0);
+        }
+
+        inline void set(const Parameter::Id & id, const double & value)
+        {
+            if (values[id] != value)
+                ++versions[id];
+
+            values[id] = value;
+        }
     };
 
     template <>
@@ -234,7 +286,7 @@ namespace eos
             unsigned idx(0);
             for (auto i(list.begin()), i_end(list.end()) ; i != i_end ; ++i, ++idx)
             {
-                parameters_data->data.push_back(Parameter::Data(*i, idx));
+                parameters_data->add(*i, idx);
                 parameters_map[i->name] = idx;
                 parameters.push_back(Parameter(parameters_data, idx));
             }
@@ -245,7 +297,7 @@ namespace eos
             parameters_map(other.parameters_map)
         {
             parameters.reserve(other.parameters.size());
-            for (unsigned i = 0 ; i != parameters.size() ; ++i)
+            for (unsigned i = 0 ; i != other.parameters.size() ; ++i)
             {
                 parameters.push_back(Parameter(parameters_data, i));
             }
@@ -323,18 +375,18 @@ namespace eos
                         Log::instance()->message("[parameters.override]", ll_informational)
                             << "Overriding existing parameter '" << name << "' with central value '" << central << "'";
 
-                        parameters_data->data[i->second].value = central;
+                        parameters_data->set(i->second, central);
                         if (has_min)
                         {
-                            parameters_data->data[i->second].min = min;
+                            parameters_data->metadata[i->second].min = min;
                         }
                         if (has_max)
                         {
-                            parameters_data->data[i->second].max = max;
+                            parameters_data->metadata[i->second].max = max;
                         }
                         if (has_latex)
                         {
-                            parameters_data->data[i->second].latex = latex;
+                            parameters_data->metadata[i->second].latex = latex;
                         }
                     }
                     else
@@ -351,8 +403,8 @@ namespace eos
                             max = central;
                         }
 
-                        auto idx = parameters_data->data.size();
-                        parameters_data->data.push_back(Parameter::Data(Parameter::Template { QualifiedName(name), min, central, max, latex }, idx));
+                        auto idx = parameters_data->metadata.size();
+                        parameters_data->add(Parameter::Template { QualifiedName(name), min, central, max, latex }, idx);
                         parameters_map[name] = idx;
                         parameters.push_back(Parameter(parameters_data, idx));
                     }
@@ -502,7 +554,7 @@ namespace eos
                                     throw ParameterInputDuplicateError(file, name);
                                 }
 
-                                parameters_data->data.push_back(Parameter::Data(Parameter::Template { QualifiedName(name), min, central, max, latex }, idx));
+                                parameters_data->add(Parameter::Template { QualifiedName(name), min, central, max, latex }, idx);
                                 parameters_map[name] = idx;
                                 parameters.push_back(Parameter(parameters_data, idx));
                                 group_parameters.push_back(Parameter(parameters_data, idx));
@@ -554,7 +606,7 @@ namespace eos
                                             throw ParameterInputDuplicateError(file, qn.str());
                                         }
 
-                                        parameters_data->data.push_back(Parameter::Data(Parameter::Template { qn, min, central, max, templated_latex.str() }, idx));
+                                        parameters_data->add(Parameter::Template { qn, min, central, max, templated_latex.str() }, idx);
                                         parameters_map[templated_name.str()] = idx;
                                         parameters.push_back(Parameter(parameters_data, idx));
                                         group_parameters.push_back(Parameter(parameters_data, idx));
@@ -622,7 +674,7 @@ namespace eos
 
         // create new parameter
         unsigned idx = _imp->parameters.size();
-        _imp->parameters_data->data.push_back(Parameter::Data(Parameter::Template { name, value, value, value, "LaTeX display not supported for run-time declared parameters" }, idx));
+        _imp->parameters_data->add(Parameter::Template { name, value, value, value, "LaTeX display not supported for run-time declared parameters" }, idx);
         _imp->parameters_map[name] = idx;
         _imp->parameters.push_back(Parameter(_imp->parameters_data, idx));
 
@@ -637,7 +689,34 @@ namespace eos
         if (_imp->parameters_map.end() == i)
             throw UnknownParameterError(name);
 
-        _imp->parameters_data->data[i->second].value = value;
+        _imp->parameters_data->set(i->second, value);
+    }
+
+    void
+    Parameters::set_values(const Parameter::Id * ids, const double * values, const std::size_t & n)
+    {
+        auto & data = *_imp->parameters_data;
+        const std::size_t size = data.values.size();
+
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            if (ids[i] >= size)
+                throw InternalError("Parameters::set_values: invalid id '" + stringify(ids[i]) + "'");
+        }
+
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            data.set(ids[i], values[i]);
+        }
+    }
+
+    void
+    Parameters::set_values(const std::vector<Parameter::Id> & ids, const std::vector<double> & values)
+    {
+        if (ids.size() != values.size())
+            throw InternalError("Parameters::set_values: number of ids '" + stringify(ids.size()) + "' does not match number of values '" + stringify(values.size()) + "'");
+
+        set_values(ids.data(), values.data(), ids.size());
     }
 
     bool
@@ -719,25 +798,25 @@ namespace eos
 
     Parameter::operator double () const
     {
-        return _parameters_data->data[_index].value;
+        return _parameters_data->values[_index];
     }
 
     double
     Parameter::operator() () const
     {
-        return _parameters_data->data[_index].value;
+        return _parameters_data->values[_index];
     }
 
     double
     Parameter::evaluate() const
     {
-        return _parameters_data->data[_index].value;
+        return _parameters_data->values[_index];
     }
 
     const Parameter &
     Parameter::operator= (const double & value)
     {
-        _parameters_data->data[_index].value = value;
+        _parameters_data->set(_index, value);
 
         return *this;
     }
@@ -745,55 +824,61 @@ namespace eos
     void
     Parameter::set(const double & value)
     {
-        _parameters_data->data[_index].value = value;
+        _parameters_data->set(_index, value);
+    }
+
+    unsigned long
+    Parameter::version() const
+    {
+        return _parameters_data->versions[_index];
     }
 
     const double &
     Parameter::central() const
     {
-        return _parameters_data->data[_index].central;
+        return _parameters_data->metadata[_index].central;
     }
 
     const double &
     Parameter::max() const
     {
-        return _parameters_data->data[_index].max;
+        return _parameters_data->metadata[_index].max;
     }
 
     void
     Parameter::set_max(const double & value)
     {
-        _parameters_data->data[_index].max = value;
+        _parameters_data->metadata[_index].max = value;
     }
 
     const double &
     Parameter::min() const
     {
-        return _parameters_data->data[_index].min;
+        return _parameters_data->metadata[_index].min;
     }
 
     void
     Parameter::set_min(const double & value)
     {
-        _parameters_data->data[_index].min = value;
+        _parameters_data->metadata[_index].min = value;
     }
 
     const std::string &
     Parameter::name() const
     {
-        return _parameters_data->data[_index].name.str();
+        return _parameters_data->metadata[_index].name.str();
     }
 
     const std::string &
     Parameter::latex() const
     {
-        return _parameters_data->data[_index].latex;
+        return _parameters_data->metadata[_index].latex;
     }
 
     Parameter::Id
     Parameter::id() const
     {
-        return _parameters_data->data[_index].id;
+        return _parameters_data->metadata[_index].id;
     }
 
     /* ParameterUser */
@@ -28,7 +28,9 @@
 #include <eos/utils/qualified-name.hh>
 #include <eos/utils/wrapped_forward_iterator.hh>
 
+#include <cstddef>
 #include <set>
+#include <vector>
 
 namespace eos
 {
@@ -158,6 +160,25 @@ namespace eos
              */
             void set(const QualifiedName & name, const double & value);
 
+            /*!
+             * Set the numeric values of several parameters at once.
+             *
+             * All ids are checked before any value is changed.
+             *
+             * @param ids    Pointer to the ids of the parameters whose numeric values shall be changed.
+             * @param values Pointer to the new numeric values, in the same order as the ids.
+             * @param n      The number of parameters.
+             */
+            void set_values(const unsigned * ids, const double * values, const std::size_t & n);
+
+            /*!
+             * Set the numeric values of several parameters at once.
+             *
+             * @param ids    The ids of the parameters whose numeric values shall be changed.
+             * @param values The new numeric values, in the same order as the ids.
+             */
+            void set_values(const std::vector<unsigned> & ids, const std::vector<double> & values);
+
             /*!
              * Verify if a parameter with a given name exists.
              *
@@ -257,6 +278,14 @@ namespace eos
 
             /// Set a Parameter's numeric value.
             virtual void set(const double &);
+
+            /*!
+             * Retrieve the number of changes to the Parameter's numeric value.
+             *
+             * The counter is shared by all Parameter objects that handle the same
+             * parameter, and is incremented whenever the numeric value changes.
+             */
+            unsigned long version() const;
             ///@}
 
             ///@name Access to Meta Data
@@ -80,5 +80,64 @@ class ParametersTest :
                 TEST_CHECK_EQUAL(p.has("mass::tau"), true);
                 TEST_CHECK_EQUAL(p.has("mass::boing747"), false);
             }
+
+            // Version counters
+            {
+                Parameters p = Parameters::Defaults();
+                Parameter m_c = p["mass::c"];
+                Parameter m_c_other = p["mass::c"];
+                Parameter m_b = p["mass::b(MSbar)"];
+
+                const unsigned long version = m_c.version();
+                TEST_CHECK_EQUAL(m_c_other.version(), version);
+
+                // setting the current value is not a change
+                m_c = m_c();
+                TEST_CHECK_EQUAL(m_c.version(), version);
+
+                m_c = 0.0;
+                TEST_CHECK_EQUAL(m_c.version(),       version + 1);
+                TEST_CHECK_EQUAL(m_c_other.version(), version + 1);
+
+                p.set("mass::c", 1.0);
+                TEST_CHECK_EQUAL(m_c.version(),       version + 2);
+
+                // clones keep their own counters
+                Parameters clone = p.clone();
+                clone["mass::c"] = 2.0;
+                TEST_CHECK_EQUAL(m_c.version(),       version + 2);
+                TEST_CHECK_EQUAL(clone["mass::c"].version(), version + 3);
+
+                const unsigned long version_b = m_b.version();
+                m_c = m_c.central();
+                TEST_CHECK_EQUAL(m_b.version(), version_b);
+            }
+
+            // Parameters::set_values
+            {
+                Parameters p = Parameters::Defaults();
+                Parameter m_c = p["mass::c"];
+                Parameter m_b = p["mass::b(MSbar)"];
+
+                const unsigned long version_c = m_c.version(), version_b = m_b.version();
+
+                p.set_values(std::vector<Parameter::Id>{ m_c.id(), m_b.id() }, std::vector<double>{ 1.5, 4.5 });
+                TEST_CHECK_EQUAL(m_c(), 1.5);
+                TEST_CHECK_EQUAL(m_b(), 4.5);
+                TEST_CHECK_EQUAL(m_c.version(), version_c + 1);
+                TEST_CHECK_EQUAL(m_b.version(), version_b + 1);
+
+                const Parameter::Id ids[] = { m_b.id() };
+                const double values[] = { 4.2 };
+                p.set_values(ids, values, 1);
+                TEST_CHECK_EQUAL(m_b(), 4.2);
+
+                // size mismatch
+                TEST_CHECK_THROWS(InternalError, p.set_values(std::vector<Parameter::Id>{ m_c.id() }, std::vector<double>{ 1.0, 2.0 }));
+
+                // invalid ids leave all values unchanged
+                TEST_CHECK_THROWS(InternalError, p.set_values(std::vector<Parameter::Id>{ m_c.id(), 1000000u }, std::vector<double>{ 1.0, 2.0 }));
+                TEST_CHECK_EQUAL(m_c(), 1.5);
+            }
         }
 } parameters_test;
@@ -0,0 +1,436 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <config.h>
+
+#include <eos/utils/exception.hh>
+#include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/persistent-cache.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace eos
+{
+    namespace implementation
+    {
+        namespace persistent_cache
+        {
+            static const char magic[8] = { 'E', 'O', 'S', 'C', 'A', 'C', 'H', 'E' };
+
+            static const std::uint32_t version = 2;
+
+            struct Header
+            {
+                char magic[8];
+
+                std::uint32_t version;
+
+                std::uint32_t payload_size;
+
+                std::uint64_t capacity;
+
+                // hash of the release and the revision of EOS that created the file
+                std::uint64_t build;
+
+                char padding[32];
+            };
+
+            static_assert(sizeof(Header) == 64, "PersistentCache: unexpected header size");
+
+            // the state of a slot; slots are never modified after they have become ready
+            enum SlotState : std::uint32_t
+            {
+                ss_empty = 0,
+                ss_writing = 1,
+                ss_ready = 2
+            };
+
+            struct Slot
+            {
+                std::uint32_t state;
+
+                std::uint32_t size;
+
+                std::uint64_t key[2];
+
+                unsigned char payload[PersistentCache::payload_size];
+            };
+
+            // the maximal number of slots that are probed for each key
+            static const unsigned max_probes = 32;
+
+            static std::uint64_t fnv1a(std::uint64_t hash, const unsigned char * data, const std::size_t & size)
+            {
+                for (std::size_t i = 0 ; i < size ; ++i)
+                {
+                    hash ^= data[i];
+                    hash *= 0x100000001b3ull;
+                }
+
+                return hash;
+            }
+
+            static std::uint64_t mix(std::uint64_t h)
+            {
+                h ^= h >> 33;
+                h *= 0xff51afd7ed558ccdull;
+                h ^= h >> 33;
+                h *= 0xc4ceb9fe1a85ec53ull;
+                h ^= h >> 33;
+
+                return h;
+            }
+
+            // results of one build of EOS must not be used by another one
+            static std::uint64_t build()
+            {
+                static const char release[] = PACKAGE_VERSION;
+                static const char revision[] = EOS_GITHEAD;
+
+                std::uint64_t result = 0xcbf29ce484222325ull;
+                result = fnv1a(result, reinterpret_cast<const unsigned char *>(release), sizeof(release));
+                result = fnv1a(result, reinterpret_cast<const unsigned char *>(revision), sizeof(revision));
+
+                return mix(result);
+            }
+        }
+    }
+
+    using namespace implementation::persistent_cache;
+
+    PersistentCache::Hasher::Hasher(const char * id) :
+        _key{ 0xcbf29ce484222325ull, 0x84222325cbf29ce4ull }
+    {
+        add(id, std::strlen(id) + 1);
+    }
+
+    void
+    PersistentCache::Hasher::add(const void * data, const std::size_t & size)
+    {
+        const unsigned char * bytes = static_cast<const unsigned char *>(data);
+        _key.first  = fnv1a(_key.first, bytes, size);
+        _key.second = fnv1a(_key.second ^ size, bytes, size);
+    }
+
+    PersistentCache::Key
+    PersistentCache::Hasher::key() const
+    {
+        return Key{ mix(_key.first), mix(_key.second ^ _key.first) };
+    }
+
+    template <>
+    struct Implementation<PersistentCache>
+    {
+        // the open cache file, on which a shared lock is held while it is mapped
+        int fd;
+
+        void * mapping;
+
+        std::size_t mapping_size;
+
+        Slot * slots;
+
+        std::uint64_t capacity;
+
+        mutable std::atomic<unsigned long> hits;
+
+        mutable std::atomic<unsigned long> misses;
+
+        Implementation() :
+            fd(-1),
+            mapping(nullptr),
+            mapping_size(0),
+            slots(nullptr),
+            capacity(0),
+            hits(0),
+            misses(0)
+        {
+        }
+
+        ~Implementation()
+        {
+            close();
+        }
+
+        void open(const std::string & path, const unsigned long & new_capacity)
+        {
+            close();
+
+            fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+            if (fd < 0)
+                throw InternalError("PersistentCache: cannot open '" + path + "': " + std::strerror(errno));
+
+            /*
+             * Every process holds a shared lock on the file while it is mapped. The exclusive lock
+             * is only granted if no other process uses the file. Its holder creates the file if needed,
+             * and reclaims the slots that have been left by writers that terminated abnormally.
+             */
+            const bool exclusive = (0 == ::flock(fd, LOCK_EX | LOCK_NB));
+            if (! exclusive)
+                ::flock(fd, LOCK_SH);
+
+            try
+            {
+                struct stat status;
+                if (0 != ::fstat(fd, &status))
+                    throw InternalError("PersistentCache: cannot determine the size of '" + path + "': " + std::strerror(errno));
+
+                if ((0 == status.st_size) && exclusive)
+                {
+                    if (0 == new_capacity)
+                        throw InternalError("PersistentCache: the capacity of '" + path + "' must be positive");
+
+                    Header header;
+                    std::memset(&header, 0, sizeof(header));
+                    std::memcpy(header.magic, magic, sizeof(magic));
+                    header.version = version;
+                    header.payload_size = PersistentCache::payload_size;
+                    header.capacity = new_capacity;
+                    header.build = build();
+
+                    // the slots remain sparse until they are written
+                    if ((0 != ::ftruncate(fd, sizeof(Header) + new_capacity * sizeof(Slot)))
+                            || (sizeof(Header) != ::pwrite(fd, &header, sizeof(Header), 0)))
+                        throw InternalError("PersistentCache: cannot create '" + path + "': " + std::strerror(errno));
+
+                    status.st_size = sizeof(Header) + new_capacity * sizeof(Slot);
+                }
+
+                Header header;
+                if ((status.st_size < off_t(sizeof(Header))) || (sizeof(Header) != ::pread(fd, &header, sizeof(Header), 0))
+                        || (0 != std::memcmp(header.magic, magic, sizeof(magic))))
+                    throw InternalError("PersistentCache: '" + path + "' is not a cache file");
+
+                if ((version != header.version) || (PersistentCache::payload_size != header.payload_size))
+                    throw InternalError("PersistentCache: '" + path + "' has an incompatible format");
+
+                if (build() != header.build)
+                    throw InternalError("PersistentCache: '" + path + "' has been created by a different build of EOS");
+
+                if (std::uint64_t(status.st_size) < sizeof(Header) + header.capacity * sizeof(Slot))
+                    throw InternalError("PersistentCache: '" + path + "' is truncated");
+
+                mapping_size = sizeof(Header) + header.capacity * sizeof(Slot);
+                mapping = ::mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (MAP_FAILED == mapping)
+                {
+                    mapping = nullptr;
+                    throw InternalError("PersistentCache: cannot map '" + path + "': " + std::strerror(errno));
+                }
+
+                slots = reinterpret_cast<Slot *>(static_cast<char *>(mapping) + sizeof(Header));
+                capacity = header.capacity;
+            }
+            catch (...)
+            {
+                close();
+                throw;
+            }
+
+            if (exclusive)
+            {
+                reclaim();
+                ::flock(fd, LOCK_SH);
+            }
+        }
+
+        // free the slots whose writers have terminated; only valid while no other process uses the file
+        void reclaim()
+        {
+            unsigned long reclaimed = 0;
+            for (std::uint64_t i = 0 ; i < capacity ; ++i)
+            {
+                if (ss_writing != slots[i].state)
+                    continue;
+
+                slots[i].state = ss_empty;
+                ++reclaimed;
+            }
+
+            if (reclaimed > 0)
+            {
+                Log::instance()->message("PersistentCache::open", ll_informational)
+                    << "Reclaimed " << reclaimed << " incompletely written slots";
+            }
+        }
+
+        void close()
+        {
+            if (mapping)
+                ::munmap(mapping, mapping_size);
+
+            if (fd >= 0)
+                ::close(fd);
+
+            fd = -1;
+            mapping = nullptr;
+            mapping_size = 0;
+            slots = nullptr;
+            capacity = 0;
+        }
+
+        bool lookup(const PersistentCache::Key & key, void * result, const unsigned & size) const
+        {
+            for (unsigned i = 0 ; i < max_probes ; ++i)
+            {
+                const Slot & slot = slots[(key.first + i) % capacity];
+                const std::uint32_t state = __atomic_load_n(&slot.state, __ATOMIC_ACQUIRE);
+
+                if (ss_empty == state)
+                    break;
+
+                if ((ss_ready == state) && (key.first == slot.key[0]) && (key.second == slot.key[1]) && (size == slot.size))
+                {
+                    std::memcpy(result, slot.payload, size);
+                    ++hits;
+
+                    return true;
+                }
+            }
+
+            ++misses;
+
+            return false;
+        }
+
+        void insert(const PersistentCache::Key & key, const void * result, const unsigned & size)
+        {
+            for (unsigned i = 0 ; i < max_probes ; ++i)
+            {
+                Slot & slot = slots[(key.first + i) % capacity];
+                std::uint32_t state = __atomic_load_n(&slot.state, __ATOMIC_ACQUIRE);
+
+                if ((ss_ready == state) && (key.first == slot.key[0]) && (key.second == slot.key[1]))
+                    return;
+
+                // claim an empty slot; the slot's content is published once its state becomes ready
+                if ((ss_empty == state) && __atomic_compare_exchange_n(&slot.state, &state, std::uint32_t(ss_writing), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+                {
+                    slot.key[0] = key.first;
+                    slot.key[1] = key.second;
+                    slot.size = size;
+                    std::memcpy(slot.payload, result, size);
+                    __atomic_store_n(&slot.state, std::uint32_t(ss_ready), __ATOMIC_RELEASE);
+
+                    return;
+                }
+            }
+
+            // all probed slots are taken; do not store the result
+        }
+    };
+
+    template class InstantiationPolicy<PersistentCache, Singleton>;
+
+    PersistentCache::PersistentCache() :
+        PrivateImplementationPattern<PersistentCache>(new Implementation<PersistentCache>)
+    {
+        const char * path = std::getenv("EOS_PERSISTENT_CACHE");
+        if ((! path) || ('\0' == *path))
+            return;
+
+        unsigned long capacity = default_capacity;
+        if (const char * envvar = std::getenv("EOS_PERSISTENT_CACHE_CAPACITY"))
+        {
+            long result = std::strtol(envvar, nullptr, 10);
+            if (result > 0)
+                capacity = result;
+        }
+
+        try
+        {
+            _imp->open(path, capacity);
+        }
+        catch (InternalError & e)
+        {
+            Log::instance()->message("PersistentCache::PersistentCache", ll_warning)
+                << "Persistent cache disabled: " << e.what();
+        }
+    }
+
+    PersistentCache::~PersistentCache()
+    {
+    }
+
+    PersistentCache *
+    PersistentCache::instance()
+    {
+        return InstantiationPolicy<PersistentCache, Singleton>::instance();
+    }
+
+    void
+    PersistentCache::open(const std::string & path, const unsigned long & capacity)
+    {
+        _imp->open(path, capacity);
+    }
+
+    void
+    PersistentCache::close()
+    {
+        _imp->close();
+    }
+
+    bool
+    PersistentCache::enabled() const
+    {
+        return nullptr != _imp->mapping;
+    }
+
+    unsigned long
+    PersistentCache::hits() const
+    {
+        return _imp->hits.load();
+    }
+
+    unsigned long
+    PersistentCache::misses() const
+    {
+        return _imp->misses.load();
+    }
+
+    bool
+    PersistentCache::lookup(const Key & key, void * result, const unsigned & size) const
+    {
+        if ((! _imp->mapping) || (size > payload_size))
+            return false;
+
+        return _imp->lookup(key, result, size);
+    }
+
+    void
+    PersistentCache::insert(const Key & key, const void * result, const unsigned & size)
+    {
+        if ((! _imp->mapping) || (size > payload_size))
+            return;
+
+        _imp->insert(key, result, size);
+    }
+}
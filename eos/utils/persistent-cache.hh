@@ -0,0 +1,170 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_PERSISTENT_CACHE_HH
+#define EOS_GUARD_EOS_UTILS_PERSISTENT_CACHE_HH 1
+
+#include <eos/utils/instantiation_policy.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+
+namespace eos
+{
+    /*!
+     * PersistentCache keeps the results of expensive, deterministic functions in a memory-mapped file,
+     * such that they can be reused by concurrent processes and across runs.
+     *
+     * Results are keyed by a stable identifier of the function and by the bit patterns of its arguments.
+     * The file holds a fixed-size, insert-only hash table. Its entries are published atomically, such that
+     * any number of processes and threads can read from and write to the same file without further locking.
+     * Once the table is full, new results are no longer stored.
+     *
+     * The cache is opt-in: it is disabled unless opened explicitly or via the environment variable
+     * EOS_PERSISTENT_CACHE, which holds the path of the cache file. The environment variable
+     * EOS_PERSISTENT_CACHE_CAPACITY sets the number of entries of a newly created file.
+     *
+     * The identifier of a function must change whenever its implementation changes its results.
+     * In addition, files are only used by the release and revision of EOS that created them.
+     * Entries whose writer terminated before completing them are reclaimed once the file is
+     * opened while no other process uses it.
+     */
+    class PersistentCache :
+        public InstantiationPolicy<PersistentCache, Singleton>,
+        public PrivateImplementationPattern<PersistentCache>
+    {
+        public:
+            /// The largest size of a result in bytes.
+            static constexpr unsigned payload_size = 256u;
+
+            /// The number of entries of a newly created file, unless set otherwise.
+            static constexpr unsigned long default_capacity = 1ul << 16;
+
+            /// A 128 bit key.
+            struct Key
+            {
+                std::uint64_t first, second;
+            };
+
+            /// Accumulates a Key from the identifier of a function and its arguments.
+            class Hasher
+            {
+                private:
+                    Key _key;
+
+                public:
+                    Hasher(const char * id);
+
+                    void add(const void * data, const std::size_t & size);
+
+                    template <typename T_> void add(const T_ & value)
+                    {
+                        static_assert(std::is_trivially_copyable<T_>::value, "PersistentCache: arguments must be trivially copyable");
+                        add(&value, sizeof(T_));
+                    }
+
+                    Key key() const;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /// Constructor. Opens the cache file given by EOS_PERSISTENT_CACHE, if set.
+            PersistentCache();
+
+            /// Destructor.
+            ~PersistentCache();
+            ///@}
+
+            static PersistentCache * instance();
+
+            /*!
+             * Open a cache file, or create a new one. Must not be called concurrently with lookups or insertions.
+             *
+             * @param path     The path of the cache file.
+             * @param capacity The number of entries, if the file is created.
+             */
+            void open(const std::string & path, const unsigned long & capacity = default_capacity);
+
+            /// Close the cache file, thereby disabling the cache. Must not be called concurrently with lookups or insertions.
+            void close();
+
+            /// Return true if a cache file is open.
+            bool enabled() const;
+
+            /// Retrieve the number of lookups that were answered from the cache file.
+            unsigned long hits() const;
+
+            /// Retrieve the number of lookups that were not answered from the cache file.
+            unsigned long misses() const;
+
+            /*!
+             * Look up a result.
+             *
+             * @param key    The key of the result.
+             * @param result Destination of the result.
+             * @param size   The size of the result in bytes.
+             * @return true if the result was found.
+             */
+            bool lookup(const Key & key, void * result, const unsigned & size) const;
+
+            /*!
+             * Insert a result. Does nothing if the cache is disabled or full.
+             *
+             * @param key    The key of the result.
+             * @param result The result.
+             * @param size   The size of the result in bytes.
+             */
+            void insert(const Key & key, const void * result, const unsigned & size);
+
+            /*!
+             * Return the result of f(p ...), either from the cache file or by calling f.
+             *
+             * @param id A stable and unique identifier of f.
+             * @param f  The function.
+             * @param p  The arguments of f.
+             */
+            template <typename Result_, typename ... Params_>
+            Result_ evaluate(const char * id, Result_ (* f)(const Params_ & ...), const Params_ & ... p)
+            {
+                static_assert(std::is_trivially_copyable<Result_>::value, "PersistentCache: results must be trivially copyable");
+                static_assert(sizeof(Result_) <= payload_size, "PersistentCache: results must not be larger than the payload size");
+
+                if (! enabled())
+                    return f(p ...);
+
+                Hasher hasher(id);
+                (void) std::initializer_list<int>{ (hasher.add(p), 0) ... };
+                const Key key = hasher.key();
+
+                Result_ result;
+                if (lookup(key, &result, sizeof(Result_)))
+                    return result;
+
+                result = f(p ...);
+                insert(key, &result, sizeof(Result_));
+
+                return result;
+            }
+    };
+}
+
+#endif
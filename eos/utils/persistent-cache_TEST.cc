@@ -0,0 +1,218 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/complex.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/persistent-cache.hh>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    unsigned calls = 0;
+
+    complex<double> f(const double & x, const double & y)
+    {
+        ++calls;
+
+        return complex<double>(x + y, x * y);
+    }
+}
+
+class PersistentCacheTest :
+    public TestCase
+{
+    public:
+        PersistentCacheTest() :
+            TestCase("persistent_cache_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            char directory[] = "/tmp/eos-persistent-cache-XXXXXX";
+            TEST_CHECK(nullptr != ::mkdtemp(directory));
+
+            const std::string path = std::string(directory) + "/cache";
+
+            /* Results are reused within and across instances */
+            {
+                PersistentCache cache;
+
+                // without a file, f is always called
+                cache.close();
+                TEST_CHECK_EQUAL(complex<double>(3.0, 2.0), cache.evaluate("f", &f, 1.0, 2.0));
+                TEST_CHECK_EQUAL(complex<double>(3.0, 2.0), cache.evaluate("f", &f, 1.0, 2.0));
+                TEST_CHECK_EQUAL(2u, calls);
+
+                cache.open(path, 1024);
+                TEST_CHECK(cache.enabled());
+
+                calls = 0;
+                TEST_CHECK_EQUAL(complex<double>(3.0, 2.0), cache.evaluate("f", &f, 1.0, 2.0));
+                TEST_CHECK_EQUAL(complex<double>(3.0, 2.0), cache.evaluate("f", &f, 1.0, 2.0));
+                TEST_CHECK_EQUAL(1u, calls);
+                TEST_CHECK_EQUAL(1u, cache.hits());
+
+                // different arguments or identifiers yield different keys
+                TEST_CHECK_EQUAL(complex<double>(3.0, 2.0), cache.evaluate("f", &f, 2.0, 1.0));
+                TEST_CHECK_EQUAL(complex<double>(3.0, 2.0), cache.evaluate("g", &f, 1.0, 2.0));
+                TEST_CHECK_EQUAL(3u, calls);
+
+                // a second instance, e.g. in another process, shares the results
+                PersistentCache other;
+                other.open(path, 16);
+                TEST_CHECK_EQUAL(complex<double>(3.0, 2.0), other.evaluate("f", &f, 1.0, 2.0));
+                TEST_CHECK_EQUAL(complex<double>(3.0, 2.0), other.evaluate("g", &f, 1.0, 2.0));
+                TEST_CHECK_EQUAL(3u, calls);
+                TEST_CHECK_EQUAL(2u, other.hits());
+                TEST_CHECK_EQUAL(0u, other.misses());
+            }
+
+            /* A full cache still yields correct results */
+            {
+                const std::string small_path = std::string(directory) + "/small";
+
+                PersistentCache cache;
+                cache.open(small_path, 4);
+
+                calls = 0;
+                for (unsigned i = 0 ; i < 10 ; ++i)
+                {
+                    TEST_CHECK_EQUAL(complex<double>(i + 1.0, i), cache.evaluate("f", &f, double(i), 1.0));
+                }
+                TEST_CHECK_EQUAL(10u, calls);
+
+                for (unsigned i = 0 ; i < 10 ; ++i)
+                {
+                    TEST_CHECK_EQUAL(complex<double>(i + 1.0, i), cache.evaluate("f", &f, double(i), 1.0));
+                }
+                TEST_CHECK_EQUAL(16u, calls);
+                TEST_CHECK_EQUAL(4u, cache.hits());
+
+                std::remove(small_path.c_str());
+            }
+
+            /* Slots left behind by an aborted writer are reclaimed */
+            {
+                // the header takes 64 bytes, and each slot consists of its state, size, key and payload
+                static const long slot_size = 4 + 4 + 16 + PersistentCache::payload_size;
+
+                PersistentCache::Hasher hasher("f");
+                hasher.add(3.0);
+                hasher.add(4.0);
+                const long offset = 64 + slot_size * (hasher.key().first % 1024);
+
+                auto state = [&] ()
+                {
+                    std::uint32_t result = 0;
+                    std::FILE * file = std::fopen(path.c_str(), "r");
+                    std::fseek(file, offset, SEEK_SET);
+                    TEST_CHECK_EQUAL(1u, std::fread(&result, sizeof(result), 1, file));
+                    std::fclose(file);
+
+                    return result;
+                };
+
+                {
+                    PersistentCache cache;
+                    cache.open(path);
+                    cache.evaluate("f", &f, 3.0, 4.0);
+                }
+                TEST_CHECK_EQUAL(2u, state());
+
+                // mark the slot as being written
+                {
+                    const std::uint32_t writing = 1;
+                    std::FILE * file = std::fopen(path.c_str(), "r+");
+                    std::fseek(file, offset, SEEK_SET);
+                    std::fwrite(&writing, sizeof(writing), 1, file);
+                    std::fclose(file);
+                }
+
+                // not reclaimed while another process uses the file
+                {
+                    int fd = ::open(path.c_str(), O_RDONLY);
+                    ::flock(fd, LOCK_SH);
+
+                    PersistentCache cache;
+                    cache.open(path);
+                    TEST_CHECK(cache.enabled());
+
+                    ::close(fd);
+                }
+                TEST_CHECK_EQUAL(1u, state());
+
+                // reclaimed by the only user of the file, and hence reusable
+                {
+                    PersistentCache cache;
+                    cache.open(path);
+                    TEST_CHECK_EQUAL(0u, state());
+
+                    calls = 0;
+                    TEST_CHECK_EQUAL(complex<double>(7.0, 12.0), cache.evaluate("f", &f, 3.0, 4.0));
+                    TEST_CHECK_EQUAL(complex<double>(7.0, 12.0), cache.evaluate("f", &f, 3.0, 4.0));
+                    TEST_CHECK_EQUAL(1u, calls);
+                }
+                TEST_CHECK_EQUAL(2u, state());
+            }
+
+            /* Files created by a different build are rejected */
+            {
+                // the build hash follows the magic, version, payload size and capacity
+                {
+                    const std::uint64_t build = 0;
+                    std::FILE * file = std::fopen(path.c_str(), "r+");
+                    std::fseek(file, 24, SEEK_SET);
+                    std::fwrite(&build, sizeof(build), 1, file);
+                    std::fclose(file);
+                }
+
+                PersistentCache cache;
+                TEST_CHECK_THROWS(InternalError, cache.open(path));
+                TEST_CHECK(! cache.enabled());
+            }
+
+            /* Invalid files are rejected */
+            {
+                {
+                    std::FILE * file = std::fopen(path.c_str(), "r+");
+                    std::fputs("INVALID!", file);
+                    std::fclose(file);
+                }
+
+                PersistentCache cache;
+                TEST_CHECK_THROWS(InternalError, cache.open(path));
+                TEST_CHECK(! cache.enabled());
+            }
+
+            std::remove(path.c_str());
+            ::rmdir(directory);
+        }
+} persistent_cache_test;
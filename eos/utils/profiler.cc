@@ -0,0 +1,354 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/density.hh>
+#include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/profiler.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+namespace eos
+{
+    // Times are kept in nanoseconds.
+    struct Profiler::Section
+    {
+        const std::string category;
+
+        const std::string name;
+
+        std::atomic<unsigned long> calls;
+
+        std::atomic<unsigned long> nans;
+
+        std::atomic<unsigned long> total_time;
+
+        std::atomic<unsigned long> maximal_time;
+
+        Section(const std::string & category, const std::string & name) :
+            category(category),
+            name(name),
+            calls(0),
+            nans(0),
+            total_time(0),
+            maximal_time(0)
+        {
+        }
+    };
+
+    template <>
+    struct Implementation<Profiler>
+    {
+        std::atomic<bool> enabled;
+
+        // Sections, looked up by category and name
+        Mutex mutex;
+
+        std::vector<std::unique_ptr<Profiler::Section>> sections;
+
+        std::map<std::pair<std::string, std::string>, Profiler::Section *> section_map;
+
+        // One execution of a section within a timeline
+        struct Event
+        {
+            Profiler::Section * section;
+
+            Profiler::Clock::time_point start, stop;
+
+            std::thread::id thread;
+        };
+
+        std::atomic<bool> tracing;
+
+        bool enabled_before_trace;
+
+        Mutex trace_mutex;
+
+        Profiler::Clock::time_point trace_origin;
+
+        std::vector<Event> events;
+
+        Implementation() :
+            enabled(false),
+            tracing(false),
+            enabled_before_trace(false)
+        {
+        }
+
+        // the utilisation of the ThreadPool is only measured while profiling
+        void enable(const bool & value)
+        {
+            enabled = value;
+            ThreadPool::instance()->collect_statistics(value);
+        }
+
+        static std::string escape(const std::string & input)
+        {
+            std::string result;
+            for (const char & c : input)
+            {
+                switch (c)
+                {
+                    case '"':
+                        result += "\\\"";
+                        break;
+
+                    case '\\':
+                        result += "\\\\";
+                        break;
+
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20)
+                        {
+                            char buffer[8];
+                            std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(c));
+                            result += buffer;
+                        }
+                        else
+                        {
+                            result += c;
+                        }
+                }
+            }
+
+            return result;
+        }
+
+        std::string render_trace() const
+        {
+            auto microseconds = [this] (const Profiler::Clock::time_point & t)
+            {
+                return std::chrono::duration<double, std::micro>(t - trace_origin).count();
+            };
+
+            // number the threads in order of their first appearance
+            std::map<std::thread::id, unsigned> threads;
+
+            std::stringstream result;
+            result.precision(3);
+            result << std::fixed;
+            result << "{\"traceEvents\":[";
+            for (auto e = events.cbegin(), e_end = events.cend() ; e != e_end ; ++e)
+            {
+                auto t = threads.insert(std::make_pair(e->thread, threads.size())).first;
+
+                result << (e == events.cbegin() ? "\n" : ",\n");
+                result << "{\"name\":\"" << escape(e->section->name) << "\","
+                       << "\"cat\":\"" << escape(e->section->category) << "\","
+                       << "\"ph\":\"X\","
+                       << "\"ts\":" << microseconds(e->start) << ","
+                       << "\"dur\":" << microseconds(e->stop) - microseconds(e->start) << ","
+                       << "\"pid\":0,"
+                       << "\"tid\":" << t->second << "}";
+            }
+            result << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+            return result.str();
+        }
+    };
+
+    template class InstantiationPolicy<Profiler, Singleton>;
+
+    Profiler::Profiler() :
+        PrivateImplementationPattern<Profiler>(new Implementation<Profiler>)
+    {
+    }
+
+    Profiler::~Profiler()
+    {
+    }
+
+    void
+    Profiler::enable()
+    {
+        _imp->enable(true);
+    }
+
+    void
+    Profiler::disable()
+    {
+        _imp->enable(false);
+    }
+
+    bool
+    Profiler::enabled() const
+    {
+        return _imp->enabled.load(std::memory_order_relaxed);
+    }
+
+    void
+    Profiler::reset()
+    {
+        Lock l(_imp->mutex);
+
+        for (auto & s : _imp->sections)
+        {
+            s->calls        = 0;
+            s->nans         = 0;
+            s->total_time   = 0;
+            s->maximal_time = 0;
+        }
+    }
+
+    Profiler::Section *
+    Profiler::section(const std::string & category, const std::string & name)
+    {
+        Lock l(_imp->mutex);
+
+        auto key = std::make_pair(category, name);
+        auto i = _imp->section_map.find(key);
+        if (_imp->section_map.end() != i)
+            return i->second;
+
+        // beyond the limit, all further sections of a category share one record
+        if (_imp->sections.size() >= maximal_number_of_sections)
+        {
+            key.second = "(further sections)";
+            i = _imp->section_map.find(key);
+            if (_imp->section_map.end() != i)
+                return i->second;
+        }
+
+        _imp->sections.push_back(std::unique_ptr<Section>(new Section(key.first, key.second)));
+        Section * result = _imp->sections.back().get();
+        _imp->section_map.insert(std::make_pair(key, result));
+
+        return result;
+    }
+
+    void
+    Profiler::record(Section * section, const Clock::time_point & start, const Clock::time_point & stop, const double & result)
+    {
+        const unsigned long time = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+        ++section->calls;
+        section->total_time += time;
+
+        if (std::isnan(result))
+            ++section->nans;
+
+        unsigned long maximum = section->maximal_time;
+        while ((time > maximum) && ! section->maximal_time.compare_exchange_weak(maximum, time))
+        {
+        }
+
+        if (_imp->tracing)
+        {
+            Lock l(_imp->trace_mutex);
+
+            _imp->events.push_back(Implementation<Profiler>::Event{ section, start, stop, std::this_thread::get_id() });
+        }
+    }
+
+    std::vector<ProfilingRecord>
+    Profiler::records() const
+    {
+        std::vector<ProfilingRecord> result;
+
+        {
+            Lock l(_imp->mutex);
+
+            for (const auto & s : _imp->sections)
+            {
+                if (0 == s->calls)
+                    continue;
+
+                ProfilingRecord record;
+                record.category     = s->category;
+                record.name         = s->name;
+                record.calls        = s->calls;
+                record.nans         = s->nans;
+                record.total_time   = 1.0e-9 * s->total_time;
+                record.maximal_time = 1.0e-9 * s->maximal_time;
+                result.push_back(record);
+            }
+        }
+
+        std::stable_sort(result.begin(), result.end(), [] (const ProfilingRecord & a, const ProfilingRecord & b)
+        {
+            return a.total_time > b.total_time;
+        });
+
+        return result;
+    }
+
+    void
+    Profiler::begin_trace()
+    {
+        Lock l(_imp->trace_mutex);
+
+        _imp->events.clear();
+        _imp->enabled_before_trace = _imp->enabled;
+        _imp->trace_origin = Clock::now();
+        _imp->enable(true);
+        _imp->tracing = true;
+    }
+
+    std::string
+    Profiler::end_trace()
+    {
+        Lock l(_imp->trace_mutex);
+
+        _imp->tracing = false;
+        _imp->enable(_imp->enabled_before_trace);
+
+        // nested sections are recorded upon their completion, i.e., before their enclosing section
+        std::stable_sort(_imp->events.begin(), _imp->events.end(), [] (const Implementation<Profiler>::Event & a, const Implementation<Profiler>::Event & b)
+        {
+            return a.start < b.start;
+        });
+
+        std::string result = _imp->render_trace();
+        _imp->events.clear();
+
+        return result;
+    }
+
+    std::string
+    Profiler::trace(const Density & density)
+    {
+        static Section * evaluate = section("density", "evaluate");
+
+        begin_trace();
+
+        try
+        {
+            const auto start = Clock::now();
+            const double result = density.evaluate();
+            record(evaluate, start, Clock::now(), result);
+        }
+        catch (...)
+        {
+            end_trace();
+            throw;
+        }
+
+        return end_trace();
+    }
+}
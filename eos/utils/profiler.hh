@@ -0,0 +1,161 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_PROFILER_HH
+#define EOS_GUARD_EOS_UTILS_PROFILER_HH 1
+
+#include <eos/utils/density-fwd.hh>
+#include <eos/utils/instantiation_policy.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Accumulated measurements of one profiled section, e.g., of the evaluation of one observable.
+     */
+    struct ProfilingRecord
+    {
+        /// The kind of section, e.g., 'observable' or 'block'.
+        std::string category;
+
+        /// The name of the section.
+        std::string name;
+
+        /// The number of executions of the section.
+        unsigned long calls = 0;
+
+        /// The number of executions that yielded NaN.
+        unsigned long nans = 0;
+
+        /// The accumulated wall time in seconds.
+        double total_time = 0.0;
+
+        /// The longest wall time of a single execution in seconds.
+        double maximal_time = 0.0;
+    };
+
+    /*!
+     * Profiler accumulates the wall time, the number of calls and the number of NaN results
+     * of named sections of code, such as the evaluation of individual observables and
+     * likelihood blocks. Sections with the same category and name share their records,
+     * i.e., the records of independent clones of a LogPosterior are combined.
+     *
+     * Profiling is disabled by default. While disabled, instrumented code only pays
+     * for checking whether profiling is enabled. Instrumented code registers its sections
+     * upon their first execution while profiling is enabled. The utilisation statistics
+     * of the ThreadPool are only collected while profiling is enabled.
+     *
+     * In addition, the Profiler can record a timeline of all executions of sections,
+     * which is rendered in the Chrome trace event format.
+     */
+    class Profiler :
+        public InstantiationPolicy<Profiler, Singleton>,
+        public PrivateImplementationPattern<Profiler>
+    {
+        private:
+            ///@name Basic Functions
+            ///@{
+            /// Constructor.
+            Profiler();
+            ///@}
+
+        public:
+            friend class InstantiationPolicy<Profiler, Singleton>;
+
+            using Clock = std::chrono::steady_clock;
+
+            /// The number of sections beyond which all further sections of a category share one record.
+            static constexpr unsigned long maximal_number_of_sections = 10000;
+
+            /// Opaque handle to the records of one section.
+            struct Section;
+
+            ///@name Basic Functions
+            ///@{
+            /// Destructor.
+            ~Profiler();
+            ///@}
+
+            ///@name Control
+            ///@{
+            /// Enable profiling.
+            void enable();
+
+            /// Disable profiling.
+            void disable();
+
+            /// Whether profiling is currently enabled.
+            bool enabled() const;
+
+            /// Reset the records of all sections.
+            void reset();
+            ///@}
+
+            ///@name Recording
+            ///@{
+            /*!
+             * Retrieve the handle of a section. The handle remains valid for the lifetime of the program.
+             *
+             * @param category The kind of section, e.g., 'observable'.
+             * @param name     The name of the section.
+             */
+            Section * section(const std::string & category, const std::string & name);
+
+            /*!
+             * Record one execution of a section.
+             *
+             * @param section The section that has been executed.
+             * @param start   The time at which the execution started.
+             * @param stop    The time at which the execution ended.
+             * @param result  The result of the execution, which is checked for NaN.
+             */
+            void record(Section * section, const Clock::time_point & start, const Clock::time_point & stop, const double & result = 0.0);
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Retrieve the records of all executed sections, ordered by decreasing total time.
+            std::vector<ProfilingRecord> records() const;
+
+            /// Start recording a timeline. Profiling is enabled until the timeline is complete.
+            void begin_trace();
+
+            /// Stop recording a timeline, and return it as a JSON document in the Chrome trace event format.
+            std::string end_trace();
+
+            /*!
+             * Record the timeline of a single evaluation of a density.
+             *
+             * Results that the density has cached, e.g., the predictions within the ObservableCache
+             * of a LogPosterior, are not re-evaluated and hence do not appear in the timeline, unless
+             * they are invalidated beforehand.
+             *
+             * @param density The density, e.g., a LogPosterior, which is evaluated at its current parameter point.
+             * @return The timeline as a JSON document in the Chrome trace event format.
+             */
+            std::string trace(const Density & density);
+            ///@}
+    };
+}
+
+#endif
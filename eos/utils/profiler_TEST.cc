@@ -0,0 +1,174 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/density-impl.hh>
+#include <eos/utils/profiler.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <limits>
+#include <string>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    // a density that records one nested section per evaluation
+    struct TestDensity :
+        public Density
+    {
+        std::vector<ParameterDescription> descriptions;
+
+        virtual double evaluate() const
+        {
+            static Profiler::Section * inner = Profiler::instance()->section("test", "inner \"quoted\"");
+
+            const auto start = Profiler::Clock::now();
+            Profiler::instance()->record(inner, start, Profiler::Clock::now(), 1.0);
+
+            return 1.0;
+        }
+
+        virtual DensityPtr clone() const
+        {
+            return DensityPtr(new TestDensity);
+        }
+
+        virtual Density::Iterator begin() const
+        {
+            return Density::Iterator(descriptions.cbegin());
+        }
+
+        virtual Density::Iterator end() const
+        {
+            return Density::Iterator(descriptions.cend());
+        }
+    };
+}
+
+class ProfilerTest :
+    public TestCase
+{
+    public:
+        ProfilerTest() :
+            TestCase("profiler_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            Profiler * profiler = Profiler::instance();
+
+            /* Records */
+            {
+                TEST_CHECK(! profiler->enabled());
+
+                Profiler::Section * a = profiler->section("test", "a");
+                Profiler::Section * b = profiler->section("test", "b");
+                TEST_CHECK(a == profiler->section("test", "a"));
+                TEST_CHECK(a != profiler->section("other", "a"));
+
+                const auto t = Profiler::Clock::now();
+                profiler->record(a, t, t + std::chrono::milliseconds(1), 1.0);
+                profiler->record(a, t, t + std::chrono::milliseconds(3), std::numeric_limits<double>::quiet_NaN());
+                profiler->record(b, t, t + std::chrono::milliseconds(5), -std::numeric_limits<double>::infinity());
+
+                auto records = profiler->records();
+                TEST_CHECK_EQUAL(2u, records.size());
+
+                // ordered by decreasing total time
+                TEST_CHECK_EQUAL("b", records[0].name);
+                TEST_CHECK_EQUAL("test", records[0].category);
+                TEST_CHECK_EQUAL(1u, records[0].calls);
+                TEST_CHECK_EQUAL(0u, records[0].nans);
+
+                TEST_CHECK_EQUAL("a", records[1].name);
+                TEST_CHECK_EQUAL(2u, records[1].calls);
+                TEST_CHECK_EQUAL(1u, records[1].nans);
+                TEST_CHECK_NEARLY_EQUAL(4.0e-3, records[1].total_time,   1.0e-12);
+                TEST_CHECK_NEARLY_EQUAL(3.0e-3, records[1].maximal_time, 1.0e-12);
+
+                profiler->reset();
+                TEST_CHECK(profiler->records().empty());
+            }
+
+            /* Timeline */
+            {
+                TestDensity density;
+
+                const std::string trace = profiler->trace(density);
+                TEST_CHECK(! profiler->enabled());
+
+                TEST_CHECK_EQUAL(0u, trace.find("{\"traceEvents\":["));
+                TEST_CHECK(std::string::npos != trace.find("\"name\":\"evaluate\",\"cat\":\"density\",\"ph\":\"X\""));
+                TEST_CHECK(std::string::npos != trace.find("\"name\":\"inner \\\"quoted\\\"\",\"cat\":\"test\""));
+
+                // the enclosing section comes first
+                TEST_CHECK(trace.find("\"evaluate\"") < trace.find("\"inner"));
+
+                // the executions within the timeline are also recorded
+                auto records = profiler->records();
+                TEST_CHECK_EQUAL(2u, records.size());
+
+                // no events are recorded outside of a timeline
+                profiler->begin_trace();
+                const std::string empty = profiler->end_trace();
+                TEST_CHECK_EQUAL("{\"traceEvents\":[\n],\"displayTimeUnit\":\"ms\"}\n", empty);
+
+                profiler->reset();
+            }
+
+            /* Utilisation of the thread pool */
+            {
+                ThreadPool::instance()->reset_statistics();
+
+                ThreadPool::instance()->parallel_for(10, [] (unsigned) { });
+                TEST_CHECK_EQUAL(0u, ThreadPool::instance()->statistics().chunks);
+
+                profiler->enable();
+                ThreadPool::instance()->parallel_for(10, [] (unsigned) { });
+                profiler->disable();
+                TEST_CHECK(ThreadPool::instance()->statistics().chunks > 0u);
+
+                ThreadPool::instance()->reset_statistics();
+            }
+
+            /* The number of sections is limited */
+            {
+                for (unsigned long i = 0 ; i < Profiler::maximal_number_of_sections ; ++i)
+                {
+                    profiler->section("many", std::to_string(i));
+                }
+
+                Profiler::Section * further = profiler->section("many", "further");
+                TEST_CHECK(further == profiler->section("many", "yet another"));
+                TEST_CHECK(further != profiler->section("many", "0"));
+
+                const auto t = Profiler::Clock::now();
+                profiler->record(further, t, t + std::chrono::milliseconds(1));
+
+                auto records = profiler->records();
+                TEST_CHECK_EQUAL(1u, records.size());
+                TEST_CHECK_EQUAL("(further sections)", records[0].name);
+
+                profiler->reset();
+            }
+        }
+} profiler_test;
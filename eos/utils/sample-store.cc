@@ -0,0 +1,409 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/sample-store.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace eos
+{
+    namespace implementation
+    {
+        namespace sample_store
+        {
+            static const char magic[8] = { 'E', 'O', 'S', 'S', 'T', 'O', 'R', 'E' };
+
+            static const std::uint32_t version = 1;
+
+            static const off_t header_size = 16;
+
+            struct File
+            {
+                std::string name;
+
+                int fd;
+
+                File(const std::string & name, const int & flags) :
+                    name(name),
+                    fd(::open(name.c_str(), flags, 0644))
+                {
+                    if (fd < 0)
+                        throw SampleStoreError(name, "cannot open file: " + std::string(std::strerror(errno)));
+                }
+
+                ~File()
+                {
+                    ::close(fd);
+                }
+
+                off_t size() const
+                {
+                    struct stat status;
+                    if (0 != ::fstat(fd, &status))
+                        throw SampleStoreError(name, "cannot determine file size: " + std::string(std::strerror(errno)));
+
+                    return status.st_size;
+                }
+
+                void read(void * buffer, std::size_t size, off_t offset) const
+                {
+                    char * b = static_cast<char *>(buffer);
+                    while (size > 0)
+                    {
+                        ssize_t result = ::pread(fd, b, size, offset);
+                        if ((result < 0) && (EINTR == errno))
+                            continue;
+
+                        if (result <= 0)
+                            throw SampleStoreError(name, "cannot read from file: " + std::string(result < 0 ? std::strerror(errno) : "unexpected end of file"));
+
+                        b += result;
+                        size -= result;
+                        offset += result;
+                    }
+                }
+
+                void write(const void * buffer, std::size_t size, off_t offset)
+                {
+                    const char * b = static_cast<const char *>(buffer);
+                    while (size > 0)
+                    {
+                        ssize_t result = ::pwrite(fd, b, size, offset);
+                        if ((result < 0) && (EINTR == errno))
+                            continue;
+
+                        if (result < 0)
+                            throw SampleStoreError(name, "cannot write to file: " + std::string(std::strerror(errno)));
+
+                        b += result;
+                        size -= result;
+                        offset += result;
+                    }
+                }
+
+                void truncate(const off_t & size)
+                {
+                    if (0 != ::ftruncate(fd, size))
+                        throw SampleStoreError(name, "cannot truncate file: " + std::string(std::strerror(errno)));
+                }
+
+                void sync()
+                {
+                    if (0 != ::fsync(fd))
+                        throw SampleStoreError(name, "cannot synchronize file: " + std::string(std::strerror(errno)));
+                }
+            };
+
+            // reads the header and all complete entries of an index file
+            static std::vector<std::uint64_t> read_index(const File & index, unsigned & columns)
+            {
+                char header_magic[8];
+                std::uint32_t header[2];
+                index.read(header_magic, sizeof(header_magic), 0);
+                index.read(header, sizeof(header), sizeof(header_magic));
+
+                if (0 != std::memcmp(header_magic, magic, sizeof(magic)))
+                    throw SampleStoreError(index.name, "not a sample store index");
+
+                if (version != header[0])
+                    throw SampleStoreError(index.name, "unsupported format version " + stringify(header[0]));
+
+                columns = header[1];
+
+                // ignore an incomplete trailing entry
+                std::vector<std::uint64_t> result((index.size() - header_size) / sizeof(std::uint64_t));
+                if (! result.empty())
+                    index.read(result.data(), result.size() * sizeof(std::uint64_t), header_size);
+
+                return result;
+            }
+        }
+    }
+
+    using namespace implementation::sample_store;
+
+    template <>
+    struct Implementation<SampleStoreWriter>
+    {
+        std::string name;
+
+        File data;
+
+        File index;
+
+        unsigned columns;
+
+        unsigned chunk_size;
+
+        // number of committed rows and chunks
+        std::uint64_t committed_rows;
+
+        std::uint64_t committed_chunks;
+
+        std::vector<double> buffer;
+
+        Implementation(const std::string & name, const unsigned & columns, const unsigned & chunk_size) :
+            name(name),
+            data(name + ".dat", O_RDWR | O_CREAT),
+            index(name + ".idx", O_RDWR | O_CREAT),
+            columns(columns),
+            chunk_size(chunk_size > 0 ? chunk_size : 1),
+            committed_rows(0),
+            committed_chunks(0)
+        {
+            if (0 == columns)
+                throw SampleStoreError(name, "the number of columns must be positive");
+
+            if (index.size() < header_size)
+            {
+                // new store
+                const std::uint32_t header[2] = { version, std::uint32_t(columns) };
+                index.truncate(0);
+                index.write(magic, sizeof(magic), 0);
+                index.write(header, sizeof(header), sizeof(magic));
+                index.sync();
+            }
+            else
+            {
+                unsigned existing_columns = 0;
+                const auto entries = read_index(index, existing_columns);
+
+                if (existing_columns != columns)
+                    throw SampleStoreError(name, "expected " + stringify(columns) + " columns, found " + stringify(existing_columns));
+
+                committed_chunks = entries.size();
+                committed_rows = entries.empty() ? 0 : entries.back();
+
+                // discard an incomplete trailing index entry
+                index.truncate(header_size + committed_chunks * sizeof(std::uint64_t));
+            }
+
+            const off_t committed_size = committed_rows * columns * sizeof(double);
+            if (data.size() < committed_size)
+                throw SampleStoreError(name, "data file is shorter than recorded in the index");
+
+            // discard the rows of a chunk that has not been committed
+            data.truncate(committed_size);
+
+            buffer.reserve(this->chunk_size * columns);
+        }
+
+        ~Implementation()
+        {
+            try
+            {
+                flush();
+            }
+            catch (SampleStoreError & e)
+            {
+                Log::instance()->message("SampleStoreWriter::~SampleStoreWriter", ll_error)
+                    << "Could not commit the buffered rows: " << e.what();
+            }
+        }
+
+        void append(const double * rows, const unsigned long & n)
+        {
+            for (unsigned long i = 0 ; i < n ; ++i)
+            {
+                buffer.insert(buffer.end(), rows + i * columns, rows + (i + 1) * columns);
+
+                if (buffer.size() >= chunk_size * columns)
+                    flush();
+            }
+        }
+
+        void flush()
+        {
+            if (buffer.empty())
+                return;
+
+            const std::uint64_t rows = buffer.size() / columns;
+
+            // the data must be on disk before the index refers to it
+            data.write(buffer.data(), buffer.size() * sizeof(double), committed_rows * columns * sizeof(double));
+            data.sync();
+
+            const std::uint64_t entry = committed_rows + rows;
+            index.write(&entry, sizeof(entry), header_size + committed_chunks * sizeof(std::uint64_t));
+            index.sync();
+
+            committed_rows = entry;
+            ++committed_chunks;
+            buffer.clear();
+        }
+    };
+
+    SampleStoreWriter::SampleStoreWriter(const std::string & name, const unsigned & columns, const unsigned & chunk_size) :
+        PrivateImplementationPattern<SampleStoreWriter>(new Implementation<SampleStoreWriter>(name, columns, chunk_size))
+    {
+    }
+
+    SampleStoreWriter::~SampleStoreWriter()
+    {
+    }
+
+    void
+    SampleStoreWriter::append(const double * row)
+    {
+        _imp->append(row, 1);
+    }
+
+    void
+    SampleStoreWriter::append(const double * rows, const unsigned long & n)
+    {
+        _imp->append(rows, n);
+    }
+
+    void
+    SampleStoreWriter::flush()
+    {
+        _imp->flush();
+    }
+
+    unsigned
+    SampleStoreWriter::columns() const
+    {
+        return _imp->columns;
+    }
+
+    unsigned long
+    SampleStoreWriter::rows() const
+    {
+        return _imp->committed_rows + _imp->buffer.size() / _imp->columns;
+    }
+
+    template <>
+    struct Implementation<SampleStoreReader>
+    {
+        std::string name;
+
+        unsigned columns;
+
+        std::vector<std::uint64_t> entries;
+
+        std::uint64_t rows;
+
+        void * mapping;
+
+        std::size_t mapping_size;
+
+        Implementation(const std::string & name) :
+            name(name),
+            columns(0),
+            rows(0),
+            mapping(nullptr),
+            mapping_size(0)
+        {
+            File index(name + ".idx", O_RDONLY);
+            if (index.size() < header_size)
+                throw SampleStoreError(name, "index file is too short");
+
+            entries = read_index(index, columns);
+            rows = entries.empty() ? 0 : entries.back();
+
+            if (0 == rows)
+                return;
+
+            File data(name + ".dat", O_RDONLY);
+            mapping_size = rows * columns * sizeof(double);
+            if (std::size_t(data.size()) < mapping_size)
+                throw SampleStoreError(name, "data file is shorter than recorded in the index");
+
+            mapping = ::mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, data.fd, 0);
+            if (MAP_FAILED == mapping)
+            {
+                mapping = nullptr;
+                throw SampleStoreError(name, "cannot map data file: " + std::string(std::strerror(errno)));
+            }
+        }
+
+        ~Implementation()
+        {
+            if (mapping)
+                ::munmap(mapping, mapping_size);
+        }
+    };
+
+    SampleStoreReader::SampleStoreReader(const std::string & name) :
+        PrivateImplementationPattern<SampleStoreReader>(new Implementation<SampleStoreReader>(name))
+    {
+    }
+
+    SampleStoreReader::~SampleStoreReader()
+    {
+    }
+
+    unsigned
+    SampleStoreReader::columns() const
+    {
+        return _imp->columns;
+    }
+
+    unsigned long
+    SampleStoreReader::rows() const
+    {
+        return _imp->rows;
+    }
+
+    unsigned
+    SampleStoreReader::chunks() const
+    {
+        return _imp->entries.size();
+    }
+
+    unsigned long
+    SampleStoreReader::chunk_end(const unsigned & c) const
+    {
+        if (c >= _imp->entries.size())
+            throw SampleStoreError(_imp->name, "chunk index " + stringify(c) + " is out of range");
+
+        return _imp->entries[c];
+    }
+
+    const double *
+    SampleStoreReader::data() const
+    {
+        return static_cast<const double *>(_imp->mapping);
+    }
+
+    const double *
+    SampleStoreReader::row(const unsigned long & i) const
+    {
+        if (i >= _imp->rows)
+            throw SampleStoreError(_imp->name, "row index " + stringify(i) + " is out of range");
+
+        return data() + i * _imp->columns;
+    }
+
+    SampleStoreError::SampleStoreError(const std::string & name, const std::string & msg) :
+        Exception("Sample store '" + name + "': " + msg)
+    {
+    }
+}
@@ -0,0 +1,146 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_SAMPLE_STORE_HH
+#define EOS_GUARD_EOS_UTILS_SAMPLE_STORE_HH 1
+
+#include <eos/utils/exception.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <string>
+
+namespace eos
+{
+    /*!
+     * An append-only, on-disk store of samples, i.e. of rows with a fixed number of columns of type double.
+     *
+     * A store with the name NAME consists of two files:
+     *
+     *  - NAME.dat holds the samples as a contiguous, row-major array of native doubles without any header,
+     *    such that it can be memory mapped as a whole, e.g. via numpy.memmap.
+     *  - NAME.idx holds a 16 byte header, made up of the magic string "EOSSTORE", the format version
+     *    and the number of columns as 32 bit unsigned integers, followed by one 64 bit unsigned integer
+     *    per chunk. The latter is the total number of rows after the chunk has been committed.
+     *
+     * Rows are written in chunks. The data of a chunk is synchronized to disk before its index entry is
+     * appended. Readers only consider rows covered by a complete index entry, such that a crash of the
+     * writer loses at most the chunk that is presently being written.
+     */
+    class SampleStoreWriter :
+        public PrivateImplementationPattern<SampleStoreWriter>
+    {
+        public:
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * Opens an existing store for appending, or creates a new store. Rows of an existing store
+             * beyond its last complete index entry are discarded.
+             *
+             * @param name       The name of the store, i.e. the path of its files without their suffixes.
+             * @param columns    The number of columns per row; must match the number of columns of an existing store.
+             * @param chunk_size The number of rows that are buffered before a chunk is committed.
+             */
+            SampleStoreWriter(const std::string & name, const unsigned & columns, const unsigned & chunk_size = 1024);
+
+            /// Destructor. Commits all buffered rows.
+            ~SampleStoreWriter();
+            ///@}
+
+            /// Append one row of samples.
+            void append(const double * row);
+
+            /*!
+             * Append a number of rows.
+             *
+             * @param rows Row-major array of n rows.
+             * @param n    The number of rows.
+             */
+            void append(const double * rows, const unsigned long & n);
+
+            /// Commit all buffered rows as one chunk.
+            void flush();
+
+            /// Retrieve the number of columns per row.
+            unsigned columns() const;
+
+            /// Retrieve the number of rows, including the buffered ones.
+            unsigned long rows() const;
+    };
+
+    /*!
+     * Provides read-only, memory-mapped access to the committed rows of a store written by SampleStoreWriter.
+     */
+    class SampleStoreReader :
+        public PrivateImplementationPattern<SampleStoreReader>
+    {
+        public:
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param name The name of the store, i.e. the path of its files without their suffixes.
+             */
+            SampleStoreReader(const std::string & name);
+
+            /// Destructor.
+            ~SampleStoreReader();
+            ///@}
+
+            /// Retrieve the number of columns per row.
+            unsigned columns() const;
+
+            /// Retrieve the number of committed rows.
+            unsigned long rows() const;
+
+            /// Retrieve the number of committed chunks.
+            unsigned chunks() const;
+
+            /// Retrieve the index of the first row after the c-th chunk.
+            unsigned long chunk_end(const unsigned & c) const;
+
+            /// Retrieve the row-major array of all committed rows; nullptr for an empty store.
+            const double * data() const;
+
+            /// Retrieve the i-th row.
+            const double * row(const unsigned long & i) const;
+    };
+
+    /*!
+     * SampleStoreError is thrown when a sample store cannot be created, opened, read or written.
+     */
+    struct SampleStoreError :
+        public Exception
+    {
+        ///@name Basic Functions
+        ///@{
+        /*!
+         * Constructor.
+         *
+         * @param name The name of the offending store.
+         * @param msg  The error message.
+         */
+        SampleStoreError(const std::string & name, const std::string & msg);
+        ///@}
+    };
+}
+
+#endif
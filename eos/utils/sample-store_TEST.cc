@@ -0,0 +1,125 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/sample-store.hh>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace test;
+using namespace eos;
+
+class SampleStoreTest :
+    public TestCase
+{
+    public:
+        SampleStoreTest() :
+            TestCase("sample_store_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            char directory[] = "/tmp/eos-sample-store-XXXXXX";
+            TEST_CHECK(nullptr != ::mkdtemp(directory));
+
+            const std::string name = std::string(directory) + "/samples";
+
+            std::vector<double> rows;
+            for (unsigned i = 0 ; i < 10 ; ++i)
+            {
+                rows.push_back(i);
+                rows.push_back(-1.0 * i);
+            }
+
+            /* Write and read a store in several chunks */
+            {
+                {
+                    SampleStoreWriter writer(name, 2, 4);
+                    writer.append(rows.data(), 5);
+                    TEST_CHECK_EQUAL(5u, writer.rows());
+
+                    // only the first chunk has been committed
+                    SampleStoreReader reader(name);
+                    TEST_CHECK_EQUAL(4u, reader.rows());
+                    TEST_CHECK_EQUAL(1u, reader.chunks());
+
+                    writer.append(rows.data() + 5 * 2, 5);
+                }
+
+                SampleStoreReader reader(name);
+                TEST_CHECK_EQUAL(2u,  reader.columns());
+                TEST_CHECK_EQUAL(10u, reader.rows());
+                TEST_CHECK_EQUAL(3u,  reader.chunks());
+                TEST_CHECK_EQUAL(4u,  reader.chunk_end(0));
+                TEST_CHECK_EQUAL(8u,  reader.chunk_end(1));
+                TEST_CHECK_EQUAL(10u, reader.chunk_end(2));
+
+                for (unsigned i = 0 ; i < 20 ; ++i)
+                {
+                    TEST_CHECK_EQUAL(rows[i], reader.data()[i]);
+                }
+                TEST_CHECK_EQUAL(7.0, reader.row(7)[0]);
+                TEST_CHECK_EQUAL(-7.0, reader.row(7)[1]);
+
+                TEST_CHECK_THROWS(SampleStoreError, reader.row(10));
+                TEST_CHECK_THROWS(SampleStoreError, SampleStoreWriter(name, 3));
+            }
+
+            /* Recover from an interrupted chunk */
+            {
+                // simulate a crash after writing the data, but before completing the index entry
+                {
+                    std::ofstream data(name + ".dat", std::ios::binary | std::ios::app);
+                    const double garbage[2] = { 99.0, 99.0 };
+                    data.write(reinterpret_cast<const char *>(garbage), sizeof(garbage));
+
+                    std::ofstream index(name + ".idx", std::ios::binary | std::ios::app);
+                    index.write("\x0b\x00\x00", 3);
+                }
+
+                TEST_CHECK_EQUAL(10u, SampleStoreReader(name).rows());
+
+                {
+                    SampleStoreWriter writer(name, 2);
+                    TEST_CHECK_EQUAL(10u, writer.rows());
+
+                    const double row[2] = { 10.0, -10.0 };
+                    writer.append(row);
+                }
+
+                SampleStoreReader reader(name);
+                TEST_CHECK_EQUAL(11u, reader.rows());
+                TEST_CHECK_EQUAL(4u,  reader.chunks());
+                TEST_CHECK_EQUAL(9.0,   reader.row(9)[0]);
+                TEST_CHECK_EQUAL(10.0,  reader.row(10)[0]);
+                TEST_CHECK_EQUAL(-10.0, reader.row(10)[1]);
+            }
+
+            std::remove((name + ".dat").c_str());
+            std::remove((name + ".idx").c_str());
+            ::rmdir(directory);
+        }
+} sample_store_test;
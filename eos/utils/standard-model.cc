@@ -21,6 +21,7 @@
 
 #include <eos/utils/log.hh>
 #include <eos/utils/matrix.hh>
+#include <eos/utils/memoise.hh>
 #include <eos/utils/power_of.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 #include <eos/utils/qcd.hh>
@@ -182,103 +183,84 @@ namespace implementation
     {
     }
 
-    double
-    SMComponent<components::QCD>::alpha_s(const double & mu) const
+namespace implementation
+{
+    /*
+     * The derived QCD quantities only depend on the numeric values of a handful of parameters.
+     * They are memoised, keyed on these values, such that all observables evaluated for the same
+     * parameter point share the results. Their arguments are always ordered as follows:
+     * the scale or the mass input (if any), followed by alpha_s(MZ), m_Z, mu_t, mu_b, mu_c, and Lambda_QCD.
+     */
+    double alpha_s(const double & mu,
+            const double & alpha_s_Z, const double & m_Z, const double & mu_t, const double & mu_b, const double & mu_c, const double & lambda_qcd)
     {
-        double alpha_s_0 = _alpha_s_Z__qcd, mu_0 = _m_Z__qcd;
+        double alpha_s_0 = alpha_s_Z, mu_0 = m_Z;
 
-        if (mu >= _m_Z__qcd)
+        if (mu >= m_Z)
         {
-            if (mu < _mu_t__qcd)
+            if (mu < mu_t)
                 return QCD::alpha_s(mu, alpha_s_0, mu_0, QCD::beta_function_nf_5);
 
-            alpha_s_0 = QCD::alpha_s(_mu_t__qcd, alpha_s_0, mu_0, QCD::beta_function_nf_5);
-            mu_0 = _mu_t__qcd;
+            alpha_s_0 = QCD::alpha_s(mu_t, alpha_s_0, mu_0, QCD::beta_function_nf_5);
+            mu_0 = mu_t;
 
             return QCD::alpha_s(mu, alpha_s_0, mu_0, QCD::beta_function_nf_6);
         }
 
-        if (mu >= _mu_b__qcd)
+        if (mu >= mu_b)
             return QCD::alpha_s(mu, alpha_s_0, mu_0, QCD::beta_function_nf_5);
 
-        alpha_s_0 = QCD::alpha_s(_mu_b__qcd, alpha_s_0, mu_0, QCD::beta_function_nf_5);
-        mu_0 = _mu_b__qcd;
+        alpha_s_0 = QCD::alpha_s(mu_b, alpha_s_0, mu_0, QCD::beta_function_nf_5);
+        mu_0 = mu_b;
 
-        if (mu >= _mu_c__qcd)
+        if (mu >= mu_c)
             return QCD::alpha_s(mu, alpha_s_0, mu_0, QCD::beta_function_nf_4);
 
-        alpha_s_0 = QCD::alpha_s(_mu_c__qcd, alpha_s_0, mu_0, QCD::beta_function_nf_4);
-        mu_0 = _mu_c__qcd;
+        alpha_s_0 = QCD::alpha_s(mu_c, alpha_s_0, mu_0, QCD::beta_function_nf_4);
+        mu_0 = mu_c;
 
-        if (mu >= _lambda_qcd__qcd)
+        if (mu >= lambda_qcd)
             return QCD::alpha_s(mu, alpha_s_0, mu_0, QCD::beta_function_nf_3);
 
         throw InternalError("SMComponent<components::QCD>::alpha_s: Cannot run alpha_s to mu < lambda_qcd");
     }
 
-    double
-    SMComponent<components::QCD>::m_t_msbar(const double & mu) const
+    double m_b_msbar(const double & mu, const double & m_b_MSbar,
+            const double & alpha_s_Z, const double & m_Z, const double & mu_t, const double & mu_b, const double & mu_c, const double & lambda_qcd)
     {
-        double alpha_s_m_t_pole = this->alpha_s(_m_t_pole__qcd);
-        double m_t_msbar_m_t_pole = QCD::m_q_msbar(_m_t_pole__qcd, alpha_s_m_t_pole, 5.0);
-
-        if ((_mu_b__qcd <= mu) && (mu < _mu_t__qcd))
-            return QCD::m_q_msbar(m_t_msbar_m_t_pole, alpha_s_m_t_pole, this->alpha_s(mu), QCD::beta_function_nf_5, QCD::gamma_m_nf_5);
-
-        throw InternalError("SMComponent<components::QCD>::m_t_msbar: Running of m_t_MSbar to mu >= mu_t or to mu < m_b not yet implemented");
-    }
-
-    double
-    SMComponent<components::QCD>::m_t_pole() const
-    {
-        return _m_t_pole__qcd();
-    }
-
-    double
-    SMComponent<components::QCD>::m_b_kin(const double & mu_kin) const
-    {
-        double m_b_MSbar = _m_b_MSbar__qcd();
-        double alpha_mu_0 = alpha_s(m_b_MSbar);
-
-        return QCD::m_q_kin(m_b_MSbar, alpha_mu_0, mu_kin, QCD::beta_function_nf_5);
-    }
-
-    double
-    SMComponent<components::QCD>::m_b_msbar(const double & mu) const
-    {
-        double m_b_MSbar = _m_b_MSbar__qcd();
-        double alpha_mu_0 = alpha_s(m_b_MSbar);
+        double alpha_mu_0 = memoise(implementation::alpha_s, m_b_MSbar, alpha_s_Z, m_Z, mu_t, mu_b, mu_c, lambda_qcd);
 
         if (mu > m_b_MSbar)
         {
-            if (mu < _mu_t__qcd)
-                return QCD::m_q_msbar(m_b_MSbar, alpha_mu_0, alpha_s(mu), QCD::beta_function_nf_5, QCD::gamma_m_nf_5);
+            if (mu < mu_t)
+                return QCD::m_q_msbar(m_b_MSbar, alpha_mu_0, memoise(implementation::alpha_s, mu, alpha_s_Z, m_Z, mu_t, mu_b, mu_c, lambda_qcd),
+                        QCD::beta_function_nf_5, QCD::gamma_m_nf_5);
 
             throw InternalError("SMComponent<components::QCD>::m_b_msbar: Running of m_b_MSbar to mu > mu_t not yet implemented");
         }
         else
         {
-            if (mu >= _mu_c__qcd)
-                return QCD::m_q_msbar(m_b_MSbar, alpha_mu_0, alpha_s(mu), QCD::beta_function_nf_4, QCD::gamma_m_nf_4);
+            if (mu >= mu_c)
+                return QCD::m_q_msbar(m_b_MSbar, alpha_mu_0, memoise(implementation::alpha_s, mu, alpha_s_Z, m_Z, mu_t, mu_b, mu_c, lambda_qcd),
+                        QCD::beta_function_nf_4, QCD::gamma_m_nf_4);
 
             throw InternalError("SMComponent<components::QCD>::m_b_msbar: Running of m_b_MSbar to mu < mu_c not yet implemented");
         }
     }
 
-    double
-    SMComponent<components::QCD>::m_b_pole() const
+    double m_b_pole(const double & m_b_MSbar_0,
+            const double & alpha_s_Z, const double & m_Z, const double & mu_t, const double & mu_b, const double & mu_c, const double & lambda_qcd)
     {
         // The true (central) pole mass of the bottom is very close to the values
         // that can be calculated by the following quadratic polynomial.
         // This holds vor 4.13 <= m_b_MSbar <= 4.37, which corresponds to the values from [PDG2010].
         static const double m0 = 4.19, a = 4.7266, b = 1.14485, c = -0.168099;
-        double m_b_MSbar = _m_b_MSbar__qcd();
-        double m_b_pole = a + (m_b_MSbar - m0) * b + power_of<2>(m_b_MSbar - m0) * c;
+        double m_b_pole = a + (m_b_MSbar_0 - m0) * b + power_of<2>(m_b_MSbar_0 - m0) * c;
 
         for (int i = 0 ; i < 10 ; ++i)
         {
-            m_b_MSbar = m_b_msbar(m_b_pole);
-            double next = QCD::m_q_pole(m_b_MSbar, alpha_s(m_b_pole), 5.0);
+            double m_b_MSbar = m_b_msbar(m_b_pole, m_b_MSbar_0, alpha_s_Z, m_Z, mu_t, mu_b, mu_c, lambda_qcd);
+            double next = QCD::m_q_pole(m_b_MSbar, memoise(implementation::alpha_s, m_b_pole, alpha_s_Z, m_Z, mu_t, mu_b, mu_c, lambda_qcd), 5.0);
 
             double delta = (m_b_pole - next) / m_b_pole;
             m_b_pole = next;
@@ -290,41 +272,25 @@ namespace implementation
         return m_b_pole;
     }
 
-    double
-    SMComponent<components::QCD>::m_b_ps(const double & mu_f) const
-    {
-        double m_b_MSbar = _m_b_MSbar__qcd();
-
-        return QCD::m_q_ps(m_b_MSbar, alpha_s(m_b_MSbar), mu_f, 5.0, QCD::beta_function_nf_5);
-    }
-
-    /* Charm */
-    double
-    SMComponent<components::QCD>::m_c_kin(const double & mu_kin) const
+    double m_c_msbar(const double & mu, const double & m_c_MSbar,
+            const double & alpha_s_Z, const double & m_Z, const double & mu_t, const double & mu_b, const double & mu_c, const double & lambda_qcd)
     {
-        double m_c_MSbar = _m_c_MSbar__qcd();
-        double alpha_mu_0 = alpha_s(m_c_MSbar);
-
-        return QCD::m_q_kin(m_c_MSbar, alpha_mu_0, mu_kin, QCD::beta_function_nf_4);
-    }
+        double m_c_0 = m_c_MSbar;
+        double alpha_s_mu0 = memoise(implementation::alpha_s, m_c_0, alpha_s_Z, m_Z, mu_t, mu_b, mu_c, lambda_qcd);
 
-    double
-    SMComponent<components::QCD>::m_c_msbar(const double & mu) const
-    {
-        double m_c_0 = _m_c_MSbar__qcd();
-        double alpha_s_mu0 = alpha_s(m_c_0);
-
-        if (mu >= _mu_c__qcd)
+        if (mu >= mu_c)
         {
-            if (mu <= _mu_b__qcd)
-                return QCD::m_q_msbar(m_c_0, alpha_s_mu0, alpha_s(mu), QCD::beta_function_nf_4, QCD::gamma_m_nf_4);
+            if (mu <= mu_b)
+                return QCD::m_q_msbar(m_c_0, alpha_s_mu0, memoise(implementation::alpha_s, mu, alpha_s_Z, m_Z, mu_t, mu_b, mu_c, lambda_qcd),
+                        QCD::beta_function_nf_4, QCD::gamma_m_nf_4);
 
-            double alpha_s_b = alpha_s(_mu_b__qcd);
+            double alpha_s_b = memoise(implementation::alpha_s, mu_b, alpha_s_Z, m_Z, mu_t, mu_b, mu_c, lambda_qcd);
             m_c_0 = QCD::m_q_msbar(m_c_0, alpha_s_mu0, alpha_s_b, QCD::beta_function_nf_4, QCD::gamma_m_nf_4);
             alpha_s_mu0 = alpha_s_b;
 
-            if (mu <= _mu_t__qcd)
-                return QCD::m_q_msbar(m_c_0, alpha_s_mu0, alpha_s(mu), QCD::beta_function_nf_5, QCD::gamma_m_nf_5);
+            if (mu <= mu_t)
+                return QCD::m_q_msbar(m_c_0, alpha_s_mu0, memoise(implementation::alpha_s, mu, alpha_s_Z, m_Z, mu_t, mu_b, mu_c, lambda_qcd),
+                        QCD::beta_function_nf_5, QCD::gamma_m_nf_5);
 
             throw InternalError("SMComponent<components::QCD>::m_c_msbar: Running of m_c_MSbar to mu > mu_t not yet implemented");
         }
@@ -334,21 +300,19 @@ namespace implementation
         }
     }
 
-    double
-    SMComponent<components::QCD>::m_c_pole() const
+    double m_c_pole(const double & m_c_MSbar_0,
+            const double & alpha_s_Z, const double & m_Z, const double & mu_t, const double & mu_b, const double & mu_c, const double & lambda_qcd)
     {
         // The true (central) pole mass of the charm is very close to the values
         // that can be calculated by the following quadratic polynomial.
         // This holds vor 1.16 <= m_c_MSbar <= 1.34, which corresponds to the values from [PDG2010].
         static const double m0 = 1.27, a = 1.59564, b = 1.13191, c = -0.737165;
-
-        double m_c_MSbar = _m_c_MSbar__qcd();
-        double m_c_pole = a + (m_c_MSbar - m0) * b + power_of<2>(m_c_MSbar - m0) * c;
+        double m_c_pole = a + (m_c_MSbar_0 - m0) * b + power_of<2>(m_c_MSbar_0 - m0) * c;
 
         for (int i = 0 ; i < 10 ; ++i)
         {
-            m_c_MSbar = m_c_msbar(m_c_pole);
-            double next = QCD::m_q_pole(m_c_MSbar, alpha_s(m_c_pole), 4.0);
+            double m_c_MSbar = m_c_msbar(m_c_pole, m_c_MSbar_0, alpha_s_Z, m_Z, mu_t, mu_b, mu_c, lambda_qcd);
+            double next = QCD::m_q_pole(m_c_MSbar, memoise(implementation::alpha_s, m_c_pole, alpha_s_Z, m_Z, mu_t, mu_b, mu_c, lambda_qcd), 4.0);
 
             double delta = (m_c_pole - next) / m_c_pole;
             m_c_pole = next;
@@ -359,6 +323,87 @@ namespace implementation
 
         return m_c_pole;
     }
+}
+
+    double
+    SMComponent<components::QCD>::alpha_s(const double & mu) const
+    {
+        return memoise(implementation::alpha_s, mu,
+                _alpha_s_Z__qcd(), _m_Z__qcd(), _mu_t__qcd(), _mu_b__qcd(), _mu_c__qcd(), _lambda_qcd__qcd());
+    }
+
+    double
+    SMComponent<components::QCD>::m_t_msbar(const double & mu) const
+    {
+        double alpha_s_m_t_pole = this->alpha_s(_m_t_pole__qcd);
+        double m_t_msbar_m_t_pole = QCD::m_q_msbar(_m_t_pole__qcd, alpha_s_m_t_pole, 5.0);
+
+        if ((_mu_b__qcd <= mu) && (mu < _mu_t__qcd))
+            return QCD::m_q_msbar(m_t_msbar_m_t_pole, alpha_s_m_t_pole, this->alpha_s(mu), QCD::beta_function_nf_5, QCD::gamma_m_nf_5);
+
+        throw InternalError("SMComponent<components::QCD>::m_t_msbar: Running of m_t_MSbar to mu >= mu_t or to mu < m_b not yet implemented");
+    }
+
+    double
+    SMComponent<components::QCD>::m_t_pole() const
+    {
+        return _m_t_pole__qcd();
+    }
+
+    double
+    SMComponent<components::QCD>::m_b_kin(const double & mu_kin) const
+    {
+        double m_b_MSbar = _m_b_MSbar__qcd();
+        double alpha_mu_0 = alpha_s(m_b_MSbar);
+
+        return QCD::m_q_kin(m_b_MSbar, alpha_mu_0, mu_kin, QCD::beta_function_nf_5);
+    }
+
+    double
+    SMComponent<components::QCD>::m_b_msbar(const double & mu) const
+    {
+        return memoise(implementation::m_b_msbar, mu, _m_b_MSbar__qcd(),
+                _alpha_s_Z__qcd(), _m_Z__qcd(), _mu_t__qcd(), _mu_b__qcd(), _mu_c__qcd(), _lambda_qcd__qcd());
+    }
+
+    double
+    SMComponent<components::QCD>::m_b_pole() const
+    {
+        return memoise(implementation::m_b_pole, _m_b_MSbar__qcd(),
+                _alpha_s_Z__qcd(), _m_Z__qcd(), _mu_t__qcd(), _mu_b__qcd(), _mu_c__qcd(), _lambda_qcd__qcd());
+    }
+
+    double
+    SMComponent<components::QCD>::m_b_ps(const double & mu_f) const
+    {
+        double m_b_MSbar = _m_b_MSbar__qcd();
+
+        return QCD::m_q_ps(m_b_MSbar, alpha_s(m_b_MSbar), mu_f, 5.0, QCD::beta_function_nf_5);
+    }
+
+    /* Charm */
+    double
+    SMComponent<components::QCD>::m_c_kin(const double & mu_kin) const
+    {
+        double m_c_MSbar = _m_c_MSbar__qcd();
+        double alpha_mu_0 = alpha_s(m_c_MSbar);
+
+        return QCD::m_q_kin(m_c_MSbar, alpha_mu_0, mu_kin, QCD::beta_function_nf_4);
+    }
+
+    double
+    SMComponent<components::QCD>::m_c_msbar(const double & mu) const
+    {
+        return memoise(implementation::m_c_msbar, mu, _m_c_MSbar__qcd(),
+                _alpha_s_Z__qcd(), _m_Z__qcd(), _mu_t__qcd(), _mu_b__qcd(), _mu_c__qcd(), _lambda_qcd__qcd());
+    }
+
+    double
+    SMComponent<components::QCD>::m_c_pole() const
+    {
+        return memoise(implementation::m_c_pole, _m_c_MSbar__qcd(),
+                _alpha_s_Z__qcd(), _m_Z__qcd(), _mu_t__qcd(), _mu_b__qcd(), _mu_c__qcd(), _lambda_qcd__qcd());
+    }
 
     double
     SMComponent<components::QCD>::m_s_msbar(const double & mu) const
@@ -622,72 +667,66 @@ namespace implementation
     }
 }
 
+namespace implementation
+{
+    /*
+     * Evolve the SM b->s Wilson coefficients from the matching scales to mu, cf. [BMU1999], Eq. (25), p. 7
+     *
+     * The result depends on the renormalisation scale and the model parameters only. It is memoised,
+     * such that all decays that read the same parameter point share one evolution per scale.
+     */
     WilsonCoefficients<BToS>
-    SMComponent<components::DeltaBS1>::wilson_coefficients_b_to_s(const double & mu, const std::string & /*lepton_flavour*/, const bool & /*cp_conjugate*/) const
+    wilson_coefficients_b_to_s(const double & mu, const double & alpha_s_Z, const double & mu_t, const double & mu_b,
+            const double & sw2, const double & m_t_pole, const double & m_W, const double & m_Z, const double & mu_0c, const double & mu_0t)
     {
-        /*
-         * In the SM all Wilson coefficients are real-valued -> all weak phases are zero.
-         * Therefore, CP conjugation leaves the Wilson coefficients invariant.
-         *
-         * In the SM there is lepton flavour universality.
-         */
-
-        // Calculation according to [BMU1999], Eq. (25), p. 7
-
-        if (mu >= _mu_t__deltabs1)
-            throw InternalError("SMComponent<components::DeltaB1>::wilson_coefficients_b_to_s: Evolution to mu >= mu_t is not yet implemented!");
-
-        if (mu <= _mu_c__deltabs1)
-            throw InternalError("SMComponent<components::DeltaB1>::wilson_coefficients_b_to_s: Evolution to mu <= mu_c is not yet implemented!");
-
         // only evolve the wilson coefficients for 5 active flavors
         static const double nf = 5.0;
 
         // calculate all alpha_s values
-        const double alpha_s_mu_0c = QCD::alpha_s(_mu_0c__deltabs1, _alpha_s_Z__deltabs1, _m_Z__deltabs1, QCD::beta_function_nf_5);
-        const double alpha_s_mu_0t = QCD::alpha_s(_mu_0t__deltabs1, _alpha_s_Z__deltabs1, _m_Z__deltabs1, QCD::beta_function_nf_5);
+        const double alpha_s_mu_0c = QCD::alpha_s(mu_0c, alpha_s_Z, m_Z, QCD::beta_function_nf_5);
+        const double alpha_s_mu_0t = QCD::alpha_s(mu_0t, alpha_s_Z, m_Z, QCD::beta_function_nf_5);
 
         double alpha_s = 0.0;
-        if (mu < _mu_b__deltabs1)
+        if (mu < mu_b)
         {
-            alpha_s = QCD::alpha_s(_mu_b__deltabs1, _alpha_s_Z__deltabs1, _m_Z__deltabs1, QCD::beta_function_nf_5);
-            alpha_s = QCD::alpha_s(mu, alpha_s, _mu_b__deltabs1, QCD::beta_function_nf_4);
+            alpha_s = QCD::alpha_s(mu_b, alpha_s_Z, m_Z, QCD::beta_function_nf_5);
+            alpha_s = QCD::alpha_s(mu, alpha_s, mu_b, QCD::beta_function_nf_4);
         }
         else
         {
-            alpha_s = QCD::alpha_s(mu, _alpha_s_Z__deltabs1, _m_Z__deltabs1, QCD::beta_function_nf_5);
+            alpha_s = QCD::alpha_s(mu, alpha_s_Z, m_Z, QCD::beta_function_nf_5);
         }
 
         double alpha_s_m_t_pole = 0.0;
-        if (_mu_t__deltabs1 <= _m_t_pole__deltabs1)
+        if (mu_t <= m_t_pole)
         {
-            alpha_s_m_t_pole = QCD::alpha_s(_mu_t__deltabs1, _alpha_s_Z__deltabs1, _m_Z__deltabs1, QCD::beta_function_nf_5);
-            alpha_s_m_t_pole = QCD::alpha_s(_m_t_pole__deltabs1, alpha_s_m_t_pole, _mu_t__deltabs1, QCD::beta_function_nf_6);
+            alpha_s_m_t_pole = QCD::alpha_s(mu_t, alpha_s_Z, m_Z, QCD::beta_function_nf_5);
+            alpha_s_m_t_pole = QCD::alpha_s(m_t_pole, alpha_s_m_t_pole, mu_t, QCD::beta_function_nf_6);
         }
         else
         {
             Log::instance()->message("sm_component<deltab1>.wc", ll_error)
                 << "mu_t > m_t_pole!";
 
-            alpha_s_m_t_pole = QCD::alpha_s(_m_t_pole__deltabs1, _alpha_s_Z__deltabs1, _m_Z__deltabs1, QCD::beta_function_nf_5);
+            alpha_s_m_t_pole = QCD::alpha_s(m_t_pole, alpha_s_Z, m_Z, QCD::beta_function_nf_5);
         }
 
         // calculate m_t at the matching scales in the MSbar scheme
-        const double m_t_msbar_m_t_pole = QCD::m_q_msbar(_m_t_pole__deltabs1, alpha_s_m_t_pole, 5.0);
+        const double m_t_msbar_m_t_pole = QCD::m_q_msbar(m_t_pole, alpha_s_m_t_pole, 5.0);
         const double m_t_mu_0c = QCD::m_q_msbar(m_t_msbar_m_t_pole, alpha_s_m_t_pole, alpha_s_mu_0c, QCD::beta_function_nf_5, QCD::gamma_m_nf_5);
         const double m_t_mu_0t = QCD::m_q_msbar(m_t_msbar_m_t_pole, alpha_s_m_t_pole, alpha_s_mu_0t, QCD::beta_function_nf_5, QCD::gamma_m_nf_5);
 
         // calculate dependent inputs
-        const double log_c = 2.0 * std::log(_mu_0c__deltabs1 / _m_W__deltabs1), log_t = std::log(_mu_0t__deltabs1 / m_t_mu_0t);
-        const double x_c = power_of<2>(m_t_mu_0c / _m_W__deltabs1), x_t = power_of<2>(m_t_mu_0t / _m_W__deltabs1);
+        const double log_c = 2.0 * std::log(mu_0c / m_W), log_t = std::log(mu_0t / m_t_mu_0t);
+        const double x_c = power_of<2>(m_t_mu_0c / m_W), x_t = power_of<2>(m_t_mu_0t / m_W);
 
-        WilsonCoefficients<BToS> downscaled_charm = evolve(implementation::initial_scale_wilson_coefficients_b_to_s_charm_sector_qcd0(),
-                implementation::initial_scale_wilson_coefficients_b_to_s_charm_sector_qcd1(log_c, _sw2__deltabs1),
-                implementation::initial_scale_wilson_coefficients_b_to_s_charm_sector_qcd2(x_c, log_c, _sw2__deltabs1),
+        WilsonCoefficients<BToS> downscaled_charm = evolve(initial_scale_wilson_coefficients_b_to_s_charm_sector_qcd0(),
+                initial_scale_wilson_coefficients_b_to_s_charm_sector_qcd1(log_c, sw2),
+                initial_scale_wilson_coefficients_b_to_s_charm_sector_qcd2(x_c, log_c, sw2),
                 alpha_s_mu_0c, alpha_s, nf, QCD::beta_function_nf_5);
-        WilsonCoefficients<BToS> downscaled_top = evolve(implementation::initial_scale_wilson_coefficients_b_to_s_top_sector_qcd0(),
-                implementation::initial_scale_wilson_coefficients_b_to_s_top_sector_qcd1(x_t, _sw2__deltabs1),
-                implementation::initial_scale_wilson_coefficients_b_to_s_top_sector_qcd2(x_t, log_t, _sw2__deltabs1),
+        WilsonCoefficients<BToS> downscaled_top = evolve(initial_scale_wilson_coefficients_b_to_s_top_sector_qcd0(),
+                initial_scale_wilson_coefficients_b_to_s_top_sector_qcd1(x_t, sw2),
+                initial_scale_wilson_coefficients_b_to_s_top_sector_qcd2(x_t, log_t, sw2),
                 alpha_s_mu_0t, alpha_s, nf, QCD::beta_function_nf_5);
 
         WilsonCoefficients<BToS> wc = downscaled_top;
@@ -695,6 +734,31 @@ namespace implementation
 
         return wc;
     }
+}
+
+    WilsonCoefficients<BToS>
+    SMComponent<components::DeltaBS1>::wilson_coefficients_b_to_s(const double & mu, const std::string & /*lepton_flavour*/, const bool & /*cp_conjugate*/) const
+    {
+        /*
+         * In the SM all Wilson coefficients are real-valued -> all weak phases are zero.
+         * Therefore, CP conjugation leaves the Wilson coefficients invariant.
+         *
+         * In the SM there is lepton flavour universality.
+         *
+         * Hence, the result is memoised for each scale and parameter point, independent of
+         * the lepton flavour and of CP conjugation.
+         */
+
+        if (mu >= _mu_t__deltabs1)
+            throw InternalError("SMComponent<components::DeltaB1>::wilson_coefficients_b_to_s: Evolution to mu >= mu_t is not yet implemented!");
+
+        if (mu <= _mu_c__deltabs1)
+            throw InternalError("SMComponent<components::DeltaB1>::wilson_coefficients_b_to_s: Evolution to mu <= mu_c is not yet implemented!");
+
+        return memoise(implementation::wilson_coefficients_b_to_s, mu,
+                _alpha_s_Z__deltabs1(), _mu_t__deltabs1(), _mu_b__deltabs1(), _sw2__deltabs1(),
+                _m_t_pole__deltabs1(), _m_W__deltabs1(), _m_Z__deltabs1(), _mu_0c__deltabs1(), _mu_0t__deltabs1());
+    }
 
     SMComponent<components::DeltaB2>::SMComponent(const Parameters & p, ParameterUser & u) :
         _G_Fermi__deltabs2(p["WET::G_Fermi"], u),
@@ -170,6 +170,20 @@ class BMassesTest :
             TEST_CHECK_NEARLY_EQUAL(4.56114, model.m_b_kin(1.00), eps);
             TEST_CHECK_NEARLY_EQUAL(4.49203, model.m_b_kin(1.25), eps);
             TEST_CHECK_NEARLY_EQUAL(4.42520, model.m_b_kin(1.50), eps);
+
+            // the memoised results follow changes of the parameters, and are shared across models
+            {
+                StandardModel other(p);
+
+                p["mass::b(MSbar)"] = 4.3;
+                const double m_b_pole = model.m_b_pole();
+                TEST_CHECK(std::abs(m_b_pole - 4.74167) > 1e-2);
+                TEST_CHECK_EQUAL(m_b_pole, other.m_b_pole());
+                TEST_CHECK_NEARLY_EQUAL(4.3, model.m_b_msbar(4.3), eps);
+
+                p["mass::b(MSbar)"] = 4.2;
+                TEST_CHECK_NEARLY_EQUAL(4.74167, other.m_b_pole(), eps);
+            }
         }
 } sm_b_masses_test;
 
@@ -438,6 +452,26 @@ class WilsonCoefficientsBToSTest :
                 TEST_CHECK_NEARLY_EQUAL(parameters["b->smumu::Im{c9}"],     imag(wc.c9()),  eps);
                 TEST_CHECK_NEARLY_EQUAL(parameters["b->smumu::Im{c10}"],    imag(wc.c10()), eps);
             }
+
+            /* Test that the memoised evolution follows changes of the parameters */
+            {
+                static const double mu = 4.2;
+
+                Parameters parameters = reference_parameters();
+                StandardModel model(parameters);
+                StandardModel other(parameters);
+
+                const double c9 = real(model.wilson_coefficients_b_to_s(mu, "mu", false).c9());
+                TEST_CHECK_EQUAL(c9, real(other.wilson_coefficients_b_to_s(mu, "e", true).c9()));
+
+                parameters["b->s::mu_0t"] = 160.0;
+                TEST_CHECK(c9 != real(model.wilson_coefficients_b_to_s(mu, "mu", false).c9()));
+                TEST_CHECK_EQUAL(real(model.wilson_coefficients_b_to_s(mu, "mu", false).c9()),
+                        real(other.wilson_coefficients_b_to_s(mu, "mu", false).c9()));
+
+                parameters["b->s::mu_0t"] = 120.0;
+                TEST_CHECK_EQUAL(c9, real(model.wilson_coefficients_b_to_s(mu, "mu", false).c9()));
+            }
         }
 } wilson_coefficients_b_to_s_test;
 
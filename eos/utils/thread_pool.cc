@@ -25,7 +25,14 @@
 #include <eos/utils/thread.hh>
 #include <eos/utils/thread_pool.hh>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
 #include <list>
+#include <memory>
+#include <vector>
 
 #include <unistd.h>
 
@@ -34,108 +41,284 @@ namespace eos
     template <>
     struct Implementation<ThreadPool>
     {
+        // A batch of jobs that shares one function object and one ticket
+        struct Batch
+        {
+            std::function<void (unsigned)> work;
+
+            // The number of chunks that have not yet completed
+            std::atomic<unsigned> remaining;
+
+            Ticket ticket;
+
+            Batch(const std::function<void (unsigned)> & work, const unsigned & chunks) :
+                work(work),
+                remaining(chunks)
+            {
+            }
+        };
+
+        // A contiguous chunk of indices [begin, end) of one batch
+        struct Job
+        {
+            std::shared_ptr<Batch> batch;
+
+            unsigned begin, end;
+        };
+
+        // A worker's queue of jobs
+        struct Queue
+        {
+            Mutex mutex;
+
+            std::deque<Job> jobs;
+        };
+
         unsigned number_of_threads;
         unsigned long nominal_capacity;
         unsigned long stop_capacity;
 
-        // Thread termination
-        Mutex * const terminate_mutex;
+        std::vector<std::unique_ptr<Queue>> queues;
 
-        bool terminate;
+        // The queue that receives the next chunk
+        std::atomic<unsigned> next_queue;
+
+        // The number of chunks that have been enqueued but not yet picked up
+        std::atomic<unsigned long> queued_jobs;
 
-        // Job handling
-        Mutex * const job_mutex;
+        // Utilisation statistics, which are only collected on request; times in nanoseconds
+        std::atomic<bool> collect_statistics;
+        std::atomic<unsigned long> processed_chunks;
+        std::atomic<unsigned long> maximal_queued_jobs;
+        std::atomic<unsigned long> busy_time;
+        std::atomic<unsigned long> idle_time;
+
+        // Idle handling and thread termination
+        Mutex * const idle_mutex;
 
         ConditionVariable * const job_arrival;
-        ConditionVariable * const job_capacity;
 
         unsigned long waiting_for_jobs;
-        unsigned long pending_jobs;
 
-        std::list<std::pair<Ticket, std::function<void (void)> *>> queue;
+        bool terminate;
+
+        // Capacity handling
+        Mutex * const capacity_mutex;
+
+        ConditionVariable * const job_capacity;
+
+        unsigned long pending_jobs;
 
         std::list<Thread *> threads;
 
-        void thread_function()
+        static unsigned determine_number_of_threads()
         {
-            std::function<void (void)> * job;
-            Ticket ticket;
+            if (const char * envvar = std::getenv("EOS_NUMBER_OF_THREADS"))
+            {
+                long result = std::strtol(envvar, nullptr, 10);
+                if (result > 0)
+                    return result;
+            }
+
+            return std::max(1l, sysconf(_SC_NPROCESSORS_CONF));
+        }
+
+        // take a job from the back of our own queue
+        bool pop(const unsigned & index, Job & job)
+        {
+            Queue & q = *queues[index];
+            Lock l(q.mutex);
+
+            if (q.jobs.empty())
+                return false;
+
+            job = std::move(q.jobs.back());
+            q.jobs.pop_back();
+            --queued_jobs;
+
+            return true;
+        }
+
+        // take a job from the front of any other queue
+        bool steal(const unsigned & index, Job & job)
+        {
+            for (unsigned k = 1 ; k <= number_of_threads ; ++k)
+            {
+                Queue & q = *queues[(index + k) % number_of_threads];
+                Lock l(q.mutex);
+
+                if (q.jobs.empty())
+                    continue;
+
+                job = std::move(q.jobs.front());
+                q.jobs.pop_front();
+                --queued_jobs;
+
+                return true;
+            }
+
+            return false;
+        }
+
+        static unsigned long nanoseconds_since(const std::chrono::steady_clock::time_point & start)
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        void run(Job & job)
+        {
+            const bool statistics = collect_statistics.load(std::memory_order_relaxed);
+            const auto start = statistics ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+            for (unsigned i = job.begin ; i < job.end ; ++i)
+            {
+                job.batch->work(i);
+            }
+
+            if (statistics)
+            {
+                busy_time += nanoseconds_since(start);
+                ++processed_chunks;
+            }
+
+            {
+                Lock l(*capacity_mutex);
+                pending_jobs -= 1;
+
+                if (pending_jobs == nominal_capacity)
+                    job_capacity->broadcast();
+            }
+
+            if (0 == --job.batch->remaining)
+                job.batch->ticket.mark();
+
+            job.batch.reset();
+        }
+
+        void thread_function(const unsigned index)
+        {
+            Job job;
 
             do
             {
+                if (pop(index, job) || steal(index, job))
                 {
-                    Lock l(*terminate_mutex);
-                    if (terminate)
-                        break;
+                    run(job);
+                    continue;
                 }
 
-                job = 0;
+                Lock l(*idle_mutex);
 
-                {
-                    Lock l(*job_mutex);
-
-                    if (queue.empty())
-                    {
-                        waiting_for_jobs += 1;
-                        job_arrival->wait(*job_mutex);
-                        waiting_for_jobs -= 1;
-                    }
-
-                    if (queue.empty())
-                    {
-                        Lock l(*terminate_mutex);
-                        if (terminate)
-                            break;
-                        else
-                            continue;
-                    }
-
-                    ticket = queue.front().first;
-                    job = queue.front().second;
-                    queue.pop_front();
-                }
+                if (terminate)
+                    break;
+
+                // a job might have arrived while we were looking for one
+                if (queued_jobs > 0)
+                    continue;
+
+                const bool statistics = collect_statistics.load(std::memory_order_relaxed);
+                const auto start = statistics ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+                waiting_for_jobs += 1;
+                job_arrival->wait(*idle_mutex);
+                waiting_for_jobs -= 1;
+
+                if (statistics)
+                    idle_time += nanoseconds_since(start);
+            }
+            while (true);
+        }
+
+        Ticket enqueue(const std::function<void (unsigned)> & work, const unsigned & n)
+        {
+            if (0 == n)
+            {
+                Ticket result;
+                result.mark();
+
+                return result;
+            }
+
+            // use a few chunks per thread to allow for load balancing through stealing
+            const unsigned number_of_chunks = std::min(n, 4 * number_of_threads);
+            const unsigned chunk_size = (n + number_of_chunks - 1) / number_of_chunks;
+            const unsigned actual_number_of_chunks = (n + chunk_size - 1) / chunk_size;
 
-                (*job)();
+            auto batch = std::make_shared<Batch>(work, actual_number_of_chunks);
+            const bool statistics = collect_statistics.load(std::memory_order_relaxed);
+
+            {
+                Lock l(*capacity_mutex);
+                pending_jobs += actual_number_of_chunks;
+            }
+
+            for (unsigned begin = 0 ; begin < n ; begin += chunk_size)
+            {
+                Queue & q = *queues[next_queue++ % number_of_threads];
+                Lock l(q.mutex);
+
+                q.jobs.push_back(Job{ batch, begin, std::min(n, begin + chunk_size) });
+                const unsigned long depth = ++queued_jobs;
+
+                if (! statistics)
+                    continue;
+
+                unsigned long maximum = maximal_queued_jobs;
+                while ((depth > maximum) && ! maximal_queued_jobs.compare_exchange_weak(maximum, depth))
                 {
-                    Lock l(*job_mutex);
-                    pending_jobs -= 1;
+                }
+            }
 
-                    if (pending_jobs == nominal_capacity)
-                        job_capacity->signal();
+            {
+                Lock l(*idle_mutex);
 
+                if (waiting_for_jobs > 0)
+                {
+                    if (1 == actual_number_of_chunks)
+                        job_arrival->signal();
+                    else
+                        job_arrival->broadcast();
                 }
-                ticket.mark();
             }
-            while (true);
+
+            return batch->ticket;
         }
 
         Implementation() :
-            number_of_threads(sysconf(_SC_NPROCESSORS_CONF)),
+            number_of_threads(determine_number_of_threads()),
             nominal_capacity(number_of_threads * 10),
             stop_capacity(nominal_capacity * 2),
-            terminate_mutex(new Mutex),
-            terminate(false),
-            job_mutex(new Mutex),
+            next_queue(0),
+            queued_jobs(0),
+            collect_statistics(false),
+            processed_chunks(0),
+            maximal_queued_jobs(0),
+            busy_time(0),
+            idle_time(0),
+            idle_mutex(new Mutex),
             job_arrival(new ConditionVariable),
-            job_capacity(new ConditionVariable),
             waiting_for_jobs(0),
+            terminate(false),
+            capacity_mutex(new Mutex),
+            job_capacity(new ConditionVariable),
             pending_jobs(0)
         {
             for (unsigned i(0) ; i < number_of_threads ; ++i)
             {
-                threads.push_back(new Thread(std::bind(&Implementation<ThreadPool>::thread_function, this)));
+                queues.push_back(std::unique_ptr<Queue>(new Queue));
+            }
+
+            for (unsigned i(0) ; i < number_of_threads ; ++i)
+            {
+                threads.push_back(new Thread(std::bind(&Implementation<ThreadPool>::thread_function, this, i)));
             }
         }
 
         ~Implementation()
         {
             {
-                Lock l(*terminate_mutex);
+                Lock l(*idle_mutex);
                 terminate = true;
-            }
-
-            {
-                Lock l(*job_mutex);
                 job_arrival->broadcast();
             }
 
@@ -143,6 +326,11 @@ namespace eos
             {
                 delete thread;
             }
+
+            delete job_capacity;
+            delete capacity_mutex;
+            delete job_arrival;
+            delete idle_mutex;
         }
     };
 
@@ -159,18 +347,28 @@ namespace eos
     Ticket
     ThreadPool::enqueue(const std::function<void (void)> & job)
     {
-        std::pair<Ticket, std::function<void (void)> *> item(Ticket(), new std::function<void (void)>(job));
+        return _imp->enqueue([job] (unsigned) { job(); }, 1u);
+    }
 
-        {
-            Lock l(*_imp->job_mutex);
-            _imp->queue.push_back(item);
-            _imp->pending_jobs += 1;
+    Ticket
+    ThreadPool::enqueue_batch(const std::function<void (unsigned)> & work, const unsigned & n)
+    {
+        return _imp->enqueue(work, n);
+    }
 
-            if (_imp->waiting_for_jobs > 0)
-                _imp->job_arrival->signal();
+    void
+    ThreadPool::parallel_for(const unsigned & n, const std::function<void (unsigned)> & work)
+    {
+        Ticket ticket = _imp->enqueue(work, n);
+
+        // help processing jobs until none are left in any queue
+        Implementation<ThreadPool>::Job job;
+        while (_imp->steal(0, job))
+        {
+            _imp->run(job);
         }
 
-        return item.first;
+        ticket.wait();
     }
 
     ThreadPool *
@@ -182,12 +380,12 @@ namespace eos
     void
     ThreadPool::wait_for_free_capacity()
     {
-        Lock l(*_imp->job_mutex);
+        Lock l(*_imp->capacity_mutex);
 
         if (_imp->pending_jobs < _imp->stop_capacity)
             return;
 
-        _imp->job_capacity->wait(*_imp->job_mutex);
+        _imp->job_capacity->wait(*_imp->capacity_mutex);
     }
 
     unsigned
@@ -195,5 +393,32 @@ namespace eos
     {
         return _imp->number_of_threads;
     }
-}
 
+    ThreadPoolStatistics
+    ThreadPool::statistics() const
+    {
+        ThreadPoolStatistics result;
+        result.chunks              = _imp->processed_chunks;
+        result.queue_depth         = _imp->queued_jobs;
+        result.maximal_queue_depth = _imp->maximal_queued_jobs;
+        result.busy_time           = 1.0e-9 * _imp->busy_time;
+        result.idle_time           = 1.0e-9 * _imp->idle_time;
+
+        return result;
+    }
+
+    void
+    ThreadPool::reset_statistics()
+    {
+        _imp->processed_chunks    = 0;
+        _imp->maximal_queued_jobs = 0;
+        _imp->busy_time           = 0;
+        _imp->idle_time           = 0;
+    }
+
+    void
+    ThreadPool::collect_statistics(const bool & enabled)
+    {
+        _imp->collect_statistics = enabled;
+    }
+}
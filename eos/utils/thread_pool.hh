@@ -28,6 +28,39 @@
 
 namespace eos
 {
+    /*!
+     * Counters describing the utilisation of the ThreadPool.
+     *
+     * Apart from the queue depth, the counters are only collected while enabled, e.g., through the Profiler.
+     */
+    struct ThreadPoolStatistics
+    {
+        /// The number of chunks of jobs that have been processed.
+        unsigned long chunks = 0;
+
+        /// The number of chunks that are currently waiting in the queues.
+        unsigned long queue_depth = 0;
+
+        /// The largest number of chunks that have been waiting in the queues at the same time.
+        unsigned long maximal_queue_depth = 0;
+
+        /// The accumulated wall time in seconds that all threads spent processing chunks.
+        double busy_time = 0.0;
+
+        /// The accumulated wall time in seconds that the worker threads spent waiting for new jobs.
+        double idle_time = 0.0;
+    };
+
+    /*!
+     * ThreadPool distributes jobs across a fixed number of worker threads.
+     *
+     * Each worker owns a double-ended queue of jobs. Workers process their own
+     * queue in LIFO order, and steal jobs from the front of other workers' queues
+     * once their own queue has run dry.
+     *
+     * The number of worker threads defaults to the number of configured processors,
+     * and can be overridden through the environment variable EOS_NUMBER_OF_THREADS.
+     */
     class ThreadPool :
         public InstantiationPolicy<ThreadPool, Singleton>,
         public PrivateImplementationPattern<ThreadPool>
@@ -37,13 +70,50 @@ namespace eos
 
             ~ThreadPool();
 
+            /*!
+             * Enqueue a single job.
+             *
+             * @param work The job to be executed.
+             * @return A Ticket that is marked upon completion of the job.
+             */
             Ticket enqueue(const std::function<void (void)> & work);
 
+            /*!
+             * Enqueue a batch of n jobs work(0), ..., work(n - 1).
+             *
+             * The batch is split into a small number of contiguous chunks, which are
+             * distributed across the workers' queues.
+             *
+             * @param work The job to be executed for each index.
+             * @param n    The number of indices.
+             * @return A single Ticket that is marked upon completion of all n jobs.
+             */
+            Ticket enqueue_batch(const std::function<void (unsigned)> & work, const unsigned & n);
+
+            /*!
+             * Execute the jobs work(0), ..., work(n - 1) in parallel, and return upon their completion.
+             *
+             * The calling thread participates in processing the jobs.
+             *
+             * @param n    The number of indices.
+             * @param work The job to be executed for each index.
+             */
+            void parallel_for(const unsigned & n, const std::function<void (unsigned)> & work);
+
             static ThreadPool * instance();
 
             void wait_for_free_capacity();
 
             unsigned number_of_threads() const;
+
+            /// Retrieve the counters describing the utilisation of the pool.
+            ThreadPoolStatistics statistics() const;
+
+            /// Reset the counters describing the utilisation of the pool.
+            void reset_statistics();
+
+            /// Enable or disable the collection of the counters describing the utilisation of the pool.
+            void collect_statistics(const bool & enabled);
     };
 }
 
@@ -0,0 +1,108 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class ThreadPoolTest :
+    public TestCase
+{
+    public:
+        ThreadPoolTest() :
+            TestCase("thread_pool_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            /* single jobs */
+            {
+                std::atomic<unsigned> counter(0);
+
+                std::vector<Ticket> tickets;
+                for (unsigned i = 0 ; i < 100 ; ++i)
+                {
+                    tickets.push_back(ThreadPool::instance()->enqueue([&counter] () { ++counter; }));
+                }
+
+                for (auto & ticket : tickets)
+                {
+                    ticket.wait();
+                }
+
+                TEST_CHECK_EQUAL(100u, counter.load());
+            }
+
+            /* batches */
+            {
+                std::vector<unsigned> results(1000, 0);
+
+                Ticket ticket = ThreadPool::instance()->enqueue_batch([&results] (unsigned i) { results[i] = i; }, results.size());
+                ticket.wait();
+
+                for (unsigned i = 0 ; i < results.size() ; ++i)
+                {
+                    TEST_CHECK_EQUAL(i, results[i]);
+                }
+
+                // empty batches complete immediately
+                ThreadPool::instance()->enqueue_batch([] (unsigned) { }, 0u).wait();
+            }
+
+            /* parallel for */
+            {
+                std::vector<double> results(12345, 0.0);
+
+                ThreadPool::instance()->parallel_for(results.size(), [&results] (unsigned i) { results[i] = 2.0 * i; });
+
+                double sum = std::accumulate(results.begin(), results.end(), 0.0);
+                TEST_CHECK_EQUAL(12344.0 * 12345.0, sum);
+            }
+
+            /* statistics */
+            {
+                ThreadPool::instance()->reset_statistics();
+                TEST_CHECK_EQUAL(0u, ThreadPool::instance()->statistics().chunks);
+
+                // not collected by default
+                ThreadPool::instance()->parallel_for(100, [] (unsigned) { });
+                TEST_CHECK_EQUAL(0u, ThreadPool::instance()->statistics().chunks);
+                TEST_CHECK_EQUAL(0u, ThreadPool::instance()->statistics().maximal_queue_depth);
+
+                ThreadPool::instance()->collect_statistics(true);
+                ThreadPool::instance()->parallel_for(100, [] (unsigned) { });
+                ThreadPool::instance()->collect_statistics(false);
+
+                auto statistics = ThreadPool::instance()->statistics();
+                TEST_CHECK(statistics.chunks > 0u);
+                TEST_CHECK(statistics.chunks <= 100u);
+                TEST_CHECK(statistics.maximal_queue_depth > 0u);
+                TEST_CHECK_EQUAL(0u, statistics.queue_depth);
+                TEST_CHECK(statistics.busy_time >= 0.0);
+                TEST_CHECK(statistics.idle_time >= 0.0);
+            }
+        }
+} thread_pool_test;
@@ -0,0 +1,433 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/yaml-index.hh>
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace eos
+{
+    namespace implementation
+    {
+        namespace yaml_index
+        {
+            static const char magic[8] = { 'E', 'O', 'S', 'I', 'N', 'D', 'E', 'X' };
+
+            static const std::uint32_t version = 2;
+
+            struct Header
+            {
+                char magic[8];
+
+                std::uint32_t version;
+
+                std::uint32_t files;
+
+                std::uint64_t entries;
+
+                std::uint64_t strings_size;
+            };
+
+            // the name of a file is relative to the indexed directory
+            struct FileRecord
+            {
+                std::uint64_t name;
+
+                std::uint64_t name_size;
+
+                std::uint64_t size;
+
+                std::uint64_t hash;
+            };
+
+            // an entry spans the bytes [begin, end) of its file
+            struct EntryRecord
+            {
+                std::uint64_t name;
+
+                std::uint32_t name_size;
+
+                std::uint32_t file;
+
+                std::uint64_t begin;
+
+                std::uint64_t end;
+            };
+
+            static_assert(sizeof(Header) == 32, "YAMLIndex: unexpected header size");
+            static_assert(sizeof(FileRecord) == 32, "YAMLIndex: unexpected file record size");
+            static_assert(sizeof(EntryRecord) == 32, "YAMLIndex: unexpected entry record size");
+
+            // the names of all YAML files in a directory, in lexicographical order
+            static std::vector<std::string> yaml_files(const std::string & index, const std::string & directory)
+            {
+                std::vector<std::string> result;
+
+                DIR * dir = ::opendir(directory.c_str());
+                if (! dir)
+                    throw YAMLIndexError(index, "cannot open directory '" + directory + "': " + std::strerror(errno));
+
+                while (struct dirent * e = ::readdir(dir))
+                {
+                    const std::string name(e->d_name);
+
+                    if ((name.size() <= 5) || (0 != name.compare(name.size() - 5, 5, ".yaml")))
+                        continue;
+
+                    struct stat status;
+                    if ((0 != ::stat((directory + "/" + name).c_str(), &status)) || (! S_ISREG(status.st_mode)))
+                        continue;
+
+                    result.push_back(name);
+                }
+
+                ::closedir(dir);
+
+                std::sort(result.begin(), result.end());
+
+                return result;
+            }
+
+            // the 64-bit FNV-1a hash of a file's content
+            static std::uint64_t content_hash(const std::string & text)
+            {
+                std::uint64_t result = 0xcbf29ce484222325ull;
+                for (const char & c : text)
+                {
+                    result ^= static_cast<unsigned char>(c);
+                    result *= 0x100000001b3ull;
+                }
+
+                return result;
+            }
+
+            static std::string read_file(const std::string & index, const std::string & path)
+            {
+                std::ifstream stream(path, std::ios::binary);
+                if (! stream)
+                    throw YAMLIndexError(index, "cannot open '" + path + "'");
+
+                std::stringstream buffer;
+                buffer << stream.rdbuf();
+
+                return buffer.str();
+            }
+        }
+    }
+
+    using namespace implementation::yaml_index;
+
+    template <>
+    struct Implementation<YAMLIndex>
+    {
+        std::string directory;
+
+        std::string index;
+
+        void * mapping;
+
+        std::size_t mapping_size;
+
+        const Header * header;
+
+        const FileRecord * files;
+
+        const EntryRecord * entries;
+
+        const char * strings;
+
+        Implementation(const std::string & directory, const std::string & index) :
+            directory(directory),
+            index(index),
+            mapping(nullptr),
+            mapping_size(0)
+        {
+            int fd = ::open(index.c_str(), O_RDONLY);
+            if (fd < 0)
+                throw YAMLIndexError(index, std::string("cannot open file: ") + std::strerror(errno));
+
+            struct stat status;
+            if ((0 != ::fstat(fd, &status)) || (status.st_size < off_t(sizeof(Header))))
+            {
+                ::close(fd);
+                throw YAMLIndexError(index, "is not an index file");
+            }
+
+            mapping_size = status.st_size;
+            mapping = ::mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);
+
+            if (MAP_FAILED == mapping)
+            {
+                mapping = nullptr;
+                throw YAMLIndexError(index, std::string("cannot map file: ") + std::strerror(errno));
+            }
+
+            try
+            {
+                header = static_cast<const Header *>(mapping);
+                if (0 != std::memcmp(header->magic, magic, sizeof(magic)))
+                    throw YAMLIndexError(index, "is not an index file");
+
+                if (version != header->version)
+                    throw YAMLIndexError(index, "has unsupported format version " + stringify(header->version));
+
+                if (mapping_size != sizeof(Header) + header->files * sizeof(FileRecord) + header->entries * sizeof(EntryRecord) + header->strings_size)
+                    throw YAMLIndexError(index, "is truncated");
+
+                files   = reinterpret_cast<const FileRecord *>(static_cast<const char *>(mapping) + sizeof(Header));
+                entries = reinterpret_cast<const EntryRecord *>(files + header->files);
+                strings = reinterpret_cast<const char *>(entries + header->entries);
+
+                // reject the index if the content of the indexed files has changed; unlike their
+                // modification times, the content is preserved when the files are copied or reinstalled
+                if (yaml_files(index, directory).size() != header->files)
+                    throw YAMLIndexError(index, "is out of date, the number of files in '" + directory + "' has changed");
+
+                for (unsigned i = 0 ; i < header->files ; ++i)
+                {
+                    const std::string path = directory + "/" + std::string(strings + files[i].name, files[i].name_size);
+                    const std::string text = read_file(index, path);
+
+                    if ((text.size() != files[i].size) || (content_hash(text) != files[i].hash))
+                        throw YAMLIndexError(index, "is out of date, '" + path + "' has changed");
+                }
+            }
+            catch (...)
+            {
+                ::munmap(mapping, mapping_size);
+                throw;
+            }
+        }
+
+        ~Implementation()
+        {
+            ::munmap(mapping, mapping_size);
+        }
+
+        std::string name(const unsigned & i) const
+        {
+            return std::string(strings + entries[i].name, entries[i].name_size);
+        }
+
+        std::string file(const unsigned & i) const
+        {
+            const FileRecord & f = files[entries[i].file];
+
+            return directory + "/" + std::string(strings + f.name, f.name_size);
+        }
+
+        unsigned find(const std::string & name) const
+        {
+            // binary search among the sorted entries
+            const EntryRecord * e = std::lower_bound(entries, entries + header->entries, name,
+                    [&] (const EntryRecord & lhs, const std::string & rhs) { return 0 < rhs.compare(0, rhs.size(), strings + lhs.name, lhs.name_size); });
+
+            if ((entries + header->entries == e) || (0 != name.compare(0, name.size(), strings + e->name, e->name_size)))
+                return header->entries;
+
+            return e - entries;
+        }
+
+        std::string entry(const unsigned & i) const
+        {
+            const std::string path = file(i);
+            const std::size_t size = entries[i].end - entries[i].begin;
+
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+                throw YAMLIndexError(index, "cannot open '" + path + "': " + std::strerror(errno));
+
+            std::string result(size, '\0');
+            ssize_t bytes = ::pread(fd, &result[0], size, entries[i].begin);
+            ::close(fd);
+
+            if (ssize_t(size) != bytes)
+                throw YAMLIndexError(index, "cannot read entry '" + name(i) + "' from '" + path + "'");
+
+            return result;
+        }
+    };
+
+    void
+    YAMLIndex::create(const std::string & directory, const std::string & index)
+    {
+        std::vector<FileRecord> files;
+        std::map<std::string, EntryRecord> entries;
+        std::string strings;
+
+        const std::vector<std::string> names = yaml_files(index, directory);
+        for (unsigned i = 0 ; i < names.size() ; ++i)
+        {
+            const std::string path = directory + "/" + names[i];
+
+            const std::string text = read_file(index, path);
+
+            FileRecord f;
+            f.name = strings.size();
+            f.name_size = names[i].size();
+            f.size = text.size();
+            f.hash = content_hash(text);
+            strings += names[i];
+            files.push_back(f);
+
+            try
+            {
+                YAML::Node root = YAML::Load(text);
+
+                if (root.IsNull())
+                    continue;
+
+                if (! root.IsMap())
+                    throw YAMLIndexError(index, "the top-level node of '" + path + "' is not a map");
+
+                // the positions of the top-level keys delimit the entries
+                std::vector<std::pair<std::size_t, std::string>> keys;
+                for (auto && p : root)
+                {
+                    if (p.first.Mark().is_null())
+                        throw YAMLIndexError(index, "cannot locate the entry '" + p.first.Scalar() + "' in '" + path + "'");
+
+                    keys.push_back(std::make_pair(std::size_t(p.first.Mark().pos), p.first.Scalar()));
+                }
+                std::sort(keys.begin(), keys.end());
+
+                for (unsigned k = 0 ; k < keys.size() ; ++k)
+                {
+                    const std::string & name = keys[k].second;
+
+                    if ("@metadata@" == name)
+                        continue;
+
+                    const std::size_t begin = keys[k].first;
+                    const std::size_t end = (k + 1 < keys.size()) ? keys[k + 1].first : text.size();
+
+                    // make sure that the entry can be parsed in isolation, e.g., it is not part of a flow mapping
+                    YAML::Node node = YAML::Load(text.substr(begin, end - begin));
+                    if ((! node.IsMap()) || (1 != node.size()) || (name != node.begin()->first.Scalar()))
+                        throw YAMLIndexError(index, "the entry '" + name + "' in '" + path + "' cannot be parsed in isolation");
+
+                    EntryRecord e;
+                    e.name = strings.size();
+                    e.name_size = name.size();
+                    e.file = i;
+                    e.begin = begin;
+                    e.end = end;
+                    strings += name;
+
+                    if (! entries.insert(std::make_pair(name, e)).second)
+                        throw YAMLIndexError(index, "encountered duplicate entry '" + name + "' in '" + path + "'");
+                }
+            }
+            catch (YAML::Exception & e)
+            {
+                throw YAMLIndexError(index, "cannot parse '" + path + "': " + e.what());
+            }
+        }
+
+        Header header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, magic, sizeof(magic));
+        header.version = version;
+        header.files = files.size();
+        header.entries = entries.size();
+        header.strings_size = strings.size();
+
+        // write to a temporary file first, such that concurrent readers never see an incomplete index
+        const std::string temporary = index + ".tmp";
+        {
+            std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+            stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            stream.write(reinterpret_cast<const char *>(files.data()), files.size() * sizeof(FileRecord));
+            for (const auto & e : entries)
+            {
+                stream.write(reinterpret_cast<const char *>(&e.second), sizeof(EntryRecord));
+            }
+            stream.write(strings.data(), strings.size());
+
+            if (! stream)
+                throw YAMLIndexError(index, "cannot write '" + temporary + "'");
+        }
+
+        if (0 != std::rename(temporary.c_str(), index.c_str()))
+            throw YAMLIndexError(index, std::string("cannot create file: ") + std::strerror(errno));
+    }
+
+    YAMLIndex::YAMLIndex(const std::string & directory, const std::string & index) :
+        PrivateImplementationPattern<YAMLIndex>(new Implementation<YAMLIndex>(directory, index))
+    {
+    }
+
+    YAMLIndex::~YAMLIndex()
+    {
+    }
+
+    unsigned
+    YAMLIndex::size() const
+    {
+        return _imp->header->entries;
+    }
+
+    std::string
+    YAMLIndex::name(const unsigned & i) const
+    {
+        return _imp->name(i);
+    }
+
+    std::string
+    YAMLIndex::file(const unsigned & i) const
+    {
+        return _imp->file(i);
+    }
+
+    unsigned
+    YAMLIndex::find(const std::string & name) const
+    {
+        return _imp->find(name);
+    }
+
+    std::string
+    YAMLIndex::entry(const unsigned & i) const
+    {
+        return _imp->entry(i);
+    }
+
+    YAMLIndexError::YAMLIndexError(const std::string & index, const std::string & msg) :
+        Exception("YAML index '" + index + "': " + msg)
+    {
+    }
+}
@@ -0,0 +1,97 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_YAML_INDEX_HH
+#define EOS_GUARD_EOS_UTILS_YAML_INDEX_HH 1
+
+#include <eos/utils/exception.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <string>
+
+namespace eos
+{
+    /*!
+     * YAMLIndex maps the names of the top-level entries of all YAML files in a directory
+     * to their location within these files.
+     *
+     * The index is a binary file, which is created once, e.g. at install time, and which is
+     * memory mapped when used. It allows to parse individual entries on demand, rather than
+     * parsing all files as a whole. The entries are sorted by name.
+     *
+     * An index is rejected if the content of any of the indexed files has changed since the index
+     * was created, or if YAML files have been added to or removed from the directory. The content
+     * is compared by means of its size and hash, such that copying or reinstalling unchanged files
+     * does not invalidate the index.
+     */
+    class YAMLIndex :
+        public PrivateImplementationPattern<YAMLIndex>
+    {
+        public:
+            /*!
+             * Create the index of all YAML files in a directory.
+             *
+             * The top-level entries of each file must form a block mapping. Entries named '@metadata@' are not indexed.
+             *
+             * @param directory The directory of the YAML files.
+             * @param index     The path of the index file.
+             */
+            static void create(const std::string & directory, const std::string & index);
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param directory The directory of the YAML files.
+             * @param index     The path of the index file.
+             */
+            YAMLIndex(const std::string & directory, const std::string & index);
+
+            /// Destructor.
+            ~YAMLIndex();
+            ///@}
+
+            /// Retrieve the number of entries.
+            unsigned size() const;
+
+            /// Retrieve the name of the i-th entry.
+            std::string name(const unsigned & i) const;
+
+            /// Retrieve the path of the file that holds the i-th entry.
+            std::string file(const unsigned & i) const;
+
+            /// Return the position of the entry with the given name, or size() if there is no such entry.
+            unsigned find(const std::string & name) const;
+
+            /// Retrieve the text of the i-th entry, i.e., a YAML map with the entry's name as its only key.
+            std::string entry(const unsigned & i) const;
+    };
+
+    /*!
+     * YAMLIndexError is thrown when a YAML index cannot be created or used.
+     */
+    struct YAMLIndexError :
+        public Exception
+    {
+        YAMLIndexError(const std::string & index, const std::string & msg);
+    };
+}
+
+#endif
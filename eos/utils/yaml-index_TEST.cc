@@ -0,0 +1,125 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/utils/yaml-index.hh>
+
+#include <yaml-cpp/yaml.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <unistd.h>
+
+using namespace test;
+using namespace eos;
+
+class YAMLIndexTest :
+    public TestCase
+{
+    public:
+        YAMLIndexTest() :
+            TestCase("yaml_index_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            char directory[] = "/tmp/eos-yaml-index-XXXXXX";
+            TEST_CHECK(nullptr != ::mkdtemp(directory));
+
+            const std::string first = std::string(directory) + "/first.yaml";
+            const std::string second = std::string(directory) + "/second.yaml";
+            const std::string index = std::string(directory) + "/index";
+
+            std::ofstream(first)
+                << "# comment\n"
+                << "'@metadata@':\n"
+                << "    title: ignored\n"
+                << "B->K::foo:\n"
+                << "    type: Gaussian\n"
+                << "    mean: 1.0\n"
+                << "# }}}\n"
+                << "'A->B::bar':\n"
+                << "    type: Gaussian\n"
+                << "    mean: 2.0\n";
+            std::ofstream(second)
+                << "C->D::baz: {type: Gaussian, mean: 3.0}\n";
+
+            /* Create and use an index */
+            {
+                YAMLIndex::create(directory, index);
+
+                YAMLIndex idx(directory, index);
+                TEST_CHECK_EQUAL(3u, idx.size());
+
+                // entries are sorted by name
+                TEST_CHECK_EQUAL("A->B::bar", idx.name(0));
+                TEST_CHECK_EQUAL("B->K::foo", idx.name(1));
+                TEST_CHECK_EQUAL("C->D::baz", idx.name(2));
+                TEST_CHECK_EQUAL(first,  idx.file(0));
+                TEST_CHECK_EQUAL(second, idx.file(2));
+
+                TEST_CHECK_EQUAL(1u, idx.find("B->K::foo"));
+                TEST_CHECK_EQUAL(3u, idx.find("@metadata@"));
+                TEST_CHECK_EQUAL(3u, idx.find("B->K::fo"));
+                TEST_CHECK_EQUAL(3u, idx.find("Z->Z::unknown"));
+
+                YAML::Node foo = YAML::Load(idx.entry(1));
+                TEST_CHECK_EQUAL(1u, foo.size());
+                TEST_CHECK_EQUAL(1.0, foo["B->K::foo"]["mean"].as<double>());
+                TEST_CHECK_EQUAL(2.0, YAML::Load(idx.entry(0))["A->B::bar"]["mean"].as<double>());
+                TEST_CHECK_EQUAL(3.0, YAML::Load(idx.entry(2))["C->D::baz"]["mean"].as<double>());
+            }
+
+            /* Reject an out-of-date index */
+            {
+                // rewriting a file with unchanged content keeps the index
+                std::ofstream(second) << "C->D::baz: {type: Gaussian, mean: 3.0}\n";
+                TEST_CHECK_EQUAL(3u, YAMLIndex(directory, index).size());
+
+                // changing the content without changing the size does not
+                std::ofstream(second) << "C->D::baz: {type: Gaussian, mean: 5.0}\n";
+                TEST_CHECK_THROWS(YAMLIndexError, YAMLIndex(directory, index));
+
+                std::ofstream(second) << "C->D::baz: {type: Gaussian, mean: 3.0}\n";
+                std::ofstream(second, std::ios::app) << "E->F::qux: {type: Gaussian, mean: 4.0}\n";
+                TEST_CHECK_THROWS(YAMLIndexError, YAMLIndex(directory, index));
+
+                YAMLIndex::create(directory, index);
+                TEST_CHECK_EQUAL(4u, YAMLIndex(directory, index).size());
+
+                const std::string third = std::string(directory) + "/third.yaml";
+                std::ofstream(third) << "G->H::quux: {}\n";
+                TEST_CHECK_THROWS(YAMLIndexError, YAMLIndex(directory, index));
+
+                // duplicate entries are rejected
+                std::ofstream(third) << "C->D::baz: {}\n";
+                TEST_CHECK_THROWS(YAMLIndexError, YAMLIndex::create(directory, index));
+
+                std::remove(third.c_str());
+            }
+
+            std::remove(first.c_str());
+            std::remove(second.c_str());
+            std::remove(index.c_str());
+            ::rmdir(directory);
+        }
+} yaml_index_test;
@@ -27,19 +27,28 @@
 #include "eos/utils/kinematic.hh"
 #include "eos/utils/model.hh"
 #include "eos/utils/parameters.hh"
+#include "eos/utils/memoise.hh"
 #include "eos/utils/options.hh"
+#include "eos/utils/profiler.hh"
 #include "eos/utils/qualified-name.hh"
 #include "eos/utils/reference-name.hh"
+#include "eos/utils/thread_pool.hh"
 #include "eos/utils/units.hh"
 #include "eos/statistics/goodness-of-fit.hh"
 #include "eos/statistics/log-likelihood.hh"
 #include "eos/statistics/log-posterior.hh"
 #include "eos/statistics/log-prior.hh"
+#include "eos/statistics/markov-chain-sampler.hh"
+#include "eos/statistics/nested-sampler.hh"
+#include "eos/statistics/population-monte-carlo-sampler.hh"
+#include "eos/statistics/prediction-engine.hh"
 #include "eos/statistics/test-statistic-impl.hh"
 
 #include <boost/python.hpp>
 #include <boost/python/raw_function.hpp>
 
+#include <algorithm>
+
 using namespace boost::python;
 using namespace eos;
 
@@ -126,6 +135,409 @@ namespace impl
     {
         PyErr_SetString(PyExc_RuntimeError, e.what());
     }
+
+    // releases the global interpreter lock for the lifetime of the object
+    struct ScopedGILRelease
+    {
+        PyThreadState * state;
+
+        ScopedGILRelease() :
+            state(PyEval_SaveThread())
+        {
+        }
+
+        ~ScopedGILRelease()
+        {
+            PyEval_RestoreThread(state);
+        }
+    };
+
+    // provides access to the memory of a C-contiguous buffer of doubles, e.g. a numpy array
+    struct DoubleBuffer
+    {
+        Py_buffer buffer;
+
+        DoubleBuffer(object obj, int flags)
+        {
+            if (0 != PyObject_GetBuffer(obj.ptr(), &buffer, flags | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+                throw_error_already_set();
+
+            const std::string format(buffer.format ? buffer.format : "B");
+            if ((sizeof(double) != buffer.itemsize) || ('d' != format.back()))
+            {
+                PyBuffer_Release(&buffer);
+                PyErr_SetString(PyExc_TypeError, "expected a buffer of type float64");
+                throw_error_already_set();
+            }
+
+            if (! native_byte_order(format))
+            {
+                PyBuffer_Release(&buffer);
+                PyErr_SetString(PyExc_TypeError, "expected a buffer of float64 in native byte order");
+                throw_error_already_set();
+            }
+        }
+
+        // the struct format of a double, optionally prefixed by a byte order
+        static bool native_byte_order(const std::string & format)
+        {
+            if (1 == format.size())
+                return true;
+
+            if (2 != format.size())
+                return false;
+
+            static const uint16_t probe = 1;
+            static const char native = (1 == *reinterpret_cast<const char *>(&probe)) ? '<' : '>';
+
+            return ('@' == format[0]) || ('=' == format[0]) || (native == format[0]);
+        }
+
+        ~DoubleBuffer()
+        {
+            PyBuffer_Release(&buffer);
+        }
+
+        double * data()
+        {
+            return static_cast<double *>(buffer.buf);
+        }
+    };
+
+    // evaluates the log(posterior) for an N x d array of parameter points without copying the input
+    object
+    LogPosterior_evaluate_batch(const LogPosterior & log_posterior, object points)
+    {
+        DoubleBuffer input(points, PyBUF_SIMPLE);
+
+        if (2 != input.buffer.ndim)
+        {
+            PyErr_SetString(PyExc_ValueError, "expected a two-dimensional array of parameter points");
+            throw_error_already_set();
+        }
+
+        const unsigned n   = input.buffer.shape[0];
+        const unsigned dim = input.buffer.shape[1];
+
+        object results = import("numpy").attr("empty")(n, "float64");
+        DoubleBuffer output(results, PyBUF_WRITABLE);
+
+        {
+            ScopedGILRelease release;
+            log_posterior.evaluate_batch(input.data(), n, dim, output.data());
+        }
+
+        return results;
+    }
+
+    // copies a row-major array of doubles into a new numpy array of shape (rows, columns)
+    object
+    to_numpy(const std::vector<double> & data, const unsigned & rows, const unsigned & columns)
+    {
+        object result = import("numpy").attr("empty")(make_tuple(rows, columns), "float64");
+        DoubleBuffer buffer(result, PyBUF_WRITABLE);
+        std::copy(data.cbegin(), data.cend(), buffer.data());
+
+        return result;
+    }
+
+    // copies an array of doubles into a new one-dimensional numpy array
+    object
+    to_numpy(const std::vector<double> & data)
+    {
+        object result = import("numpy").attr("empty")(data.size(), "float64");
+        DoubleBuffer buffer(result, PyBUF_WRITABLE);
+        std::copy(data.cbegin(), data.cend(), buffer.data());
+
+        return result;
+    }
+
+    // returns the gradient of the log(posterior) at a one-dimensional array of parameter values
+    object
+    LogPosterior_gradient(const LogPosterior & log_posterior, object point, const double & relative_step)
+    {
+        DoubleBuffer input(point, PyBUF_SIMPLE);
+
+        if (1 != input.buffer.ndim)
+        {
+            PyErr_SetString(PyExc_ValueError, "expected a one-dimensional array of parameter values");
+            throw_error_already_set();
+        }
+
+        const unsigned dim = input.buffer.shape[0];
+        std::vector<double> result(dim);
+
+        {
+            ScopedGILRelease release;
+            log_posterior.gradient(input.data(), dim, result.data(), relative_step);
+        }
+
+        return to_numpy(result);
+    }
+
+    // returns the Hessian matrix of the log(posterior) at a one-dimensional array of parameter values
+    object
+    LogPosterior_hessian(const LogPosterior & log_posterior, object point, const double & relative_step)
+    {
+        DoubleBuffer input(point, PyBUF_SIMPLE);
+
+        if (1 != input.buffer.ndim)
+        {
+            PyErr_SetString(PyExc_ValueError, "expected a one-dimensional array of parameter values");
+            throw_error_already_set();
+        }
+
+        const unsigned dim = input.buffer.shape[0];
+        std::vector<double> result(dim * dim);
+
+        {
+            ScopedGILRelease release;
+            log_posterior.hessian(input.data(), dim, result.data(), relative_step);
+        }
+
+        return to_numpy(result, dim, dim);
+    }
+
+    // constructor for class MarkovChainSampler
+    MarkovChainSampler *
+    MarkovChainSampler_ctor(const LogPosterior & log_posterior, unsigned chains, unsigned prerun_samples, unsigned preruns,
+            unsigned samples, unsigned stride, double initial_scale, unsigned long seed, std::string output, bool delayed_acceptance)
+    {
+        auto config = MarkovChainSampler::Config::Default();
+        if (chains > 0)
+            config.number_of_chains = chains;
+        config.prerun_samples = prerun_samples;
+        config.preruns = preruns;
+        config.samples = samples;
+        config.stride = stride;
+        config.initial_scale = initial_scale;
+        config.seed = seed;
+        config.output = output;
+        config.delayed_acceptance = delayed_acceptance;
+
+        return new MarkovChainSampler(log_posterior.clone(), config);
+    }
+
+    void
+    MarkovChainSampler_run(MarkovChainSampler & sampler)
+    {
+        ScopedGILRelease release;
+        sampler.run();
+    }
+
+    object
+    MarkovChainSampler_samples(const MarkovChainSampler & sampler)
+    {
+        return to_numpy(sampler.samples(), sampler.log_densities().size(), sampler.dimension());
+    }
+
+    object
+    MarkovChainSampler_log_densities(const MarkovChainSampler & sampler)
+    {
+        return to_numpy(sampler.log_densities());
+    }
+
+    // constructor for class PopulationMonteCarloSampler
+    PopulationMonteCarloSampler *
+    PopulationMonteCarloSampler_ctor(const LogPosterior & log_posterior, const MarkovChainSampler & mcmc, unsigned groups_per_chain,
+            double degrees_of_freedom, unsigned step_samples, unsigned steps, unsigned final_samples, double perplexity_threshold,
+            unsigned long seed)
+    {
+        auto config = PopulationMonteCarloSampler::Config::Default();
+        config.samples_per_step = step_samples;
+        config.steps = steps;
+        config.final_samples = final_samples;
+        config.perplexity_threshold = perplexity_threshold;
+        config.seed = seed;
+
+        return new PopulationMonteCarloSampler(log_posterior.clone(),
+                PopulationMonteCarloSampler::initial_proposal(mcmc, groups_per_chain, degrees_of_freedom), config);
+    }
+
+    double
+    PopulationMonteCarloSampler_step(PopulationMonteCarloSampler & sampler)
+    {
+        ScopedGILRelease release;
+        return sampler.step();
+    }
+
+    void
+    PopulationMonteCarloSampler_run(PopulationMonteCarloSampler & sampler)
+    {
+        ScopedGILRelease release;
+        sampler.run();
+    }
+
+    object
+    PopulationMonteCarloSampler_samples(const PopulationMonteCarloSampler & sampler)
+    {
+        return to_numpy(sampler.samples(), sampler.log_weights().size(), sampler.dimension());
+    }
+
+    object
+    PopulationMonteCarloSampler_log_weights(const PopulationMonteCarloSampler & sampler)
+    {
+        return to_numpy(sampler.log_weights());
+    }
+
+    // constructor for class NestedSampler
+    NestedSampler *
+    NestedSampler_ctor(const LogPosterior & log_posterior, unsigned live_points, unsigned batch_size, const std::string & proposal,
+            double enlargement, unsigned slice_steps, unsigned maximal_attempts, double tolerance, unsigned long seed)
+    {
+        auto config = NestedSampler::Config::Default();
+        config.live_points = live_points;
+        config.batch_size = batch_size;
+        if ("ellipsoid" == proposal)
+            config.proposal = NestedSampler::Config::Proposal::ellipsoid;
+        else if ("slice" == proposal)
+            config.proposal = NestedSampler::Config::Proposal::slice;
+        else
+            throw InternalError("NestedSampler: unknown proposal '" + proposal + "'");
+        config.enlargement = enlargement;
+        config.slice_steps = slice_steps;
+        config.maximal_attempts = maximal_attempts;
+        config.tolerance = tolerance;
+        config.seed = seed;
+
+        return new NestedSampler(log_posterior, config);
+    }
+
+    void
+    NestedSampler_run(NestedSampler & sampler)
+    {
+        ScopedGILRelease release;
+        sampler.run();
+    }
+
+    object
+    NestedSampler_samples(const NestedSampler & sampler)
+    {
+        return to_numpy(sampler.samples(), sampler.log_weights().size(), sampler.dimension());
+    }
+
+    object
+    NestedSampler_log_likelihoods(const NestedSampler & sampler)
+    {
+        return to_numpy(sampler.log_likelihoods());
+    }
+
+    object
+    NestedSampler_log_weights(const NestedSampler & sampler)
+    {
+        return to_numpy(sampler.log_weights());
+    }
+
+    list
+    Profiler_records(const Profiler & profiler)
+    {
+        list result;
+        for (const auto & r : profiler.records())
+        {
+            dict record;
+            record["category"]     = r.category;
+            record["name"]         = r.name;
+            record["calls"]        = r.calls;
+            record["nans"]         = r.nans;
+            record["total_time"]   = r.total_time;
+            record["maximal_time"] = r.maximal_time;
+            result.append(record);
+        }
+
+        return result;
+    }
+
+    void
+    Profiler_reset(Profiler & profiler)
+    {
+        profiler.reset();
+        ThreadPool::instance()->reset_statistics();
+    }
+
+    std::string
+    Profiler_trace(Profiler & profiler, const LogPosterior & log_posterior)
+    {
+        // discard the cached predictions, such that all observables are evaluated within the timeline
+        log_posterior.log_likelihood().observable_cache().invalidate();
+
+        return profiler.trace(log_posterior);
+    }
+
+    dict
+    Profiler_memoisation(const Profiler &)
+    {
+        const auto statistics = MemoisationControl::instance()->statistics();
+        const unsigned long lookups = statistics.hits + statistics.misses;
+
+        dict result;
+        result["hits"]      = statistics.hits;
+        result["misses"]    = statistics.misses;
+        result["evictions"] = statistics.evictions;
+        result["hit_rate"]  = (0 == lookups) ? 0.0 : double(statistics.hits) / lookups;
+
+        return result;
+    }
+
+    dict
+    Profiler_thread_pool(const Profiler &)
+    {
+        const auto statistics = ThreadPool::instance()->statistics();
+
+        dict result;
+        result["threads"]             = ThreadPool::instance()->number_of_threads();
+        result["chunks"]              = statistics.chunks;
+        result["queue_depth"]         = statistics.queue_depth;
+        result["maximal_queue_depth"] = statistics.maximal_queue_depth;
+        result["busy_time"]           = statistics.busy_time;
+        result["idle_time"]           = statistics.idle_time;
+
+        return result;
+    }
+
+    // constructor for class PredictionEngine
+    PredictionEngine *
+    PredictionEngine_ctor(list parameters, list observables, unsigned number_of_threads)
+    {
+        std::vector<QualifiedName> parameter_names;
+        for (unsigned i = 0, i_end = len(parameters) ; i < i_end ; ++i)
+        {
+            parameter_names.push_back(QualifiedName(extract<std::string>(parameters[i])));
+        }
+
+        std::vector<ObservablePtr> observable_ptrs;
+        for (unsigned i = 0, i_end = len(observables) ; i < i_end ; ++i)
+        {
+            observable_ptrs.push_back(extract<ObservablePtr>(observables[i]));
+        }
+
+        return new PredictionEngine(parameter_names, observable_ptrs, number_of_threads);
+    }
+
+    // predicts the observables for an N x d array of parameter points without copying the input
+    object
+    PredictionEngine_predict(const PredictionEngine & engine, object points)
+    {
+        DoubleBuffer input(points, PyBUF_SIMPLE);
+
+        if (2 != input.buffer.ndim)
+        {
+            PyErr_SetString(PyExc_ValueError, "expected a two-dimensional array of parameter points");
+            throw_error_already_set();
+        }
+
+        const unsigned n   = input.buffer.shape[0];
+        const unsigned dim = input.buffer.shape[1];
+
+        object results = import("numpy").attr("empty")(make_tuple(n, engine.number_of_observables()), "float64");
+        DoubleBuffer output(results, PyBUF_WRITABLE);
+
+        {
+            ScopedGILRelease release;
+            engine.predict(input.data(), n, dim, output.data());
+        }
+
+        return results;
+    }
 }
 
 BOOST_PYTHON_MODULE(_eos)
@@ -374,6 +786,50 @@ BOOST_PYTHON_MODULE(_eos)
         ;
     implicitly_convertible<std::string, ReferenceName>();
 
+    // Profiler
+    class_<Profiler, boost::noncopyable>("Profiler", R"(
+            Accumulates the wall time, the number of calls and the number of NaN results for the evaluation
+            of each observable and each likelihood block, and records timelines of individual evaluations.
+
+            Profiling is disabled by default. Use :meth:`eos.Profiler.instance` to access the profiler.
+        )", no_init)
+        .def("instance", &Profiler::instance, return_value_policy<reference_existing_object>(), R"(
+            Returns the profiler.
+        )")
+        .staticmethod("instance")
+        .def("enable", &Profiler::enable, R"(
+            Enables profiling.
+        )")
+        .def("disable", &Profiler::disable, R"(
+            Disables profiling.
+        )")
+        .def("enabled", &Profiler::enabled, R"(
+            Returns whether profiling is enabled.
+        )")
+        .def("reset", &impl::Profiler_reset, R"(
+            Resets all records, as well as the statistics of EOS' thread pool.
+        )")
+        .def("records", &impl::Profiler_records, R"(
+            Returns the records of all profiled sections as a list of dictionaries with the keys
+            'category', 'name', 'calls', 'nans', 'total_time' and 'maximal_time', ordered by decreasing total time.
+            Times are given in seconds.
+        )")
+        .def("trace", &impl::Profiler_trace, R"(
+            Evaluates a log(posterior) once at its current parameter point, and returns the timeline of the evaluation
+            as a JSON document in the Chrome trace event format. All observables are re-evaluated, regardless of any cached predictions. The document can be viewed with chrome://tracing or Perfetto.
+
+            :param log_posterior: The log(posterior) to be evaluated.
+            :type log_posterior: eos.LogPosterior
+        )", (arg("self"), arg("log_posterior")))
+        .def("memoisation", &impl::Profiler_memoisation, R"(
+            Returns the accumulated counters of all memoisers as a dictionary with the keys 'hits', 'misses', 'evictions' and 'hit_rate'.
+        )")
+        .def("thread_pool", &impl::Profiler_thread_pool, R"(
+            Returns the utilisation of EOS' thread pool as a dictionary with the keys 'threads', 'chunks', 'queue_depth',
+            'maximal_queue_depth', 'busy_time' and 'idle_time'. Times are given in seconds.
+        )")
+        ;
+
     // }}}
 
     // {{{ eos/statistics
@@ -501,6 +957,225 @@ BOOST_PYTHON_MODULE(_eos)
         .def("log_likelihood", &LogPosterior::log_likelihood)
         .def("log_priors", range(&LogPosterior::begin_priors, &LogPosterior::end_priors))
         .def("evaluate", &LogPosterior::evaluate)
+        .def("evaluate_batch", &impl::LogPosterior_evaluate_batch, R"(
+            Returns the log(posterior) for each of the N rows of a two-dimensional numpy array of shape (N, d).
+
+            The columns of the array must follow the order of the varied parameters, i.e., the order in
+            which the priors have been added. The array must be C-contiguous and of type float64; it is
+            accessed without copying. The points are evaluated in parallel on independent clones of
+            the log(posterior), while the Python interpreter lock is released. Points for which the
+            evaluation fails yield -inf.
+
+            :param points: The parameter points.
+            :type points: numpy.ndarray
+        )", args("self", "points"))
+        .def("gradient", &impl::LogPosterior_gradient, R"(
+            Returns the gradient of the log(posterior) at a parameter point as a one-dimensional numpy array.
+
+            The derivatives are computed by central finite differences, in parallel on independent clones
+            of the log(posterior), while the Python interpreter lock is released. Each derivative only
+            re-evaluates those priors and constraints that depend on the respective parameter.
+            Derivatives for which the evaluation fails yield NaN.
+
+            :param point: The parameter values, in the order of the varied parameters. Must be C-contiguous and of type float64.
+            :type point: numpy.ndarray
+            :param relative_step: The step size relative to each parameter's range.
+            :type relative_step: float, optional
+        )", (arg("self"), arg("point"), arg("relative_step") = 1.0e-5))
+        .def("hessian", &impl::LogPosterior_hessian, R"(
+            Returns the Hessian matrix of the log(posterior) at a parameter point as a two-dimensional numpy array.
+
+            The second derivatives are computed by finite differences, in the same way as for :meth:`gradient`.
+            Mixed derivatives with respect to parameters that do not enter any common prior or constraint vanish
+            identically and are not evaluated.
+
+            :param point: The parameter values, in the order of the varied parameters. Must be C-contiguous and of type float64.
+            :type point: numpy.ndarray
+            :param relative_step: The step size relative to each parameter's range.
+            :type relative_step: float, optional
+        )", (arg("self"), arg("point"), arg("relative_step") = 1.0e-4))
+        ;
+
+    // MarkovChainSampler
+    class_<MarkovChainSampler, boost::noncopyable>("MarkovChainSampler", R"(
+            Draws samples from a log(posterior) using several adaptive Metropolis-Hastings chains.
+
+            The chains run in parallel within EOS, each on an independent clone of the log(posterior).
+            The Python interpreter lock is released while sampling.
+
+            :param log_posterior: The log(posterior) from which samples are drawn.
+            :type log_posterior: eos.LogPosterior
+            :param chains: Number of chains. Defaults to the number of threads of EOS' thread pool if set to 0.
+            :type chains: int, optional
+            :param prerun_samples: Number of samples per chain in each prerun.
+            :type prerun_samples: int, optional
+            :param preruns: Number of preruns, each followed by an adaptation of the proposal.
+            :type preruns: int, optional
+            :param samples: Number of samples per chain that are retained from the main run.
+            :type samples: int, optional
+            :param stride: Number of iterations per retained sample.
+            :type stride: int, optional
+            :param initial_scale: Scale of the initial proposal covariance, relative to the variance of a flat distribution on each parameter's range.
+            :type initial_scale: float, optional
+            :param seed: Seed of the random number generator of the first chain.
+            :type seed: int, optional
+            :param output: Name of a sample store, to which the samples of the main run and their log(posterior) are
+                appended while they are obtained. See :class:`eos.data.SampleStore`.
+            :type output: str, optional
+            :param delayed_acceptance: Draw the acceptance threshold before evaluating a proposal, and stop evaluating the
+                constraints as soon as the proposal is certain to be rejected. Evaluates the observables of each constraint separately.
+            :type delayed_acceptance: bool, optional
+        )", no_init)
+        .def("__init__", make_constructor(&impl::MarkovChainSampler_ctor, default_call_policies(),
+                (arg("log_posterior"), arg("chains") = 0, arg("prerun_samples") = 500, arg("preruns") = 3,
+                 arg("samples") = 1000, arg("stride") = 5, arg("initial_scale") = 0.1, arg("seed") = 1, arg("output") = "",
+                 arg("delayed_acceptance") = false)))
+        .def("run", &impl::MarkovChainSampler_run, R"(
+            Carries out the preruns, followed by the main run.
+        )")
+        .def("samples", &impl::MarkovChainSampler_samples, R"(
+            Returns the samples of the main run as an array of shape (chains * samples, d).
+        )")
+        .def("log_densities", &impl::MarkovChainSampler_log_densities, R"(
+            Returns the log(posterior) for each sample of the main run.
+        )")
+        .def("acceptance_rate", &MarkovChainSampler::acceptance_rate, R"(
+            Returns the acceptance rate of the main run, averaged over all chains.
+        )")
+        ;
+
+    // PopulationMonteCarloSampler
+    class_<PopulationMonteCarloSampler, boost::noncopyable>("PopulationMonteCarloSampler", R"(
+            Draws weighted samples from a log(posterior) using adaptive importance sampling.
+
+            The initial proposal is a mixture density formed from groups of samples of a previous
+            run of an eos.MarkovChainSampler. The target density is evaluated in parallel within EOS,
+            while the Python interpreter lock is released.
+
+            :param log_posterior: The log(posterior) from which samples are drawn.
+            :type log_posterior: eos.LogPosterior
+            :param mcmc: A Markov chain sampler after its run.
+            :type mcmc: eos.MarkovChainSampler
+            :param groups_per_chain: Number of mixture components formed from the samples of each chain.
+            :type groups_per_chain: int, optional
+            :param degrees_of_freedom: Degrees of freedom of the Student-t components; infinity yields Gaussian components.
+            :type degrees_of_freedom: float, optional
+            :param step_samples: Number of samples in each adaptation step.
+            :type step_samples: int, optional
+            :param steps: Maximal number of adaptation steps.
+            :type steps: int, optional
+            :param final_samples: Number of samples drawn after all adaptation steps.
+            :type final_samples: int, optional
+            :param perplexity_threshold: Adaptation stops once the perplexity of a step exceeds this threshold.
+            :type perplexity_threshold: float, optional
+            :param seed: Seed of the random number generator.
+            :type seed: int, optional
+        )", no_init)
+        .def("__init__", make_constructor(&impl::PopulationMonteCarloSampler_ctor, default_call_policies(),
+                (arg("log_posterior"), arg("mcmc"), arg("groups_per_chain") = 4, arg("degrees_of_freedom") = std::numeric_limits<double>::infinity(),
+                 arg("step_samples") = 1000, arg("steps") = 10, arg("final_samples") = 5000, arg("perplexity_threshold") = 1.0, arg("seed") = 1)))
+        .def("step", &impl::PopulationMonteCarloSampler_step, R"(
+            Carries out a single adaptation step, and returns the perplexity of its samples.
+        )")
+        .def("run", &impl::PopulationMonteCarloSampler_run, R"(
+            Carries out adaptation steps until the perplexity threshold is reached, then draws the final samples.
+        )")
+        .def("samples", &impl::PopulationMonteCarloSampler_samples, R"(
+            Returns the most recent samples as an array of shape (N, d).
+        )")
+        .def("log_weights", &impl::PopulationMonteCarloSampler_log_weights, R"(
+            Returns the logarithmic importance weights of the most recent samples.
+        )")
+        ;
+
+    // NestedSampler
+    class_<NestedSampler, boost::noncopyable>("NestedSampler", R"(
+            Computes the evidence of a log(posterior) by means of nested sampling, and yields weighted posterior samples.
+
+            Live points are drawn in the unit hypercube and mapped onto the parameters through the inverse
+            cumulative distribution functions of the priors. The live points with the lowest likelihoods are
+            replaced in batches, in parallel within EOS, while the Python interpreter lock is released.
+
+            :param log_posterior: The log(posterior) whose evidence is computed. All of its priors must be one-dimensional.
+            :type log_posterior: eos.LogPosterior
+            :param live_points: Number of live points.
+            :type live_points: int, optional
+            :param batch_size: Number of live points replaced in parallel. The results depend on the batch size, but not on the number of threads of EOS' thread pool.
+            :type batch_size: int, optional
+            :param proposal: Either 'ellipsoid' for rejection sampling from the bounding ellipsoid of the live points, or 'slice' for slice sampling.
+            :type proposal: str, optional
+            :param enlargement: Factor by which the bounding ellipsoid is enlarged in each direction.
+            :type enlargement: float, optional
+            :param slice_steps: Number of slice sampling steps per new live point.
+            :type slice_steps: int, optional
+            :param maximal_attempts: Largest number of candidates per new live point.
+            :type maximal_attempts: int, optional
+            :param tolerance: Sampling stops once the estimated contribution of the live points to the log(evidence) falls below this value.
+            :type tolerance: float, optional
+            :param seed: Seed of the random number generator of the first point of each batch.
+            :type seed: int, optional
+        )", no_init)
+        .def("__init__", make_constructor(&impl::NestedSampler_ctor, default_call_policies(),
+                (arg("log_posterior"), arg("live_points") = 500, arg("batch_size") = 8, arg("proposal") = "ellipsoid", arg("enlargement") = 1.25,
+                 arg("slice_steps") = 5, arg("maximal_attempts") = 100000, arg("tolerance") = 0.01, arg("seed") = 1)))
+        .def("run", &impl::NestedSampler_run, R"(
+            Replaces live points until the termination criterion is met.
+        )")
+        .def("log_evidence", &NestedSampler::log_evidence, R"(
+            Returns the natural logarithm of the evidence.
+        )")
+        .def("log_evidence_error", &NestedSampler::log_evidence_error, R"(
+            Returns the estimate of the statistical uncertainty of the log(evidence).
+        )")
+        .def("information", &NestedSampler::information, R"(
+            Returns the Kullback-Leibler divergence of the posterior from the prior.
+        )")
+        .def("evaluations", &NestedSampler::evaluations, R"(
+            Returns the number of evaluations of the log(likelihood).
+        )")
+        .def("samples", &impl::NestedSampler_samples, R"(
+            Returns all discarded and final live points as an array of shape (N, d), ordered by increasing likelihood.
+        )")
+        .def("log_likelihoods", &impl::NestedSampler_log_likelihoods, R"(
+            Returns the log(likelihood) for each sample.
+        )")
+        .def("log_weights", &impl::NestedSampler_log_weights, R"(
+            Returns the normalized logarithmic posterior weights of each sample.
+        )")
+        ;
+
+    // PredictionEngine
+    class_<PredictionEngine, boost::noncopyable>("PredictionEngine", R"(
+            Predicts a set of observables for many parameter points, e.g. for the samples of a posterior.
+
+            The parameter points are distributed across the threads of EOS, while the Python interpreter
+            lock is released. Each thread works on an independent clone of the observables. Predictions
+            for which the evaluation fails yield NaN.
+
+            :param parameters: The names of the parameters, in the order of the columns of the parameter points.
+            :type parameters: list of str
+            :param observables: The observables to be predicted. They must share one common set of parameters.
+            :type observables: list of eos.Observable
+            :param threads: Largest number of threads used for the predictions; 0 uses all threads of EOS.
+            :type threads: int, optional
+        )", no_init)
+        .def("__init__", make_constructor(&impl::PredictionEngine_ctor, default_call_policies(),
+                (arg("parameters"), arg("observables"), arg("threads") = 0)))
+        .def("predict", &impl::PredictionEngine_predict, R"(
+            Predicts the observables for an array of parameter points of shape (N, d).
+
+            :param points: The parameter points, as a C-contiguous array of type float64.
+            :type points: numpy.ndarray
+
+            :return: The predictions, as an array of shape (N, number of observables).
+            :rtype: numpy.ndarray
+        )", args("self", "points"))
+        .def("number_of_parameters", &PredictionEngine::number_of_parameters, R"(
+            Returns the number of parameters per point.
+        )")
+        .def("number_of_observables", &PredictionEngine::number_of_observables, R"(
+            Returns the number of observables.
+        )")
         ;
 
     // test_statistics::ChiSquare
@@ -213,7 +213,7 @@ class Analysis:
         return eos.GoodnessOfFit(self.log_posterior)
 
 
-    def optimize(self, start_point=None, rng=np.random.mtrand, **kwargs):
+    def optimize(self, start_point=None, rng=np.random.mtrand, use_gradient=False, **kwargs):
         """
         Optimize the log(posterior) and returns a best-fit-point summary.
 
@@ -222,6 +222,8 @@ class Analysis:
                             If not specified, optimization starts at the current parameter point.
         :param start_point: iterable, optional
         :param rng: Optional random number generator
+        :param use_gradient: If true, the optimizer uses the gradient of the log(posterior) obtained from finite differences within EOS, unless 'jac' is provided explicitly.
+        :type use_gradient: bool, optional
 
         """
         if start_point == None:
@@ -229,9 +231,8 @@ class Analysis:
         elif start_point == "random":
             start_point = [p.inverse_cdf(rng.uniform()) for p in self.log_posterior.log_priors()]
 
-        default_kwargs = { 'method': 'SLSQP', 'options': { 'ftol': 1.0e-13 } }
-        if kwargs is None:
-            kwargs = default_kwargs
+        if use_gradient and 'jac' not in kwargs:
+            kwargs['jac'] = self.negative_log_pdf_gradient
 
         res = scipy.optimize.minimize(
             self.negative_log_pdf,
@@ -275,6 +276,24 @@ class Analysis:
             return(-np.inf)
 
 
+    def log_pdf_batch(self, xs):
+        """
+        Evaluates the log(posterior) for many parameter points at once, e.g. for use with population-based samplers.
+
+        The evaluation is carried out in parallel within EOS, without setting the parameters of this analysis.
+
+        :param xs: Parameter points as array of shape (N, d), with the elements of each row in the same order as in eos.Analysis.varied_parameters, rescaled so that every element is in the interval [-1, +1].
+        :type xs: numpy.ndarray
+        :return: The log(posterior) values as array of size N.
+        """
+        xs = np.atleast_2d(np.asarray(xs, dtype=np.float64))
+        lower = np.array([b[0] for b in self.bounds])
+        upper = np.array([b[1] for b in self.bounds])
+        pars = np.ascontiguousarray((upper - lower) * xs / 2 + (upper + lower) / 2)
+
+        return self.log_posterior.evaluate_batch(pars)
+
+
     def negative_log_pdf(self, x, *args):
         """
         Adapter for use with external optimization software (e.g. scipy.optimize.minimize) to aid when optimizing the log(posterior).
@@ -287,6 +306,59 @@ class Analysis:
         return -self.log_pdf(x, *args)
 
 
+    def log_pdf_gradient(self, x, *args):
+        """
+        Adapter for use with external optimization or sampling software to aid when using the gradient of the log(posterior).
+
+        The gradient is computed by finite differences in parallel within EOS, without setting the parameters of this analysis.
+
+        :param x: Parameter point, with the elements in the same order as in eos.Analysis.varied_parameters, rescaled so that every element is in the interval [-1, +1].
+        :type x: iterable
+        :param args: Dummy parameter (ignored)
+        :type args: optional
+        :return: The gradient with respect to the rescaled parameters as array of size d.
+        """
+        lower = np.array([b[0] for b in self.bounds])
+        upper = np.array([b[1] for b in self.bounds])
+        pars = np.ascontiguousarray(self._x_to_par(x), dtype=np.float64)
+
+        return self.log_posterior.gradient(pars) * (upper - lower) / 2
+
+
+    def negative_log_pdf_gradient(self, x, *args):
+        """
+        Adapter for use with external optimization software (e.g. as the 'jac' argument of scipy.optimize.minimize) to aid when optimizing the log(posterior).
+
+        Non-finite components, e.g. in regions where the log(posterior) is -inf, are replaced by zero.
+
+        :param x: Parameter point, with the elements in the same order as in eos.Analysis.varied_parameters, rescaled so that every element is in the interval [-1, +1].
+        :type x: iterable
+        :param args: Dummy parameter (ignored)
+        :type args: optional
+        """
+        gradient = -self.log_pdf_gradient(x, *args)
+
+        return np.where(np.isfinite(gradient), gradient, 0.0)
+
+
+    def log_pdf_hessian(self, x, *args):
+        """
+        Adapter for use with external optimization or sampling software to aid when using the Hessian matrix of the log(posterior).
+
+        :param x: Parameter point, with the elements in the same order as in eos.Analysis.varied_parameters, rescaled so that every element is in the interval [-1, +1].
+        :type x: iterable
+        :param args: Dummy parameter (ignored)
+        :type args: optional
+        :return: The Hessian matrix with respect to the rescaled parameters as array of shape (d, d).
+        """
+        lower = np.array([b[0] for b in self.bounds])
+        upper = np.array([b[1] for b in self.bounds])
+        pars = np.ascontiguousarray(self._x_to_par(x), dtype=np.float64)
+        scale = (upper - lower) / 2
+
+        return self.log_posterior.hessian(pars) * np.outer(scale, scale)
+
+
     def sample(self, N=1000, stride=5, pre_N=150, preruns=3, cov_scale=0.1, observables=None, start_point=None, rng=np.random.mtrand):
         """
         Return samples of the parameters, log(weights), and optionally posterior-predictive samples for a sequence of observables.
@@ -373,6 +445,90 @@ class Analysis:
             return(parameter_samples, weights, np.array(observable_samples))
 
 
+    def sample_native(self, N=1000, stride=5, pre_N=500, preruns=3, cov_scale=0.1, chains=0, seed=1, delayed_acceptance=False):
+        """
+        Return samples of the parameters and the log(posterior), using EOS' native adaptive Markov chain sampler.
+
+        In contrast to eos.Analysis.sample, all chains run in parallel within EOS, without calling back into Python.
+
+        :param N: Number of samples per chain that shall be returned.
+        :param stride: Stride, i.e., the number by which the actual amount of samples shall be thinned to return N samples.
+        :param pre_N: Number of samples per chain in each prerun.
+        :param preruns: Number of preruns.
+        :param cov_scale: Scale factor for the initial guess of the covariance matrix.
+        :param chains: Number of chains. If set to 0, one chain per thread of EOS' thread pool is used.
+        :param seed: Seed of the random number generator of the first chain.
+        :param delayed_acceptance: Stop evaluating the constraints as soon as a proposal is certain to be rejected.
+
+        :return: A tuple of the parameters as array of size (chains * N) x d, and the values of the log(posterior) as array of size chains * N.
+        """
+        sampler = eos.MarkovChainSampler(self.log_posterior, chains=chains, prerun_samples=pre_N, preruns=preruns,
+                                         samples=N, stride=stride, initial_scale=cov_scale, seed=seed,
+                                         delayed_acceptance=delayed_acceptance)
+        sampler.run()
+        eos.info('Main run: acceptance rate is {:3.0f}%'.format(sampler.acceptance_rate() * 100))
+
+        return(sampler.samples(), sampler.log_densities())
+
+
+    def sample_pmc_native(self, N=1000, stride=5, pre_N=500, preruns=3, chains=0, groups_per_chain=4, degrees_of_freedom=np.inf,
+                          step_N=1000, steps=10, final_N=5000, final_perplexity_threshold=1.0, seed=1):
+        """
+        Return weighted samples of the parameters, using EOS' native Markov chain and Population Monte Carlo samplers.
+
+        The initial proposal is formed from groups of samples of a native Markov chain run. Both samplers evaluate the
+        log(posterior) in parallel within EOS, without calling back into Python.
+
+        :param N: Number of Markov chain samples per chain.
+        :param stride: Stride of the Markov chains.
+        :param pre_N: Number of samples per chain in each prerun.
+        :param preruns: Number of preruns.
+        :param chains: Number of chains. If set to 0, one chain per thread of EOS' thread pool is used.
+        :param groups_per_chain: Number of mixture components formed from the samples of each chain.
+        :param degrees_of_freedom: Degrees of freedom of the Student-t components; np.inf yields Gaussian components.
+        :param step_N: Number of samples that shall be drawn in each adaptation step.
+        :param steps: Maximal number of adaptation steps.
+        :param final_N: Number of samples that shall be drawn after all adaptation steps.
+        :param final_perplexity_threshold: Adaptations are stopped if the perplexity of the last adaptation step is above this threshold value.
+        :param seed: Seed of the random number generators.
+
+        :return: A tuple of the parameters as array of size final_N x d, and the (linear) weights as array of size final_N.
+        """
+        mcmc = eos.MarkovChainSampler(self.log_posterior, chains=chains, prerun_samples=pre_N, preruns=preruns,
+                                      samples=N, stride=stride, seed=seed)
+        mcmc.run()
+
+        pmc = eos.PopulationMonteCarloSampler(self.log_posterior, mcmc, groups_per_chain=groups_per_chain,
+                                              degrees_of_freedom=degrees_of_freedom, step_samples=step_N, steps=steps,
+                                              final_samples=final_N, perplexity_threshold=final_perplexity_threshold, seed=seed)
+        pmc.run()
+
+        return(pmc.samples(), np.exp(pmc.log_weights()))
+
+
+    def sample_nested(self, live_points=500, batch_size=8, proposal='ellipsoid', tolerance=0.01, seed=1):
+        """
+        Return weighted samples of the parameters and the log(evidence), using EOS' native nested sampler.
+
+        The live points are replaced in parallel within EOS, without calling back into Python.
+
+        :param live_points: Number of live points.
+        :param batch_size: Number of live points that are replaced in parallel. The results depend on the batch size, but not on the number of threads of EOS' thread pool.
+        :param proposal: Either 'ellipsoid' or 'slice'.
+        :param tolerance: Sampling stops once the estimated contribution of the live points to the log(evidence) falls below this value.
+        :param seed: Seed of the random number generators.
+
+        :return: A tuple of the parameters as array of size N x d, the (linear) weights as array of size N, and a tuple of the log(evidence) and its uncertainty.
+        """
+        sampler = eos.NestedSampler(self.log_posterior, live_points=live_points, batch_size=batch_size, proposal=proposal,
+                                    tolerance=tolerance, seed=seed)
+        sampler.run()
+        eos.info('Nested sampling: log(Z) = {:.3f} +/- {:.3f} after {} evaluations'.format(
+            sampler.log_evidence(), sampler.log_evidence_error(), sampler.evaluations()))
+
+        return(sampler.samples(), np.exp(sampler.log_weights()), (sampler.log_evidence(), sampler.log_evidence_error()))
+
+
     def sample_pmc(self, log_proposal, step_N=1000, steps=10, final_N=5000, rng=np.random.mtrand, return_final_only=True, final_perplexity_threshold=1.0):
         """
         Return samples of the parameters and log(weights)
@@ -1,3 +1,4 @@
+import json
 import unittest
 
 from numpy import random
@@ -36,6 +37,9 @@ class ClassMethodTests(unittest.TestCase):
         # Test analysis optimization from a random point
         bfp = analysis.optimize(start_point='random', rng=np.random.mtrand.RandomState(123))
 
+        # Test analysis optimization using the gradient
+        bfp = analysis.optimize(use_gradient=True)
+
         # Test parameter scaling
         point = bfp.point
 
@@ -49,6 +53,49 @@ class ClassMethodTests(unittest.TestCase):
             np.max(analysis._x_to_par(analysis._par_to_x(point)) - point) < 1e-10
             )
 
+        # Test batched evaluation against the evaluation of individual points
+        xs = np.random.mtrand.RandomState(456).uniform(-1.0, +1.0, size=(10, len(analysis.varied_parameters)))
+        batch = analysis.log_pdf_batch(xs)
+        self.assertEqual(batch.shape, (10,))
+        for x, value in zip(xs, batch):
+            self.assertAlmostEqual(analysis.log_pdf(x), value, places=10)
+
+        # Test rejection of non-native byte order
+        pars = np.array([analysis._x_to_par(x) for x in xs])
+        with self.assertRaises(TypeError):
+            analysis.log_posterior.evaluate_batch(pars.astype(pars.dtype.newbyteorder('S')))
+
+        # Test native sampling
+        samples, log_densities = analysis.sample_native(N=100, stride=2, pre_N=100, preruns=1, chains=2)
+        self.assertEqual(samples.shape, (200, len(analysis.varied_parameters)))
+        self.assertEqual(log_densities.shape, (200,))
+        self.assertTrue(np.all(np.isfinite(log_densities)))
+
+        # Test nested sampling
+        samples, weights, (log_evidence, log_evidence_error) = analysis.sample_nested(live_points=50, batch_size=2, tolerance=0.5)
+        self.assertEqual(samples.shape, (len(weights), len(analysis.varied_parameters)))
+        self.assertAlmostEqual(np.sum(weights), 1.0, places=8)
+        self.assertTrue(np.isfinite(log_evidence))
+        self.assertTrue(log_evidence_error > 0.0)
+
+        # Test profiling
+        profiler = eos.Profiler.instance()
+        profiler.reset()
+        profiler.enable()
+        analysis.log_pdf(0.5 * analysis._par_to_x(point))
+        profiler.disable()
+        records = profiler.records()
+        self.assertTrue(any(r['category'] == 'observable' and r['calls'] > 0 for r in records))
+        self.assertTrue(any(r['category'] == 'block' and r['name'] == 'B->D::f_++f_0@HPQCD2015A' for r in records))
+        self.assertTrue(0.0 <= profiler.memoisation()['hit_rate'] <= 1.0)
+        self.assertTrue(profiler.thread_pool()['threads'] > 0)
+
+        trace = json.loads(profiler.trace(analysis.log_posterior))
+        self.assertTrue(any(e['name'] == 'log_posterior' for e in trace['traceEvents']))
+        # the cached predictions are discarded, such that the evaluation of the observables is traced
+        self.assertTrue(any(e['cat'] == 'observable' for e in trace['traceEvents']))
+        self.assertFalse(profiler.enabled())
+
 
     def test_sanitize_manual_input(self):
 
@@ -18,3 +18,4 @@
 
 from .hdf5 import *
 from .pypmc import *
+from .store import SampleStore, SampleStoreWriter, merge_sample_stores
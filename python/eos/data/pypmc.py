@@ -19,6 +19,88 @@ import numpy as _np
 import pypmc
 import yaml
 
+from .store import SampleStore, SampleStoreWriter
+
+def _load_samples(path, name, one_dimensional=False):
+    """ Memory maps the samples stored under a name, falling back to the legacy numpy file format.
+
+    The mapping is copy-on-write, i.e. modifications of the samples are kept in memory and never reach the disk.
+    """
+    store = os.path.join(path, name)
+    if SampleStore.exists(store):
+        samples = SampleStore(store).samples
+        return samples[:, 0] if one_dimensional else samples
+
+    f = os.path.join(path, name + '.npy')
+    if not os.path.exists(f) or not os.path.isfile(f):
+        raise RuntimeError('Samples file {} does not exist or is not a file'.format(f))
+
+    return _np.load(f, mmap_mode='c')
+
+
+def _load_samples_and_weights(path, has_weights=True):
+    """ Memory maps the samples and, optionally, their weights. """
+    samples = _load_samples(path, 'samples')
+    if not has_weights:
+        return samples, None
+
+    # an interrupted append may have committed samples without their weights
+    weights = _load_samples(path, 'weights', one_dimensional=True)
+    n = min(len(samples), len(weights))
+
+    return samples[0:n], weights[0:n]
+
+
+def _migrate_legacy_samples(store):
+    """ Converts samples in the legacy numpy file format into a sample store of the same name.
+
+    The store only becomes visible once it holds all samples, and the numpy file is removed afterwards.
+    An interrupted migration therefore leaves the numpy file in place.
+    """
+    f = store + '.npy'
+    if SampleStore.exists(store) or not os.path.isfile(f):
+        return
+
+    samples = _np.load(f, mmap_mode='r')
+    if samples.ndim == 1:
+        samples = samples.reshape((-1, 1))
+
+    # build the store under a temporary name, discarding the remainders of any interrupted migration
+    temporary = store + '.migrating'
+    for suffix in ['.idx', '.dat']:
+        if os.path.exists(temporary + suffix):
+            os.remove(temporary + suffix)
+
+    with SampleStoreWriter(temporary, samples.shape[1]) as writer:
+        for begin in range(0, len(samples), writer.chunk_size):
+            writer.append(samples[begin:begin + writer.chunk_size])
+
+    # the index file determines if a store exists, and hence is renamed last
+    os.replace(temporary + '.dat', store + '.dat')
+    os.replace(temporary + '.idx', store + '.idx')
+    os.remove(f)
+
+
+def _save_samples(path, name, samples, append=False):
+    """ Writes samples to a sample store, replacing any previous store unless appending.
+
+    When appending to samples in the legacy numpy file format, these are first migrated into a sample store.
+    """
+    store = os.path.join(path, name)
+    if not append:
+        for suffix in ['.idx', '.dat', '.npy']:
+            if os.path.exists(store + suffix):
+                os.remove(store + suffix)
+    else:
+        _migrate_legacy_samples(store)
+
+    samples = _np.asarray(samples, dtype=_np.float64)
+    if samples.ndim == 1:
+        samples = samples.reshape((-1, 1))
+    with SampleStoreWriter(store, samples.shape[1]) as writer:
+        writer.append(samples)
+
+
 class MarkovChain:
     def __init__(self, path):
         """ Read a MarkovChain object from disk.
@@ -42,18 +124,7 @@ class MarkovChain:
         self.type = 'MarkovChain'
         self.varied_parameters = description['parameters']
 
-        f = os.path.join(path, 'samples.npy')
-        if not os.path.exists(f) or not os.path.isfile(f):
-            raise RuntimeError('Samples file {} does not exist or is not a file'.format(f))
-        self.samples = _np.load(f)
-
-        if description['has-weights']:
-            f = os.path.join(path, 'weights.npy')
-            if not os.path.exists(f) or not os.path.isfile(f):
-                raise RuntimeError('Weights file {} does not exist or is not a file'.format(f))
-            self.weights = _np.load(f)
-        else:
-            self.weights = None
+        self.samples, self.weights = _load_samples_and_weights(path, description['has-weights'])
 
 
     @staticmethod 
@@ -88,10 +159,34 @@ class MarkovChain:
         os.makedirs(path, exist_ok=True)
         with open(os.path.join(path, 'description.yaml'), 'w') as description_file:
             yaml.dump(description, description_file, default_flow_style=False)
-        _np.save(os.path.join(path, 'samples.npy'), samples)
+        _save_samples(path, 'samples', samples)
+
+        if not weights is None:
+            _save_samples(path, 'weights', weights)
+
+
+    @staticmethod
+    def append(path, samples, weights=None):
+        """ Append samples to an existing MarkovChain object on disk.
+
+        The samples are committed to disk immediately, such that they persist even if the calling process is interrupted.
+        Samples in the legacy numpy file format are converted into the sample store format beforehand.
+
+        :param path: Path to the storage location of an existing MarkovChain object.
+        :type path: str
+        :param samples: Samples as a 2D array of shape (N, P).
+        :type samples: 2D numpy array
+        :param weights: Weights on a linear scale as a 1D array of shape (N, ). Required if and only if the object has weights.
+        :type weights: 1D numpy array, optional
+        """
+        if not weights is None and not samples.shape[0] == weights.shape[0]:
+            raise RuntimeError('Shape of weights {} incompatible with shape of samples {}'.format(weights.shape, samples.shape))
+
+        # commit the weights last, such that an interruption leaves no weights without samples
+        _save_samples(path, 'samples', samples, append=True)
 
         if not weights is None:
-            _np.save(os.path.join(path, 'weights.npy'), weights)
+            _save_samples(path, 'weights', weights, append=True)
 
 
 class MixtureDensity:
@@ -179,15 +274,7 @@ class PMCSampler:
         self.components = _np.array([pypmc.density.gauss.Gauss(_np.array(c['mu']), _np.array(c['sigma'])) for c in description['proposal']['components']])
         self.weights    = _np.array(description['proposal']['weights'])
 
-        f = os.path.join(path, 'samples.npy')
-        if not os.path.exists(f) or not os.path.isfile(f):
-            raise RuntimeError('Samples file {} does not exist or is not a file'.format(f))
-        self.samples = _np.load(f)
-
-        f = os.path.join(path, 'weights.npy')
-        if not os.path.exists(f) or not os.path.isfile(f):
-            raise RuntimeError('Weights file {} does not exist or is not a file'.format(f))
-        self.weights = _np.load(f)
+        self.samples, self.weights = _load_samples_and_weights(path)
 
 
     @staticmethod 
@@ -227,8 +314,8 @@ class PMCSampler:
         os.makedirs(path, exist_ok=True)
         with open(os.path.join(path, 'description.yaml'), 'w') as description_file:
             yaml.dump(description, description_file, default_flow_style=False)
-        _np.save(os.path.join(path, 'samples.npy'), samples)
-        _np.save(os.path.join(path, 'weights.npy'), weights)
+        _save_samples(path, 'samples', samples)
+        _save_samples(path, 'weights', weights)
 
 
 class Prediction:
@@ -254,15 +341,7 @@ class Prediction:
         self.type = 'Prediction'
         self.varied_parameters = description['observables']
 
-        f = os.path.join(path, 'samples.npy')
-        if not os.path.exists(f) or not os.path.isfile(f):
-            raise RuntimeError('Samples file {} does not exist or is not a file'.format(f))
-        self.samples = _np.load(f)
-
-        f = os.path.join(path, 'weights.npy')
-        if not os.path.exists(f) or not os.path.isfile(f):
-            raise RuntimeError('Weights file {} does not exist or is not a file'.format(f))
-        self.weights = _np.load(f)
+        self.samples, self.weights = _load_samples_and_weights(path)
 
 
     @staticmethod 
@@ -295,5 +374,27 @@ class Prediction:
         os.makedirs(path, exist_ok=True)
         with open(os.path.join(path, 'description.yaml'), 'w') as description_file:
             yaml.dump(description, description_file, default_flow_style=False)
-        _np.save(os.path.join(path, 'samples.npy'), samples)
-        _np.save(os.path.join(path, 'weights.npy'), weights)
+        _save_samples(path, 'samples', samples)
+        _save_samples(path, 'weights', weights)
+
+
+    @staticmethod
+    def append(path, samples, weights):
+        """ Append samples to an existing Prediction object on disk.
+
+        The samples are committed to disk immediately, such that they persist even if the calling process is interrupted.
+        Samples in the legacy numpy file format are converted into the sample store format beforehand.
+
+        :param path: Path to the storage location of an existing Prediction object.
+        :type path: str
+        :param samples: Samples as a 2D array of shape (N, O).
+        :type samples: 2D numpy array
+        :param weights: Weights on a linear scale as a 1D array of shape (N, ).
+        :type weights: 1D numpy array
+        """
+        if not samples.shape[0] == weights.shape[0]:
+            raise RuntimeError('Shape of weights {} incompatible with shape of samples {}'.format(weights.shape, samples.shape))
+
+        # commit the weights last, such that an interruption leaves no weights without samples
+        _save_samples(path, 'samples', samples, append=True)
+        _save_samples(path, 'weights', weights, append=True)
@@ -0,0 +1,209 @@
+# Copyright (c) 2026 agent
+#
+# This file is part of the EOS project. EOS is free software;
+# you can redistribute it and/or modify it under the terms of the GNU General
+# Public License version 2, as published by the Free Software Foundation.
+#
+# EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+# WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+# Place, Suite 330, Boston, MA  02111-1307  USA
+
+import os
+import numpy as _np
+
+# The format is shared with the C++ classes eos::SampleStoreWriter and eos::SampleStoreReader:
+#  - NAME.dat holds the samples as a row-major array of native float64 without any header;
+#  - NAME.idx holds the magic string 'EOSSTORE', the format version and the number of columns
+#    as native uint32, followed by the total number of rows after each committed chunk as native uint64.
+_MAGIC = b'EOSSTORE'
+_VERSION = 1
+_HEADER_SIZE = 16
+
+
+def _read_index(name):
+    with open(name + '.idx', 'rb') as f:
+        header = f.read(_HEADER_SIZE)
+        if len(header) < _HEADER_SIZE or not header[0:8] == _MAGIC:
+            raise RuntimeError('Sample store {} has no valid index'.format(name))
+
+        version, columns = _np.frombuffer(header[8:16], dtype=_np.uint32)
+        if not version == _VERSION:
+            raise RuntimeError('Sample store {} has unsupported format version {}'.format(name, version))
+
+        entries = f.read()
+
+    # ignore an incomplete trailing entry
+    entries = entries[0:len(entries) - len(entries) % 8]
+
+    return int(columns), _np.frombuffer(entries, dtype=_np.uint64).astype(int)
+
+
+class SampleStore:
+    def __init__(self, name):
+        """ Open an append-only sample store for reading.
+
+        The samples are memory mapped, and are only loaded from disk when they are accessed.
+        Only the rows of completely committed chunks are visible. The mapping is copy-on-write:
+        the samples can be modified in memory, but modifications are never written back to the store.
+
+        :param name: Name of the store, i.e. the path of its files without their suffixes.
+        :type name: str
+        """
+        self.name = name
+        self.columns, self.chunk_ends = _read_index(name)
+        rows = self.chunk_ends[-1] if len(self.chunk_ends) > 0 else 0
+
+        if rows == 0:
+            self.samples = _np.empty((0, self.columns))
+        else:
+            if os.path.getsize(name + '.dat') < rows * self.columns * 8:
+                raise RuntimeError('Sample store {} has a data file that is shorter than recorded in its index'.format(name))
+
+            self.samples = _np.memmap(name + '.dat', dtype=_np.float64, mode='c', shape=(rows, self.columns))
+
+
+    @staticmethod
+    def exists(name):
+        """ Returns True if a sample store of the given name exists. """
+        return os.path.isfile(name + '.idx')
+
+
+    def chunks(self):
+        """ Iterates over the committed chunks, yielding one array of rows per chunk. """
+        begin = 0
+        for end in self.chunk_ends:
+            yield self.samples[begin:end]
+            begin = end
+
+
+class SampleStoreWriter:
+    def __init__(self, name, columns, chunk_size=1024):
+        """ Open an append-only sample store for writing, or create a new one.
+
+        Rows are buffered and committed in chunks of the given size. A chunk's data are synchronized
+        to disk before the chunk is recorded in the index, such that an interrupted writer loses at most
+        the rows that are not yet committed. Uncommitted rows of a previous writer are discarded.
+
+        :param name: Name of the store, i.e. the path of its files without their suffixes.
+        :type name: str
+        :param columns: Number of columns per row.
+        :type columns: int
+        :param chunk_size: Number of rows per chunk.
+        :type chunk_size: int, optional
+        """
+        self.name = name
+        self.columns = int(columns)
+        self.chunk_size = max(1, int(chunk_size))
+        self._buffer = []
+        self._buffered = 0
+
+        if SampleStore.exists(name) and os.path.getsize(name + '.idx') >= _HEADER_SIZE:
+            existing_columns, chunk_ends = _read_index(name)
+            if not existing_columns == self.columns:
+                raise RuntimeError('Sample store {} has {} columns, expected {}'.format(name, existing_columns, self.columns))
+            self._rows   = chunk_ends[-1] if len(chunk_ends) > 0 else 0
+            self._chunks = len(chunk_ends)
+        else:
+            with open(name + '.idx', 'wb') as f:
+                f.write(_MAGIC)
+                f.write(_np.array([_VERSION, self.columns], dtype=_np.uint32).tobytes())
+                f.flush()
+                os.fsync(f.fileno())
+            self._rows   = 0
+            self._chunks = 0
+
+        open(name + '.dat', 'ab').close()
+        if os.path.getsize(name + '.dat') < self._rows * self.columns * 8:
+            raise RuntimeError('Sample store {} has a data file that is shorter than recorded in its index'.format(name))
+
+        self._data  = open(name + '.dat', 'rb+')
+        self._index = open(name + '.idx', 'rb+')
+
+        # discard uncommitted rows and incomplete index entries
+        self._data.truncate(self._rows * self.columns * 8)
+        self._index.truncate(_HEADER_SIZE + self._chunks * 8)
+
+
+    def append(self, rows):
+        """ Append one row, or a 2D array of rows. """
+        rows = _np.atleast_2d(_np.asarray(rows, dtype=_np.float64))
+        if not rows.shape[1] == self.columns:
+            raise RuntimeError('Shape of rows {} incompatible with number of columns {}'.format(rows.shape, self.columns))
+
+        while len(rows) > 0:
+            n = min(len(rows), self.chunk_size - self._buffered)
+            self._buffer.append(rows[0:n])
+            self._buffered += n
+            rows = rows[n:]
+
+            if self._buffered >= self.chunk_size:
+                self.flush()
+
+
+    def flush(self):
+        """ Commit all buffered rows as one chunk. """
+        if self._buffered == 0:
+            return
+
+        self._data.seek(self._rows * self.columns * 8)
+        self._data.write(_np.ascontiguousarray(_np.concatenate(self._buffer)).tobytes())
+        self._data.flush()
+        os.fsync(self._data.fileno())
+
+        self._rows += self._buffered
+        self._index.seek(_HEADER_SIZE + self._chunks * 8)
+        self._index.write(_np.array([self._rows], dtype=_np.uint64).tobytes())
+        self._index.flush()
+        os.fsync(self._index.fileno())
+
+        self._chunks += 1
+        self._buffer = []
+        self._buffered = 0
+
+
+    def rows(self):
+        """ Returns the number of rows, including the buffered ones. """
+        return self._rows + self._buffered
+
+
+    def close(self):
+        """ Commit all buffered rows and close the store. """
+        if self._data.closed:
+            return
+
+        self.flush()
+        self._data.close()
+        self._index.close()
+
+
+    def __enter__(self):
+        return self
+
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.close()
+
+
+def merge_sample_stores(name, inputs, chunk_size=1024):
+    """ Merge several sample stores into a new one, chunk by chunk and without loading any input as a whole.
+
+    :param name: Name of the output store.
+    :type name: str
+    :param inputs: Names of the input stores, which must have the same number of columns.
+    :type inputs: list or iterable of str
+    :param chunk_size: Number of rows per chunk of the output store.
+    :type chunk_size: int, optional
+    """
+    stores = [SampleStore(i) for i in inputs]
+    if len(stores) == 0:
+        raise RuntimeError('No input stores provided')
+
+    with SampleStoreWriter(name, stores[0].columns, chunk_size) as writer:
+        for store in stores:
+            for chunk in store.chunks():
+                writer.append(chunk)
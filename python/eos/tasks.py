@@ -148,26 +148,23 @@ def predict_observables(analysis_file, posterior, prediction, base_directory='./
 
     data = eos.data.PMCSampler(os.path.join(base_directory, posterior, 'pmc'))
 
-    try:
-        from tqdm import tqdm
-        progressbar = tqdm
-    except ImportError:
-        progressbar = lambda x: x
-
-    parameters = [_parameters[p['name']] for p in data.varied_parameters]
-    observable_samples = []
-    for i, sample in enumerate(progressbar(data.samples[begin:end])):
-        for p, v in zip(parameters, sample):
-            p.set(v)
-        try:
-            observable_samples.append([o.evaluate() for o in observables])
-        except RuntimeError as e:
-            eos.error('skipping prediction for sample {i} due to runtime error ({e}): {s}'.format(i=i, e=e, s=sample))
-            observable_samples.append([_np.nan for o in observables])
-    observable_samples = _np.array(observable_samples)
+    # predictions are carried out in parallel within EOS; failed predictions yield NaN
+    engine = eos.PredictionEngine([p['name'] for p in data.varied_parameters], list(observables))
 
+    # the samples are memory mapped; predict and commit them in chunks, such that an interrupted run retains its progress
+    samples = data.samples[begin:end]
+    weights = data.weights[begin:end]
     output_path = os.path.join(base_directory, posterior, 'pred-{}'.format(prediction))
-    eos.data.Prediction.create(output_path, observables, observable_samples, data.weights[begin:end])
+    eos.data.Prediction.create(output_path, observables, _np.empty((0, len(observables))), _np.empty((0, )))
+
+    chunk_size = 10000
+    for chunk_begin in range(0, len(samples), chunk_size):
+        chunk_end = min(len(samples), chunk_begin + chunk_size)
+        observable_samples = engine.predict(_np.ascontiguousarray(samples[chunk_begin:chunk_end], dtype=_np.float64))
+        for i in _np.flatnonzero(_np.any(_np.isnan(observable_samples), axis=1)):
+            eos.warn('prediction for sample {i} yields NaN'.format(i=begin + chunk_begin + i))
+
+        eos.data.Prediction.append(output_path, observable_samples, _np.asarray(weights[chunk_begin:chunk_end]))
 
 
 # Run analysis steps
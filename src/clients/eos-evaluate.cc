@@ -2,6 +2,7 @@
 
 /*
  * Copyright (c) 2010, 2011 Danny van Dyk
+ * Copyright (c) 2026 agent
  *
  * This file is part of the EOS project. EOS is free software;
  * you can redistribute it and/or modify it under the terms of the GNU General
@@ -23,9 +24,12 @@
 #include <eos/utils/instantiation_policy-impl.hh>
 #include <eos/utils/log.hh>
 #include <eos/utils/power_of.hh>
+#include <eos/utils/thread_pool.hh>
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <exception>
 #include <iostream>
 #include <vector>
 
@@ -78,11 +82,17 @@ class CommandLine :
 
         int precision;
 
+        unsigned shard_index;
+
+        unsigned number_of_shards;
+
         CommandLine() :
             parameters(Parameters::Defaults()),
             budgets{std::make_tuple(std::string("delta"), std::vector<Parameter>())},
             use_budget(false),
-            precision(-1)
+            precision(-1),
+            shard_index(0),
+            number_of_shards(1)
         {
         }
 
@@ -103,6 +113,21 @@ class CommandLine :
                 	continue;
                 }
 
+                if ("--shard" == argument)
+                {
+                    std::string shard(*(++a));
+                    std::string::size_type pos = shard.find('/');
+                    if (std::string::npos == pos)
+                        throw DoUsage("Malformed shard '" + shard + "', expected 'INDEX/NUMBER'");
+
+                    shard_index = destringify<unsigned>(shard.substr(0, pos));
+                    number_of_shards = destringify<unsigned>(shard.substr(pos + 1));
+                    if ((0 == number_of_shards) || (shard_index >= number_of_shards))
+                        throw DoUsage("Invalid shard '" + shard + "', expected 0 <= INDEX < NUMBER");
+
+                    continue;
+                }
+
                 if ("--kinematics" == argument)
                 {
                     std::string name = std::string(*(++a));
@@ -208,6 +233,27 @@ class CommandLine :
         }
 };
 
+// an independent copy of the observable, its parameters and its kinematics for each thread
+struct EvaluationClone
+{
+    ObservablePtr observable;
+
+    Kinematics kinematics;
+
+    std::vector<Parameter> variations;
+
+    EvaluationClone(const ObservablePtr & original, const std::vector<Parameter> & original_variations) :
+        observable(original->clone(original->parameters().clone())),
+        kinematics(observable->kinematics())
+    {
+        Parameters parameters = observable->parameters();
+        for (const auto & variation : original_variations)
+        {
+            variations.push_back(parameters[variation.name()]);
+        }
+    }
+};
+
 void evaluate_with_sum_of_squares(const std::shared_ptr<EvaluationInput> evaluation_input)
 {
     // print headlines
@@ -243,66 +289,138 @@ void evaluate_with_sum_of_squares(const std::shared_ptr<EvaluationInput> evaluat
         evaluation_input->ranges.over(range);
     }
 
-    // iterate over all kinematical ranges
-    for (auto r = evaluation_input->ranges.begin() ; r != evaluation_input->ranges.end() ; ++r)
+    // collect this shard's contiguous share of all kinematical points
+    std::vector<std::vector<double>> points;
+    {
+        const std::size_t size = evaluation_input->ranges.size();
+        const std::size_t shard_begin = size * CommandLine::instance()->shard_index / CommandLine::instance()->number_of_shards;
+        const std::size_t shard_end = size * (CommandLine::instance()->shard_index + 1) / CommandLine::instance()->number_of_shards;
+
+        std::size_t index = 0;
+        for (auto r = evaluation_input->ranges.begin() ; r != evaluation_input->ranges.end() ; ++r, ++index)
+        {
+            if ((shard_begin <= index) && (index < shard_end))
+                points.push_back(*r);
+        }
+    }
+
+    // flatten the variations of all budgets
+    std::vector<Parameter> variations;
+    for (auto & budget : CommandLine::instance()->budgets)
+    {
+        variations.insert(variations.end(), std::get<1>(budget).begin(), std::get<1>(budget).end());
+    }
+
+    // per point, evaluate the central value, and the values for each variation raised and lowered
+    const unsigned evaluations_per_point = 1 + 2 * variations.size();
+    const unsigned n = points.size() * evaluations_per_point;
+    std::vector<double> values(n);
+
+    if (n > 0)
+    {
+        // one independent clone per thread, each working on a contiguous range of evaluations
+        const unsigned number_of_clones = std::max(1u, std::min(n, ThreadPool::instance()->number_of_threads()));
+        const unsigned chunk_size = (n + number_of_clones - 1) / number_of_clones;
+
+        std::vector<EvaluationClone> clones;
+        clones.reserve(number_of_clones);
+        for (unsigned k = 0 ; k < number_of_clones ; ++k)
+        {
+            clones.emplace_back(evaluation_input->observable, variations);
+        }
+
+        std::vector<std::exception_ptr> errors(number_of_clones);
+
+        ThreadPool::instance()->parallel_for(number_of_clones, [&] (unsigned k)
+        {
+            EvaluationClone & clone = clones[k];
+
+            try
+            {
+                for (unsigned i = k * chunk_size, i_end = std::min(n, (k + 1) * chunk_size) ; i < i_end ; ++i)
+                {
+                    const std::vector<double> & point = points[i / evaluations_per_point];
+                    const unsigned e = i % evaluations_per_point;
+
+                    if (!ranges_empty)
+                    {
+                        // set the kinematics
+                        // for every dimension
+                        for (std::size_t d = 0 ; d < point.size() ; ++d)
+                        {
+                            clone.kinematics.set(evaluation_input->kinematic_names[d], point[d]);
+                        }
+                    }
+
+                    if (0 == e)
+                    {
+                        values[i] = clone.observable->evaluate();
+                        continue;
+                    }
+
+                    Parameter & variation = clone.variations[(e - 1) / 2];
+                    double old_v = variation;
+
+                    // raise or lower value
+                    variation = (1 == e % 2) ? variation.max() : variation.min();
+
+                    values[i] = clone.observable->evaluate();
+
+                    variation = old_v;
+                }
+            }
+            catch (...)
+            {
+                errors[k] = std::current_exception();
+            }
+        });
+
+        // report the first failure as the serial evaluation would have
+        for (const auto & error : errors)
+        {
+            if (error)
+                std::rethrow_exception(error);
+        }
+    }
+
+    // print the results in the order of the kinematical points
+    for (std::size_t p = 0 ; p < points.size() ; ++p)
     {
         if (!ranges_empty)
         {
-            // set the kinematics
-            // for every dimension
-            for (std::size_t i = 0 ; i < (*r).size() ; ++i)
+            for (const auto & value : points[p])
             {
-                evaluation_input->kinematics->set(evaluation_input->kinematic_names[i], (*r)[i]);
-                std::cout << (*r)[i] << '\t';
+                std::cout << value << '\t';
             }
         }
 
-        double central = evaluation_input->observable->evaluate();
+        const double * point_values = values.data() + p * evaluations_per_point;
+        const double central = point_values[0];
 
         std::cout << central;
 
         // do the variations
         double delta_max = 0.0, delta_min = 0.0;
+        unsigned v = 0;
         for (auto & budget : CommandLine::instance()->budgets)
         {
             double budget_min = 0.0;
             double budget_max = 0.0;
 
-            std::vector<Parameter> variations = std::get<1>(budget);
-
-            for (auto & variation : variations)
+            for (unsigned j = 0 ; j < std::get<1>(budget).size() ; ++j, ++v)
             {
-                double old_v = variation;
-
-                // raise value
-                variation = variation.max();
-
-                double value = evaluation_input->observable->evaluate();
-
-                if (value > central)
-                {
-                    budget_max += power_of<2>(value - central);
-                }
-                else if (value < central)
-                {
-                    budget_min += power_of<2>(value - central);
-                }
-
-                // lower value
-                variation = variation.min();
-
-                value = evaluation_input->observable->evaluate();
-
-                if (value > central)
+                // raised and lowered value
+                for (const double value : { point_values[1 + 2 * v], point_values[2 + 2 * v] })
                 {
-                    budget_max += power_of<2>(value - central);
-                }
-                else if (value < central)
-                {
-                    budget_min += power_of<2>(value - central);
+                    if (value > central)
+                    {
+                        budget_max += power_of<2>(value - central);
+                    }
+                    else if (value < central)
+                    {
+                        budget_min += power_of<2>(value - central);
+                    }
                 }
-
-                variation = old_v;
             }
 
             delta_min += budget_min;
@@ -318,7 +436,6 @@ void evaluate_with_sum_of_squares(const std::shared_ptr<EvaluationInput> evaluat
     }
 }
 
-
 int
 main(int argc, char * argv[])
 {
@@ -339,6 +456,7 @@ main(int argc, char * argv[])
         std::cout << e.what() << std::endl;
         std::cout << "Usage: eos-evaluate" << std::endl;
         std::cout << "  [--precision PRECISION]" << std::endl;
+        std::cout << "  [--shard INDEX/NUMBER]" << std::endl;
         std::cout << "  [--vary PARAMETER]*" << std::endl;
         std::cout << "  [{--budget BUDGET[--parameter PARAMETER]*}*|{--parameter PARAMETER}*]" << std::endl;
         std::cout << "  [[--kinematics NAME VALUE|--range NAME MIN MAX POINTS]* --observable OBSERVABLE]*" << std::endl;
@@ -347,6 +465,9 @@ main(int argc, char * argv[])
         std::cout << "  eos-evaluate --budget \"SD\" --vary \"mu\" --vary \"mass::W\" \\" << std::endl;
         std::cout << "               --budget \"CKM\" --vary \"CKM::A\" --vary \"CKM::lambda\" \\" << std::endl;
         std::cout << "               --range s 14.18 22.86 12 --observable \"B->Kll::dBR/ds@LowRecoil;l=tau\"" << std::endl;
+        std::cout << std::endl;
+        std::cout << "With --shard INDEX/NUMBER, only the INDEX-th of NUMBER contiguous shares of each range is evaluated," << std::endl;
+        std::cout << "such that the concatenated data lines of all shards 0 <= INDEX < NUMBER match the unsharded output." << std::endl;
     }
     catch(Exception & e)
     {
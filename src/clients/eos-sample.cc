@@ -0,0 +1,359 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <config.h>
+#include <eos/constraint.hh>
+#include <eos/statistics/log-likelihood.hh>
+#include <eos/statistics/log-posterior.hh>
+#include <eos/statistics/log-prior.hh>
+#include <eos/statistics/markov-chain-sampler.hh>
+#include <eos/statistics/population-monte-carlo-sampler.hh>
+#include <eos/utils/destringify.hh>
+#include <eos/utils/instantiation_policy-impl.hh>
+#include <eos/utils/log.hh>
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+using namespace eos;
+
+class DoUsage
+{
+    private:
+        std::string _what;
+
+    public:
+        DoUsage(const std::string & what) :
+            _what(what)
+        {
+        }
+
+        const std::string & what() const
+        {
+            return _what;
+        }
+};
+
+class CommandLine :
+    public InstantiationPolicy<CommandLine, Singleton>
+{
+    public:
+        Parameters parameters;
+
+        Options global_options;
+
+        LogLikelihood likelihood;
+
+        std::shared_ptr<LogPosterior> posterior;
+
+        MarkovChainSampler::Config mcmc_config;
+
+        bool use_pmc;
+
+        unsigned pmc_groups_per_chain;
+
+        double pmc_degrees_of_freedom;
+
+        PopulationMonteCarloSampler::Config pmc_config;
+
+        CommandLine() :
+            parameters(Parameters::Defaults()),
+            likelihood(parameters),
+            mcmc_config(MarkovChainSampler::Config::Default()),
+            use_pmc(false),
+            pmc_groups_per_chain(4),
+            pmc_degrees_of_freedom(std::numeric_limits<double>::infinity()),
+            pmc_config(PopulationMonteCarloSampler::Config::Default())
+        {
+        }
+
+        void parse(int argc, char ** argv)
+        {
+            Log::instance()->set_program_name("eos-sample");
+
+            std::vector<std::tuple<LogPriorPtr, bool>> priors;
+
+            for (char ** a(argv + 1), ** a_end(argv + argc) ; a != a_end ; ++a)
+            {
+                std::string argument(*a);
+
+                if ("--global-option" == argument)
+                {
+                    std::string key(*(++a));
+                    std::string value(*(++a));
+                    global_options.set(key, value);
+
+                    continue;
+                }
+
+                if ("--parameter" == argument)
+                {
+                    std::string parameter_name(*(++a));
+                    double parameter_value = destringify<double>(*(++a));
+
+                    try
+                    {
+                        parameters[parameter_name] = parameter_value;
+                    }
+                    catch (UnknownParameterError & e)
+                    {
+                        throw DoUsage("Unknown parameter '" + parameter_name + "'");
+                    }
+
+                    continue;
+                }
+
+                if (("--scan" == argument) || ("--nuisance" == argument))
+                {
+                    std::string name(*(++a));
+                    double min = destringify<double>(*(++a));
+                    double max = destringify<double>(*(++a));
+
+                    LogPriorPtr prior = LogPrior::Flat(parameters, name, ParameterRange{ min, max });
+
+                    // optionally followed by the prior's specification
+                    if ((a + 1 != a_end) && (std::string("--prior") == *(a + 1)))
+                    {
+                        ++a;
+                        std::string prior_type(*(++a));
+
+                        if (("gaussian" == prior_type) || ("gauss" == prior_type))
+                        {
+                            double lower   = destringify<double>(*(++a));
+                            double central = destringify<double>(*(++a));
+                            double upper   = destringify<double>(*(++a));
+
+                            prior = LogPrior::Gauss(parameters, name, ParameterRange{ min, max }, lower, central, upper);
+                        }
+                        else if ("flat" != prior_type)
+                        {
+                            throw DoUsage("Unsupported prior type '" + prior_type + "'");
+                        }
+                    }
+
+                    priors.push_back(std::make_tuple(prior, "--nuisance" == argument));
+
+                    continue;
+                }
+
+                if ("--constraint" == argument)
+                {
+                    std::string constraint_name(*(++a));
+
+                    likelihood.add(Constraint::make(constraint_name, global_options));
+
+                    continue;
+                }
+
+                if ("--chains" == argument)
+                {
+                    mcmc_config.number_of_chains = destringify<unsigned>(*(++a));
+
+                    continue;
+                }
+
+                if ("--prerun-samples" == argument)
+                {
+                    mcmc_config.prerun_samples = destringify<unsigned>(*(++a));
+
+                    continue;
+                }
+
+                if ("--preruns" == argument)
+                {
+                    mcmc_config.preruns = destringify<unsigned>(*(++a));
+
+                    continue;
+                }
+
+                if ("--samples" == argument)
+                {
+                    mcmc_config.samples = destringify<unsigned>(*(++a));
+
+                    continue;
+                }
+
+                if ("--stride" == argument)
+                {
+                    mcmc_config.stride = destringify<unsigned>(*(++a));
+
+                    continue;
+                }
+
+                if ("--seed" == argument)
+                {
+                    mcmc_config.seed = destringify<unsigned long>(*(++a));
+                    pmc_config.seed = mcmc_config.seed;
+
+                    continue;
+                }
+
+                if ("--pmc" == argument)
+                {
+                    use_pmc = true;
+
+                    continue;
+                }
+
+                if ("--pmc-groups-per-chain" == argument)
+                {
+                    pmc_groups_per_chain = destringify<unsigned>(*(++a));
+
+                    continue;
+                }
+
+                if ("--pmc-degrees-of-freedom" == argument)
+                {
+                    pmc_degrees_of_freedom = destringify<double>(*(++a));
+
+                    continue;
+                }
+
+                if ("--pmc-step-samples" == argument)
+                {
+                    pmc_config.samples_per_step = destringify<unsigned>(*(++a));
+
+                    continue;
+                }
+
+                if ("--pmc-steps" == argument)
+                {
+                    pmc_config.steps = destringify<unsigned>(*(++a));
+
+                    continue;
+                }
+
+                if ("--pmc-final-samples" == argument)
+                {
+                    pmc_config.final_samples = destringify<unsigned>(*(++a));
+
+                    continue;
+                }
+
+                if ("--pmc-perplexity-threshold" == argument)
+                {
+                    pmc_config.perplexity_threshold = destringify<double>(*(++a));
+
+                    continue;
+                }
+
+                throw DoUsage("Unknown command line argument: " + argument);
+            }
+
+            if (priors.empty())
+                throw DoUsage("No parameters to scan");
+
+            posterior = std::make_shared<LogPosterior>(likelihood);
+            for (const auto & prior : priors)
+            {
+                if (! posterior->add(std::get<0>(prior), std::get<1>(prior)))
+                    throw DoUsage("Parameter scanned more than once");
+            }
+        }
+};
+
+void print_samples(const std::vector<double> & samples, const std::vector<double> & values, const std::string & value_name)
+{
+    const auto & descriptions = CommandLine::instance()->posterior->parameter_descriptions();
+    const unsigned dim = descriptions.size();
+
+    std::cout << "#";
+    for (const auto & d : descriptions)
+    {
+        std::cout << ' ' << d.parameter->name();
+    }
+    std::cout << ' ' << value_name << std::endl;
+
+    std::cout.precision(std::numeric_limits<double>::max_digits10);
+    for (unsigned i = 0 ; i < values.size() ; ++i)
+    {
+        for (unsigned j = 0 ; j < dim ; ++j)
+        {
+            std::cout << samples[i * dim + j] << '\t';
+        }
+        std::cout << values[i] << std::endl;
+    }
+}
+
+int
+main(int argc, char * argv[])
+{
+    try
+    {
+        CommandLine::instance()->parse(argc, argv);
+
+        std::cout << "# Generated by eos-sample (" EOS_GITHEAD ")" << std::endl;
+
+        auto posterior = CommandLine::instance()->posterior;
+
+        MarkovChainSampler mcmc(posterior->clone(), CommandLine::instance()->mcmc_config);
+        mcmc.run();
+
+        if (! CommandLine::instance()->use_pmc)
+        {
+            std::cout << "# Markov chain samples, acceptance rate " << mcmc.acceptance_rate() << std::endl;
+            print_samples(mcmc.samples(), mcmc.log_densities(), "log(posterior)");
+
+            return EXIT_SUCCESS;
+        }
+
+        auto proposal = PopulationMonteCarloSampler::initial_proposal(mcmc,
+                CommandLine::instance()->pmc_groups_per_chain, CommandLine::instance()->pmc_degrees_of_freedom);
+
+        PopulationMonteCarloSampler pmc(posterior->clone(), proposal, CommandLine::instance()->pmc_config);
+        pmc.run();
+
+        std::cout << "# Population Monte Carlo samples, proposal with " << pmc.proposal().size() << " components" << std::endl;
+        print_samples(pmc.samples(), pmc.log_weights(), "log(weight)");
+    }
+    catch(DoUsage & e)
+    {
+        std::cout << e.what() << std::endl;
+        std::cout << "Usage: eos-sample" << std::endl;
+        std::cout << "  [--global-option KEY VALUE]*" << std::endl;
+        std::cout << "  [--parameter PARAMETER VALUE]*" << std::endl;
+        std::cout << "  [{--scan|--nuisance} PARAMETER MIN MAX [--prior {flat|gaussian LOWER CENTRAL UPPER}]]+" << std::endl;
+        std::cout << "  [--constraint CONSTRAINT]*" << std::endl;
+        std::cout << "  [--chains N] [--prerun-samples N] [--preruns N] [--samples N] [--stride N] [--seed N]" << std::endl;
+        std::cout << "  [--pmc [--pmc-groups-per-chain N] [--pmc-degrees-of-freedom NU] [--pmc-step-samples N]" << std::endl;
+        std::cout << "         [--pmc-steps N] [--pmc-final-samples N] [--pmc-perplexity-threshold P]]" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Example:" << std::endl;
+        std::cout << "  eos-sample --global-option model CKMScan \\" << std::endl;
+        std::cout << "             --scan \"CKM::abs(V_cb)\" 38e-3 45e-3 \\" << std::endl;
+        std::cout << "             --nuisance \"B->D::alpha^f+_0@BSZ2015\" 0.0 1.0 \\" << std::endl;
+        std::cout << "             --constraint \"B^0->D^+e^-nu::BRs@Belle-2015A\" --chains 8 --pmc" << std::endl;
+    }
+    catch(Exception & e)
+    {
+        std::cerr << "Caught exception: '" << e.what() << "'" << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(...)
+    {
+        std::cerr << "Aborting after unknown exception" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}